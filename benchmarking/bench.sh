@@ -13,10 +13,27 @@ function Execute {
 
     export padll_workflows=$2
     for (( stage=1; stage<($1+1); stage++ )); do 
-        LD_PRELOAD=$padll_path/libpadll.so $padll_path/padll_scalability_bench $num_runs $2 $iops $1  > /dev/null 2>&1 &
+        LD_PRELOAD=$padll_path/libpadll.so $padll_path/padll_scalability_bench $num_runs $2 $iops open  > /dev/null 2>&1 &
     	# echo "$?"
     done
     echo ""; echo "Results are placed at /tmp/padll-scalability-results/."; echo ""; 
 }
 
+# $1 = number of operations
+# compares the per-call overhead (ns/op) of the interception backends in open and read microloops
+function Backends {
+    echo "Executing bench.sh (backends ; operations = $1)"
+    echo ""
+
+    export padll_workflows=1
+    for workload in open read; do
+        echo "--- $workload: native"
+        $padll_path/padll_scalability_bench 1 1 $1 $workload | grep "Lat" | tail -n 1
+        echo "--- $workload: LD_PRELOAD (libpadll.so)"
+        LD_PRELOAD=$padll_path/libpadll.so $padll_path/padll_scalability_bench 1 1 $1 $workload | grep "Lat" | tail -n 1
+        echo "--- $workload: binary rewriting (libpadll_loader.so)"
+        LD_PRELOAD=$padll_path/libpadll_loader.so $padll_path/padll_scalability_bench 1 1 $1 $workload | grep "Lat" | tail -n 1
+    done
+}
+
 "$@"
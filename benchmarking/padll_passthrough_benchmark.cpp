@@ -0,0 +1,122 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <chrono>
+#include <cstdio>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <padll/interface/passthrough/posix_passthrough.hpp>
+#include <padll/library_headers/libc_dispatch.hpp>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace padll::headers;
+using namespace padll::interface::passthrough;
+
+/**
+ * run_benchmark: submit a given number of read operations in a close-loop, and print the average
+ * cost of each operation.
+ * @param fd File descriptor to store the benchmark report.
+ * @param name Name of the dispatch method being measured.
+ * @param total_ops Number of operations to be submitted.
+ * @param operation Callable that submits a single read operation.
+ * @return Returns the average cost of each operation, in nanoseconds.
+ */
+template <typename Operation>
+double run_benchmark (FILE* fd,
+    const std::string& name,
+    const uint64_t& total_ops,
+    Operation&& operation)
+{
+    uint64_t errors = 0;
+    auto start = std::chrono::high_resolution_clock::now ();
+
+    // cycle of operation submission
+    for (uint64_t i = 0; i < total_ops; i++) {
+        errors += (operation () < 0) ? 1 : 0;
+    }
+
+    // calculate elapsed time
+    auto end = std::chrono::high_resolution_clock::now ();
+    double elapsed_ns
+        = static_cast<double> (std::chrono::duration_cast<std::chrono::nanoseconds> (end - start)
+                                   .count ());
+    double cost = elapsed_ns / static_cast<double> (total_ops);
+
+    std::fprintf (fd, "%-28s %10.2f ns/op (errors: %lu)\n", name.c_str (), cost, errors);
+
+    return cost;
+}
+
+int main (int argc, char** argv)
+{
+    uint64_t total_ops { 1000000 };
+    std::size_t operation_size { 64 };
+
+    // parse number of operations and operation size
+    if (argc > 1) {
+        total_ops = std::stoull (argv[1]);
+    }
+    if (argc > 2) {
+        operation_size = std::stoul (argv[2]);
+    }
+
+    // open the library directly, so the raw calls are never interposed by PADLL
+    void* lib_handle = ::dlopen (option_library_name.data (), RTLD_LAZY);
+    if (lib_handle == nullptr) {
+        std::fprintf (stderr, "Error: could not open %s\n", option_library_name.data ());
+        return 1;
+    }
+    auto raw_read = reinterpret_cast<libc_read_t> (::dlsym (lib_handle, "read"));
+
+    int fd = raw_read != nullptr ? ::open ("/dev/zero", O_RDONLY) : -1;
+    if (fd < 0) {
+        std::fprintf (stderr, "Error: could not open /dev/zero\n");
+        ::dlclose (lib_handle);
+        return 1;
+    }
+
+    std::vector<char> buffer (operation_size);
+    PosixPassthrough passthrough {};
+
+    std::fprintf (stdout,
+        "PADLL || Passthrough Benchmark: %lu read ops of %zu bytes\n",
+        total_ops,
+        operation_size);
+    std::fprintf (stdout, "------------------------------------------------------------------\n");
+
+    // raw libc: function pointer resolved once by the caller
+    double raw_cost = run_benchmark (stdout, "raw libc", total_ops, [&] () {
+        return raw_read (fd, buffer.data (), buffer.size ());
+    });
+
+    // previous passthrough path: symbol lookup on every call
+    run_benchmark (stdout, "dlsym per call", total_ops, [&] () {
+        return reinterpret_cast<libc_read_t> (::dlsym (lib_handle, "read")) (fd,
+            buffer.data (),
+            buffer.size ());
+    });
+
+    // dispatch table: atomic load and indirect call
+    run_benchmark (stdout, "libc dispatch table", total_ops, [&] () {
+        return libc_dispatch ().get<libc_read_t> (PosixCall::read) (fd,
+            buffer.data (),
+            buffer.size ());
+    });
+
+    // passthrough path (statistic collection as configured)
+    double passthrough_cost = run_benchmark (stdout, "passthrough", total_ops, [&] () {
+        return passthrough.passthrough_posix_read (fd, buffer.data (), buffer.size ());
+    });
+
+    std::fprintf (stdout, "------------------------------------------------------------------\n");
+    std::fprintf (stdout, "passthrough overhead: %.2f ns/op\n", passthrough_cost - raw_cost);
+
+    ::close (fd);
+    ::dlclose (lib_handle);
+
+    return 0;
+}
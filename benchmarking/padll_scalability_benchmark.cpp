@@ -22,10 +22,14 @@
 
 namespace fs = std::filesystem;
 
+// Size of the file read by the read workload (reads restart at its beginning once it is consumed).
+constexpr ssize_t kReadFileSize { 1024 * 1024 };
+
 // Struct to store temporary results of each worker thread.
 struct ThreadResults {
     double m_iops;
     double m_throughput;
+    double m_latency;
 };
 
 // Struct that stores the cumulative IOPS and throughput results (of all worker threads) of a given
@@ -34,6 +38,7 @@ struct MergedResults {
     uint32_t m_run_id;
     std::vector<double> m_iops;
     std::vector<double> m_throughput;
+    std::vector<double> m_latency;
     double m_cumulative_iops;
     double m_cumulative_throughput;
 };
@@ -44,20 +49,24 @@ struct SetupResults {
     double m_stdev_cumulative_iops;
     double m_avg_cumulative_throughput;
     double m_stdev_cumulative_throughput;
+    double m_avg_latency;
 };
 
 /**
  * stress_test: continuously submit operation to the PADLL data plane stage in a close-loop.
  * @param fd file descriptor to store logging messages
  * @param pathname sample file to be opened
+ * @param workload Operation to be submitted: "open" (open and close the file), or "read" (read
+ * operation_size bytes of the file, opened once).
  * @param operation_size Size of the operation to be generated and submitted.
  * @param total_ops Number of operations to be submitted in the execution.
  * @param print_report Boolean that defines if the execution report is to be printed to the stdout.
- * @return Returns a ThreadResults object containing the performance results, namely IOPS and
- * throughput, of the execution.
+ * @return Returns a ThreadResults object containing the performance results, namely IOPS,
+ * throughput, and latency per operation, of the execution.
  */
 ThreadResults stress_test (FILE* fd,
     const std::string& pathname,
+    const std::string& workload,
     const ssize_t& operation_size,
     const uint64_t& total_ops,
     bool shadow_op,
@@ -69,10 +78,22 @@ ThreadResults stress_test (FILE* fd,
         message = nullptr;
     }
 
+    // the read workload reuses the same file descriptor across operations
+    bool read_workload = (workload == "read");
+    int read_fd = read_workload ? ::open (pathname.c_str (), O_RDONLY) : -1;
+
     auto start = std::chrono::high_resolution_clock::now ();
 
     // cycle of syscall submission
     for (uint64_t i = 1; i <= total_ops; i++) {
+        if (read_workload) {
+            // restart at the beginning of the file once it is consumed
+            if (::read (read_fd, message, operation_size) < operation_size) {
+                ::lseek (read_fd, 0, SEEK_SET);
+            }
+            continue;
+        }
+
         auto fd = ::open (pathname.c_str (), O_CREAT, 0666);
 
         // if open operation is really being submitted to the file system, we should close the
@@ -85,6 +106,10 @@ ThreadResults stress_test (FILE* fd,
     auto end = std::chrono::high_resolution_clock::now ();
     std::chrono::duration<double> elapsed_seconds = end - start;
 
+    if (read_workload) {
+        ::close (read_fd);
+    }
+
     // free message buffer
     delete[] message;
 
@@ -94,6 +119,7 @@ ThreadResults stress_test (FILE* fd,
     perf_result.m_throughput = (static_cast<double> (total_ops)
                                    * (static_cast<double> (operation_size) / 1024 / 1024 / 1024))
         / elapsed_seconds.count ();
+    perf_result.m_latency = elapsed_seconds.count () * 1e9 / static_cast<double> (total_ops);
 
     // print to stdout the execution report
     if (print_report) {
@@ -108,6 +134,7 @@ ThreadResults stress_test (FILE* fd,
         std::fprintf (fd,
             "IOPS:\t%lf.3 KOps/s\n",
             static_cast<double> (total_ops) / elapsed_seconds.count () / 1000);
+        std::fprintf (fd, "Lat:\t%lf.3 ns/op\n", perf_result.m_latency);
         std::fprintf (fd, "------------------------------------------------------------------\n");
 
         std::fprintf (fd,
@@ -140,10 +167,26 @@ void record_stress_test_results (MergedResults* results, const ThreadResults& th
 {
     results->m_iops.emplace_back (threaded_results.m_iops);
     results->m_throughput.emplace_back (threaded_results.m_throughput);
+    results->m_latency.emplace_back (threaded_results.m_latency);
     results->m_cumulative_iops += threaded_results.m_iops;
     results->m_cumulative_throughput += threaded_results.m_throughput;
 }
 
+/**
+ * average: Calculate the average of a given sample.
+ * @param sample Object that contains all values of the sample.
+ * @return Returns the average value of the sample (0 if empty).
+ */
+double average (const std::vector<double>& sample)
+{
+    if (sample.empty ()) {
+        return 0;
+    }
+
+    return std::accumulate (sample.begin (), sample.end (), 0.0)
+        / static_cast<double> (sample.size ());
+}
+
 /**
  * stdout_results: Print performance report of the MergedResults object to a given file (including
  * stdout). If detailed flag is enabled, the method also logs the performance results (IOPS and
@@ -158,6 +201,7 @@ void log_results (FILE* fd, const MergedResults& merged_results, bool print_deta
     std::fprintf (fd, "Run: %u\n", merged_results.m_run_id);
     std::fprintf (fd, "\tIOPS (KOps/s):\t%.3lf\n", merged_results.m_cumulative_iops);
     std::fprintf (fd, "\tThr (GiB/s):\t%.3lf\n", merged_results.m_cumulative_throughput);
+    std::fprintf (fd, "\tLat (ns/op):\t%.3lf\n", average (merged_results.m_latency));
     std::fprintf (fd, "----------------------------------\n");
 
     // log performance results of each worker thread
@@ -165,9 +209,10 @@ void log_results (FILE* fd, const MergedResults& merged_results, bool print_deta
         for (unsigned int i = 0; i < merged_results.m_iops.size (); i++) {
             std::fprintf (fd, "Thread-%d:\t", i);
             std::fprintf (fd,
-                "%.3lf KOps/s; %.3lf GiB/s\n",
+                "%.3lf KOps/s; %.3lf GiB/s; %.3lf ns/op\n",
                 merged_results.m_iops[i],
-                merged_results.m_throughput[i]);
+                merged_results.m_throughput[i],
+                merged_results.m_latency[i]);
         }
     }
 
@@ -189,6 +234,7 @@ void log_final_results (FILE* fd, const SetupResults& results, const std::string
     std::fprintf (fd, "\tThr (GiB/s):\t%.3lf\n", results.m_avg_cumulative_throughput);
     std::fprintf (fd, "\tstdev-iops:\t%.3lf\n", results.m_stdev_cumulative_iops);
     std::fprintf (fd, "\tstdev-thr:\t%.3lf\n", results.m_stdev_cumulative_throughput);
+    std::fprintf (fd, "\tLat (ns/op):\t%.3lf\n", results.m_avg_latency);
     std::fprintf (fd, "----------------------------------\n");
 }
 
@@ -230,6 +276,7 @@ SetupResults merge_final_results (const std::vector<MergedResults>& results)
     double cumulative_throughput = 0;
     std::vector<double> iops_sample_stdev {};
     std::vector<double> throughput_sample_stdev {};
+    std::vector<double> latency_sample {};
 
     // compute cumulative IOPS and throughput
     for (int i = 0; i < total_runs; i++) {
@@ -237,6 +284,7 @@ SetupResults merge_final_results (const std::vector<MergedResults>& results)
         cumulative_throughput += results[i].m_cumulative_throughput;
         iops_sample_stdev.push_back (results[i].m_cumulative_iops);
         throughput_sample_stdev.push_back (results[i].m_cumulative_throughput);
+        latency_sample.push_back (average (results[i].m_latency));
     }
 
     // compute average and standard deviation values and store them in the SetupResults object
@@ -244,6 +292,7 @@ SetupResults merge_final_results (const std::vector<MergedResults>& results)
     final_results.m_avg_cumulative_throughput = (cumulative_throughput / total_runs);
     final_results.m_stdev_cumulative_iops = compute_stdev (iops_sample_stdev);
     final_results.m_stdev_cumulative_throughput = compute_stdev (throughput_sample_stdev);
+    final_results.m_avg_latency = average (latency_sample);
 
     return final_results;
 }
@@ -254,6 +303,7 @@ SetupResults merge_final_results (const std::vector<MergedResults>& results)
  * stress_test call and stores the results in a ThreadResults shared object.
  * @param fd Pointer to a FILE object to write the performance report.
  * @param run_id Unique identifier of the current run.
+ * @param workload Operation to be submitted ("open" or "read").
  * @param total_operations Total number of operations to be performed by each worker thread.
  * @param operation_size Size of each operation.
  * @return Returns a MergedResults object with the results of the stress test.
@@ -262,6 +312,7 @@ MergedResults execute_run (FILE* fd,
     uint32_t run_id,
     uint32_t num_threads,
     const std::string& pathname,
+    const std::string& workload,
     uint64_t total_ops,
     ssize_t op_size,
     bool shadow_op)
@@ -271,6 +322,7 @@ MergedResults execute_run (FILE* fd,
     results.m_run_id = run_id + 1;
     results.m_iops = {};
     results.m_throughput = {};
+    results.m_latency = {};
     results.m_cumulative_iops = { 0 };
     results.m_cumulative_throughput = { 0 };
 
@@ -280,13 +332,14 @@ MergedResults execute_run (FILE* fd,
     // lambda function for each thread to execute
     auto func = ([&lock, &results] (FILE* fd,
                      const std::string& pathname,
+                     const std::string& workload,
                      const ssize_t& op_size,
                      const long& total_ops,
                      bool shadow_op,
                      bool print) {
         // execute stress test
         ThreadResults thread_results
-            = stress_test (fd, pathname, op_size, total_ops, shadow_op, print);
+            = stress_test (fd, pathname, workload, op_size, total_ops, shadow_op, print);
         {
             std::unique_lock<std::mutex> unique_lock (lock);
             record_stress_test_results (&results, thread_results);
@@ -295,7 +348,8 @@ MergedResults execute_run (FILE* fd,
 
     // spawn worker threads
     for (unsigned int i = 1; i <= num_threads; i++) {
-        workers[i - 1] = std::thread (func, fd, pathname, op_size, total_ops, shadow_op, false);
+        workers[i - 1]
+            = std::thread (func, fd, pathname, workload, op_size, total_ops, shadow_op, false);
         std::cerr << "Starting worker thread #" << i << " (" << workers[i - 1].get_id () << ") ..."
                   << std::endl;
     }
@@ -383,7 +437,10 @@ void print_server_info (FILE* fd)
  *    - (paio) option_default_channel_differentiation_operation_context = false
  * - Command:
  *  export padll_workflows=<total-workflows>; ./padll_scalability_bench <runs> <threads>
- * <operations>
+ * <operations> [<workload: open (default) or read> <operation-size>]
+ * - Interception backends (per-call overhead of open and read microloops):
+ *  LD_PRELOAD=libpadll.so ./padll_scalability_bench 1 1 1000000 read 0
+ *  LD_PRELOAD=libpadll_loader.so ./padll_scalability_bench 1 1 1000000 read 0
  */
 int main (int argc, char** argv)
 {
@@ -394,15 +451,22 @@ int main (int argc, char** argv)
     if (argc < 4) {
         std::fprintf (stdout, "Error: missing arguments (runs -- threads -- ops) \n");
         return 1;
-    } else {
-        std::fprintf (stdout,
-            "Executing %s: %s runs -- %s threads -- %s ops\n",
-            argv[0],
-            argv[1],
-            argv[2],
-            argv[3]);
     }
 
+    std::string workload { (argc > 4) ? argv[4] : "open" };
+    if (workload != "open" && workload != "read") {
+        std::fprintf (stdout, "Error: unknown workload (%s) \n", workload.c_str ());
+        return 1;
+    }
+
+    std::fprintf (stdout,
+        "Executing %s: %s runs -- %s threads -- %s ops -- %s\n",
+        argv[0],
+        argv[1],
+        argv[2],
+        argv[3],
+        workload.c_str ());
+
     uint32_t wait_time { 5 };
     bool store_run_perf_report { false };
     bool store_perf_report { true };
@@ -416,9 +480,8 @@ int main (int argc, char** argv)
     uint32_t num_runs { static_cast<uint32_t> (std::stoul (argv[1])) };
     uint32_t num_threads { static_cast<uint32_t> (std::stoul (argv[2])) };
     long num_ops { std::stol (argv[3]) };
-    long operation_size { 0 };
+    long operation_size { (argc > 5) ? std::stol (argv[5]) : 0 };
     bool shadow_op { false };
-    // int num_stages { std::stoi (argv[4]) };
 
     // create directory to store performance results
     if (store_perf_report && !result_path.empty ()) {
@@ -437,11 +500,24 @@ int main (int argc, char** argv)
         result_path = path.string ();
     }
 
+    // prepare the file consumed by the read workload
+    if (workload == "read") {
+        std::vector<char> content (kReadFileSize, 'r');
+        int fd = ::open (syscall_pathname.c_str (), O_CREAT | O_TRUNC | O_WRONLY, 0666);
+        if (fd == -1 || ::write (fd, content.data (), content.size ()) != kReadFileSize) {
+            std::cerr << "Error while preparing " << syscall_pathname << ": "
+                      << std::strerror (errno) << "\n";
+            return 1;
+        }
+        ::close (fd);
+    }
+
     // File name
     fs::path filename;
     if (!result_path.empty ()) {
-        filename = (result_path + "scale-perf-results-" + std::to_string (num_threads) + "-"
-            + std::to_string (operation_size) + "-" + std::to_string (::getpid ()));
+        filename = (result_path + "scale-perf-results-" + workload + "-"
+            + std::to_string (num_threads) + "-" + std::to_string (operation_size) + "-"
+            + std::to_string (::getpid ()));
     }
 
     for (uint32_t run = 0; run < static_cast<uint32_t> (num_runs); run++) {
@@ -467,6 +543,7 @@ int main (int argc, char** argv)
             run,
             static_cast<uint32_t> (num_threads),
             syscall_pathname,
+            workload,
             static_cast<uint64_t> (num_ops),
             static_cast<uint64_t> (operation_size),
             shadow_op);
@@ -22,11 +22,36 @@ struct PosixDataCalls {
 #endif
     bool padll_intercept_mmap = false;
     bool padll_intercept_munmap = false;
+    bool padll_intercept_readv = false;
+    bool padll_intercept_writev = false;
+    bool padll_intercept_preadv = false;
+    bool padll_intercept_pwritev = false;
+    bool padll_intercept_preadv2 = false;
+    bool padll_intercept_pwritev2 = false;
+    bool padll_intercept_fread = false;
+    bool padll_intercept_fwrite = false;
+    bool padll_intercept_fgets = false;
+    bool padll_intercept_fputs = false;
+    bool padll_intercept_fprintf = false;
+    bool padll_intercept_vfprintf = false;
+    bool padll_intercept_fflush = false;
+    bool padll_intercept_copy_file_range = false;
+    bool padll_intercept_sendfile = false;
+    bool padll_intercept_sendfile64 = false;
+    bool padll_intercept_splice = false;
+    bool padll_intercept_io_uring_enter = false;
+    bool padll_intercept_aio_read = false;
+    bool padll_intercept_aio_write = false;
+    bool padll_intercept_aio_read64 = false;
+    bool padll_intercept_aio_write64 = false;
+    bool padll_intercept_lio_listio = false;
+    bool padll_intercept_lio_listio64 = false;
 };
 
 /**
  * PosixDirectoryCalls struct.
- * Defines which directory-based POSIX operations (mkdir, mknod, ...) should be handled by PADLL.
+ * Defines which directory-based POSIX operations (mkdir, mknod, opendir, readdir, ...) should be
+ * handled by PADLL.
  * Operations set to false will follow the passthrough workflow.
  */
 struct PosixDirectoryCalls {
@@ -35,6 +60,12 @@ struct PosixDirectoryCalls {
     bool padll_intercept_rmdir = false;
     bool padll_intercept_mknod = false;
     bool padll_intercept_mknodat = false;
+    bool padll_intercept_opendir = false;
+    bool padll_intercept_fdopendir = false;
+    bool padll_intercept_readdir = false;
+    bool padll_intercept_readdir64 = false;
+    bool padll_intercept_getdents64 = false;
+    bool padll_intercept_closedir = false;
 };
 
 /**
@@ -81,6 +112,29 @@ struct PosixMetadataCalls {
     bool padll_intercept_fopen = false;
     bool padll_intercept_fopen64 = false;
     bool padll_intercept_fclose = false;
+    bool padll_intercept_stat = false;
+    bool padll_intercept_lstat = false;
+    bool padll_intercept_fstat = false;
+    bool padll_intercept_fstatat = false;
+    bool padll_intercept_statx = false;
+    bool padll_intercept_access = false;
+    bool padll_intercept_faccessat = false;
+    bool padll_intercept_stat64 = false;
+    bool padll_intercept_lstat64 = false;
+    bool padll_intercept_fstat64 = false;
+    bool padll_intercept_fstatat64 = false;
+    bool padll_intercept_fsync = false;
+    bool padll_intercept_fdatasync = false;
+    bool padll_intercept_sync_file_range = false;
+    bool padll_intercept_syncfs = false;
+    bool padll_intercept_truncate = false;
+    bool padll_intercept_ftruncate = false;
+    bool padll_intercept_fallocate = false;
+    bool padll_intercept_posix_fallocate = false;
+    bool padll_intercept_posix_fadvise = false;
+    bool padll_intercept_io_uring_setup = false;
+    bool padll_intercept_aio_fsync = false;
+    bool padll_intercept_aio_fsync64 = false;
 };
 
 /**
@@ -0,0 +1,297 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_CONFIGURATION_HPP
+#define PADLL_CONFIGURATION_HPP
+
+#include <array>
+#include <cstdint>
+#include <padll/library_headers/libc_enums.hpp>
+#include <padll/options/options.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace padll::headers;
+using namespace padll::options;
+
+namespace padll::configurations {
+
+/**
+ * InterceptMask struct.
+ * Bitmask of the POSIX calls (indexed by PosixCall) to be handled by PADLL. Calls not set follow
+ * the passthrough workflow.
+ */
+struct alignas(64) InterceptMask {
+    static constexpr std::size_t kWords { (posix_call_names.size () + 63) / 64 };
+    std::array<uint64_t, kWords> m_words {};
+
+    /**
+     * test: check if a given call is set in the bitmask.
+     * @param call PosixCall to be verified.
+     * @return Returns true if the call is to be handled by PADLL.
+     */
+    [[nodiscard]] constexpr bool test (const PosixCall& call) const
+    {
+        auto index = static_cast<std::size_t> (call);
+        return (this->m_words[index >> 6] >> (index & 63)) & 1;
+    }
+
+    /**
+     * set: set (or clear) a given call in the bitmask.
+     * @param call PosixCall to be set.
+     * @param value Value of the call's bit.
+     */
+    constexpr void set (const PosixCall& call, const bool& value)
+    {
+        auto index = static_cast<std::size_t> (call);
+        auto bit = uint64_t { 1 } << (index & 63);
+        this->m_words[index >> 6] = value ? (this->m_words[index >> 6] | bit)
+                                          : (this->m_words[index >> 6] & ~bit);
+    }
+};
+
+/**
+ * PadllConfiguration class.
+ * Immutable snapshot of PADLL's runtime configuration. Defaults are the compile-time ones (the
+ * PosixDataCalls, PosixMetadataCalls, ... structs of libc_calls.hpp and the options.hpp
+ * constants), which can be overridden by a configuration file, whose path is given by the
+ * option_configuration_file_env environment variable. The file is parsed once, at library load;
+ * it consists of "key = value" lines, with '#' starting a comment:
+ *  - intercept / passthrough: comma-separated list of calls (or "all") to be handled by PADLL or
+ * to follow the passthrough workflow; entries are applied in order;
+ *  - mount_point_differentiation, statistic_collection, latency_collection: true or false (other
+ * values are rejected);
+ *  - remote_mount_point, log_path, statistics_export_path: paths;
+ *  - mount_point: path prefix of an additional mount point, followed by an optional
+ * comma-separated list of its workflows (e.g., "/mnt/lustre 1000,2000"); it can be repeated;
+ *  - hsk_rules_file, dif_rules_file, enf_rules_file: rules files of the data plane stage (only
+ * used without a controller);
+ *  - statistics_export_interval, workflow_selection, credits, space_weight, io_uring_hold_back,
+ * seccomp_interception, binary_rewriting, mmap_sampling_interval, stage_name: same format as the
+ * respective environment variables, which take precedence over the file.
+ */
+class alignas(64) PadllConfiguration {
+
+private:
+    InterceptMask m_intercept_mask {};
+    bool m_mount_point_differentiation { option_mount_point_differentiation_enabled };
+    bool m_statistic_collection { option_default_statistic_collection };
+    bool m_latency_collection { option_default_latency_collection };
+    std::string m_remote_mount_point { option_default_remote_mount_point };
+    std::string m_log_path { option_default_log_path };
+    std::string m_statistics_export_path { option_statistics_export_path };
+    std::string m_statistics_export_interval {};
+    std::string m_workflow_selection {};
+    std::string m_credits {};
+    std::string m_space_weight {};
+    std::string m_io_uring_hold_back {};
+    std::string m_seccomp_interception {};
+    std::string m_binary_rewriting {};
+    std::string m_mmap_sampling_interval {};
+    std::string m_stage_name {};
+    std::string m_hsk_rules_file { option_default_hsk_rules_file ().string () };
+    std::string m_dif_rules_file { option_default_dif_rules_file ().string () };
+    std::string m_enf_rules_file { option_default_enf_rules_file ().string () };
+    std::vector<std::pair<std::string, std::vector<uint32_t>>> m_mount_points {};
+    std::string m_configuration_path {};
+
+    /**
+     * set_default_intercept_mask: initialize m_intercept_mask with the compile-time configuration
+     * of libc_calls.hpp.
+     */
+    void set_default_intercept_mask ();
+
+    /**
+     * parse_calls: set (or clear) a comma-separated list of calls in m_intercept_mask.
+     * @param calls List of call names, or "all".
+     * @param value Value to be set.
+     * @return Returns false if any of the calls is unknown.
+     */
+    bool parse_calls (const std::string& calls, const bool& value);
+
+    /**
+     * parse_mount_point: parse a "<path> [workflow,...]" mount point entry.
+     * @param value Mount point entry.
+     * @return Returns false if the entry is malformed.
+     */
+    bool parse_mount_point (const std::string& value);
+
+    /**
+     * parse_line: parse a "key = value" line of the configuration file.
+     * @param line Line to be parsed.
+     * @return Returns false if the line is malformed or the key is unknown.
+     */
+    bool parse_line (const std::string& line);
+
+    /**
+     * parse_file: parse a configuration file. Reads are issued through the libc dispatch table,
+     * since the file is parsed before PADLL's interposed calls are ready.
+     * @param path Path to the configuration file.
+     * @return Returns false if the file could not be read or has invalid lines.
+     */
+    bool parse_file (const std::string& path);
+
+public:
+    /**
+     * PadllConfiguration default constructor. Uses the compile-time configuration.
+     */
+    PadllConfiguration ();
+
+    /**
+     * PadllConfiguration parameterized constructor. Overrides the compile-time configuration with
+     * the contents of a configuration file (invalid entries are reported to stderr and ignored).
+     * @param path Path to the configuration file.
+     */
+    explicit PadllConfiguration (const std::string& path);
+
+    /**
+     * PadllConfiguration default destructor.
+     */
+    ~PadllConfiguration ();
+
+    /**
+     * get_intercept_mask: get the bitmask of the calls to be handled by PADLL.
+     */
+    [[nodiscard]] const InterceptMask& get_intercept_mask () const;
+
+    /**
+     * is_intercepted: check if a given call is to be handled by PADLL.
+     */
+    [[nodiscard]] bool is_intercepted (const PosixCall& call) const;
+
+    /**
+     * is_mount_point_differentiation_enabled: check if mount point differentiation is enabled.
+     */
+    [[nodiscard]] bool is_mount_point_differentiation_enabled () const;
+
+    /**
+     * is_statistic_collection_enabled: check if statistic collection is enabled by default.
+     */
+    [[nodiscard]] bool is_statistic_collection_enabled () const;
+
+    /**
+     * is_latency_collection_enabled: check if latency histograms are to be collected.
+     */
+    [[nodiscard]] bool is_latency_collection_enabled () const;
+
+    /**
+     * get_remote_mount_point: get the path of the remote mount point.
+     */
+    [[nodiscard]] const std::string& get_remote_mount_point () const;
+
+    /**
+     * get_log_path: get the path of the log file.
+     */
+    [[nodiscard]] const std::string& get_log_path () const;
+
+    /**
+     * get_statistics_export_path: get the path prefix of the live statistics region.
+     */
+    [[nodiscard]] const std::string& get_statistics_export_path () const;
+
+    /**
+     * get_statistics_export_interval: get the (unparsed) live statistics export interval, or an
+     * empty string if not configured.
+     */
+    [[nodiscard]] const std::string& get_statistics_export_interval () const;
+
+    /**
+     * get_workflow_selection: get the (unparsed) workflow selection strategy, or an empty string
+     * if not configured.
+     */
+    [[nodiscard]] const std::string& get_workflow_selection () const;
+
+    /**
+     * get_credits: get the (unparsed) per-workflow credit sizes, or an empty string if not
+     * configured.
+     */
+    [[nodiscard]] const std::string& get_credits () const;
+
+    /**
+     * get_space_weight: get the (unparsed) space weight of space management calls, or an empty
+     * string if not configured.
+     */
+    [[nodiscard]] const std::string& get_space_weight () const;
+
+    /**
+     * get_io_uring_hold_back: get the (unparsed) io_uring hold back setting, or an empty string if
+     * not configured.
+     */
+    [[nodiscard]] const std::string& get_io_uring_hold_back () const;
+
+    /**
+     * get_seccomp_interception: get the (unparsed) seccomp interception setting, or an empty
+     * string if not configured.
+     */
+    [[nodiscard]] const std::string& get_seccomp_interception () const;
+
+    /**
+     * get_binary_rewriting: get the (unparsed) binary rewriting setting, or an empty string if not
+     * configured.
+     */
+    [[nodiscard]] const std::string& get_binary_rewriting () const;
+
+    /**
+     * get_mmap_sampling_interval: get the (unparsed) mmap sampling interval, or an empty string if
+     * not configured.
+     */
+    [[nodiscard]] const std::string& get_mmap_sampling_interval () const;
+
+    /**
+     * get_stage_name: get the name of the data plane stage, or an empty string if not configured.
+     */
+    [[nodiscard]] const std::string& get_stage_name () const;
+
+    /**
+     * get_hsk_rules_file: get the path of the housekeeping rules file of the data plane stage.
+     */
+    [[nodiscard]] const std::string& get_hsk_rules_file () const;
+
+    /**
+     * get_dif_rules_file: get the path of the differentiation rules file of the data plane stage.
+     */
+    [[nodiscard]] const std::string& get_dif_rules_file () const;
+
+    /**
+     * get_enf_rules_file: get the path of the enforcement rules file of the data plane stage.
+     */
+    [[nodiscard]] const std::string& get_enf_rules_file () const;
+
+    /**
+     * get_mount_points: get the additional mount points (path prefix and workflows) to be
+     * registered. Mount points without workflows use the default remote workflows.
+     */
+    [[nodiscard]] const std::vector<std::pair<std::string, std::vector<uint32_t>>>&
+    get_mount_points () const;
+
+    /**
+     * get_value: get the value of a setting from an environment variable, falling back to the
+     * configured value if the variable is not set.
+     * @param env Name of the environment variable.
+     * @param configured Value of the configuration.
+     * @return Returns a pointer to the value, or nullptr if neither is set.
+     */
+    [[nodiscard]] static const char* get_value (const std::string_view& env,
+        const std::string& configured);
+
+    /**
+     * to_string: returns in string-based format the configuration snapshot.
+     */
+    [[nodiscard]] std::string to_string () const;
+};
+
+/**
+ * padll_configuration: get the configuration snapshot of the process. The snapshot is created on
+ * first use (at library load) from the file in option_configuration_file_env, and is immutable
+ * afterwards.
+ * @return Returns a const reference to the configuration snapshot.
+ */
+const PadllConfiguration& padll_configuration ();
+
+} // namespace padll::configurations
+
+#endif // PADLL_CONFIGURATION_HPP
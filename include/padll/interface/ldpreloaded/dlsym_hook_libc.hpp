@@ -7,6 +7,7 @@
 #define PADLL_DLSYM_HOOK_LIBC_HPP
 
 #include <mutex>
+#include <padll/library_headers/libc_dispatch.hpp>
 #include <padll/library_headers/libc_headers.hpp>
 #include <padll/options/options.hpp>
 #include <padll/utils/log.hpp>
@@ -20,7 +21,9 @@ namespace padll::interface::ldpreloaded {
 
 /**
  * DlsymHookLibc class.
- * This class implements all libc hooks and logic for LD_PRELOAD libc calls.
+ * This class implements all libc hooks and logic for LD_PRELOAD libc calls. Function pointers are
+ * resolved through the LibcDispatch table, which is shared with PosixPassthrough, so each symbol is
+ * looked up (dlsym) only once per process.
  */
 class DlsymHookLibc {
 
@@ -126,17 +129,9 @@ public:
      */
     void hook_posix_read (libc_read_t& read_ptr)
     {
-        // validate function and library handle pointers
-        if (!read_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? read_ptr = (libc_read_t)dlsym (this->m_lib_handle, "read")
-                : read_ptr = (libc_read_t)dlsym (RTLD_NEXT, "read");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!read_ptr) {
-            read_ptr = (libc_read_t)dlsym (this->m_lib_handle, "read");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!read_ptr) {
+            read_ptr = libc_dispatch ().get<libc_read_t> (PosixCall::read);
         }
     }
 
@@ -146,17 +141,9 @@ public:
      */
     void hook_posix_write (libc_write_t& write_ptr)
     {
-        // validate function and library handle pointers
-        if (!write_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? write_ptr = (libc_write_t)dlsym (this->m_lib_handle, "write")
-                : write_ptr = (libc_write_t)dlsym (RTLD_NEXT, "write");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!write_ptr) {
-            write_ptr = (libc_write_t)dlsym (this->m_lib_handle, "write");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!write_ptr) {
+            write_ptr = libc_dispatch ().get<libc_write_t> (PosixCall::write);
         }
     }
 
@@ -166,17 +153,9 @@ public:
      */
     void hook_posix_pread (libc_pread_t& pread_ptr)
     {
-        // validate function and library handle pointers
-        if (!pread_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? pread_ptr = (libc_pread_t)dlsym (this->m_lib_handle, "pread")
-                : pread_ptr = (libc_pread_t)dlsym (RTLD_NEXT, "pread");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!pread_ptr) {
-            pread_ptr = (libc_pread_t)dlsym (this->m_lib_handle, "pread");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!pread_ptr) {
+            pread_ptr = libc_dispatch ().get<libc_pread_t> (PosixCall::pread);
         }
     }
 
@@ -186,17 +165,9 @@ public:
      */
     void hook_posix_pwrite (libc_pwrite_t& pwrite_ptr)
     {
-        // validate function and library handle pointers
-        if (!pwrite_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? pwrite_ptr = (libc_pwrite_t)dlsym (this->m_lib_handle, "pwrite")
-                : pwrite_ptr = (libc_pwrite_t)dlsym (RTLD_NEXT, "pwrite");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!pwrite_ptr) {
-            pwrite_ptr = (libc_pwrite_t)dlsym (this->m_lib_handle, "pwrite");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!pwrite_ptr) {
+            pwrite_ptr = libc_dispatch ().get<libc_pwrite_t> (PosixCall::pwrite);
         }
     }
 
@@ -207,17 +178,9 @@ public:
 #if defined(__USE_LARGEFILE64)
     void hook_posix_pread64 (libc_pread64_t& pread64_ptr)
     {
-        // validate function and library handle pointers
-        if (!pread64_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? pread64_ptr = (libc_pread64_t)dlsym (this->m_lib_handle, "pread64")
-                : pread64_ptr = (libc_pread64_t)dlsym (RTLD_NEXT, "pread64");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!pread64_ptr) {
-            pread64_ptr = (libc_pread64_t)dlsym (this->m_lib_handle, "pread64");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!pread64_ptr) {
+            pread64_ptr = libc_dispatch ().get<libc_pread64_t> (PosixCall::pread64);
         }
     }
 #endif
@@ -229,17 +192,9 @@ public:
 #if defined(__USE_LARGEFILE64)
     void hook_posix_pwrite64 (libc_pwrite64_t& pwrite64_ptr)
     {
-        // validate function and library handle pointers
-        if (!pwrite64_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? pwrite64_ptr = (libc_pwrite64_t)dlsym (this->m_lib_handle, "pwrite64")
-                : pwrite64_ptr = (libc_pwrite64_t)dlsym (RTLD_NEXT, "pwrite64");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!pwrite64_ptr) {
-            pwrite64_ptr = (libc_pwrite64_t)dlsym (this->m_lib_handle, "pwrite64");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!pwrite64_ptr) {
+            pwrite64_ptr = libc_dispatch ().get<libc_pwrite64_t> (PosixCall::pwrite64);
         }
     }
 #endif
@@ -250,17 +205,9 @@ public:
      */
     void hook_posix_mmap (libc_mmap_t& mmap_ptr)
     {
-        // validate function and library handle pointers
-        if (!mmap_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? mmap_ptr = (libc_mmap_t)dlsym (this->m_lib_handle, "mmap")
-                : mmap_ptr = (libc_mmap_t)dlsym (RTLD_NEXT, "mmap");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!mmap_ptr) {
-            mmap_ptr = (libc_mmap_t)dlsym (this->m_lib_handle, "mmap");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!mmap_ptr) {
+            mmap_ptr = libc_dispatch ().get<libc_mmap_t> (PosixCall::mmap);
         }
     }
 
@@ -270,17 +217,288 @@ public:
      */
     void hook_posix_munmap (libc_munmap_t& munmap_ptr)
     {
-        // validate function and library handle pointers
-        if (!munmap_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? munmap_ptr = (libc_munmap_t)dlsym (this->m_lib_handle, "munmap")
-                : munmap_ptr = (libc_munmap_t)dlsym (RTLD_NEXT, "munmap");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!munmap_ptr) {
+            munmap_ptr = libc_dispatch ().get<libc_munmap_t> (PosixCall::munmap);
+        }
+    }
+
+    /**
+     * hook_posix_readv: function to hook libc's readv function pointer.
+     * @param readv_ptr function pointer with the same header as libc's readv.
+     */
+    void hook_posix_readv (libc_readv_t& readv_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!readv_ptr) {
+            readv_ptr = libc_dispatch ().get<libc_readv_t> (PosixCall::readv);
+        }
+    }
+
+    /**
+     * hook_posix_writev: function to hook libc's writev function pointer.
+     * @param writev_ptr function pointer with the same header as libc's writev.
+     */
+    void hook_posix_writev (libc_writev_t& writev_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!writev_ptr) {
+            writev_ptr = libc_dispatch ().get<libc_writev_t> (PosixCall::writev);
+        }
+    }
+
+    /**
+     * hook_posix_preadv: function to hook libc's preadv function pointer.
+     * @param preadv_ptr function pointer with the same header as libc's preadv.
+     */
+    void hook_posix_preadv (libc_preadv_t& preadv_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!preadv_ptr) {
+            preadv_ptr = libc_dispatch ().get<libc_preadv_t> (PosixCall::preadv);
+        }
+    }
+
+    /**
+     * hook_posix_pwritev: function to hook libc's pwritev function pointer.
+     * @param pwritev_ptr function pointer with the same header as libc's pwritev.
+     */
+    void hook_posix_pwritev (libc_pwritev_t& pwritev_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!pwritev_ptr) {
+            pwritev_ptr = libc_dispatch ().get<libc_pwritev_t> (PosixCall::pwritev);
+        }
+    }
+
+    /**
+     * hook_posix_preadv2: function to hook libc's preadv2 function pointer.
+     * @param preadv2_ptr function pointer with the same header as libc's preadv2.
+     */
+    void hook_posix_preadv2 (libc_preadv2_t& preadv2_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!preadv2_ptr) {
+            preadv2_ptr = libc_dispatch ().get<libc_preadv2_t> (PosixCall::preadv2);
+        }
+    }
+
+    /**
+     * hook_posix_pwritev2: function to hook libc's pwritev2 function pointer.
+     * @param pwritev2_ptr function pointer with the same header as libc's pwritev2.
+     */
+    void hook_posix_pwritev2 (libc_pwritev2_t& pwritev2_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!pwritev2_ptr) {
+            pwritev2_ptr = libc_dispatch ().get<libc_pwritev2_t> (PosixCall::pwritev2);
+        }
+    }
+
+    /**
+     * hook_posix_fread: function to hook libc's fread function pointer.
+     * @param fread_ptr function pointer with the same header as libc's fread.
+     */
+    void hook_posix_fread (libc_fread_t& fread_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fread_ptr) {
+            fread_ptr = libc_dispatch ().get<libc_fread_t> (PosixCall::fread);
+        }
+    }
+
+    /**
+     * hook_posix_fwrite: function to hook libc's fwrite function pointer.
+     * @param fwrite_ptr function pointer with the same header as libc's fwrite.
+     */
+    void hook_posix_fwrite (libc_fwrite_t& fwrite_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fwrite_ptr) {
+            fwrite_ptr = libc_dispatch ().get<libc_fwrite_t> (PosixCall::fwrite);
+        }
+    }
+
+    /**
+     * hook_posix_fgets: function to hook libc's fgets function pointer.
+     * @param fgets_ptr function pointer with the same header as libc's fgets.
+     */
+    void hook_posix_fgets (libc_fgets_t& fgets_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fgets_ptr) {
+            fgets_ptr = libc_dispatch ().get<libc_fgets_t> (PosixCall::fgets);
+        }
+    }
+
+    /**
+     * hook_posix_fputs: function to hook libc's fputs function pointer.
+     * @param fputs_ptr function pointer with the same header as libc's fputs.
+     */
+    void hook_posix_fputs (libc_fputs_t& fputs_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fputs_ptr) {
+            fputs_ptr = libc_dispatch ().get<libc_fputs_t> (PosixCall::fputs);
+        }
+    }
+
+    /**
+     * hook_posix_vfprintf: function to hook libc's vfprintf function pointer.
+     * @param vfprintf_ptr function pointer with the same header as libc's vfprintf.
+     */
+    void hook_posix_vfprintf (libc_vfprintf_t& vfprintf_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!vfprintf_ptr) {
+            vfprintf_ptr = libc_dispatch ().get<libc_vfprintf_t> (PosixCall::vfprintf);
+        }
+    }
+
+    /**
+     * hook_posix_fflush: function to hook libc's fflush function pointer.
+     * @param fflush_ptr function pointer with the same header as libc's fflush.
+     */
+    void hook_posix_fflush (libc_fflush_t& fflush_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fflush_ptr) {
+            fflush_ptr = libc_dispatch ().get<libc_fflush_t> (PosixCall::fflush);
+        }
+    }
+
+    /**
+     * hook_posix_copy_file_range: function to hook libc's copy_file_range function pointer.
+     * @param copy_file_range_ptr function pointer with the same header as libc's copy_file_range.
+     */
+    void hook_posix_copy_file_range (libc_copy_file_range_t& copy_file_range_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!copy_file_range_ptr) {
+            copy_file_range_ptr
+                = libc_dispatch ().get<libc_copy_file_range_t> (PosixCall::copy_file_range);
+        }
+    }
+
+    /**
+     * hook_posix_sendfile: function to hook libc's sendfile function pointer.
+     * @param sendfile_ptr function pointer with the same header as libc's sendfile.
+     */
+    void hook_posix_sendfile (libc_sendfile_t& sendfile_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!sendfile_ptr) {
+            sendfile_ptr = libc_dispatch ().get<libc_sendfile_t> (PosixCall::sendfile);
+        }
+    }
+
+    /**
+     * hook_posix_sendfile64: function to hook libc's sendfile64 function pointer.
+     * @param sendfile64_ptr function pointer with the same header as libc's sendfile64.
+     */
+    void hook_posix_sendfile64 (libc_sendfile64_t& sendfile64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!sendfile64_ptr) {
+            sendfile64_ptr = libc_dispatch ().get<libc_sendfile64_t> (PosixCall::sendfile64);
+        }
+    }
+
+    /**
+     * hook_posix_splice: function to hook libc's splice function pointer.
+     * @param splice_ptr function pointer with the same header as libc's splice.
+     */
+    void hook_posix_splice (libc_splice_t& splice_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!splice_ptr) {
+            splice_ptr = libc_dispatch ().get<libc_splice_t> (PosixCall::splice);
+        }
+    }
+
+    /**
+     * hook_posix_io_uring_enter: function to hook libc's io_uring_enter function pointer (issued
+     * through syscall).
+     * @param io_uring_enter_ptr function pointer with the same header as libc's syscall.
+     */
+    void hook_posix_io_uring_enter (libc_io_uring_enter_t& io_uring_enter_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!io_uring_enter_ptr) {
+            io_uring_enter_ptr
+                = libc_dispatch ().get<libc_io_uring_enter_t> (PosixCall::io_uring_enter);
+        }
+    }
+
+    /**
+     * hook_posix_aio_read: function to hook libc's aio_read function pointer.
+     * @param aio_read_ptr function pointer with the same header as libc's aio_read.
+     */
+    void hook_posix_aio_read (libc_aio_read_t& aio_read_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!aio_read_ptr) {
+            aio_read_ptr = libc_dispatch ().get<libc_aio_read_t> (PosixCall::aio_read);
+        }
+    }
+
+    /**
+     * hook_posix_aio_write: function to hook libc's aio_write function pointer.
+     * @param aio_write_ptr function pointer with the same header as libc's aio_write.
+     */
+    void hook_posix_aio_write (libc_aio_write_t& aio_write_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!aio_write_ptr) {
+            aio_write_ptr = libc_dispatch ().get<libc_aio_write_t> (PosixCall::aio_write);
+        }
+    }
+
+    /**
+     * hook_posix_aio_read64: function to hook libc's aio_read64 function pointer.
+     * @param aio_read64_ptr function pointer with the same header as libc's aio_read64.
+     */
+    void hook_posix_aio_read64 (libc_aio_read64_t& aio_read64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!aio_read64_ptr) {
+            aio_read64_ptr = libc_dispatch ().get<libc_aio_read64_t> (PosixCall::aio_read64);
+        }
+    }
+
+    /**
+     * hook_posix_aio_write64: function to hook libc's aio_write64 function pointer.
+     * @param aio_write64_ptr function pointer with the same header as libc's aio_write64.
+     */
+    void hook_posix_aio_write64 (libc_aio_write64_t& aio_write64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!aio_write64_ptr) {
+            aio_write64_ptr = libc_dispatch ().get<libc_aio_write64_t> (PosixCall::aio_write64);
+        }
+    }
 
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!munmap_ptr) {
-            munmap_ptr = (libc_munmap_t)dlsym (this->m_lib_handle, "munmap");
+    /**
+     * hook_posix_lio_listio: function to hook libc's lio_listio function pointer.
+     * @param lio_listio_ptr function pointer with the same header as libc's lio_listio.
+     */
+    void hook_posix_lio_listio (libc_lio_listio_t& lio_listio_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!lio_listio_ptr) {
+            lio_listio_ptr = libc_dispatch ().get<libc_lio_listio_t> (PosixCall::lio_listio);
+        }
+    }
+
+    /**
+     * hook_posix_lio_listio64: function to hook libc's lio_listio64 function pointer.
+     * @param lio_listio64_ptr function pointer with the same header as libc's lio_listio64.
+     */
+    void hook_posix_lio_listio64 (libc_lio_listio64_t& lio_listio64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!lio_listio64_ptr) {
+            lio_listio64_ptr = libc_dispatch ().get<libc_lio_listio64_t> (PosixCall::lio_listio64);
         }
     }
 
@@ -290,17 +508,9 @@ public:
      */
     void hook_posix_open_var (libc_open_variadic_t& open_ptr)
     {
-        // validate function and library handle pointers
-        if (!open_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? open_ptr = (libc_open_variadic_t)dlsym (this->m_lib_handle, "open")
-                : open_ptr = (libc_open_variadic_t)dlsym (RTLD_NEXT, "open");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!open_ptr) {
-            open_ptr = (libc_open_variadic_t)dlsym (this->m_lib_handle, "open");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!open_ptr) {
+            open_ptr = libc_dispatch ().get<libc_open_variadic_t> (PosixCall::open_variadic);
         }
     }
 
@@ -310,17 +520,9 @@ public:
      */
     void hook_posix_open (libc_open_t& open_ptr)
     {
-        // validate function and library handle pointers
-        if (!open_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? open_ptr = (libc_open_t)dlsym (this->m_lib_handle, "open")
-                : open_ptr = (libc_open_t)dlsym (RTLD_NEXT, "open");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!open_ptr) {
-            open_ptr = (libc_open_t)dlsym (this->m_lib_handle, "open");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!open_ptr) {
+            open_ptr = libc_dispatch ().get<libc_open_t> (PosixCall::open);
         }
     }
 
@@ -330,17 +532,9 @@ public:
      */
     void hook_posix_creat (libc_creat_t& creat_ptr)
     {
-        // validate function and library handle pointers
-        if (!creat_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? creat_ptr = (libc_creat_t)dlsym (this->m_lib_handle, "creat")
-                : creat_ptr = (libc_creat_t)dlsym (RTLD_NEXT, "creat");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!creat_ptr) {
-            creat_ptr = (libc_creat_t)dlsym (this->m_lib_handle, "creat");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!creat_ptr) {
+            creat_ptr = libc_dispatch ().get<libc_creat_t> (PosixCall::creat);
         }
     }
 
@@ -350,17 +544,9 @@ public:
      */
     void hook_posix_creat64 (libc_creat64_t& creat64_ptr)
     {
-        // validate function and library handle pointers
-        if (!creat64_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? creat64_ptr = (libc_creat64_t)dlsym (this->m_lib_handle, "creat64")
-                : creat64_ptr = (libc_creat64_t)dlsym (RTLD_NEXT, "creat64");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!creat64_ptr) {
-            creat64_ptr = (libc_creat64_t)dlsym (this->m_lib_handle, "creat64");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!creat64_ptr) {
+            creat64_ptr = libc_dispatch ().get<libc_creat64_t> (PosixCall::creat64);
         }
     }
 
@@ -370,17 +556,9 @@ public:
      */
     void hook_posix_openat_var (libc_openat_variadic_t& openat_ptr)
     {
-        // validate function and library handle pointers
-        if (!openat_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? openat_ptr = (libc_openat_variadic_t)dlsym (this->m_lib_handle, "openat")
-                : openat_ptr = (libc_openat_variadic_t)dlsym (RTLD_NEXT, "openat");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!openat_ptr) {
-            openat_ptr = (libc_openat_variadic_t)dlsym (this->m_lib_handle, "openat");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!openat_ptr) {
+            openat_ptr = libc_dispatch ().get<libc_openat_variadic_t> (PosixCall::openat_variadic);
         }
     }
 
@@ -390,17 +568,9 @@ public:
      */
     void hook_posix_openat (libc_openat_t& openat_ptr)
     {
-        // validate function and library handle pointers
-        if (!openat_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? openat_ptr = (libc_openat_t)dlsym (this->m_lib_handle, "openat")
-                : openat_ptr = (libc_openat_t)dlsym (RTLD_NEXT, "openat");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!openat_ptr) {
-            openat_ptr = (libc_openat_t)dlsym (this->m_lib_handle, "openat");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!openat_ptr) {
+            openat_ptr = libc_dispatch ().get<libc_openat_t> (PosixCall::openat);
         }
     }
 
@@ -410,17 +580,9 @@ public:
      */
     void hook_posix_open64_variadic (libc_open64_variadic_t& open64_ptr)
     {
-        // validate function and library handle pointers
-        if (!open64_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? open64_ptr = (libc_open64_variadic_t)dlsym (this->m_lib_handle, "open64")
-                : open64_ptr = (libc_open64_variadic_t)dlsym (RTLD_NEXT, "open64");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!open64_ptr) {
-            open64_ptr = (libc_open64_variadic_t)dlsym (this->m_lib_handle, "open64");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!open64_ptr) {
+            open64_ptr = libc_dispatch ().get<libc_open64_variadic_t> (PosixCall::open64_variadic);
         }
     }
 
@@ -430,17 +592,9 @@ public:
      */
     void hook_posix_open64 (libc_open64_t& open64_ptr)
     {
-        // validate function and library handle pointers
-        if (!open64_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? open64_ptr = (libc_open64_t)dlsym (this->m_lib_handle, "open64")
-                : open64_ptr = (libc_open64_t)dlsym (RTLD_NEXT, "open64");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!open64_ptr) {
-            open64_ptr = (libc_open64_t)dlsym (this->m_lib_handle, "open64");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!open64_ptr) {
+            open64_ptr = libc_dispatch ().get<libc_open64_t> (PosixCall::open64);
         }
     }
 
@@ -450,17 +604,9 @@ public:
      */
     void hook_posix_close (libc_close_t& close_ptr)
     {
-        // validate function and library handle pointers
-        if (!close_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? close_ptr = (libc_close_t)dlsym (this->m_lib_handle, "close")
-                : close_ptr = (libc_close_t)dlsym (RTLD_NEXT, "close");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!close_ptr) {
-            close_ptr = (libc_close_t)dlsym (this->m_lib_handle, "close");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!close_ptr) {
+            close_ptr = libc_dispatch ().get<libc_close_t> (PosixCall::close);
         }
     }
 
@@ -470,17 +616,9 @@ public:
      */
     void hook_posix_sync (libc_sync_t& sync_ptr)
     {
-        // validate function and library handle pointers
-        if (!sync_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? sync_ptr = (libc_sync_t)dlsym (this->m_lib_handle, "sync")
-                : sync_ptr = (libc_sync_t)dlsym (RTLD_NEXT, "sync");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!sync_ptr) {
-            sync_ptr = (libc_sync_t)dlsym (this->m_lib_handle, "sync");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!sync_ptr) {
+            sync_ptr = libc_dispatch ().get<libc_sync_t> (PosixCall::sync);
         }
     }
 
@@ -490,17 +628,9 @@ public:
      */
     void hook_posix_statfs (libc_statfs_t& statfs_ptr)
     {
-        // validate function and library handle pointers
-        if (!statfs_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? statfs_ptr = (libc_statfs_t)dlsym (this->m_lib_handle, "statfs")
-                : statfs_ptr = (libc_statfs_t)dlsym (RTLD_NEXT, "statfs");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!statfs_ptr) {
-            statfs_ptr = (libc_statfs_t)dlsym (this->m_lib_handle, "statfs");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!statfs_ptr) {
+            statfs_ptr = libc_dispatch ().get<libc_statfs_t> (PosixCall::statfs);
         }
     }
 
@@ -510,17 +640,9 @@ public:
      */
     void hook_posix_fstatfs (libc_fstatfs_t& fstatfs_ptr)
     {
-        // validate function and library handle pointers
-        if (!fstatfs_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? fstatfs_ptr = (libc_fstatfs_t)dlsym (this->m_lib_handle, "fstatfs")
-                : fstatfs_ptr = (libc_fstatfs_t)dlsym (RTLD_NEXT, "fstatfs");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!fstatfs_ptr) {
-            fstatfs_ptr = (libc_fstatfs_t)dlsym (this->m_lib_handle, "fstatfs");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fstatfs_ptr) {
+            fstatfs_ptr = libc_dispatch ().get<libc_fstatfs_t> (PosixCall::fstatfs);
         }
     }
 
@@ -530,17 +652,9 @@ public:
      */
     void hook_posix_statfs64 (libc_statfs64_t& statfs64_ptr)
     {
-        // validate function and library handle pointers
-        if (!statfs64_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? statfs64_ptr = (libc_statfs64_t)dlsym (this->m_lib_handle, "statfs64")
-                : statfs64_ptr = (libc_statfs64_t)dlsym (RTLD_NEXT, "statfs64");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!statfs64_ptr) {
-            statfs64_ptr = (libc_statfs64_t)dlsym (this->m_lib_handle, "statfs64");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!statfs64_ptr) {
+            statfs64_ptr = libc_dispatch ().get<libc_statfs64_t> (PosixCall::statfs64);
         }
     }
 
@@ -550,17 +664,9 @@ public:
      */
     void hook_posix_fstatfs64 (libc_fstatfs64_t& fstatfs64_ptr)
     {
-        // validate function and library handle pointers
-        if (!fstatfs64_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? fstatfs64_ptr = (libc_fstatfs64_t)dlsym (this->m_lib_handle, "fstatfs64")
-                : fstatfs64_ptr = (libc_fstatfs64_t)dlsym (RTLD_NEXT, "fstatfs64");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!fstatfs64_ptr) {
-            fstatfs64_ptr = (libc_fstatfs64_t)dlsym (this->m_lib_handle, "fstatfs64");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fstatfs64_ptr) {
+            fstatfs64_ptr = libc_dispatch ().get<libc_fstatfs64_t> (PosixCall::fstatfs64);
         }
     }
 
@@ -570,17 +676,9 @@ public:
      */
     void hook_posix_unlink (libc_unlink_t& unlink_ptr)
     {
-        // validate function and library handle pointers
-        if (!unlink_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? unlink_ptr = (libc_unlink_t)dlsym (this->m_lib_handle, "unlink")
-                : unlink_ptr = (libc_unlink_t)dlsym (RTLD_NEXT, "unlink");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!unlink_ptr) {
-            unlink_ptr = (libc_unlink_t)dlsym (this->m_lib_handle, "unlink");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!unlink_ptr) {
+            unlink_ptr = libc_dispatch ().get<libc_unlink_t> (PosixCall::unlink);
         }
     }
 
@@ -590,17 +688,9 @@ public:
      */
     void hook_posix_unlinkat (libc_unlinkat_t& unlinkat_ptr)
     {
-        // validate function and library handle pointers
-        if (!unlinkat_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? unlinkat_ptr = (libc_unlinkat_t)dlsym (this->m_lib_handle, "unlinkat")
-                : unlinkat_ptr = (libc_unlinkat_t)dlsym (RTLD_NEXT, "unlinkat");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!unlinkat_ptr) {
-            unlinkat_ptr = (libc_unlinkat_t)dlsym (this->m_lib_handle, "unlinkat");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!unlinkat_ptr) {
+            unlinkat_ptr = libc_dispatch ().get<libc_unlinkat_t> (PosixCall::unlinkat);
         }
     }
 
@@ -610,17 +700,9 @@ public:
      */
     void hook_posix_rename (libc_rename_t& rename_ptr)
     {
-        // validate function and library handle pointers
-        if (!rename_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? rename_ptr = (libc_rename_t)dlsym (this->m_lib_handle, "rename")
-                : rename_ptr = (libc_rename_t)dlsym (RTLD_NEXT, "rename");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!rename_ptr) {
-            rename_ptr = (libc_rename_t)dlsym (this->m_lib_handle, "rename");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!rename_ptr) {
+            rename_ptr = libc_dispatch ().get<libc_rename_t> (PosixCall::rename);
         }
     }
 
@@ -630,17 +712,9 @@ public:
      */
     void hook_posix_renameat (libc_renameat_t& renameat_ptr)
     {
-        // validate function and library handle pointers
-        if (!renameat_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? renameat_ptr = (libc_renameat_t)dlsym (this->m_lib_handle, "renameat")
-                : renameat_ptr = (libc_renameat_t)dlsym (RTLD_NEXT, "renameat");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!renameat_ptr) {
-            renameat_ptr = (libc_renameat_t)dlsym (this->m_lib_handle, "renameat");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!renameat_ptr) {
+            renameat_ptr = libc_dispatch ().get<libc_renameat_t> (PosixCall::renameat);
         }
     }
 
@@ -650,17 +724,9 @@ public:
      */
     void hook_posix_fopen (libc_fopen_t& fopen_ptr)
     {
-        // validate function and library handle pointers
-        if (!fopen_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? fopen_ptr = (libc_fopen_t)dlsym (this->m_lib_handle, "fopen")
-                : fopen_ptr = (libc_fopen_t)dlsym (RTLD_NEXT, "fopen");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!fopen_ptr) {
-            fopen_ptr = (libc_fopen_t)dlsym (this->m_lib_handle, "fopen");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fopen_ptr) {
+            fopen_ptr = libc_dispatch ().get<libc_fopen_t> (PosixCall::fopen);
         }
     }
 
@@ -670,17 +736,9 @@ public:
      */
     void hook_posix_fopen64 (libc_fopen64_t& fopen64_ptr)
     {
-        // validate function and library handle pointers
-        if (!fopen64_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? fopen64_ptr = (libc_fopen64_t)dlsym (this->m_lib_handle, "fopen64")
-                : fopen64_ptr = (libc_fopen64_t)dlsym (RTLD_NEXT, "fopen64");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!fopen64_ptr) {
-            fopen64_ptr = (libc_fopen64_t)dlsym (this->m_lib_handle, "fopen64");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fopen64_ptr) {
+            fopen64_ptr = libc_dispatch ().get<libc_fopen64_t> (PosixCall::fopen64);
         }
     }
 
@@ -690,17 +748,290 @@ public:
      */
     void hook_posix_fclose (libc_fclose_t& fclose_ptr)
     {
-        // validate function and library handle pointers
-        if (!fclose_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? fclose_ptr = (libc_fclose_t)dlsym (this->m_lib_handle, "fclose")
-                : fclose_ptr = (libc_fclose_t)dlsym (RTLD_NEXT, "fclose");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fclose_ptr) {
+            fclose_ptr = libc_dispatch ().get<libc_fclose_t> (PosixCall::fclose);
+        }
+    }
+
+    /**
+     * hook_posix_stat: function to hook libc's stat function pointer.
+     * @param stat_ptr function pointer with the same header as libc's stat.
+     */
+    void hook_posix_stat (libc_stat_t& stat_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!stat_ptr) {
+            stat_ptr = libc_dispatch ().get<libc_stat_t> (PosixCall::stat);
+        }
+    }
+
+    /**
+     * hook_posix_lstat: function to hook libc's lstat function pointer.
+     * @param lstat_ptr function pointer with the same header as libc's lstat.
+     */
+    void hook_posix_lstat (libc_lstat_t& lstat_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!lstat_ptr) {
+            lstat_ptr = libc_dispatch ().get<libc_lstat_t> (PosixCall::lstat);
+        }
+    }
+
+    /**
+     * hook_posix_fstat: function to hook libc's fstat function pointer.
+     * @param fstat_ptr function pointer with the same header as libc's fstat.
+     */
+    void hook_posix_fstat (libc_fstat_t& fstat_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fstat_ptr) {
+            fstat_ptr = libc_dispatch ().get<libc_fstat_t> (PosixCall::fstat);
+        }
+    }
+
+    /**
+     * hook_posix_fstatat: function to hook libc's fstatat function pointer.
+     * @param fstatat_ptr function pointer with the same header as libc's fstatat.
+     */
+    void hook_posix_fstatat (libc_fstatat_t& fstatat_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fstatat_ptr) {
+            fstatat_ptr = libc_dispatch ().get<libc_fstatat_t> (PosixCall::fstatat);
+        }
+    }
+
+    /**
+     * hook_posix_statx: function to hook libc's statx function pointer.
+     * @param statx_ptr function pointer with the same header as libc's statx.
+     */
+    void hook_posix_statx (libc_statx_t& statx_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!statx_ptr) {
+            statx_ptr = libc_dispatch ().get<libc_statx_t> (PosixCall::statx);
+        }
+    }
+
+    /**
+     * hook_posix_access: function to hook libc's access function pointer.
+     * @param access_ptr function pointer with the same header as libc's access.
+     */
+    void hook_posix_access (libc_access_t& access_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!access_ptr) {
+            access_ptr = libc_dispatch ().get<libc_access_t> (PosixCall::access);
+        }
+    }
+
+    /**
+     * hook_posix_faccessat: function to hook libc's faccessat function pointer.
+     * @param faccessat_ptr function pointer with the same header as libc's faccessat.
+     */
+    void hook_posix_faccessat (libc_faccessat_t& faccessat_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!faccessat_ptr) {
+            faccessat_ptr = libc_dispatch ().get<libc_faccessat_t> (PosixCall::faccessat);
+        }
+    }
+
+    /**
+     * hook_posix_stat64: function to hook libc's stat64 function pointer.
+     * @param stat64_ptr function pointer with the same header as libc's stat64.
+     */
+    void hook_posix_stat64 (libc_stat64_t& stat64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!stat64_ptr) {
+            stat64_ptr = libc_dispatch ().get<libc_stat64_t> (PosixCall::stat64);
+        }
+    }
+
+    /**
+     * hook_posix_lstat64: function to hook libc's lstat64 function pointer.
+     * @param lstat64_ptr function pointer with the same header as libc's lstat64.
+     */
+    void hook_posix_lstat64 (libc_lstat64_t& lstat64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!lstat64_ptr) {
+            lstat64_ptr = libc_dispatch ().get<libc_lstat64_t> (PosixCall::lstat64);
+        }
+    }
+
+    /**
+     * hook_posix_fstat64: function to hook libc's fstat64 function pointer.
+     * @param fstat64_ptr function pointer with the same header as libc's fstat64.
+     */
+    void hook_posix_fstat64 (libc_fstat64_t& fstat64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fstat64_ptr) {
+            fstat64_ptr = libc_dispatch ().get<libc_fstat64_t> (PosixCall::fstat64);
+        }
+    }
+
+    /**
+     * hook_posix_fstatat64: function to hook libc's fstatat64 function pointer.
+     * @param fstatat64_ptr function pointer with the same header as libc's fstatat64.
+     */
+    void hook_posix_fstatat64 (libc_fstatat64_t& fstatat64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fstatat64_ptr) {
+            fstatat64_ptr = libc_dispatch ().get<libc_fstatat64_t> (PosixCall::fstatat64);
+        }
+    }
+
+    /**
+     * hook_posix_fsync: function to hook libc's fsync function pointer.
+     * @param fsync_ptr function pointer with the same header as libc's fsync.
+     */
+    void hook_posix_fsync (libc_fsync_t& fsync_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fsync_ptr) {
+            fsync_ptr = libc_dispatch ().get<libc_fsync_t> (PosixCall::fsync);
+        }
+    }
+
+    /**
+     * hook_posix_fdatasync: function to hook libc's fdatasync function pointer.
+     * @param fdatasync_ptr function pointer with the same header as libc's fdatasync.
+     */
+    void hook_posix_fdatasync (libc_fdatasync_t& fdatasync_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fdatasync_ptr) {
+            fdatasync_ptr = libc_dispatch ().get<libc_fdatasync_t> (PosixCall::fdatasync);
+        }
+    }
+
+    /**
+     * hook_posix_sync_file_range: function to hook libc's sync_file_range function pointer.
+     * @param sync_file_range_ptr function pointer with the same header as libc's sync_file_range.
+     */
+    void hook_posix_sync_file_range (libc_sync_file_range_t& sync_file_range_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!sync_file_range_ptr) {
+            sync_file_range_ptr
+                = libc_dispatch ().get<libc_sync_file_range_t> (PosixCall::sync_file_range);
+        }
+    }
+
+    /**
+     * hook_posix_syncfs: function to hook libc's syncfs function pointer.
+     * @param syncfs_ptr function pointer with the same header as libc's syncfs.
+     */
+    void hook_posix_syncfs (libc_syncfs_t& syncfs_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!syncfs_ptr) {
+            syncfs_ptr = libc_dispatch ().get<libc_syncfs_t> (PosixCall::syncfs);
+        }
+    }
+
+    /**
+     * hook_posix_truncate: function to hook libc's truncate function pointer.
+     * @param truncate_ptr function pointer with the same header as libc's truncate.
+     */
+    void hook_posix_truncate (libc_truncate_t& truncate_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!truncate_ptr) {
+            truncate_ptr = libc_dispatch ().get<libc_truncate_t> (PosixCall::truncate);
+        }
+    }
+
+    /**
+     * hook_posix_ftruncate: function to hook libc's ftruncate function pointer.
+     * @param ftruncate_ptr function pointer with the same header as libc's ftruncate.
+     */
+    void hook_posix_ftruncate (libc_ftruncate_t& ftruncate_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!ftruncate_ptr) {
+            ftruncate_ptr = libc_dispatch ().get<libc_ftruncate_t> (PosixCall::ftruncate);
+        }
+    }
+
+    /**
+     * hook_posix_fallocate: function to hook libc's fallocate function pointer.
+     * @param fallocate_ptr function pointer with the same header as libc's fallocate.
+     */
+    void hook_posix_fallocate (libc_fallocate_t& fallocate_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fallocate_ptr) {
+            fallocate_ptr = libc_dispatch ().get<libc_fallocate_t> (PosixCall::fallocate);
+        }
+    }
+
+    /**
+     * hook_posix_posix_fallocate: function to hook libc's posix_fallocate function pointer.
+     * @param posix_fallocate_ptr function pointer with the same header as libc's posix_fallocate.
+     */
+    void hook_posix_posix_fallocate (libc_posix_fallocate_t& posix_fallocate_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!posix_fallocate_ptr) {
+            posix_fallocate_ptr
+                = libc_dispatch ().get<libc_posix_fallocate_t> (PosixCall::posix_fallocate);
+        }
+    }
+
+    /**
+     * hook_posix_posix_fadvise: function to hook libc's posix_fadvise function pointer.
+     * @param posix_fadvise_ptr function pointer with the same header as libc's posix_fadvise.
+     */
+    void hook_posix_posix_fadvise (libc_posix_fadvise_t& posix_fadvise_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!posix_fadvise_ptr) {
+            posix_fadvise_ptr
+                = libc_dispatch ().get<libc_posix_fadvise_t> (PosixCall::posix_fadvise);
+        }
+    }
+
+    /**
+     * hook_posix_io_uring_setup: function to hook libc's io_uring_setup function pointer (issued
+     * through syscall).
+     * @param io_uring_setup_ptr function pointer with the same header as libc's syscall.
+     */
+    void hook_posix_io_uring_setup (libc_io_uring_setup_t& io_uring_setup_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!io_uring_setup_ptr) {
+            io_uring_setup_ptr
+                = libc_dispatch ().get<libc_io_uring_setup_t> (PosixCall::io_uring_setup);
+        }
+    }
+
+    /**
+     * hook_posix_aio_fsync: function to hook libc's aio_fsync function pointer.
+     * @param aio_fsync_ptr function pointer with the same header as libc's aio_fsync.
+     */
+    void hook_posix_aio_fsync (libc_aio_fsync_t& aio_fsync_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!aio_fsync_ptr) {
+            aio_fsync_ptr = libc_dispatch ().get<libc_aio_fsync_t> (PosixCall::aio_fsync);
+        }
+    }
 
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!fclose_ptr) {
-            fclose_ptr = (libc_fclose_t)dlsym (this->m_lib_handle, "fclose");
+    /**
+     * hook_posix_aio_fsync64: function to hook libc's aio_fsync64 function pointer.
+     * @param aio_fsync64_ptr function pointer with the same header as libc's aio_fsync64.
+     */
+    void hook_posix_aio_fsync64 (libc_aio_fsync64_t& aio_fsync64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!aio_fsync64_ptr) {
+            aio_fsync64_ptr = libc_dispatch ().get<libc_aio_fsync64_t> (PosixCall::aio_fsync64);
         }
     }
 
@@ -710,17 +1041,9 @@ public:
      */
     void hook_posix_mkdir (libc_mkdir_t& mkdir_ptr)
     {
-        // validate function and library handle pointers
-        if (!mkdir_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? mkdir_ptr = (libc_mkdir_t)dlsym (this->m_lib_handle, "mkdir")
-                : mkdir_ptr = (libc_mkdir_t)dlsym (RTLD_NEXT, "mkdir");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!mkdir_ptr) {
-            mkdir_ptr = (libc_mkdir_t)dlsym (this->m_lib_handle, "mkdir");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!mkdir_ptr) {
+            mkdir_ptr = libc_dispatch ().get<libc_mkdir_t> (PosixCall::mkdir);
         }
     }
 
@@ -730,17 +1053,9 @@ public:
      */
     void hook_posix_mkdirat (libc_mkdirat_t& mkdirat_ptr)
     {
-        // validate function and library handle pointers
-        if (!mkdirat_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? mkdirat_ptr = (libc_mkdirat_t)dlsym (this->m_lib_handle, "mkdirat")
-                : mkdirat_ptr = (libc_mkdirat_t)dlsym (RTLD_NEXT, "mkdirat");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!mkdirat_ptr) {
-            mkdirat_ptr = (libc_mkdirat_t)dlsym (this->m_lib_handle, "mkdirat");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!mkdirat_ptr) {
+            mkdirat_ptr = libc_dispatch ().get<libc_mkdirat_t> (PosixCall::mkdirat);
         }
     }
 
@@ -750,17 +1065,9 @@ public:
      */
     void hook_posix_rmdir (libc_rmdir_t& rmdir_ptr)
     {
-        // validate function and library handle pointers
-        if (!rmdir_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? rmdir_ptr = (libc_rmdir_t)dlsym (this->m_lib_handle, "rmdir")
-                : rmdir_ptr = (libc_rmdir_t)dlsym (RTLD_NEXT, "rmdir");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!rmdir_ptr) {
-            rmdir_ptr = (libc_rmdir_t)dlsym (this->m_lib_handle, "rmdir");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!rmdir_ptr) {
+            rmdir_ptr = libc_dispatch ().get<libc_rmdir_t> (PosixCall::rmdir);
         }
     }
 
@@ -770,17 +1077,9 @@ public:
      */
     void hook_posix_mknod (libc_mknod_t& mknod_ptr)
     {
-        // validate function and library handle pointers
-        if (!mknod_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? mknod_ptr = (libc_mknod_t)dlsym (this->m_lib_handle, "mknod")
-                : mknod_ptr = (libc_mknod_t)dlsym (RTLD_NEXT, "mknod");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!mknod_ptr) {
-            mknod_ptr = (libc_mknod_t)dlsym (this->m_lib_handle, "mknod");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!mknod_ptr) {
+            mknod_ptr = libc_dispatch ().get<libc_mknod_t> (PosixCall::mknod);
         }
     }
 
@@ -790,17 +1089,81 @@ public:
      */
     void hook_posix_mknodat (libc_mknodat_t& mknodat_ptr)
     {
-        // validate function and library handle pointers
-        if (!mknodat_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? mknodat_ptr = (libc_mknodat_t)dlsym (this->m_lib_handle, "mknodat")
-                : mknodat_ptr = (libc_mknodat_t)dlsym (RTLD_NEXT, "mknodat");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!mknodat_ptr) {
+            mknodat_ptr = libc_dispatch ().get<libc_mknodat_t> (PosixCall::mknodat);
+        }
+    }
+
+    /**
+     * hook_posix_opendir: function to hook libc's opendir function pointer.
+     * @param opendir_ptr function pointer with the same header as libc's opendir.
+     */
+    void hook_posix_opendir (libc_opendir_t& opendir_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!opendir_ptr) {
+            opendir_ptr = libc_dispatch ().get<libc_opendir_t> (PosixCall::opendir);
+        }
+    }
+
+    /**
+     * hook_posix_fdopendir: function to hook libc's fdopendir function pointer.
+     * @param fdopendir_ptr function pointer with the same header as libc's fdopendir.
+     */
+    void hook_posix_fdopendir (libc_fdopendir_t& fdopendir_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fdopendir_ptr) {
+            fdopendir_ptr = libc_dispatch ().get<libc_fdopendir_t> (PosixCall::fdopendir);
+        }
+    }
+
+    /**
+     * hook_posix_readdir: function to hook libc's readdir function pointer.
+     * @param readdir_ptr function pointer with the same header as libc's readdir.
+     */
+    void hook_posix_readdir (libc_readdir_t& readdir_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!readdir_ptr) {
+            readdir_ptr = libc_dispatch ().get<libc_readdir_t> (PosixCall::readdir);
+        }
+    }
 
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!mknodat_ptr) {
-            mknodat_ptr = (libc_mknodat_t)dlsym (this->m_lib_handle, "mknodat");
+    /**
+     * hook_posix_readdir64: function to hook libc's readdir64 function pointer.
+     * @param readdir64_ptr function pointer with the same header as libc's readdir64.
+     */
+    void hook_posix_readdir64 (libc_readdir64_t& readdir64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!readdir64_ptr) {
+            readdir64_ptr = libc_dispatch ().get<libc_readdir64_t> (PosixCall::readdir64);
+        }
+    }
+
+    /**
+     * hook_posix_getdents64: function to hook libc's getdents64 function pointer.
+     * @param getdents64_ptr function pointer with the same header as libc's getdents64.
+     */
+    void hook_posix_getdents64 (libc_getdents64_t& getdents64_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!getdents64_ptr) {
+            getdents64_ptr = libc_dispatch ().get<libc_getdents64_t> (PosixCall::getdents64);
+        }
+    }
+
+    /**
+     * hook_posix_closedir: function to hook libc's closedir function pointer.
+     * @param closedir_ptr function pointer with the same header as libc's closedir.
+     */
+    void hook_posix_closedir (libc_closedir_t& closedir_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!closedir_ptr) {
+            closedir_ptr = libc_dispatch ().get<libc_closedir_t> (PosixCall::closedir);
         }
     }
 
@@ -810,17 +1173,9 @@ public:
      */
     void hook_posix_getxattr (libc_getxattr_t& getxattr_ptr)
     {
-        // validate function and library handle pointers
-        if (!getxattr_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? getxattr_ptr = (libc_getxattr_t)dlsym (this->m_lib_handle, "getxattr")
-                : getxattr_ptr = (libc_getxattr_t)dlsym (RTLD_NEXT, "getxattr");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!getxattr_ptr) {
-            getxattr_ptr = (libc_getxattr_t)dlsym (this->m_lib_handle, "getxattr");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!getxattr_ptr) {
+            getxattr_ptr = libc_dispatch ().get<libc_getxattr_t> (PosixCall::getxattr);
         }
     }
 
@@ -830,17 +1185,9 @@ public:
      */
     void hook_posix_lgetxattr (libc_lgetxattr_t& lgetxattr_ptr)
     {
-        // validate function and library handle pointers
-        if (!lgetxattr_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? lgetxattr_ptr = (libc_lgetxattr_t)dlsym (this->m_lib_handle, "lgetxattr")
-                : lgetxattr_ptr = (libc_lgetxattr_t)dlsym (RTLD_NEXT, "lgetxattr");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!lgetxattr_ptr) {
-            lgetxattr_ptr = (libc_lgetxattr_t)dlsym (this->m_lib_handle, "lgetxattr");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!lgetxattr_ptr) {
+            lgetxattr_ptr = libc_dispatch ().get<libc_lgetxattr_t> (PosixCall::lgetxattr);
         }
     }
 
@@ -850,17 +1197,9 @@ public:
      */
     void hook_posix_fgetxattr (libc_fgetxattr_t& fgetxattr_ptr)
     {
-        // validate function and library handle pointers
-        if (!fgetxattr_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? fgetxattr_ptr = (libc_fgetxattr_t)dlsym (this->m_lib_handle, "fgetxattr")
-                : fgetxattr_ptr = (libc_fgetxattr_t)dlsym (RTLD_NEXT, "fgetxattr");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!fgetxattr_ptr) {
-            fgetxattr_ptr = (libc_fgetxattr_t)dlsym (this->m_lib_handle, "fgetxattr");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fgetxattr_ptr) {
+            fgetxattr_ptr = libc_dispatch ().get<libc_fgetxattr_t> (PosixCall::fgetxattr);
         }
     }
 
@@ -870,17 +1209,9 @@ public:
      */
     void hook_posix_setxattr (libc_setxattr_t& setxattr_ptr)
     {
-        // validate function and library handle pointers
-        if (!setxattr_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? setxattr_ptr = (libc_setxattr_t)dlsym (this->m_lib_handle, "setxattr")
-                : setxattr_ptr = (libc_setxattr_t)dlsym (RTLD_NEXT, "setxattr");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!setxattr_ptr) {
-            setxattr_ptr = (libc_setxattr_t)dlsym (this->m_lib_handle, "setxattr");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!setxattr_ptr) {
+            setxattr_ptr = libc_dispatch ().get<libc_setxattr_t> (PosixCall::setxattr);
         }
     }
 
@@ -890,17 +1221,9 @@ public:
      */
     void hook_posix_lsetxattr (libc_lsetxattr_t& lsetxattr_ptr)
     {
-        // validate function and library handle pointers
-        if (!lsetxattr_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? lsetxattr_ptr = (libc_lsetxattr_t)dlsym (this->m_lib_handle, "lsetxattr")
-                : lsetxattr_ptr = (libc_lsetxattr_t)dlsym (RTLD_NEXT, "lsetxattr");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!lsetxattr_ptr) {
-            lsetxattr_ptr = (libc_lsetxattr_t)dlsym (this->m_lib_handle, "lsetxattr");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!lsetxattr_ptr) {
+            lsetxattr_ptr = libc_dispatch ().get<libc_lsetxattr_t> (PosixCall::lsetxattr);
         }
     }
 
@@ -910,17 +1233,9 @@ public:
      */
     void hook_posix_fsetxattr (libc_fsetxattr_t& fsetxattr_ptr)
     {
-        // validate function and library handle pointers
-        if (!fsetxattr_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? fsetxattr_ptr = (libc_fsetxattr_t)dlsym (this->m_lib_handle, "fsetxattr")
-                : fsetxattr_ptr = (libc_fsetxattr_t)dlsym (RTLD_NEXT, "fsetxattr");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!fsetxattr_ptr) {
-            fsetxattr_ptr = (libc_fsetxattr_t)dlsym (this->m_lib_handle, "fsetxattr");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fsetxattr_ptr) {
+            fsetxattr_ptr = libc_dispatch ().get<libc_fsetxattr_t> (PosixCall::fsetxattr);
         }
     }
 
@@ -930,17 +1245,9 @@ public:
      */
     void hook_posix_listxattr (libc_listxattr_t& listxattr_ptr)
     {
-        // validate function and library handle pointers
-        if (!listxattr_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? listxattr_ptr = (libc_listxattr_t)dlsym (this->m_lib_handle, "listxattr")
-                : listxattr_ptr = (libc_listxattr_t)dlsym (RTLD_NEXT, "listxattr");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!listxattr_ptr) {
-            listxattr_ptr = (libc_listxattr_t)dlsym (this->m_lib_handle, "listxattr");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!listxattr_ptr) {
+            listxattr_ptr = libc_dispatch ().get<libc_listxattr_t> (PosixCall::listxattr);
         }
     }
 
@@ -950,17 +1257,9 @@ public:
      */
     void hook_posix_llistxattr (libc_llistxattr_t& llistxattr_ptr)
     {
-        // validate function and library handle pointers
-        if (!llistxattr_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? llistxattr_ptr = (libc_llistxattr_t)dlsym (this->m_lib_handle, "llistxattr")
-                : llistxattr_ptr = (libc_llistxattr_t)dlsym (RTLD_NEXT, "llistxattr");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!llistxattr_ptr) {
-            llistxattr_ptr = (libc_llistxattr_t)dlsym (this->m_lib_handle, "llistxattr");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!llistxattr_ptr) {
+            llistxattr_ptr = libc_dispatch ().get<libc_llistxattr_t> (PosixCall::llistxattr);
         }
     }
 
@@ -970,17 +1269,9 @@ public:
      */
     void hook_posix_flistxattr (libc_flistxattr_t& flistxattr_ptr)
     {
-        // validate function and library handle pointers
-        if (!flistxattr_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? flistxattr_ptr = (libc_flistxattr_t)dlsym (this->m_lib_handle, "flistxattr")
-                : flistxattr_ptr = (libc_flistxattr_t)dlsym (RTLD_NEXT, "flistxattr");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!flistxattr_ptr) {
-            flistxattr_ptr = (libc_flistxattr_t)dlsym (this->m_lib_handle, "flistxattr");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!flistxattr_ptr) {
+            flistxattr_ptr = libc_dispatch ().get<libc_flistxattr_t> (PosixCall::flistxattr);
         }
     }
 
@@ -990,17 +1281,9 @@ public:
      */
     void hook_posix_socket (libc_socket_t& socket_ptr)
     {
-        // validate function and library handle pointers
-        if (!socket_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? socket_ptr = (libc_socket_t)dlsym (this->m_lib_handle, "socket")
-                : socket_ptr = (libc_socket_t)dlsym (RTLD_NEXT, "socket");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!socket_ptr) {
-            socket_ptr = (libc_socket_t)dlsym (this->m_lib_handle, "socket");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!socket_ptr) {
+            socket_ptr = libc_dispatch ().get<libc_socket_t> (PosixCall::socket);
         }
     }
 
@@ -1010,17 +1293,69 @@ public:
      */
     void hook_posix_fcntl (libc_fcntl_t& fcntl_ptr)
     {
-        // validate function and library handle pointers
-        if (!fcntl_ptr && !this->m_lib_handle) {
-            // open library handle, and assign the operation pointer through m_lib_handle if the
-            // open was successful, or through the next operation link.
-            (this->dlopen_library_handle ())
-                ? fcntl_ptr = (libc_fcntl_t)dlsym (this->m_lib_handle, "fcntl")
-                : fcntl_ptr = (libc_fcntl_t)dlsym (RTLD_NEXT, "fcntl");
-
-            // in case the library handle pointer is valid, assign the operation pointer
-        } else if (!fcntl_ptr) {
-            fcntl_ptr = (libc_fcntl_t)dlsym (this->m_lib_handle, "fcntl");
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fcntl_ptr) {
+            fcntl_ptr = libc_dispatch ().get<libc_fcntl_t> (PosixCall::fcntl);
+        }
+    }
+
+    /**
+     * hook_posix_chdir: function to hook libc's chdir function pointer.
+     * @param chdir_ptr function pointer with the same header as libc's chdir.
+     */
+    void hook_posix_chdir (libc_chdir_t& chdir_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!chdir_ptr) {
+            chdir_ptr = libc_dispatch ().get<libc_chdir_t> (PosixCall::chdir);
+        }
+    }
+
+    /**
+     * hook_posix_fchdir: function to hook libc's fchdir function pointer.
+     * @param fchdir_ptr function pointer with the same header as libc's fchdir.
+     */
+    void hook_posix_fchdir (libc_fchdir_t& fchdir_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!fchdir_ptr) {
+            fchdir_ptr = libc_dispatch ().get<libc_fchdir_t> (PosixCall::fchdir);
+        }
+    }
+
+    /**
+     * hook_posix_dup: function to hook libc's dup function pointer.
+     * @param dup_ptr function pointer with the same header as libc's dup.
+     */
+    void hook_posix_dup (libc_dup_t& dup_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!dup_ptr) {
+            dup_ptr = libc_dispatch ().get<libc_dup_t> (PosixCall::dup);
+        }
+    }
+
+    /**
+     * hook_posix_dup2: function to hook libc's dup2 function pointer.
+     * @param dup2_ptr function pointer with the same header as libc's dup2.
+     */
+    void hook_posix_dup2 (libc_dup2_t& dup2_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!dup2_ptr) {
+            dup2_ptr = libc_dispatch ().get<libc_dup2_t> (PosixCall::dup2);
+        }
+    }
+
+    /**
+     * hook_posix_dup3: function to hook libc's dup3 function pointer.
+     * @param dup3_ptr function pointer with the same header as libc's dup3.
+     */
+    void hook_posix_dup3 (libc_dup3_t& dup3_ptr)
+    {
+        // assign the operation pointer through the (shared) libc dispatch table
+        if (!dup3_ptr) {
+            dup3_ptr = libc_dispatch ().get<libc_dup3_t> (PosixCall::dup3);
         }
     }
 };
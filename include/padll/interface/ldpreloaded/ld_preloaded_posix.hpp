@@ -8,16 +8,28 @@
 
 #define _GNU_SOURCE 1
 
+#include <aio.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <padll/configurations/padll_configuration.hpp>
 #include <padll/interface/ldpreloaded/dlsym_hook_libc.hpp>
+#include <padll/interface/ldpreloaded/operation_descriptor.hpp>
 #include <padll/library_headers/libc_enums.hpp>
 #include <padll/library_headers/libc_headers.hpp>
 #include <padll/stage/data_plane_stage.hpp>
+#include <padll/stage/io_uring_table.hpp>
+#include <padll/stage/mmap_table.hpp>
 #include <padll/stage/mount_point_table.hpp>
 #include <padll/statistics/statistics.hpp>
+#include <padll/statistics/statistics_exporter.hpp>
 #include <padll/utils/log.hpp>
+#include <thread>
 #include <unistd.h>
 
+using namespace padll::configurations;
 using namespace padll::headers;
 using namespace padll::stage;
 using namespace padll::stats;
@@ -25,6 +37,27 @@ using namespace padll::utils::log;
 
 namespace padll::interface::ldpreloaded {
 
+/**
+ * RequestCharge struct: request aggregated from the entries of a batched submission (e.g., the SQEs
+ * of an io_uring submission, or the control blocks of lio_listio) that target the same workflow
+ * with the same operation.
+ */
+struct RequestCharge {
+    uint32_t m_workflow_id;
+    int m_operation;
+    int m_context;
+    uint64_t m_payload;
+};
+
+/**
+ * RequestBatch struct: requests of a batched submission, to be enforced once all of its entries are
+ * aggregated (or once it is full).
+ */
+struct RequestBatch {
+    std::array<RequestCharge, option_batch_charge_entries> m_charges {};
+    std::size_t m_size { 0 };
+};
+
 /**
  * LdPreloadedPosix class.
  *  https://www.gnu.org/software/libc/manual/html_node/Function-Index.html
@@ -43,17 +76,31 @@ private:
     std::shared_ptr<Log> m_log { nullptr };
     DlsymHookLibc m_dlsym_hook {};
 
-    std::atomic<bool> m_collect { option_default_statistic_collection };
+    std::atomic<bool> m_collect { padll_configuration ().is_statistic_collection_enabled () };
+    const bool m_collect_latency { padll_configuration ().is_latency_collection_enabled () };
     Statistics m_metadata_stats { "metadata", OperationType::metadata_calls };
     Statistics m_data_stats { "data", OperationType::data_calls };
     Statistics m_dir_stats { "directory", OperationType::directory_calls };
     Statistics m_ext_attr_stats { "ext-attr", OperationType::ext_attr_calls };
     Statistics m_special_stats { "special", OperationType::special_calls };
+    std::unique_ptr<StatisticsExporter> m_stats_exporter { nullptr };
 
     // data plane stage configurations
     std::unique_ptr<DataPlaneStage> m_stage { nullptr };
     MountPointTable m_mount_point_table { this->m_log };
     std::shared_ptr<std::atomic<bool>> m_loaded { nullptr };
+    const uint64_t m_space_weight { LdPreloadedPosix::get_space_weight () };
+    IoUringTable m_io_uring_table {};
+    const bool m_io_uring_hold_back { LdPreloadedPosix::get_io_uring_hold_back () };
+    MmapTable m_mmap_table {};
+    const std::chrono::milliseconds m_mmap_sampling_interval {
+        this->get_mmap_sampling_interval ()
+    };
+    std::thread m_mmap_sampler {};
+    std::mutex m_mmap_sampler_lock;
+    std::condition_variable m_mmap_sampler_cv;
+    bool m_mmap_sampler_running { false };
+    pid_t m_mmap_sampler_pid { -1 };
 
     /**
      * enforce_request: submit the request to be enforced (rate limited) in the PAIO data plane
@@ -73,7 +120,7 @@ private:
         const uint32_t& workflow_id,
         const int& operation_type,
         const int& operation_context,
-        const int& payload);
+        const uint64_t& payload);
 
     /**
      * update_statistic_entry_data: update the statistic entry at the m_data_stats container.
@@ -100,7 +147,8 @@ private:
      * @param result Validates if the POSIX operation was successful.
      * @param enforced Boolean that defines if the operation was successfully enforced.
      */
-    void update_statistic_entry_dir (const int& operation, const int& result, const bool& enforced);
+    void
+    update_statistic_entry_dir (const int& operation, const ssize_t& result, const bool& enforced);
 
     /**
      * update_statistic_entry_ext_attr: update the statistic entry at the _ext_attr_stats container.
@@ -121,6 +169,22 @@ private:
     void
     update_statistic_entry_special (const int& operation, const int& result, const bool& enforced);
 
+    /**
+     * start_latency_tracking: mark the start of an intercepted call, to decompose its latency in
+     * interception, enforcement, and syscall phases.
+     */
+    void start_latency_tracking () const;
+
+    /**
+     * update_latency: record the latency of each phase of the intercepted call in the respective
+     * statistics container. The interception phase spans from the start of the call until
+     * enforce_request, the enforcement phase covers enforce_request, and the syscall phase spans
+     * from then until the statistics update.
+     * @param operation_type defines the class of the submitted operation.
+     * @param operation Index of the operation to be updated.
+     */
+    void update_latency (const OperationType& operation_type, const int& operation);
+
     /**
      * update_statistics: update statistic entry.
      * @param operation_type defines the class of the submitted operations. Used to select which
@@ -134,12 +198,579 @@ private:
         const long& result,
         const bool& enforced);
 
+    /**
+     * get_space_weight: get the space weight (in bytes per token) of space management calls, from
+     * option_space_weight_env (or, if not set, the runtime configuration).
+     * @return Returns the configured space weight, or option_default_space_weight if not set.
+     */
+    [[nodiscard]] static uint64_t get_space_weight ();
+
+    /**
+     * space_payload: compute the cost of a space management call (truncate, ftruncate, fallocate,
+     * posix_fallocate), i.e., 1 token plus one token per m_space_weight bytes of its length.
+     * @param length Length (in bytes) targeted by the call.
+     * @return Returns the number of tokens to be charged.
+     */
+    [[nodiscard]] size_t space_payload (const off_t& length) const;
+
+    /**
+     * get_io_uring_hold_back: check if io_uring submissions are to be enforced before being
+     * submitted to the kernel, from option_io_uring_hold_back_env (or, if not set, the runtime
+     * configuration).
+     * @return Returns true if hold-back is enabled, or option_default_io_uring_hold_back if not
+     * set.
+     */
+    [[nodiscard]] static bool get_io_uring_hold_back ();
+
+    /**
+     * add_request_charge: aggregate a charge into a batch, merging it with the request of the same
+     * workflow and operation (if any).
+     * @param batch RequestBatch to be updated.
+     * @param charge RequestCharge to be aggregated.
+     * @return Returns false if the batch is full and the charge could not be aggregated; true
+     * otherwise.
+     */
+    static bool add_request_charge (RequestBatch& batch, const RequestCharge& charge);
+
+    /**
+     * enforce_request_batch: submit the requests of a batch to be enforced (rate limited) in the
+     * PAIO data plane stage, and clear it.
+     * @param function_name Name of the POSIX call that is being enforced.
+     * @param batch RequestBatch to be enforced.
+     * @return Returns true if at least one request was enforced; false otherwise.
+     */
+    bool enforce_request_batch (const std::string_view& function_name, RequestBatch& batch);
+
+    /**
+     * update_batch_statistics: update the statistic entry of a batched data call (io_uring_enter,
+     * lio_listio) at the m_data_stats container, accounting each submitted entry as an operation,
+     * and record its latency.
+     * @param operation Index of the operation to be updated.
+     * @param failed Boolean that defines if the call failed.
+     * @param requests Number of entries submitted by the call.
+     * @param bytes Number of bytes of the enforced read and write entries.
+     * @param enforced Boolean that defines if the call was successfully enforced.
+     */
+    void update_batch_statistics (const int& operation,
+        const bool& failed,
+        const uint64_t& requests,
+        const uint64_t& bytes,
+        const bool& enforced);
+
+    /**
+     * enforce_io_uring_submissions: enforce count SQEs of a registered io_uring instance, starting
+     * at position first of its SQ ring. Each SQE is classified through its file descriptor (or the
+     * directory and path of openat) and charged as the POSIX operation it performs (reads and
+     * writes with their bytes, fsync, fdatasync, and openat with 1 token); SQEs of the same
+     * workflow and operation are aggregated in a RequestBatch, which is only submitted to the
+     * stage after the SQ ring is released. SQEs over registered files, or that target files
+     * outside the registered mount points, are not charged.
+     * @param ring_fd File descriptor of the io_uring instance.
+     * @param first Position of the first SQE in the SQ ring.
+     * @param count Number of SQEs to be enforced.
+     * @param bytes Number of bytes of the read and write SQEs (updated by the call).
+     * @return Returns true if at least one request was enforced; false otherwise.
+     */
+    bool enforce_io_uring_submissions (const int& ring_fd,
+        const unsigned& first,
+        const unsigned& count,
+        uint64_t& bytes);
+
+    /**
+     * get_mmap_sampling_interval: get the interval at which file-backed mappings are sampled, from
+     * option_mmap_sampling_interval_env (or, if not set, the runtime configuration).
+     * Sampling is disabled (with an error message in m_log) if the interval is invalid, or if mmap
+     * is not intercepted, since mappings would never be registered.
+     * @return Returns the configured interval, or option_default_mmap_sampling_interval if not set
+     * (0 if mmap sampling is disabled).
+     */
+    [[nodiscard]] std::chrono::milliseconds get_mmap_sampling_interval () const;
+
+    /**
+     * charge_mapped_pages: enforce the pages faulted in through file-backed mappings, as reads of
+     * their mappings' workflows, and account their bytes in the mmap statistic entry.
+     * @param charges Charges of the sampled mappings.
+     * @return Returns true if at least one charge was enforced; false otherwise.
+     */
+    bool charge_mapped_pages (const std::vector<MmapCharge>& charges);
+
+    /**
+     * start_mmap_sampler: spawn the thread that periodically samples the file-backed mappings (if
+     * it is not running in the calling process yet). Spawned on the first registered mapping, so
+     * that programs that do not map files do not pay for it.
+     */
+    void start_mmap_sampler ();
+
+    /**
+     * stop_mmap_sampler: stop the mmap sampler thread. If called from a forked child, the parent's
+     * thread is left untouched.
+     */
+    void stop_mmap_sampler ();
+
+    /**
+     * run_mmap_sampler: mmap sampler thread loop; samples the registered mappings, and charges the
+     * pages faulted in since the previous sample, every m_mmap_sampling_interval until stopped.
+     */
+    void run_mmap_sampler ();
+
+    /**
+     * select_workflow: select the workflow-id of a request, from the argument that identifies its
+     * targeted file. If mount point differentiation is compiled out
+     * (option_pipeline_mount_point_differentiation), the file is not classified.
+     * @tparam Kind Kind of the key (see KeyKind).
+     * @param key File descriptor, path, <directory file descriptor, path> pair, or file pointer.
+     * @return Returns the selected workflow identifier.
+     */
+    template <KeyKind Kind, typename Key>
+    [[nodiscard]] uint32_t select_workflow (const Key& key)
+    {
+        if constexpr (!option_pipeline_mount_point_differentiation) {
+            return this->m_mount_point_table.pick_workflow_id_by_force ();
+        } else if constexpr (Kind == KeyKind::kFileDescriptor) {
+            return this->m_mount_point_table.pick_workflow_id (static_cast<int> (key));
+        } else if constexpr (Kind == KeyKind::kPath) {
+            return this->m_mount_point_table.pick_workflow_id (std::string_view { key }).second;
+        } else if constexpr (Kind == KeyKind::kDirectoryPath) {
+            return this->m_mount_point_table
+                .pick_workflow_id (key.first, std::string_view { key.second })
+                .second;
+        } else {
+            return this->m_mount_point_table.pick_workflow_id (key);
+        }
+    }
+
+    /**
+     * intercept: interception pipeline of a POSIX call described by an OperationDescriptor. It
+     * tracks the latency of the call, selects the workflow from key, enforces the request in the
+     * PAIO data plane stage, performs the original call, and updates its statistics. Stages
+     * disabled at compile time (option_pipeline_statistics, option_pipeline_enforcement) are not
+     * compiled in.
+     * @tparam Descriptor OperationDescriptor of the call.
+     * @param key Argument that identifies the targeted file (see KeyKind).
+     * @param payload Cost of the request (1 token for metadata calls; bytes for data calls).
+     * @param function Pointer to the original libc call.
+     * @param args Arguments of the original call.
+     * @return Returns the result of the original call.
+     */
+    template <typename Descriptor, typename Key, typename Function, typename... Args>
+    auto intercept ([[maybe_unused]] const Key& key,
+        [[maybe_unused]] const size_t& payload,
+        Function function,
+        Args... args)
+    {
+        // start tracking the latency of the intercepted call
+        if constexpr (option_pipeline_statistics) {
+            this->start_latency_tracking ();
+        }
+
+        // select workflow-id and enforce request to PAIO data plane stage
+        bool enforced = false;
+        if constexpr (option_pipeline_enforcement) {
+            enforced = this->enforce_request (Descriptor::name (),
+                this->select_workflow<Descriptor::key> (key),
+                Descriptor::operation,
+                Descriptor::context,
+                static_cast<uint64_t> (payload));
+        }
+
+        // perform original POSIX operation
+        auto result = function (args...);
+
+        // update statistic entry
+        if constexpr (option_pipeline_statistics) {
+            this->update_statistics (Descriptor::type,
+                Descriptor::entry,
+                static_cast<long> (result),
+                enforced);
+        }
+
+        return result;
+    }
+
+    /**
+     * intercept_transfer: interception pipeline of a zero-copy transfer call (copy_file_range,
+     * sendfile, splice) described by an OperationDescriptor. Each side of the transfer is
+     * classified through its file descriptor and charged against its own workflow: the source as
+     * a read, and the destination as a write. Transfers larger than option_transfer_chunk_size
+     * bytes are split into several calls, each enforced before being performed; the transfer stops
+     * at the first call that fails or that transfers fewer bytes than requested (as with a short
+     * write, the bytes already transferred are returned instead of the error). Since multiple
+     * chunks may be enforced, the syscall phase of earlier chunks is accounted within the
+     * interception phase.
+     * @tparam Descriptor OperationDescriptor of the call (KeyKind::kFileDescriptor).
+     * @param fd_in File descriptor of the source.
+     * @param fd_out File descriptor of the destination.
+     * @param length Number of bytes to be transferred.
+     * @param transfer Callable that performs the original call over a given number of bytes.
+     * @return Returns the number of bytes transferred, or -1 if the first call failed.
+     */
+    template <typename Descriptor, typename Transfer>
+    ssize_t intercept_transfer (const int& fd_in,
+        const int& fd_out,
+        const size_t& length,
+        Transfer transfer)
+    {
+        static_assert (Descriptor::key == KeyKind::kFileDescriptor);
+
+        // start tracking the latency of the intercepted call
+        if constexpr (option_pipeline_statistics) {
+            this->start_latency_tracking ();
+        }
+
+        // select the workflow-id of each side of the transfer
+        [[maybe_unused]] uint32_t workflow_in = 0;
+        [[maybe_unused]] uint32_t workflow_out = 0;
+        if constexpr (option_pipeline_enforcement) {
+            workflow_in = this->select_workflow<Descriptor::key> (fd_in);
+            workflow_out = this->select_workflow<Descriptor::key> (fd_out);
+        }
+
+        bool enforced = false;
+        ssize_t transferred = 0;
+        do {
+            auto chunk = std::min (length - static_cast<size_t> (transferred),
+                option_transfer_chunk_size);
+
+            // enforce the chunk against the source (read) and destination (write) workflows
+            if constexpr (option_pipeline_enforcement) {
+                auto read_enforced = this->enforce_request (Descriptor::name (),
+                    workflow_in,
+                    static_cast<int> (paio::core::POSIX::read),
+                    Descriptor::context,
+                    static_cast<uint64_t> (chunk));
+                auto write_enforced = this->enforce_request (Descriptor::name (),
+                    workflow_out,
+                    static_cast<int> (paio::core::POSIX::write),
+                    Descriptor::context,
+                    static_cast<uint64_t> (chunk));
+                enforced = read_enforced || write_enforced;
+            }
+
+            // perform original POSIX operation over the chunk
+            ssize_t result = transfer (chunk);
+            if (result < 0) {
+                transferred = (transferred > 0) ? transferred : result;
+                break;
+            }
+
+            transferred += result;
+            if (static_cast<size_t> (result) < chunk) {
+                break;
+            }
+        } while (static_cast<size_t> (transferred) < length);
+
+        // update statistic entry
+        if constexpr (option_pipeline_statistics) {
+            this->update_statistics (Descriptor::type,
+                Descriptor::entry,
+                static_cast<long> (transferred),
+                enforced);
+        }
+
+        return transferred;
+    }
+
+    /**
+     * enforce_aio_requests: enforce the read and write requests of a list of AIO control blocks.
+     * Each control block is classified through its file descriptor and charged with its size;
+     * requests of the same workflow and operation are aggregated in a RequestBatch, so a list that
+     * targets a single workflow is enforced with one request per operation. Control blocks that
+     * target files outside the registered mount points are not charged.
+     * @tparam Control AIO control block (aiocb, aiocb64).
+     * @param function_name Name of the POSIX call that is being enforced.
+     * @param list Control blocks to be enforced.
+     * @param nent Number of control blocks.
+     * @param operation Operation of the control blocks (POSIX::read, POSIX::write), or
+     * POSIX::no_op to take it from the aio_lio_opcode of each block (LIO_NOP blocks are skipped).
+     * @param requests Number of read and write control blocks (updated by the call).
+     * @param bytes Number of bytes of the charged control blocks (updated by the call).
+     * @return Returns true if at least one request was enforced; false otherwise.
+     */
+    template <typename Control>
+    bool enforce_aio_requests (const std::string_view& function_name,
+        Control* const list[],
+        const int& nent,
+        const paio::core::POSIX& operation,
+        uint64_t& requests,
+        uint64_t& bytes)
+    {
+        bool enforced = false;
+        RequestBatch batch {};
+
+        for (int i = 0; list != nullptr && i < nent; i++) {
+            const Control* aiocbp = list[i];
+            if (aiocbp == nullptr) {
+                continue;
+            }
+
+            auto block_operation = operation;
+            if (operation == paio::core::POSIX::no_op) {
+                if (aiocbp->aio_lio_opcode == LIO_READ) {
+                    block_operation = paio::core::POSIX::read;
+                } else if (aiocbp->aio_lio_opcode == LIO_WRITE) {
+                    block_operation = paio::core::POSIX::write;
+                } else {
+                    continue;
+                }
+            }
+            requests++;
+
+            RequestCharge charge { this->select_workflow<KeyKind::kFileDescriptor> (
+                                       aiocbp->aio_fildes),
+                static_cast<int> (block_operation),
+                static_cast<int> (paio::core::POSIX_META::data_op),
+                static_cast<uint64_t> (aiocbp->aio_nbytes) };
+            if (charge.m_workflow_id == static_cast<uint32_t> (-1)) {
+                continue;
+            }
+            bytes += charge.m_payload;
+
+            // enforce the aggregated requests once the batch is full
+            if (!LdPreloadedPosix::add_request_charge (batch, charge)) {
+                enforced |= this->enforce_request_batch (function_name, batch);
+                LdPreloadedPosix::add_request_charge (batch, charge);
+            }
+        }
+
+        enforced |= this->enforce_request_batch (function_name, batch);
+        return enforced;
+    }
+
+    /**
+     * intercept_aio: interception pipeline of a POSIX AIO submission call (aio_read, aio_write,
+     * lio_listio) described by an OperationDescriptor. Requests are enforced at submission, in the
+     * calling thread, so that the I/O later performed by glibc's helper threads is charged to the
+     * workflow of the targeted file. Each control block is accounted as an operation, with its
+     * size (the result of the I/O is only known to aio_return).
+     * @tparam Descriptor OperationDescriptor of the call (KeyKind::kFileDescriptor); its operation
+     * is the one of the control blocks (POSIX::no_op for lio_listio).
+     * @tparam Control AIO control block (aiocb, aiocb64).
+     * @param list Control blocks submitted by the call.
+     * @param nent Number of control blocks.
+     * @param function Pointer to the original libc call.
+     * @param args Arguments of the original call.
+     * @return Returns the result of the original call.
+     */
+    template <typename Descriptor, typename Control, typename Function, typename... Args>
+    int intercept_aio (Control* const list[], const int& nent, Function function, Args... args)
+    {
+        static_assert (Descriptor::key == KeyKind::kFileDescriptor);
+
+        // start tracking the latency of the intercepted call
+        if constexpr (option_pipeline_statistics) {
+            this->start_latency_tracking ();
+        }
+
+        // classify and enforce the control blocks
+        bool enforced = false;
+        uint64_t requests = 0;
+        uint64_t bytes = 0;
+        if constexpr (option_pipeline_enforcement) {
+            enforced = this->enforce_aio_requests (Descriptor::name (),
+                list,
+                nent,
+                static_cast<paio::core::POSIX> (Descriptor::operation),
+                requests,
+                bytes);
+        } else {
+            requests = static_cast<uint64_t> (nent);
+        }
+
+        // perform original POSIX operation
+        int result = function (args...);
+
+        // update statistic entry
+        if constexpr (option_pipeline_statistics) {
+            this->update_batch_statistics (Descriptor::entry,
+                result != 0,
+                requests,
+                bytes,
+                enforced);
+        }
+
+        return result;
+    }
+
+    /**
+     * begin_stream_call: mark the start of a stream call in the calling thread, and capture the
+     * state of the stream's buffer (bytes pending to be flushed, and bytes available to be read).
+     * @param stream File pointer targeted by the call.
+     * @return Returns false if the call is not to be intercepted, i.e., if it targets a standard
+     * stream (or all streams) or is issued while handling another stream call (e.g., stdio writes
+     * of the logging backend); true otherwise.
+     */
+    [[nodiscard]] bool begin_stream_call (FILE* stream) const;
+
+    /**
+     * stream_payload: compute the bytes that crossed the stream's buffer during the stream call,
+     * i.e., the bytes refilled from the file (read calls) or flushed to the file (write calls).
+     * @param stream File pointer targeted by the call.
+     * @param is_read Boolean that defines if the call reads from the stream.
+     * @param bytes Number of bytes read or written by the call (-1 if the call failed).
+     * @return Returns the number of bytes to be charged.
+     */
+    [[nodiscard]] size_t
+    stream_payload (FILE* stream, const bool& is_read, const ssize_t& bytes) const;
+
+    /**
+     * end_stream_call: mark the end of a stream call in the calling thread.
+     */
+    void end_stream_call () const;
+
+    /**
+     * intercept_stream: interception pipeline of a stream (stdio) call described by an
+     * OperationDescriptor. Instead of charging each call with its own size, the request is charged
+     * with the bytes that the stream's buffer refills from (or flushes to) the file, so calls
+     * served by the buffer (e.g., small fputs or fprintf) are not submitted to enforcement. Since
+     * these bytes are only known once the original call returns, the request is enforced after it
+     * (the syscall phase is thus accounted within the interception phase).
+     * @tparam Descriptor OperationDescriptor of the call (KeyKind::kFileStream).
+     * @param stream File pointer targeted by the call.
+     * @param bytes Callable that converts the result of the call into the number of bytes read or
+     * written (-1 if the call failed).
+     * @param function Pointer to the original libc call.
+     * @param args Arguments of the original call.
+     * @return Returns the result of the original call.
+     */
+    template <typename Descriptor, typename Bytes, typename Function, typename... Args>
+    auto intercept_stream (FILE* stream, Bytes bytes, Function function, Args... args)
+    {
+        static_assert (Descriptor::key == KeyKind::kFileStream);
+
+        // standard streams and reentrant stream calls go straight to libc
+        if (!this->begin_stream_call (stream)) {
+            return function (args...);
+        }
+
+        // start tracking the latency of the intercepted call
+        if constexpr (option_pipeline_statistics) {
+            this->start_latency_tracking ();
+        }
+
+        // perform original POSIX operation
+        auto result = function (args...);
+        ssize_t transferred = bytes (result);
+
+        // enforce the bytes that crossed the stream's buffer to PAIO data plane stage; calls
+        // served by the buffer are accounted as enforced if the stream belongs to a workflow
+        bool enforced = false;
+        if constexpr (option_pipeline_enforcement) {
+            auto workflow_id = this->select_workflow<Descriptor::key> (stream);
+            auto payload = this->stream_payload (stream,
+                Descriptor::operation == static_cast<int> (paio::core::POSIX::read),
+                transferred);
+
+            enforced = (payload > 0) ? this->enforce_request (Descriptor::name (),
+                                           workflow_id,
+                                           Descriptor::operation,
+                                           Descriptor::context,
+                                           static_cast<uint64_t> (payload))
+                                     : (workflow_id != static_cast<uint32_t> (-1));
+        }
+
+        // update statistic entry
+        if constexpr (option_pipeline_statistics) {
+            this->update_statistics (Descriptor::type,
+                Descriptor::entry,
+                static_cast<long> (transferred),
+                enforced);
+        }
+
+        this->end_stream_call ();
+
+        return result;
+    }
+
+    /**
+     * begin_directory_batch: check if the buffer of a directory stream was refilled from the
+     * kernel since its previous enforced call (see MountPointEntry::begin_stream_batch).
+     * @param dirp Directory stream targeted by the call.
+     * @return Returns a pair with the entry of the directory stream (nullptr if it is not
+     * registered), and a boolean that defines if the call starts a new batch (and thus is to be
+     * enforced).
+     */
+    [[nodiscard]] std::pair<std::shared_ptr<MountPointEntry>, bool> begin_directory_batch (
+        DIR* dirp);
+
+    /**
+     * intercept_directory_stream: interception pipeline of a directory stream call (readdir)
+     * described by an OperationDescriptor. Instead of submitting each call to enforcement (one per
+     * directory entry), a single request is enforced for each refill of the stream's buffer from
+     * the kernel (i.e., each getdents64 issued by libc), as getdents64 calls issued by the
+     * application are. Since a refill is only observed once its entries are returned, it is
+     * enforced at the next call over the stream (the first call of a stream always is). The
+     * remaining calls are accounted as enforced if the stream belongs to a workflow. Reaching the
+     * end of the stream (nullptr, with errno unchanged) is not accounted as an error.
+     * @tparam Descriptor OperationDescriptor of the call (KeyKind::kDirectoryStream).
+     * @param dirp Directory stream targeted by the call.
+     * @param function Pointer to the original libc call.
+     * @param args Arguments of the original call.
+     * @return Returns the result of the original call.
+     */
+    template <typename Descriptor, typename Function, typename... Args>
+    auto intercept_directory_stream (DIR* dirp, Function function, Args... args)
+    {
+        static_assert (Descriptor::key == KeyKind::kDirectoryStream);
+
+        // start tracking the latency of the intercepted call
+        if constexpr (option_pipeline_statistics) {
+            this->start_latency_tracking ();
+        }
+
+        // enforce the first call of each batch to PAIO data plane stage
+        bool enforced = false;
+        [[maybe_unused]] std::shared_ptr<MountPointEntry> entry_ptr { nullptr };
+        if constexpr (option_pipeline_enforcement) {
+            auto [stream_entry, new_batch] = this->begin_directory_batch (dirp);
+            entry_ptr = std::move (stream_entry);
+
+            enforced = new_batch ? this->enforce_request (Descriptor::name (),
+                                       this->select_workflow<Descriptor::key> (dirp),
+                                       Descriptor::operation,
+                                       Descriptor::context,
+                                       1)
+                                 : (entry_ptr != nullptr);
+        }
+
+        // perform original POSIX operation (distinguishing errors from the end of the stream)
+        int saved_errno = errno;
+        errno = 0;
+        auto result = function (args...);
+        bool failed = (result == nullptr && errno != 0);
+        if (!failed) {
+            errno = saved_errno;
+        }
+
+        // detect refills of the stream's buffer, to be enforced at the next call
+        if constexpr (option_pipeline_enforcement) {
+            if (entry_ptr != nullptr) {
+                entry_ptr->end_stream_call (result);
+            }
+        }
+
+        // update statistic entry
+        if constexpr (option_pipeline_statistics) {
+            this->update_statistics (Descriptor::type,
+                Descriptor::entry,
+                failed ? -1 : 0,
+                enforced);
+        }
+
+        return result;
+    }
+
     /**
      * generate_statistics_report: generate report for the all statistic containers.
      * @param path File path to where the report should be stored.
      */
     void generate_statistics_report (const std::string_view& path);
 
+    /**
+     * initialize_statistics_exporter: start the live export of all statistic containers to a
+     * shared-memory region, if enabled through option_statistics_export_interval_env.
+     */
+    void initialize_statistics_exporter ();
+
     /**
      * get_metadata_unit: get number of MDT or MDS unit that the file at path belongs to.
      */
@@ -179,6 +810,23 @@ public:
      */
     void set_loaded (const bool& value);
 
+    /**
+     * is_file_descriptor_tracked: check if a file descriptor was opened through LdPreloadedPosix
+     * (i.e., if it has a mount point entry).
+     * @param fd File descriptor to be verified.
+     * @return Returns true if the file descriptor is tracked.
+     */
+    [[nodiscard]] bool is_file_descriptor_tracked (const int& fd) const;
+
+    /**
+     * is_io_uring_tracked: check if an io_uring instance was registered through LdPreloadedPosix
+     * and accepts submissions from any thread (so that they can be performed on behalf of the
+     * submitting thread, e.g., by the SeccompSupervisor).
+     * @param ring_fd File descriptor of the io_uring instance.
+     * @return Returns true if the instance is tracked.
+     */
+    [[nodiscard]] bool is_io_uring_tracked (const int& ring_fd);
+
     /**
      * get_statistic_entry: get statistic entry of a given stats container.
      * @param operation_type defines the class of the submitted operations. Used to select which
@@ -272,7 +920,8 @@ public:
 #endif
 
     /**
-     * ld_preloaded_posix_mmap:
+     * ld_preloaded_posix_mmap: if mmap sampling is enabled, file-backed mappings over registered
+     * mount points are registered in m_mmap_table, so that their faulted in pages are charged.
      * @param addr
      * @param lenght
      * @param prot
@@ -285,13 +934,294 @@ public:
     ld_preloaded_posix_mmap (void* addr, size_t lenght, int prot, int flags, int fd, off_t offset);
 
     /**
-     * ld_preloaded_posix_munmap:
+     * ld_preloaded_posix_munmap: the pages of sampled mappings that were faulted in since their
+     * previous sample are charged before being unmapped.
      * @param addr
      * @param lenght
      * @return
      */
     int ld_preloaded_posix_munmap (void* addr, size_t lenght);
 
+    /**
+     * ld_preloaded_posix_readv:
+     *  https://man7.org/linux/man-pages/man2/readv.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @return
+     */
+    ssize_t ld_preloaded_posix_readv (int fd, const struct iovec* iov, int iovcnt);
+
+    /**
+     * ld_preloaded_posix_writev:
+     *  https://man7.org/linux/man-pages/man2/writev.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @return
+     */
+    ssize_t ld_preloaded_posix_writev (int fd, const struct iovec* iov, int iovcnt);
+
+    /**
+     * ld_preloaded_posix_preadv:
+     *  https://man7.org/linux/man-pages/man2/preadv.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @param offset
+     * @return
+     */
+    ssize_t ld_preloaded_posix_preadv (int fd, const struct iovec* iov, int iovcnt, off_t offset);
+
+    /**
+     * ld_preloaded_posix_pwritev:
+     *  https://man7.org/linux/man-pages/man2/pwritev.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @param offset
+     * @return
+     */
+    ssize_t ld_preloaded_posix_pwritev (int fd, const struct iovec* iov, int iovcnt, off_t offset);
+
+    /**
+     * ld_preloaded_posix_preadv2:
+     *  https://man7.org/linux/man-pages/man2/preadv2.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @param offset
+     * @param flags
+     * @return
+     */
+    ssize_t ld_preloaded_posix_preadv2 (int fd,
+        const struct iovec* iov,
+        int iovcnt,
+        off_t offset,
+        int flags);
+
+    /**
+     * ld_preloaded_posix_pwritev2:
+     *  https://man7.org/linux/man-pages/man2/pwritev2.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @param offset
+     * @param flags
+     * @return
+     */
+    ssize_t ld_preloaded_posix_pwritev2 (int fd,
+        const struct iovec* iov,
+        int iovcnt,
+        off_t offset,
+        int flags);
+
+    /**
+     * ld_preloaded_posix_fread:
+     *  https://man7.org/linux/man-pages/man3/fread.3.html
+     * @param buffer
+     * @param size
+     * @param nmemb
+     * @param stream
+     * @return
+     */
+    size_t ld_preloaded_posix_fread (void* buffer, size_t size, size_t nmemb, FILE* stream);
+
+    /**
+     * ld_preloaded_posix_fwrite:
+     *  https://man7.org/linux/man-pages/man3/fread.3.html
+     * @param buffer
+     * @param size
+     * @param nmemb
+     * @param stream
+     * @return
+     */
+    size_t ld_preloaded_posix_fwrite (const void* buffer, size_t size, size_t nmemb, FILE* stream);
+
+    /**
+     * ld_preloaded_posix_fgets:
+     *  https://man7.org/linux/man-pages/man3/fgets.3.html
+     * @param buffer
+     * @param size
+     * @param stream
+     * @return
+     */
+    char* ld_preloaded_posix_fgets (char* buffer, int size, FILE* stream);
+
+    /**
+     * ld_preloaded_posix_fputs:
+     *  https://man7.org/linux/man-pages/man3/puts.3.html
+     * @param buffer
+     * @param stream
+     * @return
+     */
+    int ld_preloaded_posix_fputs (const char* buffer, FILE* stream);
+
+    /**
+     * ld_preloaded_posix_fprintf:
+     *  https://man7.org/linux/man-pages/man3/printf.3.html
+     * The variadic arguments of fprintf are forwarded as a va_list (submitted through vfprintf).
+     * @param stream
+     * @param format
+     * @param args
+     * @return
+     */
+    int ld_preloaded_posix_fprintf (FILE* stream, const char* format, va_list args);
+
+    /**
+     * ld_preloaded_posix_vfprintf:
+     *  https://man7.org/linux/man-pages/man3/printf.3.html
+     * @param stream
+     * @param format
+     * @param args
+     * @return
+     */
+    int ld_preloaded_posix_vfprintf (FILE* stream, const char* format, va_list args);
+
+    /**
+     * ld_preloaded_posix_fflush:
+     *  https://man7.org/linux/man-pages/man3/fflush.3.html
+     * @param stream
+     * @return
+     */
+    int ld_preloaded_posix_fflush (FILE* stream);
+
+    /**
+     * ld_preloaded_posix_copy_file_range:
+     *  https://man7.org/linux/man-pages/man2/copy_file_range.2.html
+     * @param fd_in
+     * @param off_in
+     * @param fd_out
+     * @param off_out
+     * @param len
+     * @param flags
+     * @return
+     */
+    ssize_t ld_preloaded_posix_copy_file_range (int fd_in,
+        off64_t* off_in,
+        int fd_out,
+        off64_t* off_out,
+        size_t len,
+        unsigned int flags);
+
+    /**
+     * ld_preloaded_posix_sendfile:
+     *  https://man7.org/linux/man-pages/man2/sendfile.2.html
+     * @param out_fd
+     * @param in_fd
+     * @param offset
+     * @param count
+     * @return
+     */
+    ssize_t ld_preloaded_posix_sendfile (int out_fd, int in_fd, off_t* offset, size_t count);
+
+    /**
+     * ld_preloaded_posix_sendfile64:
+     *  https://man7.org/linux/man-pages/man2/sendfile.2.html
+     * @param out_fd
+     * @param in_fd
+     * @param offset
+     * @param count
+     * @return
+     */
+    ssize_t ld_preloaded_posix_sendfile64 (int out_fd, int in_fd, off64_t* offset, size_t count);
+
+    /**
+     * ld_preloaded_posix_splice:
+     *  https://man7.org/linux/man-pages/man2/splice.2.html
+     * @param fd_in
+     * @param off_in
+     * @param fd_out
+     * @param off_out
+     * @param len
+     * @param flags
+     * @return
+     */
+    ssize_t ld_preloaded_posix_splice (int fd_in,
+        off64_t* off_in,
+        int fd_out,
+        off64_t* off_out,
+        size_t len,
+        unsigned int flags);
+
+    /**
+     * ld_preloaded_posix_io_uring_enter:
+     *  https://man7.org/linux/man-pages/man2/io_uring_enter.2.html
+     * @param fd
+     * @param to_submit
+     * @param min_complete
+     * @param flags
+     * @param arg
+     * @param argsz
+     * @return
+     */
+    int ld_preloaded_posix_io_uring_enter (unsigned int fd,
+        unsigned int to_submit,
+        unsigned int min_complete,
+        unsigned int flags,
+        const void* arg,
+        size_t argsz);
+
+    /**
+     * ld_preloaded_posix_aio_read:
+     *  https://man7.org/linux/man-pages/man3/aio_read.3.html
+     * @param aiocbp
+     * @return
+     */
+    int ld_preloaded_posix_aio_read (struct aiocb* aiocbp);
+
+    /**
+     * ld_preloaded_posix_aio_write:
+     *  https://man7.org/linux/man-pages/man3/aio_write.3.html
+     * @param aiocbp
+     * @return
+     */
+    int ld_preloaded_posix_aio_write (struct aiocb* aiocbp);
+
+    /**
+     * ld_preloaded_posix_aio_read64:
+     *  https://man7.org/linux/man-pages/man3/aio_read.3.html
+     * @param aiocbp
+     * @return
+     */
+    int ld_preloaded_posix_aio_read64 (struct aiocb64* aiocbp);
+
+    /**
+     * ld_preloaded_posix_aio_write64:
+     *  https://man7.org/linux/man-pages/man3/aio_write.3.html
+     * @param aiocbp
+     * @return
+     */
+    int ld_preloaded_posix_aio_write64 (struct aiocb64* aiocbp);
+
+    /**
+     * ld_preloaded_posix_lio_listio:
+     *  https://man7.org/linux/man-pages/man3/lio_listio.3.html
+     * @param mode
+     * @param list
+     * @param nent
+     * @param sig
+     * @return
+     */
+    int ld_preloaded_posix_lio_listio (int mode,
+        struct aiocb* const list[],
+        int nent,
+        struct sigevent* sig);
+
+    /**
+     * ld_preloaded_posix_lio_listio64:
+     *  https://man7.org/linux/man-pages/man3/lio_listio.3.html
+     * @param mode
+     * @param list
+     * @param nent
+     * @param sig
+     * @return
+     */
+    int ld_preloaded_posix_lio_listio64 (int mode,
+        struct aiocb64* const list[],
+        int nent,
+        struct sigevent* sig);
+
     /**
      * ld_preloaded_posix_open:
      *  https://linux.die.net/man/2/open
@@ -491,6 +1421,236 @@ public:
      */
     int ld_preloaded_posix_fclose (FILE* stream);
 
+    /**
+     * ld_preloaded_posix_stat:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param path
+     * @param statbuf
+     * @return
+     */
+    int ld_preloaded_posix_stat (const char* path, struct stat* statbuf);
+
+    /**
+     * ld_preloaded_posix_lstat:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param path
+     * @param statbuf
+     * @return
+     */
+    int ld_preloaded_posix_lstat (const char* path, struct stat* statbuf);
+
+    /**
+     * ld_preloaded_posix_fstat:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param fd
+     * @param statbuf
+     * @return
+     */
+    int ld_preloaded_posix_fstat (int fd, struct stat* statbuf);
+
+    /**
+     * ld_preloaded_posix_fstatat:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param dirfd
+     * @param path
+     * @param statbuf
+     * @param flags
+     * @return
+     */
+    int ld_preloaded_posix_fstatat (int dirfd, const char* path, struct stat* statbuf, int flags);
+
+    /**
+     * ld_preloaded_posix_statx:
+     *  https://man7.org/linux/man-pages/man2/statx.2.html
+     * @param dirfd
+     * @param path
+     * @param flags
+     * @param mask
+     * @param statxbuf
+     * @return
+     */
+    int ld_preloaded_posix_statx (int dirfd,
+        const char* path,
+        int flags,
+        unsigned int mask,
+        struct statx* statxbuf);
+
+    /**
+     * ld_preloaded_posix_access:
+     *  https://man7.org/linux/man-pages/man2/access.2.html
+     * @param path
+     * @param mode
+     * @return
+     */
+    int ld_preloaded_posix_access (const char* path, int mode);
+
+    /**
+     * ld_preloaded_posix_faccessat:
+     *  https://man7.org/linux/man-pages/man2/access.2.html
+     * @param dirfd
+     * @param path
+     * @param mode
+     * @param flags
+     * @return
+     */
+    int ld_preloaded_posix_faccessat (int dirfd, const char* path, int mode, int flags);
+
+    /**
+     * ld_preloaded_posix_stat64:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param path
+     * @param statbuf
+     * @return
+     */
+    int ld_preloaded_posix_stat64 (const char* path, struct stat64* statbuf);
+
+    /**
+     * ld_preloaded_posix_lstat64:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param path
+     * @param statbuf
+     * @return
+     */
+    int ld_preloaded_posix_lstat64 (const char* path, struct stat64* statbuf);
+
+    /**
+     * ld_preloaded_posix_fstat64:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param fd
+     * @param statbuf
+     * @return
+     */
+    int ld_preloaded_posix_fstat64 (int fd, struct stat64* statbuf);
+
+    /**
+     * ld_preloaded_posix_fstatat64:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param dirfd
+     * @param path
+     * @param statbuf
+     * @param flags
+     * @return
+     */
+    int ld_preloaded_posix_fstatat64 (int dirfd,
+        const char* path,
+        struct stat64* statbuf,
+        int flags);
+
+    /**
+     * ld_preloaded_posix_fsync:
+     *  https://man7.org/linux/man-pages/man2/fsync.2.html
+     * @param fd
+     * @return
+     */
+    int ld_preloaded_posix_fsync (int fd);
+
+    /**
+     * ld_preloaded_posix_fdatasync:
+     *  https://man7.org/linux/man-pages/man2/fsync.2.html
+     * @param fd
+     * @return
+     */
+    int ld_preloaded_posix_fdatasync (int fd);
+
+    /**
+     * ld_preloaded_posix_sync_file_range:
+     *  https://man7.org/linux/man-pages/man2/sync_file_range.2.html
+     * @param fd
+     * @param offset
+     * @param nbytes
+     * @param flags
+     * @return
+     */
+    int ld_preloaded_posix_sync_file_range (int fd,
+        off64_t offset,
+        off64_t nbytes,
+        unsigned int flags);
+
+    /**
+     * ld_preloaded_posix_syncfs:
+     *  https://man7.org/linux/man-pages/man2/sync.2.html
+     * @param fd
+     * @return
+     */
+    int ld_preloaded_posix_syncfs (int fd);
+
+    /**
+     * ld_preloaded_posix_truncate:
+     *  https://man7.org/linux/man-pages/man2/truncate.2.html
+     * @param path
+     * @param length
+     * @return
+     */
+    int ld_preloaded_posix_truncate (const char* path, off_t length);
+
+    /**
+     * ld_preloaded_posix_ftruncate:
+     *  https://man7.org/linux/man-pages/man2/truncate.2.html
+     * @param fd
+     * @param length
+     * @return
+     */
+    int ld_preloaded_posix_ftruncate (int fd, off_t length);
+
+    /**
+     * ld_preloaded_posix_fallocate:
+     *  https://man7.org/linux/man-pages/man2/fallocate.2.html
+     * @param fd
+     * @param mode
+     * @param offset
+     * @param length
+     * @return
+     */
+    int ld_preloaded_posix_fallocate (int fd, int mode, off_t offset, off_t length);
+
+    /**
+     * ld_preloaded_posix_posix_fallocate:
+     *  https://man7.org/linux/man-pages/man3/posix_fallocate.3.html
+     * @param fd
+     * @param offset
+     * @param length
+     * @return
+     */
+    int ld_preloaded_posix_posix_fallocate (int fd, off_t offset, off_t length);
+
+    /**
+     * ld_preloaded_posix_posix_fadvise:
+     *  https://man7.org/linux/man-pages/man2/posix_fadvise.2.html
+     * @param fd
+     * @param offset
+     * @param length
+     * @param advice
+     * @return
+     */
+    int ld_preloaded_posix_posix_fadvise (int fd, off_t offset, off_t length, int advice);
+
+    /**
+     * ld_preloaded_posix_io_uring_setup:
+     *  https://man7.org/linux/man-pages/man2/io_uring_setup.2.html
+     * @param entries
+     * @param params
+     * @return
+     */
+    int ld_preloaded_posix_io_uring_setup (unsigned int entries, struct io_uring_params* params);
+
+    /**
+     * ld_preloaded_posix_aio_fsync:
+     *  https://man7.org/linux/man-pages/man3/aio_fsync.3.html
+     * @param op
+     * @param aiocbp
+     * @return
+     */
+    int ld_preloaded_posix_aio_fsync (int op, struct aiocb* aiocbp);
+
+    /**
+     * ld_preloaded_posix_aio_fsync64:
+     *  https://man7.org/linux/man-pages/man3/aio_fsync.3.html
+     * @param op
+     * @param aiocbp
+     * @return
+     */
+    int ld_preloaded_posix_aio_fsync64 (int op, struct aiocb64* aiocbp);
+
     /**
      * ld_preloaded_posix_mkdir:
      *  https://linux.die.net/man/2/mkdir
@@ -537,6 +1697,56 @@ public:
      */
     int ld_preloaded_posix_rmdir (const char* path);
 
+    /**
+     * ld_preloaded_posix_opendir:
+     *  https://man7.org/linux/man-pages/man3/opendir.3.html
+     * @param path
+     * @return
+     */
+    DIR* ld_preloaded_posix_opendir (const char* path);
+
+    /**
+     * ld_preloaded_posix_fdopendir:
+     *  https://man7.org/linux/man-pages/man3/opendir.3.html
+     * @param fd
+     * @return
+     */
+    DIR* ld_preloaded_posix_fdopendir (int fd);
+
+    /**
+     * ld_preloaded_posix_readdir:
+     *  https://man7.org/linux/man-pages/man3/readdir.3.html
+     * @param dirp
+     * @return
+     */
+    struct dirent* ld_preloaded_posix_readdir (DIR* dirp);
+
+    /**
+     * ld_preloaded_posix_readdir64:
+     *  https://man7.org/linux/man-pages/man3/readdir.3.html
+     * @param dirp
+     * @return
+     */
+    struct dirent64* ld_preloaded_posix_readdir64 (DIR* dirp);
+
+    /**
+     * ld_preloaded_posix_getdents64:
+     *  https://man7.org/linux/man-pages/man2/getdents.2.html
+     * @param fd
+     * @param buffer
+     * @param count
+     * @return
+     */
+    ssize_t ld_preloaded_posix_getdents64 (int fd, void* buffer, size_t count);
+
+    /**
+     * ld_preloaded_posix_closedir:
+     *  https://man7.org/linux/man-pages/man3/closedir.3.html
+     * @param dirp
+     * @return
+     */
+    int ld_preloaded_posix_closedir (DIR* dirp);
+
     /**
      * ld_preloaded_posix_getxattr:
      *  https://linux.die.net/man/2/getxattr
@@ -666,6 +1876,54 @@ public:
      * @return
      */
     int ld_preloaded_posix_fcntl (int fd, int cmd, void* arg);
+
+    /**
+     * ld_preloaded_posix_chdir: change the working directory, and refresh the working directory
+     * cached by the MountPointTable (used to classify relative paths).
+     *  https://linux.die.net/man/2/chdir
+     * @param path
+     * @return
+     */
+    int ld_preloaded_posix_chdir (const char* path);
+
+    /**
+     * ld_preloaded_posix_fchdir: change the working directory, and refresh the working directory
+     * cached by the MountPointTable (used to classify relative paths).
+     *  https://linux.die.net/man/2/fchdir
+     * @param fd
+     * @return
+     */
+    int ld_preloaded_posix_fchdir (int fd);
+
+    /**
+     * ld_preloaded_posix_dup: duplicate a file descriptor, which shares the MountPointEntry of the
+     * original one.
+     *  https://linux.die.net/man/2/dup
+     * @param oldfd
+     * @return
+     */
+    int ld_preloaded_posix_dup (int oldfd);
+
+    /**
+     * ld_preloaded_posix_dup2: duplicate a file descriptor onto newfd, which shares the
+     * MountPointEntry of the original one (replacing its previous entry).
+     *  https://linux.die.net/man/2/dup2
+     * @param oldfd
+     * @param newfd
+     * @return
+     */
+    int ld_preloaded_posix_dup2 (int oldfd, int newfd);
+
+    /**
+     * ld_preloaded_posix_dup3: duplicate a file descriptor onto newfd, which shares the
+     * MountPointEntry of the original one (replacing its previous entry).
+     *  https://linux.die.net/man/2/dup3
+     * @param oldfd
+     * @param newfd
+     * @param flags
+     * @return
+     */
+    int ld_preloaded_posix_dup3 (int oldfd, int newfd, int flags);
 };
 } // namespace padll::interface::ldpreloaded
 
@@ -0,0 +1,598 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_OPERATION_DESCRIPTOR_HPP
+#define PADLL_OPERATION_DESCRIPTOR_HPP
+
+#include <padll/library_headers/libc_enums.hpp>
+#include <paio/stage/paio_stage.hpp>
+#include <string_view>
+
+using namespace padll::headers;
+
+namespace padll::interface::ldpreloaded {
+
+/**
+ * KeyKind class.
+ * Defines how the workflow of an intercepted call is selected, i.e., which argument of the call
+ * identifies the targeted file (and thus its mount point):
+ *  - kFileDescriptor: a file descriptor (int);
+ *  - kPath: a path, relative to the working directory (const char*);
+ *  - kDirectoryPath: a path, relative to a directory file descriptor (std::pair<int, const char*>);
+ *  - kFileStream: a file pointer (FILE*);
+ *  - kDirectoryStream: a directory stream (DIR*).
+ */
+enum class KeyKind {
+    kFileDescriptor = 0,
+    kPath = 1,
+    kDirectoryPath = 2,
+    kFileStream = 3,
+    kDirectoryStream = 4
+};
+
+/**
+ * OperationDescriptor struct.
+ * Compile-time description of an intercepted POSIX call, used by the interception pipeline
+ * (LdPreloadedPosix::intercept) to select the workflow, enforce the request, and update the
+ * statistics of the call, without any per-call code.
+ * @tparam Call Flat identifier of the call.
+ * @tparam Type Class of the call (selects the statistics container).
+ * @tparam Entry Index of the call in the statistics container (e.g., Data::read).
+ * @tparam Operation PAIO operation type of the call.
+ * @tparam Context PAIO operation context of the call.
+ * @tparam Key Kind of the argument that identifies the targeted file.
+ */
+template <PosixCall Call,
+    OperationType::_enumerated Type,
+    int Entry,
+    paio::core::POSIX Operation,
+    paio::core::POSIX_META Context,
+    KeyKind Key>
+struct OperationDescriptor {
+    static constexpr PosixCall call { Call };
+    static constexpr OperationType::_enumerated type { Type };
+    static constexpr int entry { Entry };
+    static constexpr int operation { static_cast<int> (Operation) };
+    static constexpr int context { static_cast<int> (Context) };
+    static constexpr KeyKind key { Key };
+
+    /**
+     * name: name of the call, used for detailed logging.
+     * @return Returns the name of the call.
+     */
+    static constexpr std::string_view name ()
+    {
+        return posix_call_names[static_cast<std::size_t> (Call)];
+    }
+};
+
+/**
+ * Descriptors of the calls handled by the interception pipeline. Calls that register or remove
+ * file descriptors, file pointers, and directory streams (open, close, fopen, fclose, opendir,
+ * closedir, ...) keep their own sequence.
+ */
+namespace descriptors {
+
+using paio::core::POSIX;
+using paio::core::POSIX_META;
+
+/**
+ * durability_op: operation context of durability calls (fsync, fdatasync, sync_file_range, syncfs,
+ * and sync). PAIO does not define a context for flushes, so these are submitted with the
+ * POSIX_META::file_mod_op context, which no other call uses; this allows the controller to
+ * differentiate (and rate limit) flushes apart from data and metadata requests.
+ */
+constexpr POSIX_META durability_op { POSIX_META::file_mod_op };
+
+// data calls
+using read = OperationDescriptor<PosixCall::read,
+    OperationType::data_calls,
+    Data::read,
+    POSIX::read,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using write = OperationDescriptor<PosixCall::write,
+    OperationType::data_calls,
+    Data::write,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using pread = OperationDescriptor<PosixCall::pread,
+    OperationType::data_calls,
+    Data::pread,
+    POSIX::pread,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using pwrite = OperationDescriptor<PosixCall::pwrite,
+    OperationType::data_calls,
+    Data::pwrite,
+    POSIX::pwrite,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using pread64 = OperationDescriptor<PosixCall::pread64,
+    OperationType::data_calls,
+    Data::pread64,
+    POSIX::pread64,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using pwrite64 = OperationDescriptor<PosixCall::pwrite64,
+    OperationType::data_calls,
+    Data::pwrite64,
+    POSIX::pwrite64,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+
+// vectored data calls (classified as the respective read/write call; the request is charged the
+// summed length of all buffers)
+using readv = OperationDescriptor<PosixCall::readv,
+    OperationType::data_calls,
+    Data::readv,
+    POSIX::read,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using writev = OperationDescriptor<PosixCall::writev,
+    OperationType::data_calls,
+    Data::writev,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using preadv = OperationDescriptor<PosixCall::preadv,
+    OperationType::data_calls,
+    Data::preadv,
+    POSIX::pread,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using pwritev = OperationDescriptor<PosixCall::pwritev,
+    OperationType::data_calls,
+    Data::pwritev,
+    POSIX::pwrite,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using preadv2 = OperationDescriptor<PosixCall::preadv2,
+    OperationType::data_calls,
+    Data::preadv2,
+    POSIX::pread,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using pwritev2 = OperationDescriptor<PosixCall::pwritev2,
+    OperationType::data_calls,
+    Data::pwritev2,
+    POSIX::pwrite,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+
+// stream (stdio) data calls (classified as read/write; the request is charged the bytes that the
+// stream's buffer refills from, or flushes to, the file)
+using fread = OperationDescriptor<PosixCall::fread,
+    OperationType::data_calls,
+    Data::fread,
+    POSIX::read,
+    POSIX_META::data_op,
+    KeyKind::kFileStream>;
+using fwrite = OperationDescriptor<PosixCall::fwrite,
+    OperationType::data_calls,
+    Data::fwrite,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileStream>;
+using fgets = OperationDescriptor<PosixCall::fgets,
+    OperationType::data_calls,
+    Data::fgets,
+    POSIX::read,
+    POSIX_META::data_op,
+    KeyKind::kFileStream>;
+using fputs = OperationDescriptor<PosixCall::fputs,
+    OperationType::data_calls,
+    Data::fputs,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileStream>;
+using fprintf = OperationDescriptor<PosixCall::fprintf,
+    OperationType::data_calls,
+    Data::fprintf,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileStream>;
+using vfprintf = OperationDescriptor<PosixCall::vfprintf,
+    OperationType::data_calls,
+    Data::vfprintf,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileStream>;
+using fflush = OperationDescriptor<PosixCall::fflush,
+    OperationType::data_calls,
+    Data::fflush,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileStream>;
+
+// zero-copy transfer calls (charged as a read on the source and as a write on the destination;
+// see intercept_transfer)
+using copy_file_range = OperationDescriptor<PosixCall::copy_file_range,
+    OperationType::data_calls,
+    Data::copy_file_range,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using sendfile = OperationDescriptor<PosixCall::sendfile,
+    OperationType::data_calls,
+    Data::sendfile,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using sendfile64 = OperationDescriptor<PosixCall::sendfile64,
+    OperationType::data_calls,
+    Data::sendfile64,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using splice = OperationDescriptor<PosixCall::splice,
+    OperationType::data_calls,
+    Data::splice,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+
+// io_uring submissions (each SQE is charged on its own; see enforce_io_uring_submissions)
+using io_uring_enter = OperationDescriptor<PosixCall::io_uring_enter,
+    OperationType::data_calls,
+    Data::io_uring_enter,
+    POSIX::no_op,
+    POSIX_META::no_op,
+    KeyKind::kFileDescriptor>;
+
+// POSIX AIO submissions (each control block is charged with its size; see intercept_aio)
+using aio_read = OperationDescriptor<PosixCall::aio_read,
+    OperationType::data_calls,
+    Data::aio_read,
+    POSIX::read,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using aio_write = OperationDescriptor<PosixCall::aio_write,
+    OperationType::data_calls,
+    Data::aio_write,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using aio_read64 = OperationDescriptor<PosixCall::aio_read64,
+    OperationType::data_calls,
+    Data::aio_read64,
+    POSIX::read,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using aio_write64 = OperationDescriptor<PosixCall::aio_write64,
+    OperationType::data_calls,
+    Data::aio_write64,
+    POSIX::write,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using lio_listio = OperationDescriptor<PosixCall::lio_listio,
+    OperationType::data_calls,
+    Data::lio_listio,
+    POSIX::no_op,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+using lio_listio64 = OperationDescriptor<PosixCall::lio_listio64,
+    OperationType::data_calls,
+    Data::lio_listio64,
+    POSIX::no_op,
+    POSIX_META::data_op,
+    KeyKind::kFileDescriptor>;
+
+// metadata calls
+using statfs = OperationDescriptor<PosixCall::statfs,
+    OperationType::metadata_calls,
+    Metadata::statfs,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using fstatfs = OperationDescriptor<PosixCall::fstatfs,
+    OperationType::metadata_calls,
+    Metadata::fstatfs,
+    POSIX::fstatfs,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+using statfs64 = OperationDescriptor<PosixCall::statfs64,
+    OperationType::metadata_calls,
+    Metadata::statfs64,
+    POSIX::statfs64,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using fstatfs64 = OperationDescriptor<PosixCall::fstatfs64,
+    OperationType::metadata_calls,
+    Metadata::fstatfs64,
+    POSIX::fstatfs64,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+using unlink = OperationDescriptor<PosixCall::unlink,
+    OperationType::metadata_calls,
+    Metadata::unlink,
+    POSIX::unlink,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using unlinkat = OperationDescriptor<PosixCall::unlinkat,
+    OperationType::metadata_calls,
+    Metadata::unlinkat,
+    POSIX::unlink,
+    POSIX_META::meta_op,
+    KeyKind::kDirectoryPath>;
+using rename = OperationDescriptor<PosixCall::rename,
+    OperationType::metadata_calls,
+    Metadata::rename,
+    POSIX::rename,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using renameat = OperationDescriptor<PosixCall::renameat,
+    OperationType::metadata_calls,
+    Metadata::renameat,
+    POSIX::rename,
+    POSIX_META::meta_op,
+    KeyKind::kDirectoryPath>;
+
+// stat family calls (classified as statfs/fstatfs; file attribute lookups, as statfs, are
+// constant-cost metadata requests)
+using stat = OperationDescriptor<PosixCall::stat,
+    OperationType::metadata_calls,
+    Metadata::stat,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using lstat = OperationDescriptor<PosixCall::lstat,
+    OperationType::metadata_calls,
+    Metadata::lstat,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using fstat = OperationDescriptor<PosixCall::fstat,
+    OperationType::metadata_calls,
+    Metadata::fstat,
+    POSIX::fstatfs,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+using fstatat = OperationDescriptor<PosixCall::fstatat,
+    OperationType::metadata_calls,
+    Metadata::fstatat,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kDirectoryPath>;
+using statx = OperationDescriptor<PosixCall::statx,
+    OperationType::metadata_calls,
+    Metadata::statx,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kDirectoryPath>;
+using access = OperationDescriptor<PosixCall::access,
+    OperationType::metadata_calls,
+    Metadata::access,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using faccessat = OperationDescriptor<PosixCall::faccessat,
+    OperationType::metadata_calls,
+    Metadata::faccessat,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kDirectoryPath>;
+using stat64 = OperationDescriptor<PosixCall::stat64,
+    OperationType::metadata_calls,
+    Metadata::stat64,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using lstat64 = OperationDescriptor<PosixCall::lstat64,
+    OperationType::metadata_calls,
+    Metadata::lstat64,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using fstat64 = OperationDescriptor<PosixCall::fstat64,
+    OperationType::metadata_calls,
+    Metadata::fstat64,
+    POSIX::fstatfs,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+using fstatat64 = OperationDescriptor<PosixCall::fstatat64,
+    OperationType::metadata_calls,
+    Metadata::fstatat64,
+    POSIX::statfs,
+    POSIX_META::meta_op,
+    KeyKind::kDirectoryPath>;
+
+// durability calls (sync_file_range is classified as fdatasync); all durability calls, including
+// sync, are submitted with the durability_op context
+using fsync = OperationDescriptor<PosixCall::fsync,
+    OperationType::metadata_calls,
+    Metadata::fsync,
+    POSIX::fsync,
+    durability_op,
+    KeyKind::kFileDescriptor>;
+using fdatasync = OperationDescriptor<PosixCall::fdatasync,
+    OperationType::metadata_calls,
+    Metadata::fdatasync,
+    POSIX::fdatasync,
+    durability_op,
+    KeyKind::kFileDescriptor>;
+using sync_file_range = OperationDescriptor<PosixCall::sync_file_range,
+    OperationType::metadata_calls,
+    Metadata::sync_file_range,
+    POSIX::fdatasync,
+    durability_op,
+    KeyKind::kFileDescriptor>;
+using syncfs = OperationDescriptor<PosixCall::syncfs,
+    OperationType::metadata_calls,
+    Metadata::syncfs,
+    POSIX::syncfs,
+    durability_op,
+    KeyKind::kFileDescriptor>;
+
+// space management calls (fallocate and posix_fallocate are classified as ftruncate); requests
+// are charged with a weight proportional to the targeted size (see space_payload), while
+// posix_fadvise hints are only accounted (not enforced)
+using truncate = OperationDescriptor<PosixCall::truncate,
+    OperationType::metadata_calls,
+    Metadata::truncate,
+    POSIX::truncate,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using ftruncate = OperationDescriptor<PosixCall::ftruncate,
+    OperationType::metadata_calls,
+    Metadata::ftruncate,
+    POSIX::ftruncate,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+using fallocate = OperationDescriptor<PosixCall::fallocate,
+    OperationType::metadata_calls,
+    Metadata::fallocate,
+    POSIX::ftruncate,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+using posix_fallocate = OperationDescriptor<PosixCall::posix_fallocate,
+    OperationType::metadata_calls,
+    Metadata::posix_fallocate,
+    POSIX::ftruncate,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+using posix_fadvise = OperationDescriptor<PosixCall::posix_fadvise,
+    OperationType::metadata_calls,
+    Metadata::posix_fadvise,
+    POSIX::no_op,
+    POSIX_META::no_op,
+    KeyKind::kFileDescriptor>;
+
+// io_uring instances (not enforced; instances are registered to inspect their submissions)
+using io_uring_setup = OperationDescriptor<PosixCall::io_uring_setup,
+    OperationType::metadata_calls,
+    Metadata::io_uring_setup,
+    POSIX::no_op,
+    POSIX_META::no_op,
+    KeyKind::kFileDescriptor>;
+
+// POSIX AIO durability calls (O_DSYNC requests are charged as fdatasync)
+using aio_fsync = OperationDescriptor<PosixCall::aio_fsync,
+    OperationType::metadata_calls,
+    Metadata::aio_fsync,
+    POSIX::fsync,
+    durability_op,
+    KeyKind::kFileDescriptor>;
+using aio_fsync64 = OperationDescriptor<PosixCall::aio_fsync64,
+    OperationType::metadata_calls,
+    Metadata::aio_fsync64,
+    POSIX::fsync,
+    durability_op,
+    KeyKind::kFileDescriptor>;
+
+// directory calls
+using mkdir = OperationDescriptor<PosixCall::mkdir,
+    OperationType::directory_calls,
+    Directory::mkdir,
+    POSIX::mkdir,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using mkdirat = OperationDescriptor<PosixCall::mkdirat,
+    OperationType::directory_calls,
+    Directory::mkdirat,
+    POSIX::mkdir,
+    POSIX_META::meta_op,
+    KeyKind::kDirectoryPath>;
+using mknod = OperationDescriptor<PosixCall::mknod,
+    OperationType::directory_calls,
+    Directory::mknod,
+    POSIX::mknod,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using mknodat = OperationDescriptor<PosixCall::mknodat,
+    OperationType::directory_calls,
+    Directory::mknodat,
+    POSIX::mknod,
+    POSIX_META::meta_op,
+    KeyKind::kDirectoryPath>;
+using rmdir = OperationDescriptor<PosixCall::rmdir,
+    OperationType::directory_calls,
+    Directory::rmdir,
+    POSIX::rmdir,
+    POSIX_META::dir_op,
+    KeyKind::kPath>;
+
+// directory enumeration calls (classified as read; readdir is charged once per refill of the
+// directory stream's buffer, and getdents64 once per call)
+using readdir = OperationDescriptor<PosixCall::readdir,
+    OperationType::directory_calls,
+    Directory::readdir,
+    POSIX::read,
+    POSIX_META::dir_op,
+    KeyKind::kDirectoryStream>;
+using readdir64 = OperationDescriptor<PosixCall::readdir64,
+    OperationType::directory_calls,
+    Directory::readdir64,
+    POSIX::read,
+    POSIX_META::dir_op,
+    KeyKind::kDirectoryStream>;
+using getdents64 = OperationDescriptor<PosixCall::getdents64,
+    OperationType::directory_calls,
+    Directory::getdents64,
+    POSIX::read,
+    POSIX_META::dir_op,
+    KeyKind::kFileDescriptor>;
+
+// extended attributes calls
+using getxattr = OperationDescriptor<PosixCall::getxattr,
+    OperationType::ext_attr_calls,
+    ExtendedAttributes::getxattr,
+    POSIX::getxattr,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using lgetxattr = OperationDescriptor<PosixCall::lgetxattr,
+    OperationType::ext_attr_calls,
+    ExtendedAttributes::lgetxattr,
+    POSIX::getxattr,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using fgetxattr = OperationDescriptor<PosixCall::fgetxattr,
+    OperationType::ext_attr_calls,
+    ExtendedAttributes::fgetxattr,
+    POSIX::getxattr,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+using setxattr = OperationDescriptor<PosixCall::setxattr,
+    OperationType::ext_attr_calls,
+    ExtendedAttributes::setxattr,
+    POSIX::setxattr,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using lsetxattr = OperationDescriptor<PosixCall::lsetxattr,
+    OperationType::ext_attr_calls,
+    ExtendedAttributes::lsetxattr,
+    POSIX::setxattr,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using fsetxattr = OperationDescriptor<PosixCall::fsetxattr,
+    OperationType::ext_attr_calls,
+    ExtendedAttributes::fsetxattr,
+    POSIX::setxattr,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+using listxattr = OperationDescriptor<PosixCall::listxattr,
+    OperationType::ext_attr_calls,
+    ExtendedAttributes::listxattr,
+    POSIX::listxattr,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using llistxattr = OperationDescriptor<PosixCall::llistxattr,
+    OperationType::ext_attr_calls,
+    ExtendedAttributes::llistxattr,
+    POSIX::listxattr,
+    POSIX_META::meta_op,
+    KeyKind::kPath>;
+using flistxattr = OperationDescriptor<PosixCall::flistxattr,
+    OperationType::ext_attr_calls,
+    ExtendedAttributes::flistxattr,
+    POSIX::listxattr,
+    POSIX_META::meta_op,
+    KeyKind::kFileDescriptor>;
+
+} // namespace descriptors
+} // namespace padll::interface::ldpreloaded
+
+#endif // PADLL_OPERATION_DESCRIPTOR_HPP
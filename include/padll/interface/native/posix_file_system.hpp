@@ -8,24 +8,46 @@
 
 #include <cstdarg>
 #include <cstring>
-#include <padll/configurations/libc_calls.hpp>
+#include <padll/configurations/padll_configuration.hpp>
 #include <padll/interface/ldpreloaded/ld_preloaded_posix.hpp>
+#include <padll/interface/native/seccomp_supervisor.hpp>
+#include <padll/interface/native/syscall_rewriter.hpp>
 #include <padll/interface/passthrough/posix_passthrough.hpp>
 #include <padll/utils/log.hpp>
 #include <thread>
+#include <type_traits>
 
 namespace ldp = padll::interface::ldpreloaded;
 namespace ptr = padll::interface::passthrough;
+namespace nat = padll::interface::native;
 namespace opt = padll::options;
+namespace cfg = padll::configurations;
 namespace lgr = padll::utils::log;
 
+/**
+ * m_intercept_mask: bitmask of the calls to be handled by LdPreloadedPosix, preloaded from the
+ * runtime configuration (parsed once, at library load). Until it is initialized, all calls follow
+ * the passthrough workflow.
+ */
+const cfg::InterceptMask m_intercept_mask { cfg::padll_configuration ().get_intercept_mask () };
+
+/**
+ * is_intercepted: check if a given call is to be handled by LdPreloadedPosix.
+ * @param call PosixCall to be verified.
+ * @return Returns true if the call is to be enforced; false if it follows the passthrough workflow.
+ */
+static inline bool is_intercepted (const PosixCall& call)
+{
+    return m_intercept_mask.test (call);
+}
+
 /**
  * s_logger: static logging object.
  */
 const std::shared_ptr<lgr::Log> m_logger_ptr { std::make_shared<lgr::Log> (
     opt::option_default_enable_debug_level,
     opt::option_default_enable_debug_with_ld_preload,
-    std::string { opt::option_default_log_path }) };
+    cfg::padll_configuration ().get_log_path ()) };
 
 /**
  * PosixPassthrough file system object.
@@ -33,19 +55,47 @@ const std::shared_ptr<lgr::Log> m_logger_ptr { std::make_shared<lgr::Log> (
 ptr::PosixPassthrough m_posix_passthrough { std::string (option_library_name), m_logger_ptr };
 
 /**
- * Shared atomic object to define if the LdPreloadedPosix object is fully initialized (including
- * syscall pointers, mountpoint table,  logging, ...)
+ * Atomic object to define if the LdPreloadedPosix object is fully initialized (including syscall
+ * pointers, mountpoint table,  logging, ...). It is constant-initialized and trivially
+ * destructible, so it can be read by calls issued before the library's static objects are
+ * constructed, or after they are destroyed (e.g., stdio writes of the logging backend).
  */
-std::shared_ptr<std::atomic<bool>> m_ldp_loaded { std::make_shared<std::atomic<bool>> (false) };
+std::atomic<bool> m_ldp_loaded_flag { false };
+
+/**
+ * Shared handle of m_ldp_loaded_flag, handed to the LdPreloadedPosix object (which does not own
+ * the flag).
+ */
+std::shared_ptr<std::atomic<bool>> m_ldp_loaded { &m_ldp_loaded_flag, [] (std::atomic<bool>*) {} };
 
 /**
  * LdPreloaded file system object.
  */
 ldp::LdPreloadedPosix m_ld_preloaded_posix { std::string (option_library_name),
-    option_default_statistic_collection,
+    cfg::padll_configuration ().is_statistic_collection_enabled (),
     m_logger_ptr,
     m_ldp_loaded };
 
+/**
+ * route: route an intercepted call to LdPreloadedPosix, if the call is to be enforced and the
+ * LdPreloadedPosix object is loaded, or to PosixPassthrough otherwise. Both targets must share the
+ * same signature; overloaded calls (e.g., open) select the overload through Result and Params.
+ * @tparam Call PosixCall being routed.
+ * @param intercepted LdPreloadedPosix method that handles the call.
+ * @param passthrough PosixPassthrough method that handles the call.
+ * @param args Arguments of the call.
+ * @return Returns the result of the call.
+ */
+template <PosixCall Call, typename Result, typename... Params, typename... Args>
+static inline Result route (Result (ldp::LdPreloadedPosix::*intercepted) (Params...),
+    Result (ptr::PosixPassthrough::*passthrough) (Params...),
+    Args... args)
+{
+    return (is_intercepted (Call) && m_ldp_loaded_flag.load ())
+        ? (m_ld_preloaded_posix.*intercepted) (args...)
+        : (m_posix_passthrough.*passthrough) (args...);
+}
+
 /**
  * init_method: constructor of the PosixFileSystem.
  * This method is executed before the program executes its main (). Under shared objects, this
@@ -66,185 +116,468 @@ static __attribute__ ((destructor)) void destroy_method ()
 }
 
 /**
- * read: intercept POSIX read. Operation will be submitted to passthrough or enforced (rate limited)
- * depending on the PosixDataCalls configurations.
- * @param fd
- * @param buf
- * @param size
- * @return
+ * log_argument: convert an argument of an intercepted call to the string of its detailed logging
+ * message.
+ * @param value Argument of the call.
+ * @return Returns the string of the argument.
  */
-extern "C" ssize_t read (int fd, void* buf, size_t size)
+template <typename Type, typename = std::enable_if_t<std::is_integral_v<Type>>>
+static inline std::string log_argument (const Type& value)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (fd) },
-        std::string_view { std::to_string (size) });
-#endif
-
-    return (posix_data_calls.padll_intercept_read && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_read (fd, buf, size)
-        : m_posix_passthrough.passthrough_posix_read (fd, buf, size);
+    return std::to_string (value);
 }
 
 /**
- * write: intercept POSIX write. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the PosixDataCalls configurations.
- * @param fd
- * @param buf
- * @param size
- * @return
+ * log_argument: convert a path (or name) argument to the string of its detailed logging message.
+ * @param value Argument of the call.
+ * @return Returns the string of the argument.
  */
-extern "C" ssize_t write (int fd, const void* buf, size_t size)
+static inline std::string log_argument (const char* value)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (fd) },
-        std::string_view { std::to_string (size) });
-#endif
-
-    return (posix_data_calls.padll_intercept_write && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_write (fd, buf, size)
-        : m_posix_passthrough.passthrough_posix_write (fd, buf, size);
+    return (value != nullptr) ? value : "";
 }
 
 /**
- * pread: intercept POSIX pread. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the PosixDataCalls configurations.
- * @param fd
- * @param buf
- * @param size
- * @param offset
- * @return
+ * log_argument: convert an asynchronous I/O control block to the string of its detailed logging
+ * message (its file descriptor).
+ * @param aiocbp Control block of the call.
+ * @return Returns the string of the argument.
  */
-extern "C" ssize_t pread (int fd, void* buf, size_t size, off_t offset)
+static inline std::string log_argument (const struct aiocb* aiocbp)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (fd) },
-        std::string_view { std::to_string (size) });
-#endif
-
-    return (posix_data_calls.padll_intercept_pread && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_pread (fd, buf, size, offset)
-        : m_posix_passthrough.passthrough_posix_pread (fd, buf, size, offset);
+    return std::to_string ((aiocbp != nullptr) ? aiocbp->aio_fildes : -1);
 }
 
 /**
- * pwrite: intercept POSIX pwrite. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the PosixDataCalls configurations.
- * @param fd
- * @param buf
- * @param size
- * @param offset
- * @return
+ * log_argument: convert an asynchronous I/O control block (64-bit) to the string of its detailed
+ * logging message (its file descriptor).
+ * @param aiocbp Control block of the call.
+ * @return Returns the string of the argument.
  */
-extern "C" ssize_t pwrite (int fd, const void* buf, size_t size, off_t offset)
+static inline std::string log_argument (const struct aiocb64* aiocbp)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (fd) },
-        std::string_view { std::to_string (size) });
-#endif
-
-    return (posix_data_calls.padll_intercept_pwrite && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_pwrite (fd, buf, size, offset)
-        : m_posix_passthrough.passthrough_posix_pwrite (fd, buf, size, offset);
+    return std::to_string ((aiocbp != nullptr) ? aiocbp->aio_fildes : -1);
 }
 
 /**
- * pread64: intercept POSIX pread64. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the PosixDataCalls configurations.
- * @param fd
- * @param buf
- * @param size
- * @param offset
- * @return
+ * log_routine: create the detailed logging message of an intercepted call (only if
+ * OPTION_DETAILED_LOGGING is enabled).
+ * @param routine Name of the call.
+ * @param args Arguments to be logged (one or two).
  */
-#if defined(__USE_LARGEFILE64)
-extern "C" ssize_t pread64 (int fd, void* buf, size_t size, off64_t offset)
+template <typename... Args>
+static inline void log_routine ([[maybe_unused]] const char* routine,
+    [[maybe_unused]] const Args&... args)
 {
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (fd) },
-        std::string_view { std::to_string (size) });
+    m_logger_ptr->create_routine_log_message (routine, std::string_view { log_argument (args) }...);
 #endif
-
-    return (posix_data_calls.padll_intercept_pread64 && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_pread64 (fd, buf, size, offset)
-        : m_posix_passthrough.passthrough_posix_pread64 (fd, buf, size, offset);
 }
-#endif
 
 /**
- * pwrite64: intercept POSIX pwrite64. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the PosixDataCalls configurations.
- * @param fd
- * @param buf
- * @param size
- * @param offset
- * @return
+ * PADLL_EXPAND: expand a parenthesized list of arguments.
  */
-#if defined(__USE_LARGEFILE64)
-extern "C" ssize_t pwrite64 (int fd, const void* buf, size_t size, off64_t offset)
-{
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (fd) },
-        std::string_view { std::to_string (size) });
-#endif
+#define PADLL_EXPAND(...) __VA_ARGS__
 
-    return (posix_data_calls.padll_intercept_pwrite64 && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_pwrite64 (fd, buf, size, offset)
-        : m_posix_passthrough.passthrough_posix_pwrite64 (fd, buf, size, offset);
-}
-#endif
+/**
+ * PADLL_INTERCEPT_CALL: define the wrapper of an intercepted call. Operation will be submitted to
+ * passthrough or enforced (rate limited) depending on the call's configurations (see route).
+ */
+#define PADLL_INTERCEPT_CALL(symbol, call, result, params, args, logged)                           \
+    extern "C" result symbol params                                                                \
+    {                                                                                              \
+        log_routine (#symbol, PADLL_EXPAND logged);                                                \
+        return route<PosixCall::call> (&ldp::LdPreloadedPosix::ld_preloaded_posix_##call,          \
+            &ptr::PosixPassthrough::passthrough_posix_##call,                                      \
+            PADLL_EXPAND args);                                                                    \
+    }
 
 /**
- * mmap: intercept POSIX mmap. Operation will be submitted to passthrough or enforced (rate limited)
- * depending on the PosixDataCalls configurations.
- * @param addr
- * @param length
- * @param prot
- * @param flags
- * @param fd
- * @param offset
- * @return
+ * PADLL_INTERCEPT_STREAM_CALL: define the wrapper of an intercepted stdio or directory stream call.
+ * These are not logged, since the logging backend writes through stdio.
  */
-extern "C" void* mmap (void* addr, size_t length, int prot, int flags, int fd, off_t offset)
-{
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, std::string_view { std::to_string (fd) });
+#define PADLL_INTERCEPT_STREAM_CALL(symbol, call, result, params, args)                            \
+    extern "C" result symbol params                                                                \
+    {                                                                                              \
+        return route<PosixCall::call> (&ldp::LdPreloadedPosix::ld_preloaded_posix_##call,          \
+            &ptr::PosixPassthrough::passthrough_posix_##call,                                      \
+            PADLL_EXPAND args);                                                                    \
+    }
+
+/**
+ * PADLL_DATA_CALLS: data calls intercepted through the standard wrapper (PADLL_INTERCEPT_CALL),
+ * listed as X (symbol, call, result, params, args, logged). The wrapper of symbol, with the given
+ * result type and parameters, logs the logged arguments and routes args to the LdPreloadedPosix and
+ * PosixPassthrough methods of call. Calls with variadic arguments, without arguments, or with
+ * extra checks (open, fprintf, fcntl, sync, syscall, fortified entry points, ...) are written
+ * separately.
+ */
+#define PADLL_DATA_CALLS(X)                                                                        \
+    X (read, read, ssize_t, (int fd, void* buf, size_t size), (fd, buf, size), (fd, size))         \
+    X (write, write, ssize_t, (int fd, const void* buf, size_t size), (fd, buf, size), (fd, size)) \
+    X (pread,                                                                                      \
+        pread,                                                                                     \
+        ssize_t,                                                                                   \
+        (int fd, void* buf, size_t size, off_t offset),                                            \
+        (fd, buf, size, offset),                                                                   \
+        (fd, size))                                                                                \
+    X (pwrite,                                                                                     \
+        pwrite,                                                                                    \
+        ssize_t,                                                                                   \
+        (int fd, const void* buf, size_t size, off_t offset),                                      \
+        (fd, buf, size, offset),                                                                   \
+        (fd, size))                                                                                \
+    X (mmap,                                                                                       \
+        mmap,                                                                                      \
+        void*,                                                                                     \
+        (void* addr, size_t length, int prot, int flags, int fd, off_t offset),                    \
+        (addr, length, prot, flags, fd, offset),                                                   \
+        (fd))                                                                                      \
+    X (munmap, munmap, int, (void* addr, size_t length), (addr, length), ("?"))                    \
+    X (readv,                                                                                      \
+        readv,                                                                                     \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt),                                             \
+        (fd, iov, iovcnt),                                                                         \
+        (fd, iovcnt))                                                                              \
+    X (writev,                                                                                     \
+        writev,                                                                                    \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt),                                             \
+        (fd, iov, iovcnt),                                                                         \
+        (fd, iovcnt))                                                                              \
+    X (preadv,                                                                                     \
+        preadv,                                                                                    \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt, off_t offset),                               \
+        (fd, iov, iovcnt, offset),                                                                 \
+        (fd, iovcnt))                                                                              \
+    X (pwritev,                                                                                    \
+        pwritev,                                                                                   \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt, off_t offset),                               \
+        (fd, iov, iovcnt, offset),                                                                 \
+        (fd, iovcnt))                                                                              \
+    X (preadv2,                                                                                    \
+        preadv2,                                                                                   \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt, off_t offset, int flags),                    \
+        (fd, iov, iovcnt, offset, flags),                                                          \
+        (fd, iovcnt))                                                                              \
+    X (pwritev2,                                                                                   \
+        pwritev2,                                                                                  \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt, off_t offset, int flags),                    \
+        (fd, iov, iovcnt, offset, flags),                                                          \
+        (fd, iovcnt))                                                                              \
+    X (copy_file_range,                                                                            \
+        copy_file_range,                                                                           \
+        ssize_t,                                                                                   \
+        (int fd_in, off64_t* off_in, int fd_out, off64_t* off_out, size_t len,                     \
+            unsigned int flags),                                                                   \
+        (fd_in, off_in, fd_out, off_out, len, flags),                                              \
+        (fd_in, fd_out))                                                                           \
+    X (sendfile,                                                                                   \
+        sendfile,                                                                                  \
+        ssize_t,                                                                                   \
+        (int out_fd, int in_fd, off_t* offset, size_t count),                                      \
+        (out_fd, in_fd, offset, count),                                                            \
+        (in_fd, out_fd))                                                                           \
+    X (sendfile64,                                                                                 \
+        sendfile64,                                                                                \
+        ssize_t,                                                                                   \
+        (int out_fd, int in_fd, off64_t* offset, size_t count),                                    \
+        (out_fd, in_fd, offset, count),                                                            \
+        (in_fd, out_fd))                                                                           \
+    X (splice,                                                                                     \
+        splice,                                                                                    \
+        ssize_t,                                                                                   \
+        (int fd_in, off64_t* off_in, int fd_out, off64_t* off_out, size_t len,                     \
+            unsigned int flags),                                                                   \
+        (fd_in, off_in, fd_out, off_out, len, flags),                                              \
+        (fd_in, fd_out))                                                                           \
+    X (aio_read, aio_read, int, (struct aiocb* aiocbp), (aiocbp), (aiocbp))                        \
+    X (aio_write, aio_write, int, (struct aiocb* aiocbp), (aiocbp), (aiocbp))                      \
+    X (aio_read64, aio_read64, int, (struct aiocb64* aiocbp), (aiocbp), (aiocbp))                  \
+    X (aio_write64, aio_write64, int, (struct aiocb64* aiocbp), (aiocbp), (aiocbp))                \
+    X (lio_listio,                                                                                 \
+        lio_listio,                                                                                \
+        int,                                                                                       \
+        (int mode, struct aiocb* const list[], int nent, struct sigevent* sig),                    \
+        (mode, list, nent, sig),                                                                   \
+        (mode, nent))                                                                              \
+    X (lio_listio64,                                                                               \
+        lio_listio64,                                                                              \
+        int,                                                                                       \
+        (int mode, struct aiocb64* const list[], int nent, struct sigevent* sig),                  \
+        (mode, list, nent, sig),                                                                   \
+        (mode, nent))
+
+/**
+ * PADLL_LARGEFILE_DATA_CALLS: 64-bit offset data calls intercepted through the standard wrapper
+ * (same layout of PADLL_DATA_CALLS).
+ */
+#define PADLL_LARGEFILE_DATA_CALLS(X)                                                              \
+    X (pread64,                                                                                    \
+        pread64,                                                                                   \
+        ssize_t,                                                                                   \
+        (int fd, void* buf, size_t size, off64_t offset),                                          \
+        (fd, buf, size, offset),                                                                   \
+        (fd, size))                                                                                \
+    X (pwrite64,                                                                                   \
+        pwrite64,                                                                                  \
+        ssize_t,                                                                                   \
+        (int fd, const void* buf, size_t size, off64_t offset),                                    \
+        (fd, buf, size, offset),                                                                   \
+        (fd, size))
+
+/**
+ * PADLL_STREAM_CALLS: stdio and directory stream calls intercepted through the stream wrapper
+ * (PADLL_INTERCEPT_STREAM_CALL), listed as X (symbol, call, result, params, args).
+ */
+#define PADLL_STREAM_CALLS(X)                                                                      \
+    X (fread,                                                                                      \
+        fread,                                                                                     \
+        size_t,                                                                                    \
+        (void* buffer, size_t size, size_t nmemb, FILE* stream),                                   \
+        (buffer, size, nmemb, stream))                                                             \
+    X (fwrite,                                                                                     \
+        fwrite,                                                                                    \
+        size_t,                                                                                    \
+        (const void* buffer, size_t size, size_t nmemb, FILE* stream),                             \
+        (buffer, size, nmemb, stream))                                                             \
+    X (fgets, fgets, char*, (char* buffer, int size, FILE* stream), (buffer, size, stream))        \
+    X (fputs, fputs, int, (const char* buffer, FILE* stream), (buffer, stream))                    \
+    X (vfprintf,                                                                                   \
+        vfprintf,                                                                                  \
+        int,                                                                                       \
+        (FILE* stream, const char* format, va_list args),                                          \
+        (stream, format, args))                                                                    \
+    X (fflush, fflush, int, (FILE* stream), (stream))                                              \
+    X (fclose, fclose, int, (FILE* stream), (stream))                                              \
+    X (readdir, readdir, struct dirent*, (DIR* dirp), (dirp))                                      \
+    X (readdir64, readdir64, struct dirent64*, (DIR* dirp), (dirp))                                \
+    X (closedir, closedir, int, (DIR* dirp), (dirp))
+
+/**
+ * PADLL_METADATA_CALLS: metadata calls (MetadataDataCalls configurations) intercepted through the
+ * standard wrapper (same layout of PADLL_DATA_CALLS).
+ */
+#define PADLL_METADATA_CALLS(X)                                                                    \
+    X (creat, creat, int, (const char* path, mode_t mode), (path, mode), (path))                   \
+    X (creat64, creat64, int, (const char* path, mode_t mode), (path, mode), (path))               \
+    X (close, close, int, (int fd), (fd), (fd))                                                    \
+    X (statfs, statfs, int, (const char* path, struct statfs* buf), (path, buf), (path))           \
+    X (fstatfs, fstatfs, int, (int fd, struct statfs* buf), (fd, buf), (fd))                       \
+    X (statfs64, statfs64, int, (const char* path, struct statfs64* buf), (path, buf), (path))     \
+    X (fstatfs64, fstatfs64, int, (int fd, struct statfs64* buf), (fd, buf), (fd))                 \
+    X (unlink, unlink, int, (const char* path), (path), (path))                                    \
+    X (unlinkat,                                                                                   \
+        unlinkat,                                                                                  \
+        int,                                                                                       \
+        (int dirfd, const char* pathname, int flags),                                              \
+        (dirfd, pathname, flags),                                                                  \
+        (dirfd, pathname))                                                                         \
+    X (rename,                                                                                     \
+        rename,                                                                                    \
+        int,                                                                                       \
+        (const char* old_path, const char* new_path),                                              \
+        (old_path, new_path),                                                                      \
+        (old_path, new_path))                                                                      \
+    X (renameat,                                                                                   \
+        renameat,                                                                                  \
+        int,                                                                                       \
+        (int olddirfd, const char* old_path, int newdirfd, const char* new_path),                  \
+        (olddirfd, old_path, newdirfd, new_path),                                                  \
+        (old_path, new_path))                                                                      \
+    X (fopen,                                                                                      \
+        fopen,                                                                                     \
+        FILE*,                                                                                     \
+        (const char* pathname, const char* mode),                                                  \
+        (pathname, mode),                                                                          \
+        (pathname))                                                                                \
+    X (fopen64,                                                                                    \
+        fopen64,                                                                                   \
+        FILE*,                                                                                     \
+        (const char* pathname, const char* mode),                                                  \
+        (pathname, mode),                                                                          \
+        (pathname))                                                                                \
+    X (stat, stat, int, (const char* path, struct stat* statbuf), (path, statbuf), (path))         \
+    X (lstat, lstat, int, (const char* path, struct stat* statbuf), (path, statbuf), (path))       \
+    X (fstat, fstat, int, (int fd, struct stat* statbuf), (fd, statbuf), (fd))                     \
+    X (fstatat,                                                                                    \
+        fstatat,                                                                                   \
+        int,                                                                                       \
+        (int dirfd, const char* path, struct stat* statbuf, int flags),                            \
+        (dirfd, path, statbuf, flags),                                                             \
+        (dirfd, path))                                                                             \
+    X (statx,                                                                                      \
+        statx,                                                                                     \
+        int,                                                                                       \
+        (int dirfd, const char* path, int flags, unsigned int mask, struct statx* statxbuf),       \
+        (dirfd, path, flags, mask, statxbuf),                                                      \
+        (dirfd, path))                                                                             \
+    X (access, access, int, (const char* path, int mode), (path, mode), (path))                    \
+    X (faccessat,                                                                                  \
+        faccessat,                                                                                 \
+        int,                                                                                       \
+        (int dirfd, const char* path, int mode, int flags),                                        \
+        (dirfd, path, mode, flags),                                                                \
+        (dirfd, path))                                                                             \
+    X (stat64, stat64, int, (const char* path, struct stat64* statbuf), (path, statbuf), (path))   \
+    X (lstat64, lstat64, int, (const char* path, struct stat64* statbuf), (path, statbuf), (path)) \
+    X (fstat64, fstat64, int, (int fd, struct stat64* statbuf), (fd, statbuf), (fd))               \
+    X (fstatat64,                                                                                  \
+        fstatat64,                                                                                 \
+        int,                                                                                       \
+        (int dirfd, const char* path, struct stat64* statbuf, int flags),                          \
+        (dirfd, path, statbuf, flags),                                                             \
+        (dirfd, path))                                                                             \
+    X (fsync, fsync, int, (int fd), (fd), (fd))                                                    \
+    X (fdatasync, fdatasync, int, (int fd), (fd), (fd))                                            \
+    X (sync_file_range,                                                                            \
+        sync_file_range,                                                                           \
+        int,                                                                                       \
+        (int fd, off64_t offset, off64_t nbytes, unsigned int flags),                              \
+        (fd, offset, nbytes, flags),                                                               \
+        (fd))                                                                                      \
+    X (syncfs, syncfs, int, (int fd), (fd), (fd))                                                  \
+    X (truncate, truncate, int, (const char* path, off_t length), (path, length), (path))          \
+    X (ftruncate, ftruncate, int, (int fd, off_t length), (fd, length), (fd))                      \
+    X (fallocate,                                                                                  \
+        fallocate,                                                                                 \
+        int,                                                                                       \
+        (int fd, int mode, off_t offset, off_t length),                                            \
+        (fd, mode, offset, length),                                                                \
+        (fd))                                                                                      \
+    X (posix_fallocate,                                                                            \
+        posix_fallocate,                                                                           \
+        int,                                                                                       \
+        (int fd, off_t offset, off_t length),                                                      \
+        (fd, offset, length),                                                                      \
+        (fd))                                                                                      \
+    X (posix_fadvise,                                                                              \
+        posix_fadvise,                                                                             \
+        int,                                                                                       \
+        (int fd, off_t offset, off_t length, int advice),                                          \
+        (fd, offset, length, advice),                                                              \
+        (fd))                                                                                      \
+    X (aio_fsync, aio_fsync, int, (int op, struct aiocb* aiocbp), (op, aiocbp), (aiocbp))          \
+    X (aio_fsync64, aio_fsync64, int, (int op, struct aiocb64* aiocbp), (op, aiocbp), (aiocbp))    \
+    X (mkdir, mkdir, int, (const char* path, mode_t mode), (path, mode), (path))                   \
+    X (mkdirat,                                                                                    \
+        mkdirat,                                                                                   \
+        int,                                                                                       \
+        (int dirfd, const char* path, mode_t mode),                                                \
+        (dirfd, path, mode),                                                                       \
+        (dirfd, path))                                                                             \
+    X (rmdir, rmdir, int, (const char* path), (path), (path))                                      \
+    X (mknod, mknod, int, (const char* path, mode_t mode, dev_t dev), (path, mode, dev), (path))   \
+    X (mknodat,                                                                                    \
+        mknodat,                                                                                   \
+        int,                                                                                       \
+        (int dirfd, const char* path, mode_t mode, dev_t dev),                                     \
+        (dirfd, path, mode, dev),                                                                  \
+        (dirfd, path))                                                                             \
+    X (opendir, opendir, DIR*, (const char* path), (path), (path))                                 \
+    X (fdopendir, fdopendir, DIR*, (int fd), (fd), (fd))                                           \
+    X (getdents64,                                                                                 \
+        getdents64,                                                                                \
+        ssize_t,                                                                                   \
+        (int fd, void* buffer, size_t count),                                                      \
+        (fd, buffer, count),                                                                       \
+        (fd))                                                                                      \
+    X (socket, socket, int, (int domain, int type, int protocol), (domain, type, protocol), ("?"))
+
+/**
+ * PADLL_EXTENDED_ATTRIBUTE_CALLS: extended attribute calls intercepted through the standard
+ * wrapper (same layout of PADLL_DATA_CALLS).
+ */
+#define PADLL_EXTENDED_ATTRIBUTE_CALLS(X)                                                          \
+    X (getxattr,                                                                                   \
+        getxattr,                                                                                  \
+        ssize_t,                                                                                   \
+        (const char* path, const char* name, void* value, size_t size),                            \
+        (path, name, value, size),                                                                 \
+        (path, name))                                                                              \
+    X (lgetxattr,                                                                                  \
+        lgetxattr,                                                                                 \
+        ssize_t,                                                                                   \
+        (const char* path, const char* name, void* value, size_t size),                            \
+        (path, name, value, size),                                                                 \
+        (path, name))                                                                              \
+    X (fgetxattr,                                                                                  \
+        fgetxattr,                                                                                 \
+        ssize_t,                                                                                   \
+        (int fd, const char* name, void* value, size_t size),                                      \
+        (fd, name, value, size),                                                                   \
+        (fd, name))                                                                                \
+    X (setxattr,                                                                                   \
+        setxattr,                                                                                  \
+        int,                                                                                       \
+        (const char* path, const char* name, const void* value, size_t size, int flags),           \
+        (path, name, value, size, flags),                                                          \
+        (path, name))                                                                              \
+    X (lsetxattr,                                                                                  \
+        lsetxattr,                                                                                 \
+        int,                                                                                       \
+        (const char* path, const char* name, const void* value, size_t size, int flags),           \
+        (path, name, value, size, flags),                                                          \
+        (path, name))                                                                              \
+    X (fsetxattr,                                                                                  \
+        fsetxattr,                                                                                 \
+        int,                                                                                       \
+        (int fd, const char* name, const void* value, size_t size, int flags),                     \
+        (fd, name, value, size, flags),                                                            \
+        (fd, name))                                                                                \
+    X (listxattr,                                                                                  \
+        listxattr,                                                                                 \
+        ssize_t,                                                                                   \
+        (const char* path, char* list, size_t size),                                               \
+        (path, list, size),                                                                        \
+        (path))                                                                                    \
+    X (llistxattr,                                                                                 \
+        llistxattr,                                                                                \
+        ssize_t,                                                                                   \
+        (const char* path, char* list, size_t size),                                               \
+        (path, list, size),                                                                        \
+        (path))                                                                                    \
+    X (flistxattr, flistxattr, ssize_t, (int fd, char* list, size_t size), (fd, list, size), (fd))
+
+PADLL_DATA_CALLS (PADLL_INTERCEPT_CALL)
+PADLL_STREAM_CALLS (PADLL_INTERCEPT_STREAM_CALL)
+PADLL_METADATA_CALLS (PADLL_INTERCEPT_CALL)
+
+#if defined(__USE_LARGEFILE64)
+PADLL_LARGEFILE_DATA_CALLS (PADLL_INTERCEPT_CALL)
 #endif
 
-    return (posix_data_calls.padll_intercept_mmap && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_mmap (addr, length, prot, flags, fd, offset)
-        : m_posix_passthrough.passthrough_posix_mmap (addr, length, prot, flags, fd, offset);
-}
+#ifdef __linux__
+PADLL_EXTENDED_ATTRIBUTE_CALLS (PADLL_INTERCEPT_CALL)
+#endif
 
 /**
- * munmap: intercept POSIX munmap. Operation will be submitted to passthrough or enforced (rate
+ * fprintf: intercept POSIX fprintf. Operation will be submitted to passthrough or enforced (rate
  * limited) depending on the PosixDataCalls configurations.
- * @param addr
- * @param length
+ * @param stream
+ * @param format
+ * @param ...
  * @return
  */
-extern "C" int munmap (void* addr, size_t length)
+extern "C" int fprintf (FILE* stream, const char* format, ...)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, "?");
-#endif
+    va_list args;
+
+    va_start (args, format);
+    auto result = route<PosixCall::fprintf> (&ldp::LdPreloadedPosix::ld_preloaded_posix_fprintf,
+        &ptr::PosixPassthrough::passthrough_posix_fprintf,
+        stream,
+        format,
+        args);
+    va_end (args);
 
-    return (posix_data_calls.padll_intercept_munmap && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_munmap (addr, length)
-        : m_posix_passthrough.passthrough_posix_munmap (addr, length);
+    return result;
 }
 
 /**
@@ -269,54 +602,21 @@ extern "C" int open (const char* path, int flags, ...)
         auto mode = static_cast<mode_t> (va_arg (args, int));
         va_end (args);
 
-        return (posix_metadata_calls.padll_intercept_open_var && m_ldp_loaded->load ())
-            ? m_ld_preloaded_posix.ld_preloaded_posix_open (path, flags, mode)
-            : m_posix_passthrough.passthrough_posix_open (path, flags, mode);
+        return route<PosixCall::open_variadic, int, const char*, int, mode_t> (
+            &ldp::LdPreloadedPosix::ld_preloaded_posix_open,
+            &ptr::PosixPassthrough::passthrough_posix_open,
+            path,
+            flags,
+            mode);
     } else {
-        return (posix_metadata_calls.padll_intercept_open && m_ldp_loaded->load ())
-            ? m_ld_preloaded_posix.ld_preloaded_posix_open (path, flags)
-            : m_posix_passthrough.passthrough_posix_open (path, flags);
+        return route<PosixCall::open, int, const char*, int> (
+            &ldp::LdPreloadedPosix::ld_preloaded_posix_open,
+            &ptr::PosixPassthrough::passthrough_posix_open,
+            path,
+            flags);
     }
 }
 
-/**
- * creat: intercept POSIX creat. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param path
- * @param mode
- * @return
- */
-extern "C" int creat (const char* path, mode_t mode)
-{
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path);
-#endif
-
-    return (posix_metadata_calls.padll_intercept_creat && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_creat (path, mode)
-        : m_posix_passthrough.passthrough_posix_creat (path, mode);
-}
-
-/**
- * creat64: intercept POSIX creat64. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param path
- * @param mode
- * @return
- */
-extern "C" int creat64 (const char* path, mode_t mode)
-{
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path);
-#endif
-
-    return (posix_metadata_calls.padll_intercept_creat64 && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_creat64 (path, mode)
-        : m_posix_passthrough.passthrough_posix_creat64 (path, mode);
-}
-
 /**
  * openat: intercept POSIX openat. Operation will be submitted to passthrough or enforced (rate
  * limited) depending on the MetadataDataCalls configurations.
@@ -342,13 +642,20 @@ extern "C" int openat (int dirfd, const char* path, int flags, ...)
         auto mode = static_cast<mode_t> (va_arg (args, int));
         va_end (args);
 
-        return (posix_metadata_calls.padll_intercept_openat_var && m_ldp_loaded->load ())
-            ? m_ld_preloaded_posix.ld_preloaded_posix_openat (dirfd, path, flags, mode)
-            : m_posix_passthrough.passthrough_posix_openat (dirfd, path, flags, mode);
+        return route<PosixCall::openat_variadic, int, int, const char*, int, mode_t> (
+            &ldp::LdPreloadedPosix::ld_preloaded_posix_openat,
+            &ptr::PosixPassthrough::passthrough_posix_openat,
+            dirfd,
+            path,
+            flags,
+            mode);
     } else {
-        return (posix_metadata_calls.padll_intercept_openat && m_ldp_loaded->load ())
-            ? m_ld_preloaded_posix.ld_preloaded_posix_openat (dirfd, path, flags)
-            : m_posix_passthrough.passthrough_posix_openat (dirfd, path, flags);
+        return route<PosixCall::openat, int, int, const char*, int> (
+            &ldp::LdPreloadedPosix::ld_preloaded_posix_openat,
+            &ptr::PosixPassthrough::passthrough_posix_openat,
+            dirfd,
+            path,
+            flags);
     }
 }
 
@@ -374,34 +681,21 @@ extern "C" int open64 (const char* path, int flags, ...)
         auto mode = static_cast<mode_t> (va_arg (args, int));
         va_end (args);
 
-        return (posix_metadata_calls.padll_intercept_open64_var && m_ldp_loaded->load ())
-            ? m_ld_preloaded_posix.ld_preloaded_posix_open64 (path, flags, mode)
-            : m_posix_passthrough.passthrough_posix_open64 (path, flags, mode);
+        return route<PosixCall::open64_variadic, int, const char*, int, mode_t> (
+            &ldp::LdPreloadedPosix::ld_preloaded_posix_open64,
+            &ptr::PosixPassthrough::passthrough_posix_open64,
+            path,
+            flags,
+            mode);
     } else {
-        return (posix_metadata_calls.padll_intercept_open64 && m_ldp_loaded->load ())
-            ? m_ld_preloaded_posix.ld_preloaded_posix_open64 (path, flags)
-            : m_posix_passthrough.passthrough_posix_open64 (path, flags);
+        return route<PosixCall::open64, int, const char*, int> (
+            &ldp::LdPreloadedPosix::ld_preloaded_posix_open64,
+            &ptr::PosixPassthrough::passthrough_posix_open64,
+            path,
+            flags);
     }
 }
 
-/**
- * close: intercept POSIX close. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param fd
- * @return
- */
-extern "C" int close (int fd)
-{
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, std::string_view { std::to_string (fd) });
-#endif
-
-    return (posix_metadata_calls.padll_intercept_close && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_close (fd)
-        : m_posix_passthrough.passthrough_posix_close (fd);
-}
-
 /**
  * sync: intercept POSIX sync. Operation will be submitted to passthrough or enforced (rate limited)
  * depending on the MetadataDataCalls configurations.
@@ -413,310 +707,341 @@ extern "C" void sync ()
     m_logger_ptr->create_routine_log_message (__func__, "?");
 #endif
 
-    return (posix_metadata_calls.padll_intercept_sync && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_sync ()
-        : m_posix_passthrough.passthrough_posix_sync ();
+    return route<PosixCall::sync> (&ldp::LdPreloadedPosix::ld_preloaded_posix_sync,
+        &ptr::PosixPassthrough::passthrough_posix_sync);
 }
 
 /**
- * statfs: intercept POSIX statfs. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param path
- * @param buf
- * @return
+ * fcntl: intercept POSIX fcntl. Operation will be submitted to passthrough or enforced (rate
+ * limited) depending on the SpecialCalls configurations.
+ * @param fd
+ * @param cmd
  */
-extern "C" int statfs (const char* path, struct statfs* buf)
+extern "C" int fcntl (int fd, int cmd, ...)
 {
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path);
+    m_logger_ptr->create_routine_log_message (__func__,
+        std::string_view { std::to_string (fd) },
+        std::string_view { std::to_string (cmd) });
 #endif
 
-    return (posix_metadata_calls.padll_intercept_statfs && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_statfs (path, buf)
-        : m_posix_passthrough.passthrough_posix_statfs (path, buf);
-}
+    va_list ap;
+    void* arg;
+    va_start (ap, cmd);
+    arg = va_arg (ap, void*);
+    va_end (ap);
 
-/**
- * fstatfs: intercept POSIX fstatfs. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param fd
- * @param buf
- * @return
- */
-extern "C" int fstatfs (int fd, struct statfs* buf)
-{
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, std::string_view { std::to_string (fd) });
-#endif
+    // submit fcntl call to ld_preloaded_posix
+    int result = m_ld_preloaded_posix.ld_preloaded_posix_fcntl (fd, cmd, arg);
 
-    return (posix_metadata_calls.padll_intercept_fstatfs && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_fstatfs (fd, buf)
-        : m_posix_passthrough.passthrough_posix_fstatfs (fd, buf);
+    return result;
 }
 
 /**
- * statfs64: intercept POSIX statfs64. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
+ * chdir: intercept POSIX chdir. The operation is always submitted to ld_preloaded_posix (and never
+ * enforced), so the working directory used to classify relative paths is kept up to date.
  * @param path
- * @param buf
  * @return
  */
-extern "C" int statfs64 (const char* path, struct statfs64* buf)
+extern "C" int chdir (const char* path)
 {
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
     m_logger_ptr->create_routine_log_message (__func__, path);
 #endif
 
-    return (posix_metadata_calls.padll_intercept_statfs64 && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_statfs64 (path, buf)
-        : m_posix_passthrough.passthrough_posix_statfs64 (path, buf);
+    return m_ld_preloaded_posix.ld_preloaded_posix_chdir (path);
 }
 
 /**
- * fstatfs64: intercept POSIX fstatfs64. Operation will be submitted to passthrough or enforced
- * (rate limited) depending on the MetadataDataCalls configurations.
+ * fchdir: intercept POSIX fchdir. The operation is always submitted to ld_preloaded_posix (and
+ * never enforced), so the working directory used to classify relative paths is kept up to date.
  * @param fd
- * @param buf
  * @return
  */
-extern "C" int fstatfs64 (int fd, struct statfs64* buf)
+extern "C" int fchdir (int fd)
 {
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
     m_logger_ptr->create_routine_log_message (__func__, std::string_view { std::to_string (fd) });
 #endif
 
-    return (posix_metadata_calls.padll_intercept_fstatfs64 && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_fstatfs64 (fd, buf)
-        : m_posix_passthrough.passthrough_posix_fstatfs64 (fd, buf);
+    return m_ld_preloaded_posix.ld_preloaded_posix_fchdir (fd);
 }
 
 /**
- * unlink: intercept POSIX unlink. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param path
+ * dup: intercept POSIX dup. The operation is always submitted to ld_preloaded_posix (and never
+ * enforced), so the duplicate file descriptor shares the MountPointEntry of oldfd.
+ * @param oldfd
  * @return
  */
-extern "C" int unlink (const char* path)
+extern "C" int dup (int oldfd)
 {
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path);
+    m_logger_ptr->create_routine_log_message (__func__,
+        std::string_view { std::to_string (oldfd) });
 #endif
 
-    return (posix_metadata_calls.padll_intercept_unlink && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_unlink (path)
-        : m_posix_passthrough.passthrough_posix_unlink (path);
+    return m_ld_preloaded_posix.ld_preloaded_posix_dup (oldfd);
 }
 
 /**
- * unlinkat: intercept POSIX unlinkat. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param dirfd
- * @param pathname
- * @param flags
+ * dup2: intercept POSIX dup2. The operation is always submitted to ld_preloaded_posix (and never
+ * enforced), so the duplicate file descriptor shares the MountPointEntry of oldfd.
+ * @param oldfd
+ * @param newfd
  * @return
  */
-extern "C" int unlinkat (int dirfd, const char* pathname, int flags)
+extern "C" int dup2 (int oldfd, int newfd)
 {
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
     m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (dirfd) },
-        pathname);
+        std::string_view { std::to_string (oldfd) },
+        std::string_view { std::to_string (newfd) });
 #endif
 
-    return (posix_metadata_calls.padll_intercept_unlinkat && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_unlinkat (dirfd, pathname, flags)
-        : m_posix_passthrough.passthrough_posix_unlinkat (dirfd, pathname, flags);
+    return m_ld_preloaded_posix.ld_preloaded_posix_dup2 (oldfd, newfd);
 }
 
 /**
- * rename: intercept POSIX rename. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- *  https://man7.org/linux/man-pages/man2/rename.2.html
- * @param old_path
- * @param new_path
+ * dup3: intercept POSIX dup3. The operation is always submitted to ld_preloaded_posix (and never
+ * enforced), so the duplicate file descriptor shares the MountPointEntry of oldfd.
+ * @param oldfd
+ * @param newfd
+ * @param flags
  * @return
  */
-extern "C" int rename (const char* old_path, const char* new_path)
+extern "C" int dup3 (int oldfd, int newfd, int flags)
 {
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, old_path, new_path);
+    m_logger_ptr->create_routine_log_message (__func__,
+        std::string_view { std::to_string (oldfd) },
+        std::string_view { std::to_string (newfd) });
 #endif
 
-    return (posix_metadata_calls.padll_intercept_rename && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_rename (old_path, new_path)
-        : m_posix_passthrough.passthrough_posix_rename (old_path, new_path);
+    return m_ld_preloaded_posix.ld_preloaded_posix_dup3 (oldfd, newfd, flags);
 }
 
 /**
- * renameat: intercept POSIX renameat. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- *  https://man7.org/linux/man-pages/man2/renameat.2.html
- * @param olddirfd
- * @param old_path
- * @param newdirfd
- * @param new_path
- * @return
+ * dispatch_system_call: perform a system call through LdPreloadedPosix (defined below, along with
+ * the system calls supported by the seccomp and binary-rewriting backends).
  */
-extern "C" int renameat (int olddirfd, const char* old_path, int newdirfd, const char* new_path)
-{
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, old_path, new_path);
-#endif
-
-    return (posix_metadata_calls.padll_intercept_renameat && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_renameat (olddirfd, old_path, newdirfd, new_path)
-        : m_posix_passthrough.passthrough_posix_renameat (olddirfd, old_path, newdirfd, new_path);
-}
+static bool dispatch_system_call (const long& number, const __u64* args, long& result);
 
 /**
- * fopen: intercept POSIX fopen. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param pathname
- * @param mode
+ * syscall: intercept libc's syscall, to handle the io_uring calls (io_uring_setup, io_uring_enter),
+ * which have no libc wrapper, and the system calls supported by the seccomp and binary-rewriting
+ * backends (e.g., syscall (SYS_openat, ...)), which take the same paths as when trapped. These
+ * will be submitted to passthrough or enforced (rate limited) depending on the PosixDataCalls and
+ * PosixMetadataCalls configurations; all other system calls are forwarded to libc.
+ * @param number
+ * @param ...
  * @return
  */
-extern "C" FILE* fopen (const char* pathname, const char* mode)
+extern "C" long syscall (long number, ...)
 {
+    // system calls take up to six (register-sized) arguments
+    std::va_list args;
+    va_start (args, number);
+    long arg[6];
+    for (auto& value : arg) {
+        value = va_arg (args, long);
+    }
+    va_end (args);
+
+    switch (number) {
+        case SYS_io_uring_setup:
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, pathname);
+            m_logger_ptr->create_routine_log_message ("io_uring_setup",
+                std::string_view { std::to_string (arg[0]) });
 #endif
 
-    return (posix_metadata_calls.padll_intercept_fopen && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_fopen (pathname, mode)
-        : m_posix_passthrough.passthrough_posix_fopen (pathname, mode);
-}
+            return route<PosixCall::io_uring_setup> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_io_uring_setup,
+                &ptr::PosixPassthrough::passthrough_posix_io_uring_setup,
+                static_cast<unsigned int> (arg[0]),
+                reinterpret_cast<struct io_uring_params*> (arg[1]));
 
-/**
- * fopen64: intercept POSIX fopen64. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param pathname
- * @param mode
- * @return
- */
-extern "C" FILE* fopen64 (const char* pathname, const char* mode)
-{
+        case SYS_io_uring_enter:
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, pathname);
+            m_logger_ptr->create_routine_log_message ("io_uring_enter",
+                std::string_view { std::to_string (arg[0]) },
+                std::string_view { std::to_string (arg[1]) });
 #endif
 
-    return (posix_metadata_calls.padll_intercept_fopen64 && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_fopen64 (pathname, mode)
-        : m_posix_passthrough.passthrough_posix_fopen64 (pathname, mode);
+            return route<PosixCall::io_uring_enter> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_io_uring_enter,
+                &ptr::PosixPassthrough::passthrough_posix_io_uring_enter,
+                static_cast<unsigned int> (arg[0]),
+                static_cast<unsigned int> (arg[1]),
+                static_cast<unsigned int> (arg[2]),
+                static_cast<unsigned int> (arg[3]),
+                reinterpret_cast<const void*> (arg[4]),
+                static_cast<size_t> (arg[5]));
+
+        default: {
+            // system calls supported by the seccomp and binary-rewriting backends
+            __u64 values[6];
+            for (int i = 0; i < 6; i++) {
+                values[i] = static_cast<__u64> (arg[i]);
+            }
+
+            long result = -1;
+            if (m_ldp_loaded_flag.load () && dispatch_system_call (number, values, result)) {
+                return result;
+            }
+
+            // libc's syscall (resolved through the io_uring_enter entry of the libc dispatch table)
+            return libc_dispatch ().get<libc_io_uring_enter_t> (PosixCall::io_uring_enter) (number,
+                arg[0],
+                arg[1],
+                arg[2],
+                arg[3],
+                arg[4],
+                arg[5]);
+        }
+    }
 }
 
 /**
- * fclose: intercept POSIX fclose. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the MetadataDataCalls configurations.
- * @param stream
- * @return
+ * Fortified entry points. When built with _FORTIFY_SOURCE, applications call glibc's checked
+ * variants of some POSIX calls (e.g., __read_chk instead of read, or __open_2 instead of open),
+ * which would otherwise bypass PADLL. They are routed through the same LdPreloadedPosix and
+ * PosixPassthrough paths of the call they check. Calls whose check may fail are handed to libc's
+ * own entry point (fortified_fallback), which preserves glibc's abort-on-overflow semantics.
+ * The 64-bit aliases (e.g., preadv64) share the same paths as their base calls, since off_t and
+ * off64_t are the same type in the supported (LP64) platforms.
  */
-extern "C" int fclose (FILE* stream)
+static_assert (sizeof (off_t) == sizeof (off64_t), "off_t and off64_t must have the same size");
+
+/**
+ * fortified_fallback: submit a fortified call to libc's own entry point, without accounting it.
+ * If the symbol cannot be resolved, the process is aborted (as it would be on a failed check).
+ * @tparam Function Type of the function pointer.
+ * @param symbol Name of the fortified entry point.
+ * @param args Arguments of the call.
+ * @return Returns the result of the call.
+ */
+template <typename Function, typename... Args>
+static inline auto fortified_fallback (const char* symbol, Args... args)
 {
-    return (posix_metadata_calls.padll_intercept_fclose && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_fclose (stream)
-        : m_posix_passthrough.passthrough_posix_fclose (stream);
+    auto function = reinterpret_cast<Function> (::dlsym (RTLD_NEXT, symbol));
+    if (function == nullptr) {
+        std::abort ();
+    }
+
+    return function (args...);
 }
 
 /**
- * mkdir: intercept POSIX mkdir. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the DirectoryCalls configurations.
- * @param path
- * @param mode
- * @return
+ * open_needs_mode: check if the flags of an open call require the mode argument.
+ * @param flags
+ * @return Returns true if flags include O_CREAT or O_TMPFILE.
  */
-extern "C" int mkdir (const char* path, mode_t mode)
+static inline bool open_needs_mode (const int& flags)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path);
-#endif
-
-    return (posix_directory_calls.padll_intercept_mkdir && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_mkdir (path, mode)
-        : m_posix_passthrough.passthrough_posix_mkdir (path, mode);
+    return (flags & O_CREAT) != 0 || (flags & O_TMPFILE) == O_TMPFILE;
 }
 
 /**
- * mkdirat: intercept POSIX mkdirat. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the DirectoryCalls configurations.
- * @param dirfd
+ * __open_2: intercept fortified open (without mode). Operation will be submitted to passthrough or
+ * enforced (rate limited) depending on the MetadataDataCalls configurations.
  * @param path
- * @param mode
+ * @param flags
  * @return
  */
-extern "C" int mkdirat (int dirfd, const char* path, mode_t mode)
+extern "C" int __open_2 (const char* path, int flags)
 {
+    if (open_needs_mode (flags)) {
+        return fortified_fallback<int (*) (const char*, int)> (__func__, path, flags);
+    }
+
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (dirfd) },
-        path);
+    m_logger_ptr->create_routine_log_message (__func__, path);
 #endif
 
-    return (posix_directory_calls.padll_intercept_mkdirat && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_mkdirat (dirfd, path, mode)
-        : m_posix_passthrough.passthrough_posix_mkdirat (dirfd, path, mode);
+    return route<PosixCall::open, int, const char*, int> (
+        &ldp::LdPreloadedPosix::ld_preloaded_posix_open,
+        &ptr::PosixPassthrough::passthrough_posix_open,
+        path,
+        flags);
 }
 
 /**
- * rmdir: intercept POSIX rmdir. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the DirectoryCalls configurations.
+ * __open64_2: intercept fortified open64 (without mode). Operation will be submitted to
+ * passthrough or enforced (rate limited) depending on the MetadataDataCalls configurations.
  * @param path
+ * @param flags
  * @return
  */
-extern "C" int rmdir (const char* path)
+extern "C" int __open64_2 (const char* path, int flags)
 {
+    if (open_needs_mode (flags)) {
+        return fortified_fallback<int (*) (const char*, int)> (__func__, path, flags);
+    }
+
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
     m_logger_ptr->create_routine_log_message (__func__, path);
 #endif
 
-    return (posix_directory_calls.padll_intercept_rmdir && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_rmdir (path)
-        : m_posix_passthrough.passthrough_posix_rmdir (path);
+    return route<PosixCall::open64, int, const char*, int> (
+        &ldp::LdPreloadedPosix::ld_preloaded_posix_open64,
+        &ptr::PosixPassthrough::passthrough_posix_open64,
+        path,
+        flags);
 }
 
 /**
- * mknod: intercept POSIX mknod. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the DirectoryCalls configurations.
+ * __openat_2: intercept fortified openat (without mode). Operation will be submitted to
+ * passthrough or enforced (rate limited) depending on the MetadataDataCalls configurations.
+ * @param dirfd
  * @param path
- * @param mode
- * @param dev
+ * @param flags
  * @return
  */
-extern "C" int mknod (const char* path, mode_t mode, dev_t dev)
+extern "C" int __openat_2 (int dirfd, const char* path, int flags)
 {
+    if (open_needs_mode (flags)) {
+        return fortified_fallback<int (*) (int, const char*, int)> (__func__, dirfd, path, flags);
+    }
+
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path);
+    m_logger_ptr->create_routine_log_message (__func__,
+        std::string_view { std::to_string (dirfd) },
+        path);
 #endif
 
-    return (posix_directory_calls.padll_intercept_mknod && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_mknod (path, mode, dev)
-        : m_posix_passthrough.passthrough_posix_mknod (path, mode, dev);
+    return route<PosixCall::openat, int, int, const char*, int> (
+        &ldp::LdPreloadedPosix::ld_preloaded_posix_openat,
+        &ptr::PosixPassthrough::passthrough_posix_openat,
+        dirfd,
+        path,
+        flags);
 }
 
 /**
- * mknodat: intercept POSIX mknodat. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the DirectoryCalls configurations.
+ * __openat64_2: intercept fortified openat64 (without mode). Operation will be submitted to
+ * passthrough or enforced (rate limited) depending on the MetadataDataCalls configurations.
  * @param dirfd
  * @param path
- * @param mode
- * @param dev
+ * @param flags
  * @return
  */
-extern "C" int mknodat (int dirfd, const char* path, mode_t mode, dev_t dev)
+extern "C" int __openat64_2 (int dirfd, const char* path, int flags)
 {
+    if (open_needs_mode (flags)) {
+        return fortified_fallback<int (*) (int, const char*, int)> (__func__, dirfd, path, flags);
+    }
+
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
     m_logger_ptr->create_routine_log_message (__func__,
@@ -724,263 +1049,970 @@ extern "C" int mknodat (int dirfd, const char* path, mode_t mode, dev_t dev)
         path);
 #endif
 
-    return (posix_directory_calls.padll_intercept_mknodat && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_mknodat (dirfd, path, mode, dev)
-        : m_posix_passthrough.passthrough_posix_mknodat (dirfd, path, mode, dev);
+    return route<PosixCall::openat, int, int, const char*, int> (
+        &ldp::LdPreloadedPosix::ld_preloaded_posix_openat,
+        &ptr::PosixPassthrough::passthrough_posix_openat,
+        dirfd,
+        path,
+        flags);
 }
 
 /**
- * getxattr: intercept POSIX getxattr. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the ExtendedAttributesCalls configurations.
- * @param path
- * @param name
- * @param value
+ * __read_chk: intercept fortified read. Operation will be submitted to passthrough or enforced
+ * (rate limited) depending on the PosixDataCalls configurations.
+ * @param fd
+ * @param buf
  * @param size
+ * @param buflen Size of the destination buffer.
  * @return
  */
-#ifdef __linux__
-extern "C" ssize_t getxattr (const char* path, const char* name, void* value, size_t size)
+extern "C" ssize_t __read_chk (int fd, void* buf, size_t size, size_t buflen)
 {
+    if (size > buflen) {
+        return fortified_fallback<ssize_t (*) (int, void*, size_t, size_t)> (__func__,
+            fd,
+            buf,
+            size,
+            buflen);
+    }
+
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path, name);
+    m_logger_ptr->create_routine_log_message (__func__, std::string_view { std::to_string (fd) });
 #endif
 
-    return (posix_extended_attributes_calls.padll_intercept_getxattr && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_getxattr (path, name, value, size)
-        : m_posix_passthrough.passthrough_posix_getxattr (path, name, value, size);
+    return route<PosixCall::read> (&ldp::LdPreloadedPosix::ld_preloaded_posix_read,
+        &ptr::PosixPassthrough::passthrough_posix_read,
+        fd,
+        buf,
+        size);
 }
-#endif
 
 /**
- * lgetxattr: intercept POSIX lgetxattr. Operation will be submitted to passthrough or enforced
- * (rate limited) depending on the ExtendedAttributesCalls configurations.
- * @param path
- * @param name
- * @param value
+ * __pread_chk: intercept fortified pread. Operation will be submitted to passthrough or enforced
+ * (rate limited) depending on the PosixDataCalls configurations.
+ * @param fd
+ * @param buf
  * @param size
+ * @param offset
+ * @param buflen Size of the destination buffer.
  * @return
  */
-extern "C" ssize_t lgetxattr (const char* path, const char* name, void* value, size_t size)
+extern "C" ssize_t __pread_chk (int fd, void* buf, size_t size, off_t offset, size_t buflen)
 {
+    if (size > buflen) {
+        return fortified_fallback<ssize_t (*) (int, void*, size_t, off_t, size_t)> (__func__,
+            fd,
+            buf,
+            size,
+            offset,
+            buflen);
+    }
+
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path, name);
+    m_logger_ptr->create_routine_log_message (__func__, std::string_view { std::to_string (fd) });
 #endif
 
-    return (posix_extended_attributes_calls.padll_intercept_lgetxattr && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_lgetxattr (path, name, value, size)
-        : m_posix_passthrough.passthrough_posix_lgetxattr (path, name, value, size);
+    return route<PosixCall::pread> (&ldp::LdPreloadedPosix::ld_preloaded_posix_pread,
+        &ptr::PosixPassthrough::passthrough_posix_pread,
+        fd,
+        buf,
+        size,
+        offset);
 }
 
 /**
- * fgetxattr: intercept POSIX fgetxattr. Operation will be submitted to passthrough or enforced
- * (rate limited) depending on the ExtendedAttributesCalls configurations.
+ * __pread64_chk: intercept fortified pread64. Operation will be submitted to passthrough or
+ * enforced (rate limited) depending on the PosixDataCalls configurations.
  * @param fd
- * @param name
- * @param value
+ * @param buf
  * @param size
+ * @param offset
+ * @param buflen Size of the destination buffer.
  * @return
  */
-#ifdef __linux__
-extern "C" ssize_t fgetxattr (int fd, const char* name, void* value, size_t size)
+extern "C" ssize_t __pread64_chk (int fd, void* buf, size_t size, off64_t offset, size_t buflen)
 {
+    if (size > buflen) {
+        return fortified_fallback<ssize_t (*) (int, void*, size_t, off64_t, size_t)> (__func__,
+            fd,
+            buf,
+            size,
+            offset,
+            buflen);
+    }
+
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (fd) },
-        name);
+    m_logger_ptr->create_routine_log_message (__func__, std::string_view { std::to_string (fd) });
 #endif
 
-    return (posix_extended_attributes_calls.padll_intercept_fgetxattr && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_fgetxattr (fd, name, value, size)
-        : m_posix_passthrough.passthrough_posix_fgetxattr (fd, name, value, size);
+    return route<PosixCall::pread64> (&ldp::LdPreloadedPosix::ld_preloaded_posix_pread64,
+        &ptr::PosixPassthrough::passthrough_posix_pread64,
+        fd,
+        buf,
+        size,
+        offset);
 }
-#endif
 
 /**
- * setxattr: intercept POSIX setxattr. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the ExtendedAttributesCalls configurations.
- * @param path
- * @param name
- * @param value
+ * __fread_chk: intercept fortified fread. Operation will be submitted to passthrough or enforced
+ * (rate limited) depending on the PosixDataCalls configurations.
+ * @param buffer
+ * @param buflen Size of the destination buffer.
  * @param size
- * @param flags
+ * @param nmemb
+ * @param stream
  * @return
  */
-#ifdef __linux__
-extern "C" int
-setxattr (const char* path, const char* name, const void* value, size_t size, int flags)
+extern "C" size_t __fread_chk (void* buffer, size_t buflen, size_t size, size_t nmemb, FILE* stream)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path, name);
-#endif
+    size_t bytes = 0;
+    if (__builtin_mul_overflow (size, nmemb, &bytes) || bytes > buflen) {
+        return fortified_fallback<size_t (*) (void*, size_t, size_t, size_t, FILE*)> (__func__,
+            buffer,
+            buflen,
+            size,
+            nmemb,
+            stream);
+    }
 
-    return (posix_extended_attributes_calls.padll_intercept_setxattr && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_setxattr (path, name, value, size, flags)
-        : m_posix_passthrough.passthrough_posix_setxattr (path, name, value, size, flags);
+    return route<PosixCall::fread> (&ldp::LdPreloadedPosix::ld_preloaded_posix_fread,
+        &ptr::PosixPassthrough::passthrough_posix_fread,
+        buffer,
+        size,
+        nmemb,
+        stream);
 }
-#endif
 
 /**
- * lsetxattr: intercept POSIX lsetxattr. Operation will be submitted to passthrough or enforced
- * (rate limited) depending on the ExtendedAttributesCalls configurations.
- * @param path
- * @param name
- * @param value
+ * __fgets_chk: intercept fortified fgets. Operation will be submitted to passthrough or enforced
+ * (rate limited) depending on the PosixDataCalls configurations.
+ * @param buffer
+ * @param buflen Size of the destination buffer.
  * @param size
- * @param flags
+ * @param stream
  * @return
  */
-extern "C" int
-lsetxattr (const char* path, const char* name, const void* value, size_t size, int flags)
+extern "C" char* __fgets_chk (char* buffer, size_t buflen, int size, FILE* stream)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path, name);
-#endif
+    if (size <= 0 || static_cast<size_t> (size) > buflen) {
+        return fortified_fallback<char* (*) (char*, size_t, int, FILE*)> (__func__,
+            buffer,
+            buflen,
+            size,
+            stream);
+    }
 
-    return (posix_extended_attributes_calls.padll_intercept_lsetxattr && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_lsetxattr (path, name, value, size, flags)
-        : m_posix_passthrough.passthrough_posix_lsetxattr (path, name, value, size, flags);
+    return route<PosixCall::fgets> (&ldp::LdPreloadedPosix::ld_preloaded_posix_fgets,
+        &ptr::PosixPassthrough::passthrough_posix_fgets,
+        buffer,
+        size,
+        stream);
 }
 
 /**
- * fsetxattr: intercept POSIX fsetxattr. Operation will be submitted to passthrough or enforced
- * (rate limited) depending on the ExtendedAttributesCalls configurations.
- * @param fd
- * @param name
- * @param value
- * @param size
+ * openat64: intercept POSIX openat64. Operation will be submitted to passthrough or enforced (rate
+ * limited) depending on the MetadataDataCalls configurations.
+ * @param dirfd
+ * @param path
  * @param flags
+ * @param ...
  * @return
  */
-#ifdef __linux__
-extern "C" int fsetxattr (int fd, const char* name, const void* value, size_t size, int flags)
+extern "C" int openat64 (int dirfd, const char* path, int flags, ...)
 {
 // detailed logging message
 #if OPTION_DETAILED_LOGGING
     m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (fd) },
-        name);
+        std::string_view { std::to_string (dirfd) },
+        path);
 #endif
 
-    return (posix_extended_attributes_calls.padll_intercept_fsetxattr && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_fsetxattr (fd, name, value, size, flags)
-        : m_posix_passthrough.passthrough_posix_fsetxattr (fd, name, value, size, flags);
+    if (flags & O_CREAT) {
+        va_list args;
+
+        va_start (args, flags);
+        auto mode = static_cast<mode_t> (va_arg (args, int));
+        va_end (args);
+
+        return route<PosixCall::openat_variadic, int, int, const char*, int, mode_t> (
+            &ldp::LdPreloadedPosix::ld_preloaded_posix_openat,
+            &ptr::PosixPassthrough::passthrough_posix_openat,
+            dirfd,
+            path,
+            flags,
+            mode);
+    } else {
+        return route<PosixCall::openat, int, int, const char*, int> (
+            &ldp::LdPreloadedPosix::ld_preloaded_posix_openat,
+            &ptr::PosixPassthrough::passthrough_posix_openat,
+            dirfd,
+            path,
+            flags);
+    }
 }
-#endif
 
 /**
- * listxattr: intercept POSIX listxattr. Operation will be submitted to passthrough or enforced
- * (rate limited) depending on the ExtendedAttributesCalls configurations.
- * @param path
- * @param list
- * @param size
- * @return
+ * PADLL_ALIAS_CALLS: 64-bit aliases intercepted through the standard wrapper (same layout of
+ * PADLL_DATA_CALLS), routed through the LdPreloadedPosix and PosixPassthrough methods of their
+ * base calls.
  */
-#ifdef __linux__
-extern "C" ssize_t listxattr (const char* path, char* list, size_t size)
+#define PADLL_ALIAS_CALLS(X)                                                                       \
+    X (preadv64,                                                                                   \
+        preadv,                                                                                    \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt, off64_t offset),                             \
+        (fd, iov, iovcnt, offset),                                                                 \
+        (fd, iovcnt))                                                                              \
+    X (pwritev64,                                                                                  \
+        pwritev,                                                                                   \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt, off64_t offset),                             \
+        (fd, iov, iovcnt, offset),                                                                 \
+        (fd, iovcnt))                                                                              \
+    X (preadv64v2,                                                                                 \
+        preadv2,                                                                                   \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt, off64_t offset, int flags),                  \
+        (fd, iov, iovcnt, offset, flags),                                                          \
+        (fd, iovcnt))                                                                              \
+    X (pwritev64v2,                                                                                \
+        pwritev2,                                                                                  \
+        ssize_t,                                                                                   \
+        (int fd, const struct iovec* iov, int iovcnt, off64_t offset, int flags),                  \
+        (fd, iov, iovcnt, offset, flags),                                                          \
+        (fd, iovcnt))                                                                              \
+    X (mmap64,                                                                                     \
+        mmap,                                                                                      \
+        void*,                                                                                     \
+        (void* addr, size_t length, int prot, int flags, int fd, off64_t offset),                  \
+        (addr, length, prot, flags, fd, offset),                                                   \
+        (fd))                                                                                      \
+    X (truncate64, truncate, int, (const char* path, off64_t length), (path, length), (path))      \
+    X (ftruncate64, ftruncate, int, (int fd, off64_t length), (fd, length), (fd))                  \
+    X (fallocate64,                                                                                \
+        fallocate,                                                                                 \
+        int,                                                                                       \
+        (int fd, int mode, off64_t offset, off64_t length),                                        \
+        (fd, mode, offset, length),                                                                \
+        (fd))                                                                                      \
+    X (posix_fallocate64,                                                                          \
+        posix_fallocate,                                                                           \
+        int,                                                                                       \
+        (int fd, off64_t offset, off64_t length),                                                  \
+        (fd, offset, length),                                                                      \
+        (fd))                                                                                      \
+    X (posix_fadvise64,                                                                            \
+        posix_fadvise,                                                                             \
+        int,                                                                                       \
+        (int fd, off64_t offset, off64_t length, int advice),                                      \
+        (fd, offset, length, advice),                                                              \
+        (fd))
+
+PADLL_ALIAS_CALLS (PADLL_INTERCEPT_CALL)
+
+/**
+ * PADLL_VERSIONED_STAT_CALLS: versioned stat entry points of glibc (called instead of stat, lstat,
+ * fstat, and fstatat by binaries built against glibc < 2.33) intercepted through the standard
+ * wrapper (same layout of PADLL_DATA_CALLS), routed through the LdPreloadedPosix and
+ * PosixPassthrough methods of their base calls. The version of struct stat (first parameter) is
+ * not forwarded, since the base calls fill the same structure.
+ */
+#define PADLL_VERSIONED_STAT_CALLS(X)                                                              \
+    X (__xstat, stat, int, (int, const char* path, struct stat* statbuf), (path, statbuf), (path)) \
+    X (__lxstat,                                                                                   \
+        lstat,                                                                                     \
+        int,                                                                                       \
+        (int, const char* path, struct stat* statbuf),                                             \
+        (path, statbuf),                                                                           \
+        (path))                                                                                    \
+    X (__fxstat, fstat, int, (int, int fd, struct stat* statbuf), (fd, statbuf), (fd))             \
+    X (__fxstatat,                                                                                 \
+        fstatat,                                                                                   \
+        int,                                                                                       \
+        (int, int dirfd, const char* path, struct stat* statbuf, int flags),                       \
+        (dirfd, path, statbuf, flags),                                                             \
+        (dirfd, path))                                                                             \
+    X (__xstat64,                                                                                  \
+        stat64,                                                                                    \
+        int,                                                                                       \
+        (int, const char* path, struct stat64* statbuf),                                           \
+        (path, statbuf),                                                                           \
+        (path))                                                                                    \
+    X (__lxstat64,                                                                                 \
+        lstat64,                                                                                   \
+        int,                                                                                       \
+        (int, const char* path, struct stat64* statbuf),                                           \
+        (path, statbuf),                                                                           \
+        (path))                                                                                    \
+    X (__fxstat64, fstat64, int, (int, int fd, struct stat64* statbuf), (fd, statbuf), (fd))       \
+    X (__fxstatat64,                                                                               \
+        fstatat64,                                                                                 \
+        int,                                                                                       \
+        (int, int dirfd, const char* path, struct stat64* statbuf, int flags),                     \
+        (dirfd, path, statbuf, flags),                                                             \
+        (dirfd, path))
+
+PADLL_VERSIONED_STAT_CALLS (PADLL_INTERCEPT_CALL)
+
+/**
+ * to_register: convert an argument of a system call to the value of its register.
+ * @param value Argument of the call.
+ * @return Returns the value of the register.
+ */
+template <typename Type>
+static inline long to_register (const Type& value)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path);
-#endif
+    if constexpr (std::is_pointer_v<Type>) {
+        return reinterpret_cast<long> (value);
+    } else {
+        return static_cast<long> (value);
+    }
+}
+
+/**
+ * from_kernel: convert the result of a system call to the result of its libc wrapper (-1 with
+ * errno set on error).
+ * @param result Result of the call, as returned by the kernel.
+ * @return Returns the result of the call.
+ */
+template <typename Result>
+static inline Result from_kernel (const long& result)
+{
+    if (result < 0 && result > -4096) {
+        errno = static_cast<int> (-result);
+        return static_cast<Result> (-1);
+    }
 
-    return (posix_extended_attributes_calls.padll_intercept_listxattr && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_listxattr (path, list, size)
-        : m_posix_passthrough.passthrough_posix_listxattr (path, list, size);
+    return static_cast<Result> (result);
 }
-#endif
 
 /**
- * llistxattr: intercept POSIX llistxattr. Operation will be submitted to passthrough or enforced
- * (rate limited) depending on the ExtendedAttributesCalls configurations.
- * @param path
- * @param list
- * @param size
- * @return
+ * DirectCall struct: replacement of a libc wrapper (Function) that performs its system call
+ * (Number) through SyscallRewriter::direct_system_call. Used by the binary-rewriting backend, so
+ * that the calls performed by PADLL do not re-enter the rewritten wrappers.
  */
-extern "C" ssize_t llistxattr (const char* path, char* list, size_t size)
+template <long Number, typename Function>
+struct DirectCall;
+
+template <long Number, typename Result, typename... Args>
+struct DirectCall<Number, Result (*) (Args...)> {
+    static Result call (Args... args)
+    {
+        return from_kernel<Result> (
+            nat::SyscallRewriter::direct_system_call (Number, to_register (args)...));
+    }
+};
+
+/**
+ * direct_open_variadic: replacement of libc's open (with the mode argument) that performs it
+ * through SyscallRewriter::direct_system_call.
+ */
+static int direct_open_variadic (const char* path, int flags, ...)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, path);
-#endif
+    mode_t mode = 0;
+    if (open_needs_mode (flags)) {
+        std::va_list args;
+        va_start (args, flags);
+        mode = static_cast<mode_t> (va_arg (args, int));
+        va_end (args);
+    }
 
-    return (posix_extended_attributes_calls.padll_intercept_llistxattr && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_llistxattr (path, list, size)
-        : m_posix_passthrough.passthrough_posix_llistxattr (path, list, size);
+    return from_kernel<int> (nat::SyscallRewriter::direct_system_call (SYS_openat,
+        AT_FDCWD,
+        to_register (path),
+        flags,
+        mode));
 }
 
 /**
- * flistxattr: intercept POSIX flistxattr. Operation will be submitted to passthrough or enforced
- * (rate limited) depending on the ExtendedAttributesCalls configurations.
- * @param fd
- * @param list
- * @param size
- * @return
+ * direct_openat_variadic: replacement of libc's openat (with the mode argument) that performs it
+ * through SyscallRewriter::direct_system_call.
  */
-#ifdef __linux__
-extern "C" ssize_t flistxattr (int fd, char* list, size_t size)
+static int direct_openat_variadic (int dirfd, const char* path, int flags, ...)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, std::string_view { std::to_string (fd) });
-#endif
+    mode_t mode = 0;
+    if (open_needs_mode (flags)) {
+        std::va_list args;
+        va_start (args, flags);
+        mode = static_cast<mode_t> (va_arg (args, int));
+        va_end (args);
+    }
 
-    return (posix_extended_attributes_calls.padll_intercept_flistxattr && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_flistxattr (fd, list, size)
-        : m_posix_passthrough.passthrough_posix_flistxattr (fd, list, size);
+    return from_kernel<int> (nat::SyscallRewriter::direct_system_call (SYS_openat,
+        dirfd,
+        to_register (path),
+        flags,
+        mode));
 }
+
+/**
+ * direct_call: get the DirectCall of a system call, with the signature of its libc wrapper.
+ * @return Returns the address of the DirectCall.
+ */
+template <long Number, typename Function>
+static inline void* direct_call ()
+{
+    return reinterpret_cast<void*> (&DirectCall<Number, Function>::call);
+}
+
+/**
+ * SystemCall struct: system call that can be intercepted by the seccomp and binary-rewriting
+ * backends, the PosixCall through which it is routed (calls are only intercepted if their
+ * PosixCall is to be intercepted), and the DirectCall that replaces its libc wrapper in the libc
+ * dispatch table when the wrapper is rewritten (nullptr to keep the wrapper).
+ */
+struct SystemCall {
+    long m_number;
+    PosixCall m_call;
+    void* m_direct;
+};
+
+/**
+ * system_calls: system calls supported by the seccomp and binary-rewriting backends. Calls over
+ * file descriptors are only performed by PADLL if the file descriptor is tracked by
+ * LdPreloadedPosix.
+ */
+const SystemCall system_calls[] {
+    { SYS_read, PosixCall::read, direct_call<SYS_read, libc_read_t> () },
+    { SYS_write, PosixCall::write, direct_call<SYS_write, libc_write_t> () },
+    { SYS_pread64, PosixCall::pread64, direct_call<SYS_pread64, libc_pread64_t> () },
+    { SYS_pwrite64, PosixCall::pwrite64, direct_call<SYS_pwrite64, libc_pwrite64_t> () },
+    { SYS_readv, PosixCall::readv, direct_call<SYS_readv, libc_readv_t> () },
+    { SYS_writev, PosixCall::writev, direct_call<SYS_writev, libc_writev_t> () },
+    { SYS_preadv, PosixCall::preadv, direct_call<SYS_preadv, libc_preadv_t> () },
+    { SYS_pwritev, PosixCall::pwritev, direct_call<SYS_pwritev, libc_pwritev_t> () },
+#ifdef SYS_open
+    { SYS_open, PosixCall::open, direct_call<SYS_open, libc_open_t> () },
+    { SYS_open, PosixCall::open_variadic, reinterpret_cast<void*> (&direct_open_variadic) },
+#endif
+#ifdef SYS_creat
+    { SYS_creat, PosixCall::creat, direct_call<SYS_creat, libc_creat_t> () },
 #endif
+    { SYS_openat, PosixCall::openat, direct_call<SYS_openat, libc_openat_t> () },
+    { SYS_openat, PosixCall::openat_variadic, reinterpret_cast<void*> (&direct_openat_variadic) },
+    { SYS_close, PosixCall::close, direct_call<SYS_close, libc_close_t> () },
+    { SYS_fsync, PosixCall::fsync, direct_call<SYS_fsync, libc_fsync_t> () },
+    { SYS_fdatasync, PosixCall::fdatasync, direct_call<SYS_fdatasync, libc_fdatasync_t> () },
+    { SYS_truncate, PosixCall::truncate, direct_call<SYS_truncate, libc_truncate_t> () },
+    { SYS_ftruncate, PosixCall::ftruncate, direct_call<SYS_ftruncate, libc_ftruncate_t> () },
+    { SYS_fallocate, PosixCall::fallocate, direct_call<SYS_fallocate, libc_fallocate_t> () },
+#ifdef SYS_rename
+    { SYS_rename, PosixCall::rename, direct_call<SYS_rename, libc_rename_t> () },
+#endif
+    { SYS_renameat, PosixCall::renameat, direct_call<SYS_renameat, libc_renameat_t> () },
+#ifdef SYS_unlink
+    { SYS_unlink, PosixCall::unlink, direct_call<SYS_unlink, libc_unlink_t> () },
+#endif
+    { SYS_unlinkat, PosixCall::unlinkat, direct_call<SYS_unlinkat, libc_unlinkat_t> () },
+#ifdef SYS_mkdir
+    { SYS_mkdir, PosixCall::mkdir, direct_call<SYS_mkdir, libc_mkdir_t> () },
+#endif
+    { SYS_mkdirat, PosixCall::mkdirat, direct_call<SYS_mkdirat, libc_mkdirat_t> () },
+#ifdef SYS_rmdir
+    { SYS_rmdir, PosixCall::rmdir, direct_call<SYS_rmdir, libc_rmdir_t> () },
+#endif
+    { SYS_io_uring_setup, PosixCall::io_uring_setup, nullptr },
+    { SYS_io_uring_enter, PosixCall::io_uring_enter, nullptr },
+};
 
 /**
- * socket: intercept POSIX socket. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the SpecialCalls configurations.
- * @param domain
- * @param type
- * @param protocol
- * @return
+ * dispatch_system_call: perform a system call intercepted by the seccomp or binary-rewriting
+ * backends, by routing it through the same LdPreloadedPosix and PosixPassthrough paths of its libc
+ * counterpart.
+ * @param number Number of the system call.
+ * @param args Arguments of the system call.
+ * @param result Result of the call (as returned by libc, with errno set on error).
+ * @return Returns false if the call is to be performed as is (e.g., unsupported calls, or calls
+ * over file descriptors not tracked by LdPreloadedPosix, such as pipes or sockets).
  */
-extern "C" int socket (int domain, int type, int protocol)
+static bool dispatch_system_call (const long& number, const __u64* args, long& result)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__, "?");
+    auto fd = static_cast<int> (args[0]);
+
+    // calls over file descriptors are only performed if the file descriptor is tracked
+    auto tracked
+        = m_ldp_loaded_flag.load () && m_ld_preloaded_posix.is_file_descriptor_tracked (fd);
+
+    switch (number) {
+        case SYS_read:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::read> (&ldp::LdPreloadedPosix::ld_preloaded_posix_read,
+                &ptr::PosixPassthrough::passthrough_posix_read,
+                fd,
+                reinterpret_cast<void*> (args[1]),
+                static_cast<size_t> (args[2]));
+            break;
+
+        case SYS_write:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::write> (&ldp::LdPreloadedPosix::ld_preloaded_posix_write,
+                &ptr::PosixPassthrough::passthrough_posix_write,
+                fd,
+                reinterpret_cast<const void*> (args[1]),
+                static_cast<size_t> (args[2]));
+            break;
+
+        case SYS_pread64:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::pread64> (&ldp::LdPreloadedPosix::ld_preloaded_posix_pread64,
+                &ptr::PosixPassthrough::passthrough_posix_pread64,
+                fd,
+                reinterpret_cast<void*> (args[1]),
+                static_cast<size_t> (args[2]),
+                static_cast<off64_t> (args[3]));
+            break;
+
+        case SYS_pwrite64:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::pwrite64> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_pwrite64,
+                &ptr::PosixPassthrough::passthrough_posix_pwrite64,
+                fd,
+                reinterpret_cast<const void*> (args[1]),
+                static_cast<size_t> (args[2]),
+                static_cast<off64_t> (args[3]));
+            break;
+
+        case SYS_readv:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::readv> (&ldp::LdPreloadedPosix::ld_preloaded_posix_readv,
+                &ptr::PosixPassthrough::passthrough_posix_readv,
+                fd,
+                reinterpret_cast<const struct iovec*> (args[1]),
+                static_cast<int> (args[2]));
+            break;
+
+        case SYS_writev:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::writev> (&ldp::LdPreloadedPosix::ld_preloaded_posix_writev,
+                &ptr::PosixPassthrough::passthrough_posix_writev,
+                fd,
+                reinterpret_cast<const struct iovec*> (args[1]),
+                static_cast<int> (args[2]));
+            break;
+
+        // the offset is passed in a single register (pos_l) in 64-bit architectures
+        case SYS_preadv:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::preadv> (&ldp::LdPreloadedPosix::ld_preloaded_posix_preadv,
+                &ptr::PosixPassthrough::passthrough_posix_preadv,
+                fd,
+                reinterpret_cast<const struct iovec*> (args[1]),
+                static_cast<int> (args[2]),
+                static_cast<off_t> (args[3]));
+            break;
+
+        case SYS_pwritev:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::pwritev> (&ldp::LdPreloadedPosix::ld_preloaded_posix_pwritev,
+                &ptr::PosixPassthrough::passthrough_posix_pwritev,
+                fd,
+                reinterpret_cast<const struct iovec*> (args[1]),
+                static_cast<int> (args[2]),
+                static_cast<off_t> (args[3]));
+            break;
+
+#ifdef SYS_open
+        case SYS_open:
+            if (open_needs_mode (static_cast<int> (args[1]))) {
+                result = route<PosixCall::open_variadic, int, const char*, int, mode_t> (
+                    &ldp::LdPreloadedPosix::ld_preloaded_posix_open,
+                    &ptr::PosixPassthrough::passthrough_posix_open,
+                    reinterpret_cast<const char*> (args[0]),
+                    static_cast<int> (args[1]),
+                    static_cast<mode_t> (args[2]));
+            } else {
+                result = route<PosixCall::open, int, const char*, int> (
+                    &ldp::LdPreloadedPosix::ld_preloaded_posix_open,
+                    &ptr::PosixPassthrough::passthrough_posix_open,
+                    reinterpret_cast<const char*> (args[0]),
+                    static_cast<int> (args[1]));
+            }
+            break;
+#endif
+
+#ifdef SYS_creat
+        case SYS_creat:
+            result = route<PosixCall::creat> (&ldp::LdPreloadedPosix::ld_preloaded_posix_creat,
+                &ptr::PosixPassthrough::passthrough_posix_creat,
+                reinterpret_cast<const char*> (args[0]),
+                static_cast<mode_t> (args[1]));
+            break;
+#endif
+
+        case SYS_openat:
+            if (open_needs_mode (static_cast<int> (args[2]))) {
+                result = route<PosixCall::openat_variadic, int, int, const char*, int, mode_t> (
+                    &ldp::LdPreloadedPosix::ld_preloaded_posix_openat,
+                    &ptr::PosixPassthrough::passthrough_posix_openat,
+                    fd,
+                    reinterpret_cast<const char*> (args[1]),
+                    static_cast<int> (args[2]),
+                    static_cast<mode_t> (args[3]));
+            } else {
+                result = route<PosixCall::openat, int, int, const char*, int> (
+                    &ldp::LdPreloadedPosix::ld_preloaded_posix_openat,
+                    &ptr::PosixPassthrough::passthrough_posix_openat,
+                    fd,
+                    reinterpret_cast<const char*> (args[1]),
+                    static_cast<int> (args[2]));
+            }
+            break;
+
+        // io_uring instances are released through close as well (e.g., by liburing)
+        case SYS_close:
+            if (!tracked
+                && !(m_ldp_loaded_flag.load () && m_ld_preloaded_posix.is_io_uring_tracked (fd))) {
+                return false;
+            }
+            result = route<PosixCall::close> (&ldp::LdPreloadedPosix::ld_preloaded_posix_close,
+                &ptr::PosixPassthrough::passthrough_posix_close,
+                fd);
+            break;
+
+        case SYS_fsync:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::fsync> (&ldp::LdPreloadedPosix::ld_preloaded_posix_fsync,
+                &ptr::PosixPassthrough::passthrough_posix_fsync,
+                fd);
+            break;
+
+        case SYS_fdatasync:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::fdatasync> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_fdatasync,
+                &ptr::PosixPassthrough::passthrough_posix_fdatasync,
+                fd);
+            break;
+
+        case SYS_truncate:
+            result = route<PosixCall::truncate> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_truncate,
+                &ptr::PosixPassthrough::passthrough_posix_truncate,
+                reinterpret_cast<const char*> (args[0]),
+                static_cast<off_t> (args[1]));
+            break;
+
+        case SYS_ftruncate:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::ftruncate> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_ftruncate,
+                &ptr::PosixPassthrough::passthrough_posix_ftruncate,
+                fd,
+                static_cast<off_t> (args[1]));
+            break;
+
+        case SYS_fallocate:
+            if (!tracked) {
+                return false;
+            }
+            result = route<PosixCall::fallocate> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_fallocate,
+                &ptr::PosixPassthrough::passthrough_posix_fallocate,
+                fd,
+                static_cast<int> (args[1]),
+                static_cast<off_t> (args[2]),
+                static_cast<off_t> (args[3]));
+            break;
+
+#ifdef SYS_rename
+        case SYS_rename:
+            result = route<PosixCall::rename> (&ldp::LdPreloadedPosix::ld_preloaded_posix_rename,
+                &ptr::PosixPassthrough::passthrough_posix_rename,
+                reinterpret_cast<const char*> (args[0]),
+                reinterpret_cast<const char*> (args[1]));
+            break;
+#endif
+
+        case SYS_renameat:
+            result = route<PosixCall::renameat> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_renameat,
+                &ptr::PosixPassthrough::passthrough_posix_renameat,
+                fd,
+                reinterpret_cast<const char*> (args[1]),
+                static_cast<int> (args[2]),
+                reinterpret_cast<const char*> (args[3]));
+            break;
+
+#ifdef SYS_unlink
+        case SYS_unlink:
+            result = route<PosixCall::unlink> (&ldp::LdPreloadedPosix::ld_preloaded_posix_unlink,
+                &ptr::PosixPassthrough::passthrough_posix_unlink,
+                reinterpret_cast<const char*> (args[0]));
+            break;
 #endif
 
-    return (posix_special_calls.padll_intercept_socket && m_ldp_loaded->load ())
-        ? m_ld_preloaded_posix.ld_preloaded_posix_socket (domain, type, protocol)
-        : m_posix_passthrough.passthrough_posix_socket (domain, type, protocol);
+        case SYS_unlinkat:
+            result = route<PosixCall::unlinkat> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_unlinkat,
+                &ptr::PosixPassthrough::passthrough_posix_unlinkat,
+                fd,
+                reinterpret_cast<const char*> (args[1]),
+                static_cast<int> (args[2]));
+            break;
+
+#ifdef SYS_mkdir
+        case SYS_mkdir:
+            result = route<PosixCall::mkdir> (&ldp::LdPreloadedPosix::ld_preloaded_posix_mkdir,
+                &ptr::PosixPassthrough::passthrough_posix_mkdir,
+                reinterpret_cast<const char*> (args[0]),
+                static_cast<mode_t> (args[1]));
+            break;
+#endif
+
+        case SYS_mkdirat:
+            result = route<PosixCall::mkdirat> (&ldp::LdPreloadedPosix::ld_preloaded_posix_mkdirat,
+                &ptr::PosixPassthrough::passthrough_posix_mkdirat,
+                fd,
+                reinterpret_cast<const char*> (args[1]),
+                static_cast<mode_t> (args[2]));
+            break;
+
+#ifdef SYS_rmdir
+        case SYS_rmdir:
+            result = route<PosixCall::rmdir> (&ldp::LdPreloadedPosix::ld_preloaded_posix_rmdir,
+                &ptr::PosixPassthrough::passthrough_posix_rmdir,
+                reinterpret_cast<const char*> (args[0]));
+            break;
+#endif
+
+        // io_uring calls issued outside libc (e.g., by liburing, which issues its own system call
+        // instructions); instances restricted to a single submitting thread are performed as is
+        case SYS_io_uring_setup: {
+            auto* params = reinterpret_cast<struct io_uring_params*> (args[1]);
+#ifdef IORING_SETUP_SINGLE_ISSUER
+            if (params != nullptr && (params->flags & IORING_SETUP_SINGLE_ISSUER) != 0) {
+                return false;
+            }
+#endif
+            result = route<PosixCall::io_uring_setup> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_io_uring_setup,
+                &ptr::PosixPassthrough::passthrough_posix_io_uring_setup,
+                static_cast<unsigned int> (args[0]),
+                params);
+            break;
+        }
+
+        // registered ring descriptors are an index of the submitting task (not a file descriptor)
+        case SYS_io_uring_enter:
+            if ((static_cast<unsigned int> (args[3]) & IORING_ENTER_REGISTERED_RING) != 0
+                || !m_ldp_loaded_flag.load () || !m_ld_preloaded_posix.is_io_uring_tracked (fd)) {
+                return false;
+            }
+            result = route<PosixCall::io_uring_enter> (
+                &ldp::LdPreloadedPosix::ld_preloaded_posix_io_uring_enter,
+                &ptr::PosixPassthrough::passthrough_posix_io_uring_enter,
+                static_cast<unsigned int> (args[0]),
+                static_cast<unsigned int> (args[1]),
+                static_cast<unsigned int> (args[2]),
+                static_cast<unsigned int> (args[3]),
+                reinterpret_cast<const void*> (args[4]),
+                static_cast<size_t> (args[5]));
+            break;
+
+        default:
+            return false;
+    }
+
+    return true;
 }
 
 /**
- * fcntl: intercept POSIX fcntl. Operation will be submitted to passthrough or enforced (rate
- * limited) depending on the SpecialCalls configurations.
- * @param fd
- * @param cmd
+ * seccomp_dispatch: perform a call trapped by the seccomp filter (Handler of the
+ * SeccompSupervisor).
+ * @param request Trapped call.
+ * @param response Response to the calling thread (result or error of the call).
+ * @return Returns false if the call is to be performed by the calling thread.
  */
-extern "C" int fcntl (int fd, int cmd, ...)
+static bool seccomp_dispatch (const struct seccomp_notif& request,
+    struct seccomp_notif_resp& response)
 {
-// detailed logging message
-#if OPTION_DETAILED_LOGGING
-    m_logger_ptr->create_routine_log_message (__func__,
-        std::string_view { std::to_string (fd) },
-        std::string_view { std::to_string (cmd) });
-#endif
+    long result = -1;
+    if (!dispatch_system_call (request.data.nr, request.data.args, result)) {
+        return false;
+    }
 
-    va_list ap;
-    void* arg;
-    va_start (ap, cmd);
-    arg = va_arg (ap, void*);
-    va_end (ap);
+    // libc reports errors with -1 and errno; the kernel expects a negative error number
+    if (result == -1) {
+        response.error = -errno;
+    } else {
+        response.val = result;
+    }
 
-    // submit fcntl call to ld_preloaded_posix
-    int result = m_ld_preloaded_posix.ld_preloaded_posix_fcntl (fd, cmd, arg);
+    return true;
+}
 
-    return result;
+/**
+ * rewrite_dispatch: perform a call issued by a rewritten system call instruction of libc (Handler
+ * of the SyscallRewriter). Calls issued before LdPreloadedPosix is loaded are performed as is.
+ * @param number Number of the system call.
+ * @param args Arguments of the system call.
+ * @param result Result of the call (with negative error numbers on error, as the kernel).
+ * @return Returns false if the call is to be performed as is.
+ */
+static bool rewrite_dispatch (const long& number, const __u64* args, long& result)
+{
+    if (!m_ldp_loaded_flag.load () || !dispatch_system_call (number, args, result)) {
+        return false;
+    }
+
+    if (result == -1) {
+        result = -errno;
+    }
+
+    return true;
 }
 
+/**
+ * warn_intercepted_system_calls: warn if a backend is enabled, but the intercept mask selects
+ * (almost) none of the system calls it supports (see option_min_intercepted_system_calls_ratio).
+ * @param backend Name of the backend.
+ * @param selected Number of system calls (or libc functions) selected by the intercept mask.
+ * @param supported Number of system calls (or libc functions) supported by the backend.
+ */
+static void warn_intercepted_system_calls (const std::string& backend,
+    const std::size_t& selected,
+    const std::size_t& supported)
+{
+    if (selected * opt::option_min_intercepted_system_calls_ratio < supported) {
+        m_logger_ptr->log_error (backend + " is enabled, but the intercept mask only selects "
+            + std::to_string (selected) + " of its " + std::to_string (supported)
+            + " system calls (see the 'intercept' key of padll_config).");
+    }
+}
+
+/**
+ * SeccompSupervisor object. It is only started if seccomp interception is enabled, at library
+ * load (after LdPreloadedPosix is constructed), so that the filter is installed in the thread that
+ * loads PADLL before it creates other threads.
+ */
+nat::SeccompSupervisor m_seccomp_supervisor { m_logger_ptr, seccomp_dispatch };
+
+/**
+ * start_seccomp_supervisor: start the SeccompSupervisor with the system calls whose PosixCall is
+ * to be intercepted, if seccomp interception is enabled.
+ * @return Returns true if the supervisor was started.
+ */
+static bool start_seccomp_supervisor ()
+{
+    if (!nat::SeccompSupervisor::is_enabled ()) {
+        return false;
+    }
+
+    std::vector<long> syscalls {};
+    std::vector<long> supported {};
+    for (const auto& entry : system_calls) {
+        if (std::find (supported.begin (), supported.end (), entry.m_number) == supported.end ()) {
+            supported.push_back (entry.m_number);
+        }
+        if (is_intercepted (entry.m_call)
+            && std::find (syscalls.begin (), syscalls.end (), entry.m_number) == syscalls.end ()) {
+            syscalls.push_back (entry.m_number);
+        }
+    }
+
+    warn_intercepted_system_calls ("Seccomp interception", syscalls.size (), supported.size ());
+
+    return m_seccomp_supervisor.start (syscalls, opt::option_seccomp_supervisor_workers);
+}
+
+/**
+ * m_seccomp_started: whether the SeccompSupervisor was started (initialized at library load).
+ */
+const bool m_seccomp_started { start_seccomp_supervisor () };
+
+/**
+ * SyscallRewriter object. It is only started if binary rewriting is enabled, at library load
+ * (after LdPreloadedPosix is constructed), and if PADLL does not interpose libc's symbols.
+ */
+nat::SyscallRewriter m_syscall_rewriter { m_logger_ptr, rewrite_dispatch };
+
+/**
+ * start_syscall_rewriter: start the SyscallRewriter over the libc functions of the calls to be
+ * intercepted, if binary rewriting is enabled.
+ * @return Returns true if the rewriter was started.
+ */
+static bool start_syscall_rewriter ()
+{
+    if (!nat::SyscallRewriter::is_enabled ()) {
+        return false;
+    }
+
+    // calls would be handled twice: through PADLL's symbols and through the rewritten libc
+    if (nat::SyscallRewriter::is_interposed ("read")) {
+        m_logger_ptr->log_error ("Binary rewriting requires PADLL to be loaded through "
+                                 "libpadll_loader.so; falling back to LD_PRELOAD.");
+        return false;
+    }
+
+    // the seccomp filter would trap the calls performed by the trampolines
+    if (m_seccomp_started) {
+        m_logger_ptr->log_error ("Binary rewriting cannot be combined with seccomp interception.");
+        return false;
+    }
+
+    std::vector<void*> functions {};
+    std::vector<void*> supported {};
+    for (const auto& entry : system_calls) {
+        auto* function = padll::headers::libc_dispatch ().get<void*> (entry.m_call);
+        if (function == nullptr) {
+            continue;
+        }
+        if (std::find (supported.begin (), supported.end (), function) == supported.end ()) {
+            supported.push_back (function);
+        }
+        if (is_intercepted (entry.m_call)
+            && std::find (functions.begin (), functions.end (), function) == functions.end ()) {
+            functions.push_back (function);
+        }
+    }
+
+    warn_intercepted_system_calls ("Binary rewriting", functions.size (), supported.size ());
+
+    if (!m_syscall_rewriter.start (functions)) {
+        return false;
+    }
+
+    // calls performed by PADLL bypass the rewritten wrappers (and their trampolines)
+    for (const auto& entry : system_calls) {
+        auto* function = padll::headers::libc_dispatch ().get<void*> (entry.m_call);
+        if (entry.m_direct != nullptr
+            && std::find (functions.begin (), functions.end (), function) != functions.end ()) {
+            padll::headers::libc_dispatch ().replace (entry.m_call, entry.m_direct);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * m_rewriter_started: whether the SyscallRewriter was started (initialized at library load).
+ */
+const bool m_rewriter_started { start_syscall_rewriter () };
+
 #endif // PADLL_POSIX_FILE_SYSTEM_H
@@ -0,0 +1,137 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_SECCOMP_SUPERVISOR_HPP
+#define PADLL_SECCOMP_SUPERVISOR_HPP
+
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <memory>
+#include <padll/library_headers/libc_headers.hpp>
+#include <padll/options/options.hpp>
+#include <padll/utils/log.hpp>
+#include <utility>
+#include <vector>
+
+using namespace padll::headers;
+using namespace padll::options;
+using namespace padll::utils::log;
+
+namespace padll::interface::native {
+
+/**
+ * SeccompSupervisor class.
+ * Alternative interception backend for calls that do not go through libc, and thus are not
+ * visible to LD_PRELOAD (e.g., raw syscalls, or the runtime of Go programs). It installs a seccomp
+ * filter that traps (SECCOMP_RET_USER_NOTIF) a given set of system calls, and spawns a pool of
+ * supervisor threads that receive the trapped calls and perform them on behalf of the calling
+ * thread, through a Handler (which submits them to the same enforcement and statistics pipeline
+ * of LD_PRELOAD calls). Since PADLL and the target share the address space and the file
+ * descriptor table, the call's arguments are used as is.
+ * - Syscalls not in the set are allowed by the filter, so they stay at native speed.
+ * - Syscalls issued from libc or from the dynamic loader are allowed by the filter (by their
+ *   instruction pointer), since libc calls are already intercepted through LD_PRELOAD, and so
+ *   that PADLL's own calls are never trapped.
+ * - Supervisor threads are created before the filter is installed, so they are not filtered. The
+ *   filter applies to the installing thread and to the threads and processes it creates
+ *   afterwards; calls of other processes (e.g., forked children) are resumed by the kernel
+ *   (SECCOMP_USER_NOTIF_FLAG_CONTINUE), as well as calls the Handler declines.
+ * The filter cannot be removed, and outlives the supervisor (e.g., after execve, trapped calls of
+ * the new program fail with ENOSYS), so it should only be enabled for jobs that do not exec.
+ */
+class SeccompSupervisor {
+
+public:
+    /**
+     * Handler: perform a trapped call, and fill its response (val and error). Returns false if
+     * the call is to be resumed (performed by the calling thread) instead.
+     */
+    using Handler = bool (*) (const struct seccomp_notif& request,
+        struct seccomp_notif_resp& response);
+
+private:
+    std::shared_ptr<Log> m_log { nullptr };
+    Handler m_handler { nullptr };
+    int m_listener { -1 };
+    std::vector<std::pair<uintptr_t, uintptr_t>> m_allowed_ranges {};
+
+    /**
+     * collect_allowed_ranges: collect the executable segments of libc and of the dynamic loader,
+     * from which calls are not to be trapped.
+     * @return Returns true if the segments of libc were found.
+     */
+    bool collect_allowed_ranges ();
+
+    /**
+     * build_filter: build the BPF program of the seccomp filter.
+     * @param syscalls System call numbers to be trapped.
+     * @return Returns the BPF program.
+     */
+    [[nodiscard]] std::vector<struct sock_filter> build_filter (
+        const std::vector<long>& syscalls) const;
+
+    /**
+     * install_filter: install the seccomp filter in the calling thread.
+     * @param program BPF program of the filter.
+     * @return Returns the listener file descriptor of the filter, or -1 on error.
+     */
+    int install_filter (std::vector<struct sock_filter>& program);
+
+    /**
+     * serve: supervisor thread loop; receives trapped calls from listener and responds to them,
+     * until the listener is closed.
+     * @param listener Listener file descriptor of the filter.
+     * @param handler Handler of the trapped calls.
+     */
+    static void serve (const int listener, const Handler handler);
+
+    /**
+     * is_own_thread: check if a thread belongs to the calling process.
+     * @param tid Thread identifier.
+     * @return Returns true if the thread belongs to the process.
+     */
+    [[nodiscard]] static bool is_own_thread (const pid_t& tid);
+
+public:
+    /**
+     * SeccompSupervisor parameterized constructor.
+     * @param log_ptr Shared pointer to a Logging object.
+     * @param handler Handler of the trapped calls.
+     */
+    SeccompSupervisor (std::shared_ptr<Log> log_ptr, Handler handler);
+
+    /**
+     * SeccompSupervisor default destructor. Supervisor threads are not stopped, since the filter
+     * remains installed (and other threads may still be trapped) until the process exits.
+     */
+    ~SeccompSupervisor ();
+
+    SeccompSupervisor (const SeccompSupervisor&) = delete;
+    SeccompSupervisor& operator= (const SeccompSupervisor&) = delete;
+
+    /**
+     * start: spawn the supervisor threads and install the seccomp filter in the calling thread.
+     * @param syscalls System call numbers to be trapped.
+     * @param workers Number of supervisor threads.
+     * @return Returns true if the filter was installed.
+     */
+    bool start (const std::vector<long>& syscalls, const int& workers);
+
+    /**
+     * is_running: check if the seccomp filter is installed.
+     * @return Returns true if the supervisor was started.
+     */
+    [[nodiscard]] bool is_running () const;
+
+    /**
+     * is_enabled: check if seccomp interception is enabled, from option_seccomp_interception_env
+     * (or, if not set, from the runtime configuration).
+     * @return Returns true if seccomp interception is enabled.
+     */
+    [[nodiscard]] static bool is_enabled ();
+};
+} // namespace padll::interface::native
+
+#endif // PADLL_SECCOMP_SUPERVISOR_HPP
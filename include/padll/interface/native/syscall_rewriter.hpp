@@ -0,0 +1,169 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_SYSCALL_REWRITER_HPP
+#define PADLL_SYSCALL_REWRITER_HPP
+
+#include <linux/types.h>
+#include <memory>
+#include <padll/options/options.hpp>
+#include <padll/utils/log.hpp>
+#include <vector>
+
+using namespace padll::options;
+using namespace padll::utils::log;
+
+namespace padll::interface::native {
+
+/**
+ * SyscallRewriter class.
+ * Alternative interception backend, in the style of syscall_intercept, that rewrites the system
+ * call instructions of libc's wrappers (e.g., read, openat, close) at load time, instead of
+ * interposing libc's symbols. Each rewritten instruction (and the instructions around it, to fit a
+ * 5-byte jump) is relocated to a per-site trampoline, which saves the registers of the call and
+ * enters a single C-ABI dispatcher that hands the call to a Handler (which submits it to the same
+ * enforcement and statistics pipeline of LD_PRELOAD calls). Calls the Handler declines, and calls
+ * issued while a call is being handled, execute the original system call instruction. Handled
+ * calls are performed through direct_system_call (instead of the rewritten libc wrapper), so that
+ * they do not pay the trampoline twice.
+ * - Only the functions given to start are rewritten; instructions are decoded from the start of
+ *   each function (with a length decoder of x86-64), and sites are only patched if the relocated
+ *   instructions are position-independent and no branch of the function targets them.
+ * - Functions are rewritten once, at load time, before the application creates threads.
+ * - PADLL must not interpose libc's symbols (i.e., it is loaded through libpadll_loader.so), or
+ *   calls would be handled twice.
+ * Only x86-64 is supported.
+ */
+class SyscallRewriter {
+
+public:
+    /**
+     * Handler: perform an intercepted system call, and set its result (as returned by the kernel,
+     * with negative error numbers on error). Returns false if the call is to be performed as is.
+     */
+    using Handler = bool (*) (const long& number, const __u64* args, long& result);
+
+private:
+    /**
+     * Patch struct: bytes to be written over a window of instructions of libc (a jump to the
+     * window's trampoline).
+     */
+    struct Patch {
+        uintptr_t m_address;
+        std::vector<unsigned char> m_bytes;
+    };
+
+    std::shared_ptr<Log> m_log { nullptr };
+    Handler m_handler { nullptr };
+    unsigned char* m_trampolines { nullptr };
+    std::size_t m_trampolines_used { 0 };
+    std::vector<Patch> m_patches {};
+    int m_rewritten_sites { 0 };
+
+    /**
+     * allocate_trampolines: map the region of the trampolines within the reach of a 32-bit
+     * relative jump from a given address.
+     * @param address Address of a rewritten function.
+     * @return Returns true if the region was mapped.
+     */
+    bool allocate_trampolines (const uintptr_t& address);
+
+    /**
+     * rewrite_site: relocate a window of instructions, which contains a system call instruction,
+     * to a new trampoline, and prepare the Patch that jumps to it.
+     * @param first Address of the first instruction of the window.
+     * @param site Address of the system call instruction.
+     * @param end Address that follows the last instruction of the window.
+     * @return Returns true if the trampoline was created.
+     */
+    bool rewrite_site (const uintptr_t& first, const uintptr_t& site, const uintptr_t& end);
+
+    /**
+     * rewrite_function: rewrite the system call instructions of a function (the Patches are only
+     * applied by start).
+     * @param function Address of the function.
+     * @return Returns the number of rewritten instructions, or -1 if the function could not be
+     * decoded.
+     */
+    int rewrite_function (void* function);
+
+    /**
+     * apply_patch: write a Patch over libc's code.
+     * @param patch
+     * @return Returns true if the Patch was written.
+     */
+    bool apply_patch (const Patch& patch);
+
+public:
+    /**
+     * SyscallRewriter parameterized constructor.
+     * @param log_ptr Shared pointer to a Logging object.
+     * @param handler Handler of the intercepted calls.
+     */
+    SyscallRewriter (std::shared_ptr<Log> log_ptr, Handler handler);
+
+    /**
+     * SyscallRewriter default destructor. Rewritten functions (and their trampolines) are not
+     * restored, since other threads may be executing them until the process exits.
+     */
+    ~SyscallRewriter ();
+
+    SyscallRewriter (const SyscallRewriter&) = delete;
+    SyscallRewriter& operator= (const SyscallRewriter&) = delete;
+
+    /**
+     * start: rewrite the system call instructions of the given libc functions.
+     * @param functions Addresses of the functions to be rewritten.
+     * @return Returns true if at least one instruction was rewritten.
+     */
+    bool start (const std::vector<void*>& functions);
+
+    /**
+     * is_running: check if any system call instruction was rewritten.
+     * @return Returns true if the rewriter was started.
+     */
+    [[nodiscard]] bool is_running () const;
+
+    /**
+     * is_enabled: check if binary rewriting is enabled, from option_binary_rewriting_env (or, if
+     * not set, from the runtime configuration).
+     * @return Returns true if binary rewriting is enabled.
+     */
+    [[nodiscard]] static bool is_enabled ();
+
+    /**
+     * direct_system_call: perform a system call through PADLL's own system call instruction,
+     * which is never rewritten. Used to perform the calls handled by PADLL without re-entering the
+     * rewritten libc wrappers (and their trampolines). Unlike libc's wrappers, it is not a
+     * cancellation point and does not set errno.
+     * @param number Number of the system call.
+     * @param arg0
+     * @param arg1
+     * @param arg2
+     * @param arg3
+     * @param arg4
+     * @param arg5
+     * @return Returns the result of the call (negative error numbers on error), or -ENOSYS if the
+     * architecture is not supported.
+     */
+    static long direct_system_call (long number,
+        long arg0 = 0,
+        long arg1 = 0,
+        long arg2 = 0,
+        long arg3 = 0,
+        long arg4 = 0,
+        long arg5 = 0);
+
+    /**
+     * is_interposed: check if the global definition of a symbol (the one the application binds
+     * to) belongs to the object that contains PADLL, i.e., if PADLL was loaded with LD_PRELOAD.
+     * @param symbol Name of the symbol (e.g., "read").
+     * @return Returns true if the symbol is interposed by PADLL.
+     */
+    [[nodiscard]] static bool is_interposed (const char* symbol);
+};
+} // namespace padll::interface::native
+
+#endif // PADLL_SYSCALL_REWRITER_HPP
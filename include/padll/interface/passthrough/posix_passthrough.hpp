@@ -8,6 +8,8 @@
 
 #include <atomic>
 #include <mutex>
+#include <padll/configurations/padll_configuration.hpp>
+#include <padll/library_headers/libc_dispatch.hpp>
 #include <padll/library_headers/libc_headers.hpp>
 #include <padll/options/options.hpp>
 #include <padll/statistics/statistics.hpp>
@@ -15,6 +17,7 @@
 #include <string>
 #include <unistd.h>
 
+using namespace padll::configurations;
 using namespace padll::headers;
 using namespace padll::options;
 using namespace padll::stats;
@@ -27,6 +30,8 @@ namespace padll::interface::passthrough {
  * This class handles the logic for all intercepted POSIX operations that should not be rate
  * limited, thus actuating as a passthrough. It only handles operations that have set to 'false' in
  * the libc_calls header.
+ * libc symbols are dispatched through the (shared) LibcDispatch table, which is resolved once at
+ * initialization, rather than through a dlsym per call.
  */
 class PosixPassthrough {
 
@@ -36,7 +41,7 @@ private:
     void* m_lib_handle { nullptr };
     std::shared_ptr<Log> m_log { nullptr };
 
-    std::atomic<bool> m_collect { option_default_statistic_collection };
+    std::atomic<bool> m_collect { padll_configuration ().is_statistic_collection_enabled () };
     Statistics m_metadata_stats { "metadata", OperationType::metadata_calls };
     Statistics m_data_stats { "data", OperationType::data_calls };
     Statistics m_dir_stats { "directory", OperationType::directory_calls };
@@ -44,7 +49,8 @@ private:
     Statistics m_special_stats { "special", OperationType::special_calls };
 
     /**
-     * initialize: initialize PosixPassthrough constructors, by opening libc library handle.
+     * initialize: initialize PosixPassthrough constructors, by opening libc library handle and
+     * resolving the libc dispatch table.
      */
     void initialize ();
 
@@ -191,6 +197,286 @@ public:
      */
     int passthrough_posix_munmap (void* addr, size_t length);
 
+    /**
+     * passthrough_posix_readv:
+     *  https://man7.org/linux/man-pages/man2/readv.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @return
+     */
+    ssize_t passthrough_posix_readv (int fd, const struct iovec* iov, int iovcnt);
+
+    /**
+     * passthrough_posix_writev:
+     *  https://man7.org/linux/man-pages/man2/writev.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @return
+     */
+    ssize_t passthrough_posix_writev (int fd, const struct iovec* iov, int iovcnt);
+
+    /**
+     * passthrough_posix_preadv:
+     *  https://man7.org/linux/man-pages/man2/preadv.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @param offset
+     * @return
+     */
+    ssize_t passthrough_posix_preadv (int fd, const struct iovec* iov, int iovcnt, off_t offset);
+
+    /**
+     * passthrough_posix_pwritev:
+     *  https://man7.org/linux/man-pages/man2/pwritev.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @param offset
+     * @return
+     */
+    ssize_t passthrough_posix_pwritev (int fd, const struct iovec* iov, int iovcnt, off_t offset);
+
+    /**
+     * passthrough_posix_preadv2:
+     *  https://man7.org/linux/man-pages/man2/preadv2.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @param offset
+     * @param flags
+     * @return
+     */
+    ssize_t passthrough_posix_preadv2 (int fd,
+        const struct iovec* iov,
+        int iovcnt,
+        off_t offset,
+        int flags);
+
+    /**
+     * passthrough_posix_pwritev2:
+     *  https://man7.org/linux/man-pages/man2/pwritev2.2.html
+     * @param fd
+     * @param iov
+     * @param iovcnt
+     * @param offset
+     * @param flags
+     * @return
+     */
+    ssize_t passthrough_posix_pwritev2 (int fd,
+        const struct iovec* iov,
+        int iovcnt,
+        off_t offset,
+        int flags);
+
+    /**
+     * passthrough_posix_fread:
+     *  https://man7.org/linux/man-pages/man3/fread.3.html
+     * @param buffer
+     * @param size
+     * @param nmemb
+     * @param stream
+     * @return
+     */
+    size_t passthrough_posix_fread (void* buffer, size_t size, size_t nmemb, FILE* stream);
+
+    /**
+     * passthrough_posix_fwrite:
+     *  https://man7.org/linux/man-pages/man3/fread.3.html
+     * @param buffer
+     * @param size
+     * @param nmemb
+     * @param stream
+     * @return
+     */
+    size_t passthrough_posix_fwrite (const void* buffer, size_t size, size_t nmemb, FILE* stream);
+
+    /**
+     * passthrough_posix_fgets:
+     *  https://man7.org/linux/man-pages/man3/fgets.3.html
+     * @param buffer
+     * @param size
+     * @param stream
+     * @return
+     */
+    char* passthrough_posix_fgets (char* buffer, int size, FILE* stream);
+
+    /**
+     * passthrough_posix_fputs:
+     *  https://man7.org/linux/man-pages/man3/puts.3.html
+     * @param buffer
+     * @param stream
+     * @return
+     */
+    int passthrough_posix_fputs (const char* buffer, FILE* stream);
+
+    /**
+     * passthrough_posix_fprintf:
+     *  https://man7.org/linux/man-pages/man3/printf.3.html
+     * The variadic arguments of fprintf are forwarded as a va_list (submitted through vfprintf).
+     * @param stream
+     * @param format
+     * @param args
+     * @return
+     */
+    int passthrough_posix_fprintf (FILE* stream, const char* format, va_list args);
+
+    /**
+     * passthrough_posix_vfprintf:
+     *  https://man7.org/linux/man-pages/man3/printf.3.html
+     * @param stream
+     * @param format
+     * @param args
+     * @return
+     */
+    int passthrough_posix_vfprintf (FILE* stream, const char* format, va_list args);
+
+    /**
+     * passthrough_posix_fflush:
+     *  https://man7.org/linux/man-pages/man3/fflush.3.html
+     * @param stream
+     * @return
+     */
+    int passthrough_posix_fflush (FILE* stream);
+
+    /**
+     * passthrough_posix_copy_file_range:
+     *  https://man7.org/linux/man-pages/man2/copy_file_range.2.html
+     * @param fd_in
+     * @param off_in
+     * @param fd_out
+     * @param off_out
+     * @param len
+     * @param flags
+     * @return
+     */
+    ssize_t passthrough_posix_copy_file_range (int fd_in,
+        off64_t* off_in,
+        int fd_out,
+        off64_t* off_out,
+        size_t len,
+        unsigned int flags);
+
+    /**
+     * passthrough_posix_sendfile:
+     *  https://man7.org/linux/man-pages/man2/sendfile.2.html
+     * @param out_fd
+     * @param in_fd
+     * @param offset
+     * @param count
+     * @return
+     */
+    ssize_t passthrough_posix_sendfile (int out_fd, int in_fd, off_t* offset, size_t count);
+
+    /**
+     * passthrough_posix_sendfile64:
+     *  https://man7.org/linux/man-pages/man2/sendfile.2.html
+     * @param out_fd
+     * @param in_fd
+     * @param offset
+     * @param count
+     * @return
+     */
+    ssize_t passthrough_posix_sendfile64 (int out_fd, int in_fd, off64_t* offset, size_t count);
+
+    /**
+     * passthrough_posix_splice:
+     *  https://man7.org/linux/man-pages/man2/splice.2.html
+     * @param fd_in
+     * @param off_in
+     * @param fd_out
+     * @param off_out
+     * @param len
+     * @param flags
+     * @return
+     */
+    ssize_t passthrough_posix_splice (int fd_in,
+        off64_t* off_in,
+        int fd_out,
+        off64_t* off_out,
+        size_t len,
+        unsigned int flags);
+
+    /**
+     * passthrough_posix_io_uring_enter:
+     *  https://man7.org/linux/man-pages/man2/io_uring_enter.2.html
+     * @param fd
+     * @param to_submit
+     * @param min_complete
+     * @param flags
+     * @param arg
+     * @param argsz
+     * @return
+     */
+    int passthrough_posix_io_uring_enter (unsigned int fd,
+        unsigned int to_submit,
+        unsigned int min_complete,
+        unsigned int flags,
+        const void* arg,
+        size_t argsz);
+
+    /**
+     * passthrough_posix_aio_read:
+     *  https://man7.org/linux/man-pages/man3/aio_read.3.html
+     * @param aiocbp
+     * @return
+     */
+    int passthrough_posix_aio_read (struct aiocb* aiocbp);
+
+    /**
+     * passthrough_posix_aio_write:
+     *  https://man7.org/linux/man-pages/man3/aio_write.3.html
+     * @param aiocbp
+     * @return
+     */
+    int passthrough_posix_aio_write (struct aiocb* aiocbp);
+
+    /**
+     * passthrough_posix_aio_read64:
+     *  https://man7.org/linux/man-pages/man3/aio_read.3.html
+     * @param aiocbp
+     * @return
+     */
+    int passthrough_posix_aio_read64 (struct aiocb64* aiocbp);
+
+    /**
+     * passthrough_posix_aio_write64:
+     *  https://man7.org/linux/man-pages/man3/aio_write.3.html
+     * @param aiocbp
+     * @return
+     */
+    int passthrough_posix_aio_write64 (struct aiocb64* aiocbp);
+
+    /**
+     * passthrough_posix_lio_listio:
+     *  https://man7.org/linux/man-pages/man3/lio_listio.3.html
+     * @param mode
+     * @param list
+     * @param nent
+     * @param sig
+     * @return
+     */
+    int passthrough_posix_lio_listio (int mode,
+        struct aiocb* const list[],
+        int nent,
+        struct sigevent* sig);
+
+    /**
+     * passthrough_posix_lio_listio64:
+     *  https://man7.org/linux/man-pages/man3/lio_listio.3.html
+     * @param mode
+     * @param list
+     * @param nent
+     * @param sig
+     * @return
+     */
+    int passthrough_posix_lio_listio64 (int mode,
+        struct aiocb64* const list[],
+        int nent,
+        struct sigevent* sig);
+
     /**
      * passthrough_posix_open:
      *  https://linux.die.net/man/2/open
@@ -399,6 +685,236 @@ public:
      */
     int passthrough_posix_fclose (FILE* stream);
 
+    /**
+     * passthrough_posix_stat:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param path
+     * @param statbuf
+     * @return
+     */
+    int passthrough_posix_stat (const char* path, struct stat* statbuf);
+
+    /**
+     * passthrough_posix_lstat:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param path
+     * @param statbuf
+     * @return
+     */
+    int passthrough_posix_lstat (const char* path, struct stat* statbuf);
+
+    /**
+     * passthrough_posix_fstat:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param fd
+     * @param statbuf
+     * @return
+     */
+    int passthrough_posix_fstat (int fd, struct stat* statbuf);
+
+    /**
+     * passthrough_posix_fstatat:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param dirfd
+     * @param path
+     * @param statbuf
+     * @param flags
+     * @return
+     */
+    int passthrough_posix_fstatat (int dirfd, const char* path, struct stat* statbuf, int flags);
+
+    /**
+     * passthrough_posix_statx:
+     *  https://man7.org/linux/man-pages/man2/statx.2.html
+     * @param dirfd
+     * @param path
+     * @param flags
+     * @param mask
+     * @param statxbuf
+     * @return
+     */
+    int passthrough_posix_statx (int dirfd,
+        const char* path,
+        int flags,
+        unsigned int mask,
+        struct statx* statxbuf);
+
+    /**
+     * passthrough_posix_access:
+     *  https://man7.org/linux/man-pages/man2/access.2.html
+     * @param path
+     * @param mode
+     * @return
+     */
+    int passthrough_posix_access (const char* path, int mode);
+
+    /**
+     * passthrough_posix_faccessat:
+     *  https://man7.org/linux/man-pages/man2/access.2.html
+     * @param dirfd
+     * @param path
+     * @param mode
+     * @param flags
+     * @return
+     */
+    int passthrough_posix_faccessat (int dirfd, const char* path, int mode, int flags);
+
+    /**
+     * passthrough_posix_stat64:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param path
+     * @param statbuf
+     * @return
+     */
+    int passthrough_posix_stat64 (const char* path, struct stat64* statbuf);
+
+    /**
+     * passthrough_posix_lstat64:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param path
+     * @param statbuf
+     * @return
+     */
+    int passthrough_posix_lstat64 (const char* path, struct stat64* statbuf);
+
+    /**
+     * passthrough_posix_fstat64:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param fd
+     * @param statbuf
+     * @return
+     */
+    int passthrough_posix_fstat64 (int fd, struct stat64* statbuf);
+
+    /**
+     * passthrough_posix_fstatat64:
+     *  https://man7.org/linux/man-pages/man2/stat.2.html
+     * @param dirfd
+     * @param path
+     * @param statbuf
+     * @param flags
+     * @return
+     */
+    int passthrough_posix_fstatat64 (int dirfd,
+        const char* path,
+        struct stat64* statbuf,
+        int flags);
+
+    /**
+     * passthrough_posix_fsync:
+     *  https://man7.org/linux/man-pages/man2/fsync.2.html
+     * @param fd
+     * @return
+     */
+    int passthrough_posix_fsync (int fd);
+
+    /**
+     * passthrough_posix_fdatasync:
+     *  https://man7.org/linux/man-pages/man2/fsync.2.html
+     * @param fd
+     * @return
+     */
+    int passthrough_posix_fdatasync (int fd);
+
+    /**
+     * passthrough_posix_sync_file_range:
+     *  https://man7.org/linux/man-pages/man2/sync_file_range.2.html
+     * @param fd
+     * @param offset
+     * @param nbytes
+     * @param flags
+     * @return
+     */
+    int passthrough_posix_sync_file_range (int fd,
+        off64_t offset,
+        off64_t nbytes,
+        unsigned int flags);
+
+    /**
+     * passthrough_posix_syncfs:
+     *  https://man7.org/linux/man-pages/man2/sync.2.html
+     * @param fd
+     * @return
+     */
+    int passthrough_posix_syncfs (int fd);
+
+    /**
+     * passthrough_posix_truncate:
+     *  https://man7.org/linux/man-pages/man2/truncate.2.html
+     * @param path
+     * @param length
+     * @return
+     */
+    int passthrough_posix_truncate (const char* path, off_t length);
+
+    /**
+     * passthrough_posix_ftruncate:
+     *  https://man7.org/linux/man-pages/man2/truncate.2.html
+     * @param fd
+     * @param length
+     * @return
+     */
+    int passthrough_posix_ftruncate (int fd, off_t length);
+
+    /**
+     * passthrough_posix_fallocate:
+     *  https://man7.org/linux/man-pages/man2/fallocate.2.html
+     * @param fd
+     * @param mode
+     * @param offset
+     * @param length
+     * @return
+     */
+    int passthrough_posix_fallocate (int fd, int mode, off_t offset, off_t length);
+
+    /**
+     * passthrough_posix_posix_fallocate:
+     *  https://man7.org/linux/man-pages/man3/posix_fallocate.3.html
+     * @param fd
+     * @param offset
+     * @param length
+     * @return
+     */
+    int passthrough_posix_posix_fallocate (int fd, off_t offset, off_t length);
+
+    /**
+     * passthrough_posix_posix_fadvise:
+     *  https://man7.org/linux/man-pages/man2/posix_fadvise.2.html
+     * @param fd
+     * @param offset
+     * @param length
+     * @param advice
+     * @return
+     */
+    int passthrough_posix_posix_fadvise (int fd, off_t offset, off_t length, int advice);
+
+    /**
+     * passthrough_posix_io_uring_setup:
+     *  https://man7.org/linux/man-pages/man2/io_uring_setup.2.html
+     * @param entries
+     * @param params
+     * @return
+     */
+    int passthrough_posix_io_uring_setup (unsigned int entries, struct io_uring_params* params);
+
+    /**
+     * passthrough_posix_aio_fsync:
+     *  https://man7.org/linux/man-pages/man3/aio_fsync.3.html
+     * @param op
+     * @param aiocbp
+     * @return
+     */
+    int passthrough_posix_aio_fsync (int op, struct aiocb* aiocbp);
+
+    /**
+     * passthrough_posix_aio_fsync64:
+     *  https://man7.org/linux/man-pages/man3/aio_fsync.3.html
+     * @param op
+     * @param aiocbp
+     * @return
+     */
+    int passthrough_posix_aio_fsync64 (int op, struct aiocb64* aiocbp);
+
     /**
      * passthrough_posix_mkdir:
      *  https://linux.die.net/man/2/mkdir
@@ -447,6 +963,56 @@ public:
      */
     int passthrough_posix_mknodat (int dirfd, const char* path, mode_t mode, dev_t dev);
 
+    /**
+     * passthrough_posix_opendir:
+     *  https://man7.org/linux/man-pages/man3/opendir.3.html
+     * @param path
+     * @return
+     */
+    DIR* passthrough_posix_opendir (const char* path);
+
+    /**
+     * passthrough_posix_fdopendir:
+     *  https://man7.org/linux/man-pages/man3/opendir.3.html
+     * @param fd
+     * @return
+     */
+    DIR* passthrough_posix_fdopendir (int fd);
+
+    /**
+     * passthrough_posix_readdir:
+     *  https://man7.org/linux/man-pages/man3/readdir.3.html
+     * @param dirp
+     * @return
+     */
+    struct dirent* passthrough_posix_readdir (DIR* dirp);
+
+    /**
+     * passthrough_posix_readdir64:
+     *  https://man7.org/linux/man-pages/man3/readdir.3.html
+     * @param dirp
+     * @return
+     */
+    struct dirent64* passthrough_posix_readdir64 (DIR* dirp);
+
+    /**
+     * passthrough_posix_getdents64:
+     *  https://man7.org/linux/man-pages/man2/getdents.2.html
+     * @param fd
+     * @param buffer
+     * @param count
+     * @return
+     */
+    ssize_t passthrough_posix_getdents64 (int fd, void* buffer, size_t count);
+
+    /**
+     * passthrough_posix_closedir:
+     *  https://man7.org/linux/man-pages/man3/closedir.3.html
+     * @param dirp
+     * @return
+     */
+    int passthrough_posix_closedir (DIR* dirp);
+
     /**
      * passthrough_posix_getxattr:
      *  https://linux.die.net/man/2/getxattr
@@ -0,0 +1,111 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_LIBC_DISPATCH_HPP
+#define PADLL_LIBC_DISPATCH_HPP
+
+#include <array>
+#include <atomic>
+#include <padll/library_headers/libc_enums.hpp>
+
+namespace padll::headers {
+
+/**
+ * LibcDispatch class.
+ * Dispatch table with the libc function pointers of all POSIX calls supported by PADLL, indexed
+ * by PosixCall. Symbols are resolved once (dlsym over the option_library_name handle, falling back
+ * to RTLD_NEXT), either eagerly at library load (initialize) or lazily on first use, and each
+ * pointer is published with a single atomic store. After that, dispatching a call costs an atomic
+ * (acquire) load and an indirect call, instead of a dlsym per call.
+ * The table is shared by PosixPassthrough and DlsymHookLibc, so intercepted and passthrough calls
+ * always reach the same libc symbols. It has a constexpr constructor, so it is constant-initialized
+ * and can be used before (and while) the library's static objects are constructed.
+ */
+class LibcDispatch {
+
+private:
+    static constexpr std::size_t kNumCalls { posix_call_names.size () };
+
+    std::atomic<void*> m_lib_handle { nullptr };
+    std::array<std::atomic<void*>, kNumCalls> m_symbols {};
+
+    /**
+     * get_library_handle: get the handle of the option_library_name library, opening it on first
+     * use. Concurrent openers publish the handle with a single compare-and-swap.
+     * @return Returns the library handle, or nullptr if it could not be opened.
+     */
+    void* get_library_handle ();
+
+    /**
+     * resolve: resolve and publish the libc symbol of a given call (slow path of get).
+     * @param call PosixCall to be resolved.
+     * @return Returns the resolved symbol, or nullptr if it could not be found.
+     */
+    void* resolve (const PosixCall& call);
+
+public:
+    /**
+     * LibcDispatch default constructor.
+     */
+    constexpr LibcDispatch () = default;
+
+    LibcDispatch (const LibcDispatch&) = delete;
+    LibcDispatch& operator= (const LibcDispatch&) = delete;
+
+    /**
+     * get: get the libc function pointer of a given call.
+     * @tparam Function Type of the function pointer (e.g., libc_read_t).
+     * @param call PosixCall to be dispatched.
+     * @return Returns the function pointer (nullptr if the symbol could not be resolved).
+     */
+    template <typename Function>
+    [[nodiscard]] Function get (const PosixCall& call)
+    {
+        auto* symbol = this->m_symbols[static_cast<std::size_t> (call)].load (
+            std::memory_order_acquire);
+
+        if (symbol == nullptr) {
+            symbol = this->resolve (call);
+        }
+
+        return reinterpret_cast<Function> (symbol);
+    }
+
+    /**
+     * initialize: eagerly resolve the symbols of all calls.
+     * @return Returns the number of symbols that could not be resolved.
+     */
+    int initialize ();
+
+    /**
+     * replace: publish a replacement of the libc symbol of a given call (e.g., a direct system
+     * call, so that PADLL's own calls bypass the libc wrappers rewritten by the SyscallRewriter).
+     * @param call PosixCall to be replaced.
+     * @param symbol Replacement, with the same signature of the libc symbol.
+     */
+    void replace (const PosixCall& call, void* symbol);
+
+    /**
+     * is_resolved: check if the symbol of a given call is already resolved.
+     * @param call PosixCall to be verified.
+     * @return Returns true if the symbol is published in the table.
+     */
+    [[nodiscard]] bool is_resolved (const PosixCall& call) const;
+};
+
+/**
+ * libc_dispatch: get the dispatch table of the process. The table is constant-initialized, so
+ * this call never runs a constructor nor takes a lock.
+ * @return Returns a reference to the dispatch table.
+ */
+inline LibcDispatch& libc_dispatch ()
+{
+    static LibcDispatch dispatch {};
+    return dispatch;
+}
+
+} // namespace padll::headers
+
+#endif // PADLL_LIBC_DISPATCH_HPP
@@ -6,7 +6,10 @@
 #ifndef PADLL_LIBC_ENUMS_HPP
 #define PADLL_LIBC_ENUMS_HPP
 
+#include <array>
+#include <cstdint>
 #include <padll/third_party/enum.h>
+#include <string_view>
 
 namespace padll::headers {
 
@@ -47,7 +50,30 @@ BETTER_ENUM (Metadata,
     renameat = 18,
     fopen = 19,
     fopen64 = 20,
-    fclose = 21)
+    fclose = 21,
+    stat = 22,
+    lstat = 23,
+    fstat = 24,
+    fstatat = 25,
+    statx = 26,
+    access = 27,
+    faccessat = 28,
+    stat64 = 29,
+    lstat64 = 30,
+    fstat64 = 31,
+    fstatat64 = 32,
+    fsync = 33,
+    fdatasync = 34,
+    sync_file_range = 35,
+    syncfs = 36,
+    truncate = 37,
+    ftruncate = 38,
+    fallocate = 39,
+    posix_fallocate = 40,
+    posix_fadvise = 41,
+    io_uring_setup = 42,
+    aio_fsync = 43,
+    aio_fsync64 = 44)
 
 /**
  * Data Definitions.
@@ -62,12 +88,49 @@ BETTER_ENUM (Data,
     pread64 = 5,
     pwrite64 = 6,
     mmap = 7,
-    munmap = 8)
+    munmap = 8,
+    readv = 9,
+    writev = 10,
+    preadv = 11,
+    pwritev = 12,
+    preadv2 = 13,
+    pwritev2 = 14,
+    fread = 15,
+    fwrite = 16,
+    fgets = 17,
+    fputs = 18,
+    fprintf = 19,
+    vfprintf = 20,
+    fflush = 21,
+    copy_file_range = 22,
+    sendfile = 23,
+    sendfile64 = 24,
+    splice = 25,
+    io_uring_enter = 26,
+    aio_read = 27,
+    aio_write = 28,
+    aio_read64 = 29,
+    aio_write64 = 30,
+    lio_listio = 31,
+    lio_listio64 = 32)
 
 /**
  * Directory Definitions.
  */
-BETTER_ENUM (Directory, int, no_op = 0, mkdir = 1, mkdirat = 2, rmdir = 3, mknod = 4, mknodat = 5)
+BETTER_ENUM (Directory,
+    int,
+    no_op = 0,
+    mkdir = 1,
+    mkdirat = 2,
+    rmdir = 3,
+    mknod = 4,
+    mknodat = 5,
+    opendir = 6,
+    fdopendir = 7,
+    readdir = 8,
+    readdir64 = 9,
+    getdents64 = 10,
+    closedir = 11)
 
 /**
  * ExtendedAttributes Definitions.
@@ -88,7 +151,279 @@ BETTER_ENUM (ExtendedAttributes,
 /**
  * Special POSIX calls definitions.
  */
-BETTER_ENUM (Special, int, no_op = 0, socket = 1, fcntl = 2)
+BETTER_ENUM (Special,
+    int,
+    no_op = 0,
+    socket = 1,
+    fcntl = 2,
+    chdir = 3,
+    fchdir = 4,
+    dup = 5,
+    dup2 = 6,
+    dup3 = 7)
+
+/**
+ * PosixCall enum class.
+ * Flat identifier of every POSIX call that can be intercepted by PADLL, regardless of its
+ * OperationType. It is used to index per-call configurations (e.g., the interception bitmask).
+ */
+enum class PosixCall : uint32_t {
+    // data calls
+    read,
+    write,
+    pread,
+    pwrite,
+    pread64,
+    pwrite64,
+    mmap,
+    munmap,
+    readv,
+    writev,
+    preadv,
+    pwritev,
+    preadv2,
+    pwritev2,
+    fread,
+    fwrite,
+    fgets,
+    fputs,
+    fprintf,
+    vfprintf,
+    fflush,
+    copy_file_range,
+    sendfile,
+    sendfile64,
+    splice,
+    io_uring_enter,
+    aio_read,
+    aio_write,
+    aio_read64,
+    aio_write64,
+    lio_listio,
+    lio_listio64,
+    // directory calls
+    mkdir,
+    mkdirat,
+    rmdir,
+    mknod,
+    mknodat,
+    opendir,
+    fdopendir,
+    readdir,
+    readdir64,
+    getdents64,
+    closedir,
+    // extended attributes calls
+    getxattr,
+    lgetxattr,
+    fgetxattr,
+    setxattr,
+    lsetxattr,
+    fsetxattr,
+    listxattr,
+    llistxattr,
+    flistxattr,
+    // metadata calls
+    open_variadic,
+    open,
+    creat,
+    creat64,
+    openat_variadic,
+    openat,
+    open64_variadic,
+    open64,
+    close,
+    sync,
+    statfs,
+    fstatfs,
+    statfs64,
+    fstatfs64,
+    unlink,
+    unlinkat,
+    rename,
+    renameat,
+    fopen,
+    fopen64,
+    fclose,
+    stat,
+    lstat,
+    fstat,
+    fstatat,
+    statx,
+    access,
+    faccessat,
+    stat64,
+    lstat64,
+    fstat64,
+    fstatat64,
+    fsync,
+    fdatasync,
+    sync_file_range,
+    syncfs,
+    truncate,
+    ftruncate,
+    fallocate,
+    posix_fallocate,
+    posix_fadvise,
+    io_uring_setup,
+    aio_fsync,
+    aio_fsync64,
+    // special calls
+    socket,
+    fcntl,
+    chdir,
+    fchdir,
+    dup,
+    dup2,
+    dup3,
+};
+
+/**
+ * posix_call_names: names of all PosixCall values, in the same order of the enum.
+ */
+constexpr std::array<std::string_view, 103> posix_call_names {
+    // data calls
+    "read",
+    "write",
+    "pread",
+    "pwrite",
+    "pread64",
+    "pwrite64",
+    "mmap",
+    "munmap",
+    "readv",
+    "writev",
+    "preadv",
+    "pwritev",
+    "preadv2",
+    "pwritev2",
+    "fread",
+    "fwrite",
+    "fgets",
+    "fputs",
+    "fprintf",
+    "vfprintf",
+    "fflush",
+    "copy_file_range",
+    "sendfile",
+    "sendfile64",
+    "splice",
+    "io_uring_enter",
+    "aio_read",
+    "aio_write",
+    "aio_read64",
+    "aio_write64",
+    "lio_listio",
+    "lio_listio64",
+    // directory calls
+    "mkdir",
+    "mkdirat",
+    "rmdir",
+    "mknod",
+    "mknodat",
+    "opendir",
+    "fdopendir",
+    "readdir",
+    "readdir64",
+    "getdents64",
+    "closedir",
+    // extended attributes calls
+    "getxattr",
+    "lgetxattr",
+    "fgetxattr",
+    "setxattr",
+    "lsetxattr",
+    "fsetxattr",
+    "listxattr",
+    "llistxattr",
+    "flistxattr",
+    // metadata calls
+    "open_variadic",
+    "open",
+    "creat",
+    "creat64",
+    "openat_variadic",
+    "openat",
+    "open64_variadic",
+    "open64",
+    "close",
+    "sync",
+    "statfs",
+    "fstatfs",
+    "statfs64",
+    "fstatfs64",
+    "unlink",
+    "unlinkat",
+    "rename",
+    "renameat",
+    "fopen",
+    "fopen64",
+    "fclose",
+    "stat",
+    "lstat",
+    "fstat",
+    "fstatat",
+    "statx",
+    "access",
+    "faccessat",
+    "stat64",
+    "lstat64",
+    "fstat64",
+    "fstatat64",
+    "fsync",
+    "fdatasync",
+    "sync_file_range",
+    "syncfs",
+    "truncate",
+    "ftruncate",
+    "fallocate",
+    "posix_fallocate",
+    "posix_fadvise",
+    "io_uring_setup",
+    "aio_fsync",
+    "aio_fsync64",
+    // special calls
+    "socket",
+    "fcntl",
+    "chdir",
+    "fchdir",
+    "dup",
+    "dup2",
+    "dup3",
+};
+
+/**
+ * posix_call_to_string: auxiliary method that converts a PosixCall value to a string.
+ * @param call PosixCall value.
+ * @return constexpr std::string_view
+ */
+constexpr std::string_view posix_call_to_string (const PosixCall& call)
+{
+    auto index = static_cast<std::size_t> (call);
+    return (index < posix_call_names.size ()) ? posix_call_names[index] : "unknown";
+}
+
+/**
+ * posix_call_symbol: auxiliary method that converts a PosixCall value to the name of its libc
+ * symbol (variadic variants, such as open_variadic, share the symbol of the base call, while calls
+ * without a libc wrapper, such as io_uring_enter, are issued through syscall).
+ * @param call PosixCall value.
+ * @return constexpr std::string_view
+ */
+constexpr std::string_view posix_call_symbol (const PosixCall& call)
+{
+    constexpr std::string_view suffix { "_variadic" };
+    auto name = posix_call_to_string (call);
+
+    if (call == PosixCall::io_uring_setup || call == PosixCall::io_uring_enter) {
+        return "syscall";
+    }
+
+    return (name.size () > suffix.size ()
+               && name.substr (name.size () - suffix.size ()) == suffix)
+        ? name.substr (0, name.size () - suffix.size ())
+        : name;
+}
 
 } // namespace padll::headers
 
@@ -6,14 +6,20 @@
 #ifndef PADLL_LIBC_HEADERS_HPP
 #define PADLL_LIBC_HEADERS_HPP
 
+#include <aio.h>
+#include <cstdarg>
 #include <dirent.h>
 #include <dlfcn.h>
 #include <fcntl.h>
+#include <linux/io_uring.h>
 #include <sstream>
 #include <stdio.h>
 #include <sys/mman.h>
+#include <sys/sendfile.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #ifdef __linux__
 #include <sys/vfs.h>
@@ -48,6 +54,29 @@ using libc_renameat_t = int (*) (int, const char*, int, const char*);
 using libc_fopen_t = FILE* (*)(const char*, const char*);
 using libc_fopen64_t = FILE* (*)(const char*, const char*);
 using libc_fclose_t = int (*) (FILE*);
+using libc_stat_t = int (*) (const char*, struct stat*);
+using libc_lstat_t = int (*) (const char*, struct stat*);
+using libc_fstat_t = int (*) (int, struct stat*);
+using libc_fstatat_t = int (*) (int, const char*, struct stat*, int);
+using libc_statx_t = int (*) (int, const char*, int, unsigned int, struct statx*);
+using libc_access_t = int (*) (const char*, int);
+using libc_faccessat_t = int (*) (int, const char*, int, int);
+using libc_stat64_t = int (*) (const char*, struct stat64*);
+using libc_lstat64_t = int (*) (const char*, struct stat64*);
+using libc_fstat64_t = int (*) (int, struct stat64*);
+using libc_fstatat64_t = int (*) (int, const char*, struct stat64*, int);
+using libc_fsync_t = int (*) (int);
+using libc_fdatasync_t = int (*) (int);
+using libc_sync_file_range_t = int (*) (int, off64_t, off64_t, unsigned int);
+using libc_syncfs_t = int (*) (int);
+using libc_truncate_t = int (*) (const char*, off_t);
+using libc_ftruncate_t = int (*) (int, off_t);
+using libc_fallocate_t = int (*) (int, int, off_t, off_t);
+using libc_posix_fallocate_t = int (*) (int, off_t, off_t);
+using libc_posix_fadvise_t = int (*) (int, off_t, off_t, int);
+using libc_io_uring_setup_t = long (*) (long, ...);
+using libc_aio_fsync_t = int (*) (int, struct aiocb*);
+using libc_aio_fsync64_t = int (*) (int, struct aiocb64*);
 
 /**
  * libc_metadata struct: provides an object with the function pointers to all libc metadata-like
@@ -75,6 +104,29 @@ struct libc_metadata {
     libc_fopen_t m_fopen { nullptr };
     libc_fopen64_t m_fopen64 { nullptr };
     libc_fclose_t m_fclose { nullptr };
+    libc_stat_t m_stat { nullptr };
+    libc_lstat_t m_lstat { nullptr };
+    libc_fstat_t m_fstat { nullptr };
+    libc_fstatat_t m_fstatat { nullptr };
+    libc_statx_t m_statx { nullptr };
+    libc_access_t m_access { nullptr };
+    libc_faccessat_t m_faccessat { nullptr };
+    libc_stat64_t m_stat64 { nullptr };
+    libc_lstat64_t m_lstat64 { nullptr };
+    libc_fstat64_t m_fstat64 { nullptr };
+    libc_fstatat64_t m_fstatat64 { nullptr };
+    libc_fsync_t m_fsync { nullptr };
+    libc_fdatasync_t m_fdatasync { nullptr };
+    libc_sync_file_range_t m_sync_file_range { nullptr };
+    libc_syncfs_t m_syncfs { nullptr };
+    libc_truncate_t m_truncate { nullptr };
+    libc_ftruncate_t m_ftruncate { nullptr };
+    libc_fallocate_t m_fallocate { nullptr };
+    libc_posix_fallocate_t m_posix_fallocate { nullptr };
+    libc_posix_fadvise_t m_posix_fadvise { nullptr };
+    libc_io_uring_setup_t m_io_uring_setup { nullptr };
+    libc_aio_fsync_t m_aio_fsync { nullptr };
+    libc_aio_fsync64_t m_aio_fsync64 { nullptr };
 };
 
 /**
@@ -90,6 +142,29 @@ using libc_pwrite64_t = ssize_t (*) (int, const void*, size_t, off64_t);
 #endif
 using libc_mmap_t = void* (*)(void*, size_t, int, int, int, off_t);
 using libc_munmap_t = int (*) (void*, size_t);
+using libc_readv_t = ssize_t (*) (int, const struct iovec*, int);
+using libc_writev_t = ssize_t (*) (int, const struct iovec*, int);
+using libc_preadv_t = ssize_t (*) (int, const struct iovec*, int, off_t);
+using libc_pwritev_t = ssize_t (*) (int, const struct iovec*, int, off_t);
+using libc_preadv2_t = ssize_t (*) (int, const struct iovec*, int, off_t, int);
+using libc_pwritev2_t = ssize_t (*) (int, const struct iovec*, int, off_t, int);
+using libc_fread_t = size_t (*) (void*, size_t, size_t, FILE*);
+using libc_fwrite_t = size_t (*) (const void*, size_t, size_t, FILE*);
+using libc_fgets_t = char* (*)(char*, int, FILE*);
+using libc_fputs_t = int (*) (const char*, FILE*);
+using libc_vfprintf_t = int (*) (FILE*, const char*, va_list);
+using libc_fflush_t = int (*) (FILE*);
+using libc_copy_file_range_t = ssize_t (*) (int, off64_t*, int, off64_t*, size_t, unsigned int);
+using libc_sendfile_t = ssize_t (*) (int, int, off_t*, size_t);
+using libc_sendfile64_t = ssize_t (*) (int, int, off64_t*, size_t);
+using libc_splice_t = ssize_t (*) (int, off64_t*, int, off64_t*, size_t, unsigned int);
+using libc_io_uring_enter_t = long (*) (long, ...);
+using libc_aio_read_t = int (*) (struct aiocb*);
+using libc_aio_write_t = int (*) (struct aiocb*);
+using libc_aio_read64_t = int (*) (struct aiocb64*);
+using libc_aio_write64_t = int (*) (struct aiocb64*);
+using libc_lio_listio_t = int (*) (int, struct aiocb* const[], int, struct sigevent*);
+using libc_lio_listio64_t = int (*) (int, struct aiocb64* const[], int, struct sigevent*);
 
 /**
  * libc_data: provides an object with the function pointers to all libc data-like operations.
@@ -105,6 +180,29 @@ struct libc_data {
 #endif
     libc_mmap_t m_mmap { nullptr };
     libc_munmap_t m_munmap { nullptr };
+    libc_readv_t m_readv { nullptr };
+    libc_writev_t m_writev { nullptr };
+    libc_preadv_t m_preadv { nullptr };
+    libc_pwritev_t m_pwritev { nullptr };
+    libc_preadv2_t m_preadv2 { nullptr };
+    libc_pwritev2_t m_pwritev2 { nullptr };
+    libc_fread_t m_fread { nullptr };
+    libc_fwrite_t m_fwrite { nullptr };
+    libc_fgets_t m_fgets { nullptr };
+    libc_fputs_t m_fputs { nullptr };
+    libc_vfprintf_t m_vfprintf { nullptr };
+    libc_fflush_t m_fflush { nullptr };
+    libc_copy_file_range_t m_copy_file_range { nullptr };
+    libc_sendfile_t m_sendfile { nullptr };
+    libc_sendfile64_t m_sendfile64 { nullptr };
+    libc_splice_t m_splice { nullptr };
+    libc_io_uring_enter_t m_io_uring_enter { nullptr };
+    libc_aio_read_t m_aio_read { nullptr };
+    libc_aio_write_t m_aio_write { nullptr };
+    libc_aio_read64_t m_aio_read64 { nullptr };
+    libc_aio_write64_t m_aio_write64 { nullptr };
+    libc_lio_listio_t m_lio_listio { nullptr };
+    libc_lio_listio64_t m_lio_listio64 { nullptr };
 };
 
 /**
@@ -115,6 +213,12 @@ using libc_mkdirat_t = int (*) (int, const char*, mode_t);
 using libc_rmdir_t = int (*) (const char*);
 using libc_mknod_t = int (*) (const char*, mode_t, dev_t);
 using libc_mknodat_t = int (*) (int, const char*, mode_t, dev_t);
+using libc_opendir_t = DIR* (*) (const char*);
+using libc_fdopendir_t = DIR* (*) (int);
+using libc_readdir_t = struct dirent* (*) (DIR*);
+using libc_readdir64_t = struct dirent64* (*) (DIR*);
+using libc_getdents64_t = ssize_t (*) (int, void*, size_t);
+using libc_closedir_t = int (*) (DIR*);
 
 /**
  * libc_directory: provides an object with the function pointers to all libc directory-like
@@ -126,6 +230,12 @@ struct libc_directory {
     libc_rmdir_t m_rmdir { nullptr };
     libc_mknod_t m_mknod { nullptr };
     libc_mknodat_t m_mknodat { nullptr };
+    libc_opendir_t m_opendir { nullptr };
+    libc_fdopendir_t m_fdopendir { nullptr };
+    libc_readdir_t m_readdir { nullptr };
+    libc_readdir64_t m_readdir64 { nullptr };
+    libc_getdents64_t m_getdents64 { nullptr };
+    libc_closedir_t m_closedir { nullptr };
 };
 
 /**
@@ -162,10 +272,20 @@ struct libc_extattr {
  */
 using libc_socket_t = int (*) (int, int, int);
 using libc_fcntl_t = int (*) (int, int, void*);
+using libc_chdir_t = int (*) (const char*);
+using libc_fchdir_t = int (*) (int);
+using libc_dup_t = int (*) (int);
+using libc_dup2_t = int (*) (int, int);
+using libc_dup3_t = int (*) (int, int, int);
 
 struct libc_special {
     libc_socket_t m_socket { nullptr };
     libc_fcntl_t m_fcntl { nullptr };
+    libc_chdir_t m_chdir { nullptr };
+    libc_fchdir_t m_fchdir { nullptr };
+    libc_dup_t m_dup { nullptr };
+    libc_dup2_t m_dup2 { nullptr };
+    libc_dup3_t m_dup3 { nullptr };
 };
 
 } // namespace padll::headers
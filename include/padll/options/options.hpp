@@ -6,6 +6,7 @@
 #ifndef PADLL_OPTIONS_HPP
 #define PADLL_OPTIONS_HPP
 
+#include <cstdint>
 #include <filesystem>
 #include <string>
 #include <vector>
@@ -45,6 +46,40 @@ constexpr std::string_view mount_point_to_string (const MountPoint& mount_point)
     }
 }
 
+/**
+ * WorkflowSelection enum class.
+ * Defines how a workflow is selected from the set of workflows of a mount point.
+ *  - kRandom: pick a random workflow (each thread holds its own PRNG);
+ *  - kRoundRobin: each thread cycles through the workflows of the mount point;
+ *  - kThreadAffinity: each thread is pinned to a single workflow (improves cache locality in the
+ * PAIO channel);
+ *  - kPathHash: pick the workflow from the hash of the targeted path, so that all requests to the
+ * same file are handled by the same workflow.
+ */
+enum class WorkflowSelection { kRandom = 0, kRoundRobin = 1, kThreadAffinity = 2, kPathHash = 3 };
+
+/**
+ * workflow_selection_to_string: auxiliary method that converts a WorkflowSelection enum value to a
+ * string.
+ * @param selection WorkflowSelection value.
+ * @return constexpr std::string_view
+ */
+constexpr std::string_view workflow_selection_to_string (const WorkflowSelection& selection)
+{
+    switch (selection) {
+        case WorkflowSelection::kRandom:
+            return "random";
+        case WorkflowSelection::kRoundRobin:
+            return "round-robin";
+        case WorkflowSelection::kThreadAffinity:
+            return "thread-affinity";
+        case WorkflowSelection::kPathHash:
+            return "path-hash";
+        default:
+            return "unknown";
+    }
+}
+
 /***************************************************************************************************
  * PADLL default configurations
  **************************************************************************************************/
@@ -54,12 +89,26 @@ constexpr std::string_view mount_point_to_string (const MountPoint& mount_point)
  */
 constexpr std::string_view option_library_name { "libc.so.6" };
 
+/**
+ * option_configuration_file_env: environment variable with the path of PADLL's runtime
+ * configuration file, which overrides the compile-time configurations (libc_calls.hpp and the
+ * options below). See PadllConfiguration. $ export padll_config="/etc/padll/job.conf"
+ */
+constexpr std::string_view option_configuration_file_env { "padll_config" };
+
 /**
  * option_default_statistic_collection: option to enable/disable collection of LD_PRELOADED and
  * passthrough POSIX operations.
  */
 constexpr bool option_default_statistic_collection { true };
 
+/**
+ * option_default_latency_collection: option to enable/disable the collection of per-operation
+ * latency histograms of LD_PRELOADED calls, decomposed in interception, enforcement (PAIO), and
+ * syscall phases. Only considered if statistic collection is enabled.
+ */
+constexpr bool option_default_latency_collection { true };
+
 /**
  * option_mount_point_differentiation_enabled: option to enable/disable mountpoint differentiation
  * and further selection of workflow identifiers (workflow-id to be submitted to the PAIO data
@@ -67,6 +116,20 @@ constexpr bool option_default_statistic_collection { true };
  */
 constexpr bool option_mount_point_differentiation_enabled { true };
 
+/**
+ * option_pipeline_*: compile-time switches of the stages of the interception pipeline (see
+ * LdPreloadedPosix::intercept). A disabled stage is compiled out of every intercepted call, rather
+ * than checked at runtime; the runtime configuration can only disable enabled stages.
+ *  - option_pipeline_statistics: statistic and latency collection;
+ *  - option_pipeline_enforcement: submission of requests to the PAIO data plane stage;
+ *  - option_pipeline_mount_point_differentiation: classification of the request's file descriptor,
+ *  path, or file pointer; if disabled, all requests are submitted to the workflows of the default
+ *  mount point.
+ */
+constexpr bool option_pipeline_statistics { true };
+constexpr bool option_pipeline_enforcement { true };
+constexpr bool option_pipeline_mount_point_differentiation { true };
+
 /**
  * option_check_local_mount_point_first:
  *  if option_mount_point_differentiation = true, first check if the path to be extracted is in the
@@ -91,18 +154,161 @@ constexpr bool option_mount_point_differentiation_enabled { true };
  */
 constexpr std::string_view option_default_remote_mount_point { "/tmp" };
 
+/**
+ * option_max_mount_points: maximum number of mount points (including the MountPoint enum values)
+ * that can be registered in the MountPointTable.
+ */
+constexpr int option_max_mount_points { 1024 };
+
 /**
  * option_hard_remove: option to remove file descriptors from LdPreloadedPosix's m_mount_point_table
  * on ::close, even if the original fd was not registered due to process-based operations.
  */
 constexpr bool option_hard_remove { false };
 
+/**
+ * option_default_space_weight: number of bytes worth of each additional token charged to space
+ * management calls (truncate, ftruncate, fallocate, and posix_fallocate). These are charged 1
+ * token plus one token per option_default_space_weight bytes of their targeted length, so that
+ * multi-GB preallocations cost more than small ones. A value of 0 charges them a constant 1 token.
+ */
+constexpr uint64_t option_default_space_weight { 1073741824 };
+
+/**
+ * option_space_weight_env: environment variable to set the space weight (in bytes) of space
+ * management calls. $ export padll_space_weight="268435456";
+ */
+constexpr std::string_view option_space_weight_env { "padll_space_weight" };
+
+/**
+ * option_transfer_chunk_size: maximum number of bytes of a zero-copy transfer call
+ * (copy_file_range, sendfile, splice) that are enforced at once. Larger transfers are split into
+ * several calls, each enforced before being performed, so that a single call cannot burst far past
+ * the configured rate.
+ */
+constexpr size_t option_transfer_chunk_size { 4194304 };
+
+/**
+ * option_default_io_uring_hold_back: option to enforce the SQEs of an io_uring submission before
+ * they are submitted, holding them back until their workflows have enough budget. Otherwise, SQEs
+ * are submitted right away and charged after the submission, throttling the following ones.
+ */
+constexpr bool option_default_io_uring_hold_back { false };
+
+/**
+ * option_io_uring_hold_back_env: environment variable to enable (or disable) holding back io_uring
+ * submissions until they are enforced. $ export padll_io_uring_hold_back="true";
+ */
+constexpr std::string_view option_io_uring_hold_back_env { "padll_io_uring_hold_back" };
+
+/**
+ * option_batch_charge_entries: number of distinct <workflow, operation type> charges that are
+ * aggregated per batched submission (io_uring submissions, lio_listio lists). Entries of the same
+ * charge are enforced in a single request; charges that do not fit are enforced as soon as the
+ * batch is full.
+ */
+constexpr std::size_t option_batch_charge_entries { 16 };
+
+/**
+ * option_default_seccomp_interception: option to intercept, through a seccomp filter, the calls
+ * that do not go through libc (e.g., raw syscalls, or the runtimes of Go programs), in addition to
+ * the LD_PRELOAD interception. Only the configured calls are trapped by the filter, and only if
+ * issued outside of libc and of the dynamic loader; trapped calls are performed by PADLL's
+ * supervisor threads (SeccompSupervisor).
+ */
+constexpr bool option_default_seccomp_interception { false };
+
+/**
+ * option_seccomp_interception_env: environment variable to enable (or disable) seccomp-based
+ * interception. $ export padll_seccomp_interception="true";
+ */
+constexpr std::string_view option_seccomp_interception_env { "padll_seccomp_interception" };
+
+/**
+ * option_seccomp_supervisor_workers: number of supervisor threads that perform the calls trapped
+ * by the seccomp filter. Each worker serves one call at a time, so this bounds the number of
+ * trapped calls that can be concurrently enforced.
+ */
+constexpr int option_seccomp_supervisor_workers { 4 };
+
+/**
+ * option_default_binary_rewriting: option to intercept calls by rewriting the system call
+ * instructions of libc's wrappers (SyscallRewriter), instead of interposing libc's symbols. Calls
+ * reach PADLL through a single dispatcher, without the PLT hop and wrapper layers of LD_PRELOAD.
+ * PADLL must be loaded through libpadll_loader.so, so that its symbols do not interpose libc.
+ */
+constexpr bool option_default_binary_rewriting { false };
+
+/**
+ * option_binary_rewriting_env: environment variable to enable (or disable) the binary-rewriting
+ * backend. $ export padll_binary_rewriting="true";
+ */
+constexpr std::string_view option_binary_rewriting_env { "padll_binary_rewriting" };
+
+/**
+ * option_min_intercepted_system_calls_ratio: the seccomp and binary-rewriting backends warn when
+ * the intercept mask selects less than 1/ratio of the system calls they support (e.g., when the
+ * default mask is used without a padll_config file), since most calls would then bypass PADLL.
+ */
+constexpr std::size_t option_min_intercepted_system_calls_ratio { 4 };
+
+/**
+ * option_library_path_env: environment variable with the path of libpadll.so, to be loaded by
+ * libpadll_loader.so (if not set, it is searched in the loader's directory).
+ */
+constexpr std::string_view option_library_path_env { "padll_library_path" };
+
+/**
+ * option_default_mmap_sampling_interval: interval (in milliseconds) at which the file-backed
+ * mappings over registered mount points are sampled with mincore, so that the pages faulted in
+ * since the previous sample are charged (as reads of their mapping's workflow). 0 disables it, and
+ * mmap calls are only charged as a single operation.
+ */
+constexpr long option_default_mmap_sampling_interval { 0 };
+
+/**
+ * option_mmap_sampling_interval_env: environment variable to set the mmap sampling interval (in
+ * milliseconds). $ export padll_mmap_sampling_interval=100;
+ */
+constexpr std::string_view option_mmap_sampling_interval_env { "padll_mmap_sampling_interval" };
+
+/**
+ * option_mmap_sampling_chunk: maximum number of pages whose residency is queried per mincore call,
+ * bounding the memory used to sample large mappings.
+ */
+constexpr std::size_t option_mmap_sampling_chunk { 16384 };
+
+/**
+ * option_fd_table_segment_size: number of file descriptor slots per segment of the
+ * FileDescriptorTable. Segments are allocated on demand, as higher file descriptors get registered.
+ */
+constexpr std::size_t option_fd_table_segment_size { 1024 };
+
+/**
+ * option_fd_table_max_capacity: upper bound of file descriptors tracked by the FileDescriptorTable.
+ * Used when the RLIMIT_NOFILE hard limit of the process is unlimited or larger than this value.
+ */
+constexpr std::size_t option_fd_table_max_capacity { 1UL << 20 };
+
 /**
  * option_default_metadata_server_unit: option to enable/disable the selection of a workflow-id for
  * a given MDS or MDT. This feature is still work-in-progress.
  */
 constexpr bool option_select_workflow_by_metadata_unit { false };
 
+/**
+ * option_default_workflow_selection: default strategy to select a workflow from the set of
+ * workflows of a mount point.
+ */
+constexpr WorkflowSelection option_default_workflow_selection { WorkflowSelection::kRandom };
+
+/**
+ * option_workflow_selection_env: environment variable to override the workflow selection strategy
+ * (random, round-robin, thread-affinity, or path-hash).
+ * $ export padll_workflow_selection="path-hash"
+ */
+constexpr std::string_view option_workflow_selection_env { "padll_workflow_selection" };
+
 /**
  * option_padll_workflows: get the number of internal workflows used by the PADLL data plane stage.
  * @return: returns the number of workflows to set in the data plane stage.
@@ -172,6 +378,27 @@ constexpr bool option_default_save_statistics_report { true };
  */
 constexpr std::string_view option_default_statistics_report_path { "/tmp" };
 
+/**
+ * option_max_statistics_instances: maximum number of Statistics objects that can keep per-thread
+ * counter shards. Statistics objects created beyond this limit fall back to a single shared shard
+ * updated with atomic read-modify-write operations.
+ */
+constexpr std::size_t option_max_statistics_instances { 64 };
+
+/**
+ * option_statistics_export_interval_env: environment variable to enable the live export of
+ * statistics to a shared-memory region, and to set the export interval (in milliseconds). If not
+ * set (or set to 0), statistics are only reported when the process exits.
+ * $ export padll_stats_interval=1000
+ */
+constexpr std::string_view option_statistics_export_interval_env { "padll_stats_interval" };
+
+/**
+ * option_statistics_export_path: path prefix of the shared-memory region where statistics are
+ * exported; the process identifier is appended to it (e.g., /dev/shm/padll-stats-<pid>).
+ */
+constexpr std::string_view option_statistics_export_path { "/dev/shm/padll-stats" };
+
 // *************************************************************************************************
 //  Default PAIO data plane stage configuration
 // *************************************************************************************************
@@ -217,6 +444,41 @@ constexpr std::string_view option_default_stage_name_env { "paio_name" };
  */
 constexpr std::string_view option_paio_environment_variable_env { "paio_env" };
 
+/**
+ * option_default_credit_size: number of operations' worth of tokens that a thread prefetches from
+ * the PAIO data plane stage in a single enforcement call, and then consumes locally. Metadata
+ * operations consume 1 token each, while data operations consume their size in bytes. A value of 1
+ * disables credit-based enforcement (i.e., each request is enforced individually).
+ */
+constexpr uint32_t option_default_credit_size { 1 };
+
+/**
+ * option_credit_size_env: environment variable to set the credit size per workflow. It takes a
+ * comma-separated list of <workflow-id>:<credit> entries; an entry without workflow-id sets the
+ * credit of all workflows not explicitly configured. $ export padll_credits="64,0:256,3:1";
+ */
+constexpr std::string_view option_credit_size_env { "padll_credits" };
+
+/**
+ * option_credit_table_size: number of credit entries (<workflow, operation type, operation
+ * context>) kept by each thread. Requests that do not fit in the table are enforced individually.
+ */
+constexpr std::size_t option_credit_table_size { 64 };
+
+/**
+ * option_credit_lifetime: time (in milliseconds) during which the tokens of a credit can be
+ * consumed after being acquired. Expired tokens are dropped, so that threads do not hoard tokens
+ * acquired long ago (e.g., under a previous rate) and release them in a burst.
+ */
+constexpr uint64_t option_credit_lifetime { 100 };
+
+/**
+ * option_credit_max_prefetch_bytes: maximum number of bytes prefetched (i.e., beyond the request's
+ * own size) when a data request acquires a new credit, so that large requests do not acquire
+ * credit_size times their size (e.g., 64 GiB for a 1 GiB write with a credit of 64).
+ */
+constexpr uint64_t option_credit_max_prefetch_bytes { 16 * 1024 * 1024 };
+
 /**
  * option_default_connection_address_env: environment variable to set the address to connect with
  * the control plane's local controller. If not set, PADLL will consider
@@ -6,10 +6,16 @@
 #ifndef PADLL_DATA_PLANE_STAGE_H
 #define PADLL_DATA_PLANE_STAGE_H
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <padll/options/options.hpp>
 #include <padll/utils/log.hpp>
 #include <paio/interface/posix_layer.hpp>
 #include <paio/stage/paio_stage.hpp>
+#include <unordered_map>
+#include <vector>
 
 using namespace padll::options;
 using namespace padll::utils::log;
@@ -20,11 +26,51 @@ namespace padll::stage {
  * DataPlaneStage class.
  * This class handles all logic to submit requests to the PAIO data plane stage to be enforced (rate
  * limited).
+ * Requests can be enforced individually, or through credits: a thread acquires N operations' worth
+ * of tokens from the stage in a single call (N being the credit size of the workflow), and consumes
+ * them locally until they run out. Credits are kept per thread and per <workflow, operation type,
+ * operation context>, so that tokens are always charged to the same channel as the requests that
+ * consume them. Credits expire option_credit_lifetime after being acquired, which bounds the time
+ * tokens acquired before a rate change are consumed under the previous rate. Unused, unexpired
+ * tokens of an exiting thread are refunded to the stage, and consumed by the next thread that runs
+ * out of tokens for the same key. Credit entries are keyed by the stage's generation (unique per
+ * DataPlaneStage object), so a stage created at the address of a destroyed one does not inherit
+ * its credits.
  */
 class DataPlaneStage {
 
 private:
+    /**
+     * CreditEntry struct: tokens prefetched by a thread for a <workflow, operation type, operation
+     * context> key.
+     */
+    struct CreditEntry {
+        uint64_t m_generation;
+        uint32_t m_workflow_id;
+        int m_operation_type;
+        int m_operation_context;
+        uint64_t m_tokens;
+        std::chrono::steady_clock::time_point m_expiry;
+    };
+
+    /**
+     * CreditTable struct: credit entries of a thread (open addressing with linear probing). Its
+     * unused tokens are refunded to their stages when the thread exits.
+     */
+    struct CreditTable {
+        std::array<CreditEntry, option_credit_table_size> m_entries {};
+
+        /**
+         * CreditTable default destructor.
+         */
+        ~CreditTable ();
+    };
+
     std::mutex m_lock;
+    const uint64_t m_generation { DataPlaneStage::next_generation () };
+    std::mutex m_refunds_lock;
+    std::vector<CreditEntry> m_refunds {};
+    std::atomic<bool> m_has_refunds { false };
     std::shared_ptr<Log> m_log { nullptr };
     std::atomic<bool> m_stage_initialized { false };
     paio::options::CommunicationType m_communication_type {
@@ -34,6 +80,82 @@ private:
     int m_local_controller_port { paio::options::option_default_port };
     std::shared_ptr<paio::PaioStage> m_stage { nullptr };
     std::unique_ptr<paio::PosixLayer> m_posix_instance { nullptr };
+    uint32_t m_default_credit_size { option_default_credit_size };
+    std::vector<uint32_t> m_credit_sizes {};
+
+    /**
+     * initialize_credit_sizes: parse the per-workflow credit sizes from option_credit_size_env (or,
+     * if not set, from the runtime configuration).
+     */
+    void initialize_credit_sizes ();
+
+    /**
+     * get_credit_size: get the credit size of a given workflow.
+     * @param workflow_id Workflow identifier.
+     * @return Returns the credit size (1 if credits are disabled for the workflow).
+     */
+    [[nodiscard]] uint32_t get_credit_size (const uint32_t& workflow_id) const;
+
+    /**
+     * next_generation: get a new stage generation (never 0, which marks empty credit entries).
+     * @return Returns the generation.
+     */
+    [[nodiscard]] static uint64_t next_generation ();
+
+    /**
+     * live_stages: registry of the existing stages, indexed by their generation, so that credits
+     * are only refunded to stages that were not destroyed. Must be accessed under
+     * live_stages_lock.
+     * @return Returns a reference to the registry.
+     */
+    [[nodiscard]] static std::unordered_map<uint64_t, DataPlaneStage*>& live_stages ();
+
+    /**
+     * live_stages_lock: lock of the live_stages registry.
+     * @return Returns a reference to the lock.
+     */
+    [[nodiscard]] static std::mutex& live_stages_lock ();
+
+    /**
+     * register_stage: add the stage to the live_stages registry.
+     */
+    void register_stage ();
+
+    /**
+     * refund_credit: keep the unused tokens of a credit of an exiting thread, to be reclaimed by
+     * another thread.
+     * @param entry Credit entry with the tokens to be refunded.
+     */
+    void refund_credit (const CreditEntry& entry);
+
+    /**
+     * reclaim_credit: move the unexpired tokens refunded for the key of a credit entry to it.
+     * @param entry Credit entry of the calling thread.
+     * @param now Current time.
+     */
+    void reclaim_credit (CreditEntry& entry, const std::chrono::steady_clock::time_point& now);
+
+    /**
+     * get_credit_entry: get (or create) the credit entry of the calling thread for a given key.
+     * @return Returns a pointer to the entry, or nullptr if the thread's credit table is full.
+     */
+    [[nodiscard]] CreditEntry* get_credit_entry (const uint32_t& workflow_id,
+        const int& operation_type,
+        const int& operation_context) const;
+
+    /**
+     * submit_request: submit request to be enforced at the PAIO data plane stage.
+     * @param workflow_id Workflow identifier (used for channel selection).
+     * @param operation_type Operation type of the handled POSIX operation.
+     * @param operation_context Context of the handled POSIX operation.
+     * @param operation_size Cost of the request (in tokens).
+     * @param total_operations Number of operations accounted by the request.
+     */
+    void submit_request (const uint32_t& workflow_id,
+        const int& operation_type,
+        const int& operation_context,
+        const uint64_t& operation_size,
+        const int& total_operations);
 
     /**
      * set_stage_initialized: mark data plane stage as initialized.
@@ -95,7 +217,9 @@ public:
     ~DataPlaneStage ();
 
     /**
-     * enforce_request: submit request to be enforced at the PAIO data plane stage.
+     * enforce_request: submit request to be enforced at the PAIO data plane stage. If credits are
+     * enabled for the workflow, the request consumes locally available tokens, and only goes to
+     * the stage to acquire a new credit when these run out.
      * @param workflow_id Workflow identifier (used for channel selection).
      * @param operation_type Operation type of the handled POSIX operation.
      * @param operation_context Context of the handled POSIX operation (data, metadata, extended
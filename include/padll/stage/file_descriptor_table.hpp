@@ -0,0 +1,213 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_FILE_DESCRIPTOR_TABLE_HPP
+#define PADLL_FILE_DESCRIPTOR_TABLE_HPP
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <padll/options/options.hpp>
+#include <padll/stage/mount_point_entry.hpp>
+#include <sstream>
+#include <sys/resource.h>
+
+using namespace padll::options;
+
+namespace padll::stage {
+
+/**
+ * FileDescriptorTag struct.
+ * Snapshot of the classification of a registered file descriptor, as published in the
+ * FileDescriptorTable. It holds everything the data path needs to select a workflow.
+ */
+struct FileDescriptorTag {
+    bool m_valid { false };
+    MountPoint m_mount_point { MountPoint::kNone };
+    uint32_t m_metadata_server_unit { static_cast<uint32_t> (-1) };
+    uint64_t m_path_hash { 0 };
+};
+
+/**
+ * FileDescriptorTable class.
+ * Flat table of MountPointEntry objects, directly indexed by file descriptor. Slots are organized
+ * in fixed-size segments (option_fd_table_segment_size) that are allocated on demand, and the
+ * table capacity is bounded by the RLIMIT_NOFILE hard limit of the process.
+ * Each slot publishes the classification of its file descriptor (FileDescriptorTag) in plain
+ * atomic words, guarded by a per-slot sequence counter (seqlock), so lookups on the data path never
+ * take a lock nor dereference the MountPointEntry; they only retry while the same slot is being
+ * published. Readers that need the entry itself (e.g., its path) get a shared_ptr copy, which keeps
+ * the entry alive even if its file descriptor is concurrently closed or replaced. Writers (create,
+ * remove, move, and duplicate) are serialized through m_write_lock.
+ * Entries are reference counted, so file descriptors duplicated with dup, dup2, dup3, or fcntl
+ * (F_DUPFD) share the entry of the original file descriptor, which is only released when its last
+ * file descriptor is removed.
+ */
+class FileDescriptorTable {
+
+private:
+    /**
+     * Slot struct: packed tag and path hash of the file descriptor, published under m_sequence
+     * (odd while being published), and the slot's reference to its (shared) MountPointEntry.
+     * m_owner is only modified under m_write_lock, through the atomic shared_ptr operations, so
+     * lock-free readers can copy it.
+     */
+    struct Slot {
+        std::atomic<uint64_t> m_sequence { 0 };
+        std::atomic<uint64_t> m_tag { 0 };
+        std::atomic<uint64_t> m_path_hash { 0 };
+        std::shared_ptr<MountPointEntry> m_owner { nullptr };
+    };
+
+    /**
+     * Segment struct: contiguous block of option_fd_table_segment_size slots.
+     */
+    struct Segment {
+        std::array<Slot, option_fd_table_segment_size> m_slots {};
+    };
+
+    std::mutex m_write_lock;
+    std::size_t m_capacity { 0 };
+    std::size_t m_num_segments { 0 };
+    std::unique_ptr<std::atomic<Segment*>[]> m_segments { nullptr };
+
+    static constexpr uint64_t kValidTag { 1ULL << 63 };
+
+    /**
+     * compute_capacity: compute the number of file descriptors the table can hold, based on the
+     * RLIMIT_NOFILE hard limit and option_fd_table_max_capacity.
+     * @return Returns the table capacity.
+     */
+    [[nodiscard]] static std::size_t compute_capacity ();
+
+    /**
+     * encode_tag: pack the mount point and metadata server unit of an entry in a single word.
+     * @param entry Entry to be encoded.
+     * @return Returns the packed tag.
+     */
+    [[nodiscard]] static uint64_t encode_tag (const MountPointEntry& entry);
+
+    /**
+     * get_slot: get the slot of a given file descriptor, if its segment is already allocated.
+     * This method is wait-free.
+     * @param fd File descriptor.
+     * @return Returns a pointer to the slot, or nullptr if fd is out of range or not allocated.
+     */
+    [[nodiscard]] Slot* get_slot (const int& fd) const;
+
+    /**
+     * get_or_create_slot: get the slot of a given file descriptor, allocating its segment if
+     * needed. Must be called while holding m_write_lock.
+     * @param fd File descriptor.
+     * @return Returns a pointer to the slot, or nullptr if fd is out of range.
+     */
+    [[nodiscard]] Slot* get_or_create_slot (const int& fd);
+
+    /**
+     * publish: store entry in slot and publish its tag and path hash. Must be called while holding
+     * m_write_lock.
+     * @param slot Slot to be updated.
+     * @param entry Entry to be stored (may be nullptr to clear the slot).
+     * @return Returns the slot's reference to the entry previously stored in the slot.
+     */
+    std::shared_ptr<MountPointEntry> publish (Slot* slot, std::shared_ptr<MountPointEntry> entry);
+
+public:
+    /**
+     * FileDescriptorTable default constructor.
+     */
+    FileDescriptorTable ();
+
+    /**
+     * FileDescriptorTable default destructor.
+     */
+    ~FileDescriptorTable ();
+
+    FileDescriptorTable (const FileDescriptorTable&) = delete;
+    FileDescriptorTable& operator= (const FileDescriptorTable&) = delete;
+
+    /**
+     * capacity: get the maximum number of file descriptors the table can hold.
+     * @return Returns the table capacity.
+     */
+    [[nodiscard]] std::size_t capacity () const;
+
+    /**
+     * is_within_capacity: verify if a file descriptor can be indexed by the table.
+     * @param fd File descriptor to be verified.
+     * @return Returns true if fd is within [0, capacity).
+     */
+    [[nodiscard]] bool is_within_capacity (const int& fd) const;
+
+    /**
+     * insert: register entry for the fd file descriptor, replacing any previous entry.
+     * @param fd File descriptor to be registered.
+     * @param entry Entry to be stored.
+     * @return Returns true if the slot was empty, and false if an entry was replaced or if fd is
+     * out of range.
+     */
+    bool insert (const int& fd, std::unique_ptr<MountPointEntry> entry);
+
+    /**
+     * lookup: get the classification of a registered file descriptor. This method is lock-free,
+     * and only retries while the slot of fd is being published.
+     * @param fd File descriptor to be considered.
+     * @return Returns a FileDescriptorTag; m_valid is false if fd is not registered.
+     */
+    [[nodiscard]] FileDescriptorTag lookup (const int& fd) const;
+
+    /**
+     * get: get the entry of a registered file descriptor. The returned reference keeps the entry
+     * alive, even if fd is concurrently removed or replaced.
+     * @param fd File descriptor to be considered.
+     * @return Returns a shared pointer to the MountPointEntry, or nullptr if fd is not registered.
+     */
+    [[nodiscard]] std::shared_ptr<MountPointEntry> get (const int& fd) const;
+
+    /**
+     * remove: remove the entry of a registered file descriptor.
+     * @param fd File descriptor to be removed.
+     * @return Returns true if the entry was removed, and false if fd was not registered.
+     */
+    bool remove (const int& fd);
+
+    /**
+     * move: move the entry of old_fd to new_fd, replacing any entry of new_fd.
+     * @param old_fd File descriptor with a registered entry.
+     * @param new_fd File descriptor to receive the entry.
+     * @return Returns true if the entry was moved, and false if old_fd was not registered or if
+     * new_fd is out of range.
+     */
+    bool move (const int& old_fd, const int& new_fd);
+
+    /**
+     * duplicate: make new_fd share the entry of old_fd (as in dup, dup2, dup3, and fcntl with
+     * F_DUPFD), atomically replacing any entry of new_fd. If old_fd is not registered, new_fd is
+     * unregistered, since it no longer refers to the file of its previous entry.
+     * @param old_fd File descriptor being duplicated.
+     * @param new_fd Duplicate file descriptor.
+     * @return Returns true if new_fd shares the entry of old_fd, and false if old_fd was not
+     * registered or if new_fd is out of range.
+     */
+    bool duplicate (const int& old_fd, const int& new_fd);
+
+    /**
+     * references: get the number of file descriptors that share the entry of a given file
+     * descriptor.
+     * @param fd File descriptor to be considered.
+     * @return Returns the number of file descriptors, or 0 if fd is not registered.
+     */
+    [[nodiscard]] long references (const int& fd);
+
+    /**
+     * to_string: returns in string-based format all registered entries.
+     */
+    [[nodiscard]] std::string to_string ();
+};
+
+} // namespace padll::stage
+
+#endif // PADLL_FILE_DESCRIPTOR_TABLE_HPP
@@ -0,0 +1,212 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_IO_URING_TABLE_HPP
+#define PADLL_IO_URING_TABLE_HPP
+
+#include <atomic>
+#include <linux/io_uring.h>
+#include <mutex>
+#include <optional>
+#include <padll/options/options.hpp>
+#include <shared_mutex>
+#include <sstream>
+#include <sys/uio.h>
+#include <unordered_map>
+#include <utility>
+
+using namespace padll::options;
+
+namespace padll::stage {
+
+/**
+ * IoUringOperation enum class.
+ * Class of the operation of a submission queue entry (SQE), as charged by PADLL.
+ */
+enum class IoUringOperation : int {
+    kRead = 0,
+    kWrite = 1,
+    kFsync = 2,
+    kFdatasync = 3,
+    kOpenat = 4,
+    kOther = 5
+};
+
+/**
+ * IoUringSubmission struct: decoded submission queue entry (SQE). m_fd is the targeted file
+ * descriptor (the directory file descriptor of openat), m_path the path of openat, and m_bytes the
+ * number of bytes of read and write operations. Entries over registered files (IOSQE_FIXED_FILE)
+ * hold an index in m_fd instead of a file descriptor, so they cannot be classified.
+ */
+struct IoUringSubmission {
+    IoUringOperation m_operation { IoUringOperation::kOther };
+    int m_fd { -1 };
+    const char* m_path { nullptr };
+    uint64_t m_bytes { 0 };
+    bool m_fixed_file { false };
+};
+
+/**
+ * IoUringTable class.
+ * Table of the io_uring instances of the process, indexed by the ring's file descriptor. For each
+ * instance, PADLL maps its own (read-only) view of the submission queue (SQ) ring and of the SQE
+ * array, so it can inspect the SQEs that are pending submission when the application calls
+ * io_uring_enter, without depending on the application's mappings.
+ * Instances that are not submitted through io_uring_enter (IORING_SETUP_SQPOLL), or whose rings are
+ * not mapped by the kernel (IORING_SETUP_NO_MMAP), are not registered.
+ */
+class IoUringTable {
+
+private:
+    /**
+     * IoUringRing struct: PADLL's view of the SQ ring and SQE array of an io_uring instance.
+     */
+    struct IoUringRing {
+        void* m_sq_ring { nullptr };
+        size_t m_sq_ring_size { 0 };
+        void* m_sqes { nullptr };
+        size_t m_sqes_size { 0 };
+        size_t m_sqe_size { sizeof (struct io_uring_sqe) };
+        const unsigned* m_head { nullptr };
+        const unsigned* m_tail { nullptr };
+        const unsigned* m_mask { nullptr };
+        const unsigned* m_array { nullptr };
+        unsigned m_entries { 0 };
+        bool m_single_issuer { false };
+    };
+
+    std::shared_timed_mutex m_shared_lock;
+    std::unordered_map<int, IoUringRing> m_rings {};
+    std::atomic<size_t> m_size { 0 };
+
+    /**
+     * unmap_ring: release PADLL's view of an io_uring instance.
+     * @param ring IoUringRing to be released.
+     */
+    static void unmap_ring (const IoUringRing& ring);
+
+    /**
+     * decode_submission: decode a submission queue entry.
+     * @param sqe Pointer to the SQE.
+     * @return Returns the decoded IoUringSubmission.
+     */
+    [[nodiscard]] static IoUringSubmission decode_submission (const struct io_uring_sqe* sqe);
+
+public:
+    /**
+     * IoUringTable default constructor.
+     */
+    IoUringTable ();
+
+    /**
+     * IoUringTable default destructor.
+     */
+    ~IoUringTable ();
+
+    /**
+     * register_ring: map PADLL's view of the SQ ring and SQE array of an io_uring instance, and
+     * register it in the table (replacing any instance previously registered with the same file
+     * descriptor).
+     * @param ring_fd File descriptor of the io_uring instance.
+     * @param params Parameters of the instance, as filled by io_uring_setup.
+     * @return Returns true if the instance was registered; false if it is not supported or if its
+     * rings could not be mapped.
+     */
+    bool register_ring (const int& ring_fd, const struct io_uring_params& params);
+
+    /**
+     * remove_ring: remove an io_uring instance from the table.
+     * @param ring_fd File descriptor of the io_uring instance.
+     * @return Returns true if the instance was registered and removed; false otherwise.
+     */
+    bool remove_ring (const int& ring_fd);
+
+    /**
+     * is_empty: check if there are registered io_uring instances. Lock-free, so that calls on the
+     * data path (e.g., close) only take the lock when io_uring is being used.
+     * @return Returns true if no instances are registered.
+     */
+    [[nodiscard]] bool is_empty () const;
+
+    /**
+     * submission_window: get the window of SQEs pending submission of an io_uring instance.
+     * @param ring_fd File descriptor of the io_uring instance.
+     * @return Returns a pair with the position of the first pending SQE and the number of pending
+     * SQEs, or std::nullopt if the instance is not registered.
+     */
+    [[nodiscard]] std::optional<std::pair<unsigned, unsigned>> submission_window (
+        const int& ring_fd);
+
+    /**
+     * is_shared_ring: check if an io_uring instance is registered and accepts submissions from any
+     * thread of the process (i.e., it was not set up with IORING_SETUP_SINGLE_ISSUER).
+     * @param ring_fd File descriptor of the io_uring instance.
+     * @return Returns true if the instance is registered and accepts submissions from any thread.
+     */
+    [[nodiscard]] bool is_shared_ring (const int& ring_fd);
+
+    /**
+     * for_each_submission: decode count SQEs of an io_uring instance, starting at position first
+     * of the SQ ring, and pass each one to visitor, until it returns false. The SQEs must not have
+     * been reused by the application (i.e., they are either pending, or were consumed by the
+     * calling thread's submission).
+     * @tparam Visitor Callable that receives a const IoUringSubmission&, and returns false if the
+     * SQE could not be handled (which stops the iteration).
+     * @param ring_fd File descriptor of the io_uring instance.
+     * @param first Position of the first SQE in the SQ ring.
+     * @param count Number of SQEs to be visited.
+     * @param visitor Callable to be invoked for each SQE.
+     * @return Returns the number of SQEs handled by visitor (invalid SQEs are skipped, and count as
+     * handled).
+     */
+    template <typename Visitor>
+    unsigned for_each_submission (const int& ring_fd,
+        const unsigned& first,
+        const unsigned& count,
+        Visitor visitor)
+    {
+        std::shared_lock lock (this->m_shared_lock);
+
+        auto iterator = this->m_rings.find (ring_fd);
+        if (iterator == this->m_rings.end ()) {
+            return 0;
+        }
+
+        const auto& ring = iterator->second;
+        auto mask = *ring.m_mask;
+        unsigned visited = 0;
+
+        for (unsigned position = first; visited < count; position++, visited++) {
+            // the SQ array holds the index of each SQE (if the instance has one)
+            auto index = position & mask;
+            if (ring.m_array != nullptr) {
+                index = ring.m_array[index];
+            }
+
+            // invalid indexes are dropped by the kernel
+            if (index >= ring.m_entries) {
+                continue;
+            }
+
+            const auto* sqe = reinterpret_cast<const struct io_uring_sqe*> (
+                static_cast<const char*> (ring.m_sqes) + index * ring.m_sqe_size);
+            if (!visitor (IoUringTable::decode_submission (sqe))) {
+                break;
+            }
+        }
+
+        return visited;
+    }
+
+    /**
+     * to_string: generate a string with the io_uring instances registered in the table.
+     * @return Returns a string.
+     */
+    std::string to_string ();
+};
+
+} // namespace padll::stage
+
+#endif // PADLL_IO_URING_TABLE_HPP
@@ -0,0 +1,135 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_MMAP_TABLE_HPP
+#define PADLL_MMAP_TABLE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <padll/options/options.hpp>
+#include <sstream>
+#include <vector>
+
+using namespace padll::options;
+
+namespace padll::stage {
+
+/**
+ * MmapCharge struct: bytes of a mapping that were faulted in since its previous sample, to be
+ * charged to the mapping's workflow.
+ */
+struct MmapCharge {
+    uint32_t m_workflow_id { 0 };
+    uint64_t m_bytes { 0 };
+};
+
+/**
+ * MmapTable class.
+ * Table of the file-backed mappings of the process over registered mount points, indexed by their
+ * start address. For each mapping, PADLL keeps the residency of its pages, as last sampled with
+ * mincore, so that each sample reports the pages faulted in since the previous one (i.e., the data
+ * actually read through the mapping), instead of the mapping's length.
+ * - Pages that were already resident when the mapping was registered are not reported.
+ * - Pages that are evicted and faulted in again are reported again.
+ * - Mappings that are no longer mapped (e.g., unmapped without going through PADLL) are dropped at
+ *   their next sample.
+ */
+class MmapTable {
+
+private:
+    /**
+     * MappedRegion struct: workflow of a mapping, and the residency of each of its pages.
+     */
+    struct MappedRegion {
+        uint32_t m_workflow_id { 0 };
+        std::vector<bool> m_resident {};
+    };
+
+    std::mutex m_lock;
+    std::map<uintptr_t, MappedRegion> m_regions {};
+    std::atomic<size_t> m_size { 0 };
+    const size_t m_page_size;
+
+    /**
+     * sample_region: query the residency of the pages of a mapping (option_mmap_sampling_chunk
+     * pages at a time), and update it.
+     * @param address Start address of the mapping.
+     * @param region MappedRegion to be updated.
+     * @param bytes Number of bytes of the pages faulted in since the previous sample (updated by
+     * the call).
+     * @return Returns false if the mapping is no longer mapped; true otherwise.
+     */
+    bool sample_region (const uintptr_t& address, MappedRegion& region, uint64_t& bytes) const;
+
+    /**
+     * remove_regions: remove the mappings that overlap with [start, end), keeping their
+     * non-overlapping parts. Must be called with m_lock held.
+     * @param start Start address of the range.
+     * @param end End address of the range (page-aligned).
+     */
+    void remove_regions (const uintptr_t& start, const uintptr_t& end);
+
+public:
+    /**
+     * MmapTable default constructor.
+     */
+    MmapTable ();
+
+    /**
+     * MmapTable default destructor.
+     */
+    ~MmapTable ();
+
+    /**
+     * register_mapping: register a file-backed mapping, and sample the residency of its pages
+     * (which are not charged). Mappings previously registered over the same range are replaced.
+     * @param address Start address of the mapping.
+     * @param length Length of the mapping.
+     * @param workflow_id Workflow to which the faulted in pages are charged.
+     * @return Returns true if the mapping was registered; false if it could not be sampled.
+     */
+    bool register_mapping (void* address, const size_t& length, const uint32_t& workflow_id);
+
+    /**
+     * sample_mappings: sample the mappings that overlap with a range that is about to be unmapped,
+     * so that the pages faulted in since their previous sample are charged before being unmapped.
+     * The mappings are kept until the range is actually unmapped (see remove_mappings).
+     * @param address Start address of the range.
+     * @param length Length of the range.
+     * @return Returns the charges of the pages faulted in since the previous sample.
+     */
+    std::vector<MmapCharge> sample_mappings (void* address, const size_t& length);
+
+    /**
+     * remove_mappings: remove the mappings (or their parts) within a range that was unmapped.
+     * @param address Start address of the range.
+     * @param length Length of the range.
+     */
+    void remove_mappings (void* address, const size_t& length);
+
+    /**
+     * sample: sample the residency of all registered mappings.
+     * @return Returns the charges of the pages faulted in since the previous sample.
+     */
+    std::vector<MmapCharge> sample ();
+
+    /**
+     * is_empty: check if there are registered mappings. Lock-free, so that munmap calls only take
+     * the lock when mappings are being sampled.
+     * @return Returns true if no mappings are registered.
+     */
+    [[nodiscard]] bool is_empty () const;
+
+    /**
+     * to_string: generate a string with the mappings registered in the table.
+     * @return Returns a string.
+     */
+    std::string to_string ();
+};
+} // namespace padll::stage
+
+#endif // PADLL_MMAP_TABLE_HPP
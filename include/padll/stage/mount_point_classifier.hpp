@@ -0,0 +1,147 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_MOUNT_POINT_CLASSIFIER_HPP
+#define PADLL_MOUNT_POINT_CLASSIFIER_HPP
+
+#include <cstdint>
+#include <padll/options/options.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace padll::options;
+
+namespace padll::stage {
+
+/**
+ * MountPointClassifier class.
+ * Classifies paths by the longest registered mount point prefix, matched component-wise (i.e.,
+ * "/tmp" matches "/tmp" and "/tmp/file", but not "/tmpfiles" nor "/home/tmp").
+ * Registered prefixes are compiled into a flat trie: nodes keep a contiguous, lexicographically
+ * sorted range of edges, and edge labels are stored in a single string pool. A classification walks
+ * the path's components once (O(path depth), with a binary search over the children of each node)
+ * and does not allocate memory. "." components are skipped and ".." components are resolved
+ * lexically. The classifier also records which mount points have other mount points registered
+ * below them, so paths relative to a classified directory can be classified without a walk.
+ * Mount points are expected to be registered at initialization, before any classification.
+ */
+class MountPointClassifier {
+
+private:
+    /**
+     * Node struct: node of the compiled trie. Edges to its children are stored in
+     * m_edges[m_first_edge, m_first_edge + m_num_edges).
+     */
+    struct Node {
+        uint32_t m_first_edge { 0 };
+        uint32_t m_num_edges { 0 };
+        bool m_terminal { false };
+        MountPoint m_mount_point { MountPoint::kNone };
+    };
+
+    /**
+     * Edge struct: path component (stored in m_components) that leads to a child node.
+     */
+    struct Edge {
+        uint32_t m_offset { 0 };
+        uint32_t m_length { 0 };
+        uint32_t m_node { 0 };
+    };
+
+    static constexpr std::size_t kMaxDepth { 64 };
+
+    std::vector<std::pair<std::string, MountPoint>> m_mount_points {};
+    std::vector<Node> m_nodes { Node {} };
+    std::vector<Edge> m_edges {};
+    std::string m_components {};
+    std::vector<uint8_t> m_nested_mount_points {};
+
+    /**
+     * compile: rebuild the flat trie from all registered mount points.
+     */
+    void compile ();
+
+    /**
+     * find_child: find the child of a node that is reached through a given path component.
+     * @param node Index of the parent node.
+     * @param component Path component.
+     * @return Returns the index of the child node, or -1 if there is no such child.
+     */
+    [[nodiscard]] uint32_t
+    find_child (const uint32_t& node, const std::string_view& component) const;
+
+public:
+    /**
+     * MountPointClassifier default constructor.
+     */
+    MountPointClassifier ();
+
+    /**
+     * MountPointClassifier default destructor.
+     */
+    ~MountPointClassifier ();
+
+    /**
+     * next_component: get the next component of a path.
+     * @param path Path to be considered.
+     * @param position Position to start from; updated to the end of the returned component.
+     * @param component Object to store the component.
+     * @return Returns false if there are no more components.
+     */
+    static bool next_component (const std::string_view& path,
+        std::size_t& position,
+        std::string_view& component);
+
+    /**
+     * normalize: normalize a mount point prefix (absolute path, without empty, ".", and ".."
+     * components, nor trailing slashes).
+     * @param prefix Mount point prefix.
+     * @return Returns the normalized prefix, or an empty string if the prefix is not a valid
+     * absolute path.
+     */
+    [[nodiscard]] static std::string normalize (const std::string_view& prefix);
+
+    /**
+     * register_mount_point: register (or replace) the mount point of a given path prefix.
+     * @param prefix Path prefix of the mount point (absolute path).
+     * @param mount_point Identifier of the mount point.
+     * @return Returns true if the mount point was registered; false if the prefix is invalid.
+     */
+    bool register_mount_point (const std::string_view& prefix, const MountPoint& mount_point);
+
+    /**
+     * classify: get the mount point with the longest prefix that matches a given path.
+     * @param path Absolute path to be classified.
+     * @return Returns a pair with a boolean that defines if a mount point was found, and the
+     * respective mount point (MountPoint::kNone if not found).
+     */
+    [[nodiscard]] std::pair<bool, MountPoint> classify (const std::string_view& path) const;
+
+    /**
+     * has_nested_mount_points: check if other mount points are registered below the prefix of a
+     * given mount point. If not, every path below that prefix (without ".." components) is
+     * classified as that mount point.
+     * @param mount_point Identifier of the mount point.
+     * @return Returns true if there are nested mount points, or if mount_point is not registered.
+     */
+    [[nodiscard]] bool has_nested_mount_points (const MountPoint& mount_point) const;
+
+    /**
+     * get_mount_points: get all registered <prefix, mount point> pairs, in registration order.
+     */
+    [[nodiscard]] const std::vector<std::pair<std::string, MountPoint>>& get_mount_points () const;
+
+    /**
+     * get_prefix: get the prefix of a registered mount point.
+     * @param mount_point Identifier of the mount point.
+     * @return Returns the prefix, or an empty string if the mount point is not registered.
+     */
+    [[nodiscard]] std::string get_prefix (const MountPoint& mount_point) const;
+};
+} // namespace padll::stage
+
+#endif // PADLL_MOUNT_POINT_CLASSIFIER_HPP
@@ -6,6 +6,8 @@
 #ifndef PADLL_NAMESPACE_ENTRY_H
 #define PADLL_NAMESPACE_ENTRY_H
 
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 #include <padll/options/options.hpp>
 #include <sstream>
@@ -25,6 +27,9 @@ private:
     std::string m_path {};
     MountPoint m_mount_point {};
     uint32_t m_metadata_server_unit { static_cast<uint32_t> (-1) };
+    uint64_t m_path_hash { 0 };
+    std::atomic<uintptr_t> m_stream_position { 0 };
+    std::atomic<bool> m_stream_refilled { true };
     std::mutex m_lock;
 
 public:
@@ -73,6 +78,31 @@ public:
      */
     [[nodiscard]] const uint32_t& get_metadata_server_unit () const;
 
+    /**
+     * get_path_hash: get the hash of the pathname (computed once, at construction), used for
+     * path-based workflow selection.
+     * @return Returns a const value of m_path_hash.
+     */
+    [[nodiscard]] const uint64_t& get_path_hash () const;
+
+    /**
+     * begin_stream_batch: check if the buffer of the directory stream of the MountPointEntry
+     * object was refilled (through getdents64) since the previous check (only used by entries of
+     * directory streams). The first check of a stream is always true, since its first read fills
+     * the buffer.
+     * @return Returns true if a new batch of entries was read from the kernel.
+     */
+    bool begin_stream_batch ();
+
+    /**
+     * end_stream_call: account an entry returned by a directory stream call. Entries are returned
+     * from the stream's buffer at increasing addresses, so an entry at (or below) the address of
+     * the previous one marks a refill of the buffer (or a rewind), to be reported by the next
+     * begin_stream_batch.
+     * @param entry Entry returned by the call (nullptr at the end of the stream).
+     */
+    void end_stream_call (const void* entry);
+
     /**
      * to_string: create a string with the MountPointEntry object data.
      * @return Returns the information of the MountPointEntry in string-based format.
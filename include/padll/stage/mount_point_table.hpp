@@ -6,11 +6,17 @@
 #ifndef PADLL_MOUNT_POINT_TABLE_HPP
 #define PADLL_MOUNT_POINT_TABLE_HPP
 
+#include <dirent.h>
+#include <fcntl.h>
 #include <iostream>
 #include <map>
+#include <padll/configurations/padll_configuration.hpp>
 #include <padll/options/options.hpp>
+#include <padll/stage/file_descriptor_table.hpp>
+#include <padll/stage/mount_point_classifier.hpp>
 #include <padll/stage/mount_point_entry.hpp>
-#include <padll/third_party/xoshiro.hpp>
+#include <padll/stage/path_resolver.hpp>
+#include <padll/stage/workflow_selector.hpp>
 #include <padll/utils/log.hpp>
 #include <shared_mutex>
 #include <sstream>
@@ -18,7 +24,6 @@
 #include <vector>
 
 using namespace padll::utils::log;
-using namespace XoshiroCpp;
 
 namespace padll::stage {
 
@@ -55,20 +60,38 @@ public:
  * This class registers all mountpoints to be considered for intercepted requests. Further, it
  * manages all file descriptor and file pointer based operations, by registering in the
  * m_file_descriptors_table and m_file_ptr_table upon path-based requests (e.g., open, fopen, ...).
+ * Directory streams (opendir, fdopendir) are registered in m_dir_ptr_table.
+ * File descriptor lookups are served by a FileDescriptorTable and do not take any lock.
+ * Workflows are selected by a WorkflowSelector, which keeps all selection state per thread.
+ * Paths are classified by a MountPointClassifier (longest registered prefix). Besides the
+ * MountPoint enum values, any number of mount points can be registered (register_mount_point),
+ * each with its own set of workflows.
+ * Relative paths are classified against the current working directory (AT_FDCWD) or a directory
+ * file descriptor (*at calls), whose classification is cached by the PathResolver and the
+ * FileDescriptorTable, respectively.
  */
 class MountPointTable {
 
 private:
-    std::shared_timed_mutex m_fd_shared_lock;
     std::shared_timed_mutex m_fptr_shared_lock;
     int m_num_workflows { padll::options::option_padll_workflows () };
     MountPointWorkflows m_default_workflows { this->m_num_workflows };
-    std::unordered_map<int, std::unique_ptr<MountPointEntry>> m_file_descriptors_table {};
-    std::unordered_map<FILE*, std::unique_ptr<MountPointEntry>> m_file_ptr_table {};
-    std::map<MountPoint, std::vector<uint32_t>> m_mount_point_workflows {};
+    FileDescriptorTable m_file_descriptors_table {};
+    std::unordered_map<FILE*, std::shared_ptr<MountPointEntry>> m_file_ptr_table {};
+    std::shared_timed_mutex m_dptr_shared_lock;
+    std::unordered_map<DIR*, std::shared_ptr<MountPointEntry>> m_dir_ptr_table {};
+    WorkflowSelector m_workflow_selector {};
+    MountPointClassifier m_mount_point_classifier {};
+    PathResolver m_path_resolver { this->m_mount_point_classifier };
+    int m_next_mount_point { static_cast<int> (MountPoint::kRemote) + 1 };
+    const bool m_mount_point_differentiation {
+        padll::configurations::padll_configuration ().is_mount_point_differentiation_enabled ()
+    };
+    const std::string m_remote_mount_point {
+        padll::configurations::padll_configuration ().get_remote_mount_point ()
+    };
 
     std::shared_ptr<Log> m_log { std::make_shared<Log> () };
-    Xoshiro128StarStar m_prng { static_cast<uint64_t> (::getpid ()) };
 
     /**
      * initialize: initialize and register workflows for considered mountpoint types.
@@ -77,26 +100,45 @@ private:
 
     /**
      * register_mount_point_type: assign a given set of workflows for a given mountpoint type.
-     * @param type MountPoint type to be considered; can be of types ::none, ::local, or ::remote.
+     * @param type MountPoint type to be considered; can be of types ::none, ::local, ::remote, or
+     * an identifier returned by register_mount_point.
      * @param workflows Container that holds all workflows to be registered for that given
      * MountPoint type.
      */
     void register_mount_point_type (const MountPoint& type, const std::vector<uint32_t>& workflows);
 
     /**
-     * extract_mount_point_from_path: identify the targeted mountpoint of a given path.
+     * extract_mount_point_from_path: identify the targeted mountpoint of a given path. Relative
+     * paths inherit the classification of their base directory (dirfd, or the working directory
+     * if dirfd is AT_FDCWD) when no other mount point may be reached from it, and are resolved
+     * and classified otherwise.
+     * @param dirfd Base directory of relative paths.
      * @param path Path to be considered.
      * @return Returns the respective MountPoint associated with path.
      */
-    [[nodiscard]] MountPoint extract_mount_point_from_path (const std::string_view& path) const;
+    [[nodiscard]] MountPoint extract_mount_point_from_path (const int& dirfd,
+        const std::string_view& path) const;
+
+    /**
+     * resolve_base_path: build the path of a relative path under a directory file descriptor (or
+     * the working directory, if dirfd is AT_FDCWD).
+     * @param dirfd Base directory of relative paths.
+     * @param path Path to be resolved; absolute paths are returned unchanged.
+     * @return Returns the resolved path, or an empty string if the base directory is unknown.
+     */
+    [[nodiscard]] std::string resolve_base_path (const int& dirfd,
+        const std::string_view& path) const;
 
     /**
      * select_workflow_from_mountpoint: select a workflow from the MountPoint set. For load
-     * balancing, workflows are assigned in random fashion with a Xoshiro128StarStar hashing scheme.
+     * balancing, workflows are assigned following the strategy of m_workflow_selector (random,
+     * round-robin, thread-affinity, or path-hash).
      * @param mount_point MountPoint to select the workflow.
+     * @param path_hash Hash of the targeted path (only considered by path-hash selection).
      * @return Returns the identifier of the selected workflow.
      */
-    [[nodiscard]] uint32_t select_workflow_from_mountpoint (const MountPoint& mount_point);
+    [[nodiscard]] uint32_t select_workflow_from_mountpoint (const MountPoint& mount_point,
+        const uint64_t& path_hash) const;
 
     /**
      * select_workflow_from_metadata_unit: work-in-progress.
@@ -111,10 +153,9 @@ private:
     [[nodiscard]] uint32_t select_workflow_from_metadata_unit (const std::string_view& path) const;
 
     /**
-     * is_file_descriptor_valid: validates if a given file descriptor is valid. Currently, we
-     * consider that a given file descriptor is valid if greater than 2 (>2); since negative fds are
-     * errors, 0 to stdin, 1 to stdout, and 2 to stderr.
-     * TODO: as future work, intercept dup/dup2 system calls to prevent false invalidations.
+     * is_file_descriptor_valid: validates if a given file descriptor is valid. A file descriptor
+     * is valid if non-negative, since negative fds are errors. Standard streams (0, 1, and 2) are
+     * valid as well, since they are registered when redirected (dup2, dup3) to a file.
      * @param fd File descriptor to be verified.
      * @return Returns a boolean stating if the FD is valid or not.
      */
@@ -128,6 +169,14 @@ private:
      */
     [[nodiscard]] bool is_file_pointer_valid (const FILE* fptr) const;
 
+    /**
+     * is_directory_pointer_valid: validates if a given directory stream is valid, i.e., if it is
+     * not a nullptr.
+     * @param dptr Directory stream to be verified.
+     * @return Returns a boolean stating if the DIR* is valid or not.
+     */
+    [[nodiscard]] bool is_directory_pointer_valid (const DIR* dptr) const;
+
 public:
     /**
      * MountPointTable default constructor.
@@ -173,21 +222,76 @@ public:
         const MountPoint& mount_point,
         const uint32_t& metadata_server_unit);
 
+    /**
+     * create_mount_point_entry: create a entry at the m_dir_ptr_table container.
+     * @param dir_ptr Directory stream to be inserted.
+     * @param path Path of the directory that the stream respects to.
+     * @param mount_point Targeted mountpoint.
+     * @param metadata_server_unit work-in-progress.
+     * @return Returns a boolean that defines if the entry was successfully created (true) or not
+     * (false).
+     */
+    bool create_mount_point_entry (DIR* dir_ptr,
+        const std::string& path,
+        const MountPoint& mount_point,
+        const uint32_t& metadata_server_unit);
+
+    /**
+     * register_mount_point: register an additional mount point, given its path prefix, with its
+     * own set of workflows. If the prefix is already registered, its workflows are replaced.
+     * Must be called before any request is handled.
+     * @param prefix Path prefix of the mount point.
+     * @param workflows Workflows to be assigned to the mount point.
+     * @return Returns a pair with a boolean that defines if the mount point was registered, and its
+     * identifier.
+     */
+    std::pair<bool, MountPoint> register_mount_point (const std::string& prefix,
+        const std::vector<uint32_t>& workflows);
+
     /**
      * extract_mount_point: extract mountpoint from a given path. This method uses
      * extract_mount_point_from_path.
      * @param path Path to be considered.
+     * @param dirfd Base directory of relative paths (defaults to the working directory).
      * @return Returns the respective MountPoint associated with path.
      */
-    [[nodiscard]] MountPoint extract_mount_point (const std::string_view& path) const;
+    [[nodiscard]] MountPoint extract_mount_point (const std::string_view& path,
+        const int& dirfd = AT_FDCWD) const;
 
     /**
      * pick_workflow_id: select a workflow id to enforce a request destined towards a given path.
+     * Relative paths are considered from the current working directory.
      * @param path Path to considered.
      * @return Returns a pair of a MountPoint and the selected workflow identifier.
      */
     [[nodiscard]] std::pair<MountPoint, uint32_t> pick_workflow_id (const std::string_view& path);
 
+    /**
+     * pick_workflow_id: select a workflow id to enforce a request destined towards a given path,
+     * relative to a directory file descriptor (as in openat, mkdirat, ...).
+     * @param dirfd Base directory of relative paths (or AT_FDCWD).
+     * @param path Path to be considered.
+     * @return Returns a pair of a MountPoint and the selected workflow identifier.
+     */
+    [[nodiscard]] std::pair<MountPoint, uint32_t> pick_workflow_id (const int& dirfd,
+        const std::string_view& path);
+
+    /**
+     * resolve_path: build the path of a relative path under a directory file descriptor (or the
+     * working directory), to be registered in a MountPointEntry. Absolute paths are returned
+     * unchanged.
+     * @param dirfd Base directory of relative paths (or AT_FDCWD).
+     * @param path Path to be resolved.
+     * @return Returns the resolved path, or path itself if its base directory is unknown.
+     */
+    [[nodiscard]] std::string resolve_path (const int& dirfd, const std::string_view& path);
+
+    /**
+     * update_working_directory: refresh the cached working directory and its classification. To
+     * be called after a successful chdir or fchdir.
+     */
+    void update_working_directory ();
+
     /**
      * pick_workflow_id: select a workflow id to a enforce a request destined towards a given file
      * descriptor.
@@ -204,6 +308,21 @@ public:
      */
     [[nodiscard]] uint32_t pick_workflow_id_by_force ();
 
+    /**
+     * pick_workflow_ids: select a workflow id of each mount point with registered workflows, to
+     * enforce a request that targets all mount points of the process (e.g., sync).
+     * @return Returns the selected workflow identifiers (one per mount point).
+     */
+    [[nodiscard]] std::vector<uint32_t> pick_workflow_ids () const;
+
+    /**
+     * is_file_descriptor_registered: check if a file descriptor has a mount point entry. This
+     * method is lock-free, and (unlike get_mount_point_entry) does not log missing entries.
+     * @param fd File descriptor to be verified.
+     * @return Returns true if the file descriptor is registered.
+     */
+    [[nodiscard]] bool is_file_descriptor_registered (const int& fd) const;
+
     /**
      * pick_workflow_id: select a workflow id to a enforce a request destined towards a given file
      * pointer.
@@ -212,21 +331,40 @@ public:
      */
     [[nodiscard]] uint32_t pick_workflow_id (FILE* file_ptr);
 
+    /**
+     * pick_workflow_id: select a workflow id to a enforce a request destined towards a given
+     * directory stream.
+     * @param dir_ptr Directory stream to be considered.
+     * @return Returns a workflow identifier.
+     */
+    [[nodiscard]] uint32_t pick_workflow_id (DIR* dir_ptr);
+
     /**
      * get_mount_point_entry: get the mountpoint entry of the m_file_descriptor_table.
      * @param key The key corresponds to the registered file descriptor.
      * @return Returns a pair with the a boolean, which defines if the operation was successful, and
-     * a pointer to the mountpoint entry.
+     * a shared pointer to the mountpoint entry (kept alive while in use).
      */
-    [[nodiscard]] std::pair<bool, MountPointEntry*> get_mount_point_entry (const int& key);
+    [[nodiscard]] std::pair<bool, std::shared_ptr<MountPointEntry>> get_mount_point_entry (
+        const int& key);
 
     /**
      * get_mount_point_entry: get the mountpoint entry of the m_file_pointer_table.
      * @param key The key corresponds to the registered file pointer.
      * @return Returns a pair with the a boolean, which defines if the operation was successful, and
-     * a pointer to the mountpoint entry.
+     * a shared pointer to the mountpoint entry (kept alive while in use).
+     */
+    [[nodiscard]] std::pair<bool, std::shared_ptr<MountPointEntry>> get_mount_point_entry (
+        FILE* key);
+
+    /**
+     * get_mount_point_entry: get the mountpoint entry of the m_dir_ptr_table.
+     * @param key The key corresponds to the registered directory stream.
+     * @return Returns a pair with the a boolean, which defines if the operation was successful, and
+     * a shared pointer to the mountpoint entry (kept alive while in use).
      */
-    [[nodiscard]] std::pair<bool, MountPointEntry*> get_mount_point_entry (FILE* key);
+    [[nodiscard]] std::pair<bool, std::shared_ptr<MountPointEntry>> get_mount_point_entry (
+        DIR* key);
 
     /**
      * remove_mount_point_entry: remove entry from the m_file_descriptor_table.
@@ -243,8 +381,15 @@ public:
     bool remove_mount_point_entry (FILE* key);
 
     /**
-     * replace_file_descriptor: replace one file descriptor for a new one. This is used to handle
-     * ::fcntl functions for the F_DUPFD and F_DUPFD_CLOEXEC flags.
+     * remove_mount_point_entry: remove entry from the m_dir_ptr_table.
+     * @param key The key corresponds to the registered directory stream.
+     * @return Returns a boolean that defines if the entry was removed (true) or not (false).
+     */
+    bool remove_mount_point_entry (DIR* key);
+
+    /**
+     * replace_file_descriptor: replace one file descriptor for a new one (the entry is moved, and
+     * old_fd is unregistered).
      * @param old_fd Old file descriptor, with an entry in the m_file_descriptor_table.
      * @param new_fd New file descriptor to be replaced.
      * @return Returns a boolean that defines if the entry was replaced (true) or not (false).
@@ -252,8 +397,20 @@ public:
     [[nodiscard]] bool replace_file_descriptor (const int& old_fd, const int& new_fd);
 
     /**
-     * to_string: returns in string-based format all registered workflows in
-     * m_mount_point_workflows.
+     * duplicate_file_descriptor: register new_fd as a duplicate of old_fd, sharing its entry.
+     * This is used to handle ::dup, ::dup2, ::dup3, and ::fcntl with the F_DUPFD and
+     * F_DUPFD_CLOEXEC flags. Any entry of new_fd is replaced (or removed, if old_fd is not
+     * registered).
+     * @param old_fd File descriptor being duplicated.
+     * @param new_fd Duplicate file descriptor.
+     * @return Returns a boolean that defines if new_fd shares the entry of old_fd (true) or not
+     * (false).
+     */
+    bool duplicate_file_descriptor (const int& old_fd, const int& new_fd);
+
+    /**
+     * to_string: returns in string-based format all workflows registered in
+     * m_workflow_selector.
      */
     [[nodiscard]] std::string to_string () const;
 
@@ -268,6 +425,11 @@ public:
      */
     [[nodiscard]] std::string fp_table_to_string ();
 
+    /**
+     * dp_table_to_string: returns in string-based format all entries of the m_dir_ptr_table.
+     */
+    [[nodiscard]] std::string dp_table_to_string ();
+
     /**
      * get_default_workflows: get all workflows registered in m_default_workflows.
      * @return Returns a const reference to the m_default_workflows container.
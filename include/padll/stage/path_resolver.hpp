@@ -0,0 +1,112 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_PATH_RESOLVER_HPP
+#define PADLL_PATH_RESOLVER_HPP
+
+#include <atomic>
+#include <padll/options/options.hpp>
+#include <padll/stage/mount_point_classifier.hpp>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace padll::options;
+
+namespace padll::stage {
+
+/**
+ * PathResolver class.
+ * Per-process cache of the current working directory and of its mount point classification, used
+ * to classify relative paths. The working directory is resolved (getcwd) at initialization and
+ * after every successful chdir/fchdir, so classifying a relative path does not require resolving
+ * it: if the path does not escape its base directory (no ".." components) and no mount point is
+ * nested below the base directory's mount point, the path inherits the base's classification.
+ * The classification is published in an atomic word (lock-free reads); the directory path is only
+ * read, under a shared lock, when a relative path must be joined with it.
+ */
+class PathResolver {
+
+private:
+    static constexpr int kUnknown { -1 };
+
+    const MountPointClassifier& m_classifier;
+    mutable std::shared_timed_mutex m_working_directory_lock;
+    std::string m_working_directory {};
+    std::atomic<int> m_working_directory_mount_point { kUnknown };
+
+public:
+    /**
+     * PathResolver parameterized constructor.
+     * @param classifier Classifier used to classify the working directory.
+     */
+    explicit PathResolver (const MountPointClassifier& classifier);
+
+    /**
+     * PathResolver default destructor.
+     */
+    ~PathResolver ();
+
+    PathResolver (const PathResolver&) = delete;
+    PathResolver& operator= (const PathResolver&) = delete;
+
+    /**
+     * is_absolute: check if a path is absolute.
+     * @param path Path to be verified.
+     * @return Returns true if path starts with '/'.
+     */
+    [[nodiscard]] static bool is_absolute (const std::string_view& path);
+
+    /**
+     * has_parent_reference: check if a path has ".." components (and thus may escape its base
+     * directory).
+     * @param path Path to be verified.
+     * @return Returns true if path has at least one ".." component.
+     */
+    [[nodiscard]] static bool has_parent_reference (const std::string_view& path);
+
+    /**
+     * join: build the path of a relative path under a given base directory. The result is not
+     * normalized ("." and ".." components are kept).
+     * @param base Absolute path of the base directory.
+     * @param path Relative path.
+     * @return Returns the joined path.
+     */
+    [[nodiscard]] static std::string join (const std::string_view& base,
+        const std::string_view& path);
+
+    /**
+     * update_working_directory: resolve the current working directory of the process and its
+     * classification. To be called after the working directory changes (chdir, fchdir), and
+     * after mount points are registered. errno is preserved.
+     * @return Returns true if the working directory was resolved.
+     */
+    bool update_working_directory ();
+
+    /**
+     * get_working_directory_mount_point: get the classification of the current working directory.
+     * This method is lock-free.
+     * @return Returns a pair with a boolean that defines if the working directory belongs to a
+     * registered mount point, and the respective mount point.
+     */
+    [[nodiscard]] std::pair<bool, MountPoint> get_working_directory_mount_point () const;
+
+    /**
+     * get_working_directory: get the cached path of the current working directory.
+     * @return Returns a copy of the path, or an empty string if it could not be resolved.
+     */
+    [[nodiscard]] std::string get_working_directory () const;
+
+    /**
+     * resolve: build the path of a relative path under the current working directory.
+     * @param path Path to be resolved; absolute paths are returned unchanged.
+     * @return Returns the resolved path, or an empty string if the working directory is unknown.
+     */
+    [[nodiscard]] std::string resolve (const std::string_view& path) const;
+};
+} // namespace padll::stage
+
+#endif // PADLL_PATH_RESOLVER_HPP
@@ -0,0 +1,158 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_WORKFLOW_SELECTOR_HPP
+#define PADLL_WORKFLOW_SELECTOR_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <padll/options/options.hpp>
+#include <padll/third_party/xoshiro.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace padll::options;
+
+namespace padll::stage {
+
+/**
+ * WorkflowSelector class.
+ * Selects the workflow (i.e., the PAIO channel) of each intercepted request, from the set of
+ * workflows registered for the targeted mount point. Workflows of all mount points are kept in a
+ * single flat array, indexed by the MountPoint value, so that a selection is a bounds check and a
+ * single array access.
+ * All mutable selection state (PRNG, round-robin cursor, and thread index) is kept per thread, so
+ * concurrent selections neither race nor share cache lines. Workflows are expected to be
+ * registered at initialization, before any selection takes place.
+ */
+class WorkflowSelector {
+
+private:
+    /**
+     * WorkflowRange struct: range of the m_workflows array that holds the workflows of a mount
+     * point.
+     */
+    struct WorkflowRange {
+        uint32_t m_offset { 0 };
+        uint32_t m_size { 0 };
+    };
+
+    /**
+     * ThreadState struct: per-thread selection state. It is trivially destructible, so that it can
+     * be safely used from interposed calls issued during thread (or process) teardown.
+     */
+    struct alignas(64) ThreadState {
+        XoshiroCpp::Xoshiro128StarStar m_prng {};
+        uint32_t m_round_robin { 0 };
+        uint32_t m_thread_index { 0 };
+        bool m_initialized { false };
+    };
+
+    WorkflowSelection m_strategy { option_default_workflow_selection };
+    std::vector<uint32_t> m_workflows {};
+    std::vector<WorkflowRange> m_ranges {};
+
+    /**
+     * get_thread_state: get the selection state of the calling thread, initializing it on first
+     * use (the PRNG is seeded with the process id and an unique thread index).
+     * @return Returns a reference to the thread's state.
+     */
+    [[nodiscard]] static ThreadState& get_thread_state ();
+
+public:
+    /**
+     * WorkflowSelector default constructor.
+     */
+    WorkflowSelector ();
+
+    /**
+     * WorkflowSelector parameterized constructor.
+     * @param strategy Workflow selection strategy.
+     */
+    explicit WorkflowSelector (const WorkflowSelection& strategy);
+
+    /**
+     * WorkflowSelector default destructor.
+     */
+    ~WorkflowSelector ();
+
+    /**
+     * register_workflows: assign a set of workflows to a mount point, replacing any previously
+     * registered set. This method is not thread-safe with regard to select.
+     * @param mount_point MountPoint to be considered.
+     * @param workflows Workflows to be assigned to the mount point.
+     */
+    void register_workflows (const MountPoint& mount_point, const std::vector<uint32_t>& workflows);
+
+    /**
+     * get_workflows: get the workflows registered for a given mount point.
+     * @param mount_point MountPoint to be considered.
+     * @return Returns a copy of the mount point's workflows (empty if not registered).
+     */
+    [[nodiscard]] std::vector<uint32_t> get_workflows (const MountPoint& mount_point) const;
+
+    /**
+     * select: select a workflow of a given mount point, following the configured strategy.
+     * @param mount_point MountPoint to select the workflow from.
+     * @param path_hash Hash of the targeted path (only used by WorkflowSelection::kPathHash).
+     * @return Returns the identifier of the selected workflow, or -1 if the mount point has no
+     * registered workflows.
+     */
+    [[nodiscard]] uint32_t select (const MountPoint& mount_point, const uint64_t& path_hash) const
+    {
+        auto index = static_cast<std::size_t> (mount_point);
+        if (index >= this->m_ranges.size () || this->m_ranges[index].m_size == 0) {
+            return static_cast<uint32_t> (-1);
+        }
+
+        const auto& range = this->m_ranges[index];
+        uint64_t item;
+
+        switch (this->m_strategy) {
+            case WorkflowSelection::kRoundRobin:
+                item = WorkflowSelector::get_thread_state ().m_round_robin++;
+                break;
+
+            case WorkflowSelection::kThreadAffinity:
+                item = WorkflowSelector::get_thread_state ().m_thread_index;
+                break;
+
+            case WorkflowSelection::kPathHash:
+                item = path_hash;
+                break;
+
+            case WorkflowSelection::kRandom:
+            default:
+                item = WorkflowSelector::get_thread_state ().m_prng ();
+                break;
+        }
+
+        return this->m_workflows[range.m_offset + (item % range.m_size)];
+    }
+
+    /**
+     * get_strategy: get the configured workflow selection strategy.
+     */
+    [[nodiscard]] WorkflowSelection get_strategy () const;
+
+    /**
+     * hash_path: compute the (FNV-1a) hash of a given path.
+     * @param path Path to be hashed.
+     * @return Returns the hash value.
+     */
+    [[nodiscard]] static uint64_t hash_path (const std::string_view& path);
+
+    /**
+     * get_strategy_from_env: read the workflow selection strategy from
+     * option_workflow_selection_env (or, if not set, from the runtime configuration).
+     * @return Returns the configured strategy, or option_default_workflow_selection if not set (or
+     * invalid).
+     */
+    [[nodiscard]] static WorkflowSelection get_strategy_from_env ();
+};
+} // namespace padll::stage
+
+#endif // PADLL_WORKFLOW_SELECTOR_HPP
@@ -0,0 +1,144 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_LATENCY_HISTOGRAM_HPP
+#define PADLL_LATENCY_HISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace padll::stats {
+
+/**
+ * LatencyPhase enum: phases in which the latency of an intercepted call is decomposed.
+ *  - interception: PADLL bookkeeping before enforcement (hooking, workflow selection, ...);
+ *  - enforcement: time spent in the PAIO data plane stage (i.e., rate limiting wait);
+ *  - syscall: time spent in the original libc call.
+ */
+enum class LatencyPhase : int { interception = 0, enforcement = 1, syscall = 2 };
+
+constexpr int kLatencyPhases { 3 };
+
+/**
+ * latency_phase_to_string: get the name of a given latency phase.
+ * @param phase Latency phase.
+ * @return Returns the name of the phase.
+ */
+inline std::string latency_phase_to_string (const LatencyPhase& phase)
+{
+    switch (phase) {
+        case LatencyPhase::interception:
+            return "interception";
+        case LatencyPhase::enforcement:
+            return "enforcement";
+        case LatencyPhase::syscall:
+            return "syscall";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * LatencyHistogram class.
+ * Log-linear (HDR-style) histogram of latencies, in nanoseconds. Each power-of-two range is split
+ * in kSubBuckets linear sub-buckets, which bounds the relative error of each recorded value to
+ * 1/kSubBuckets. Values above 2^kMaxExponent ns are accounted in the last bucket.
+ * A histogram is meant to have a single writer (record), while readers may concurrently merge it
+ * into another histogram; all fields are thus relaxed atomics.
+ */
+class LatencyHistogram {
+
+private:
+    static constexpr int kSubBucketBits { 3 };
+    static constexpr uint64_t kSubBuckets { 1ULL << kSubBucketBits };
+    static constexpr int kMaxExponent { 36 };
+    static constexpr std::size_t kBuckets { (kMaxExponent - kSubBucketBits + 2) * kSubBuckets };
+
+    std::array<std::atomic<uint64_t>, kBuckets> m_buckets {};
+    std::atomic<uint64_t> m_count { 0 };
+    std::atomic<uint64_t> m_sum { 0 };
+    std::atomic<uint64_t> m_max { 0 };
+
+    /**
+     * bucket_index: compute the bucket of a given value.
+     * @param value Value (in nanoseconds).
+     * @return Returns the index of the bucket.
+     */
+    [[nodiscard]] static std::size_t bucket_index (const uint64_t& value);
+
+    /**
+     * bucket_upper_bound: compute the highest value accounted in a given bucket.
+     * @param index Index of the bucket.
+     * @return Returns the upper bound of the bucket (in nanoseconds).
+     */
+    [[nodiscard]] static uint64_t bucket_upper_bound (const std::size_t& index);
+
+    /**
+     * add: add value to a counter. Only the owner of the histogram writes to it, so a relaxed load
+     * and store suffices.
+     */
+    static void add (std::atomic<uint64_t>& counter, const uint64_t& value);
+
+public:
+    /**
+     * LatencyHistogram default constructor.
+     */
+    LatencyHistogram ();
+
+    /**
+     * LatencyHistogram default destructor.
+     */
+    ~LatencyHistogram ();
+
+    LatencyHistogram (const LatencyHistogram&) = delete;
+    LatencyHistogram& operator= (const LatencyHistogram&) = delete;
+
+    /**
+     * record: account a latency value. Must only be called by the owner thread of the histogram.
+     * @param value Latency (in nanoseconds).
+     */
+    void record (const uint64_t& value);
+
+    /**
+     * merge: add all values of other histogram to this histogram. The caller must be the only
+     * writer of this histogram.
+     * @param other Histogram to be merged.
+     */
+    void merge (const LatencyHistogram& other);
+
+    /**
+     * get_count: get the number of recorded values.
+     */
+    [[nodiscard]] uint64_t get_count () const;
+
+    /**
+     * get_mean: get the mean of all recorded values (in nanoseconds).
+     */
+    [[nodiscard]] double get_mean () const;
+
+    /**
+     * get_max: get the maximum recorded value (in nanoseconds).
+     */
+    [[nodiscard]] uint64_t get_max () const;
+
+    /**
+     * get_percentile: get the (upper bound of the) value at a given percentile.
+     * @param percentile Percentile, in [0, 100].
+     * @return Returns the value (in nanoseconds).
+     */
+    [[nodiscard]] uint64_t get_percentile (const double& percentile) const;
+
+    /**
+     * to_string: generate a single-line summary of the histogram (count, mean, p50, p99, p99.9,
+     * and max, in microseconds).
+     * @param name Label of the histogram.
+     */
+    [[nodiscard]] std::string to_string (const std::string& name) const;
+};
+} // namespace padll::stats
+
+#endif // PADLL_LATENCY_HISTOGRAM_HPP
@@ -40,6 +40,21 @@ public:
      */
     explicit StatisticEntry (const std::string& name);
 
+    /**
+     * StatisticEntry parameterized constructor. Creates a snapshot of the counters of a given
+     * operation (e.g., the aggregation of all per-thread shards of a Statistics object).
+     * @param name Name of the operation.
+     * @param operations Number of operations.
+     * @param bytes Number of bytes.
+     * @param errors Number of errors.
+     * @param bypassed Number of bypassed operations.
+     */
+    StatisticEntry (const std::string& name,
+        const uint64_t& operations,
+        const uint64_t& bytes,
+        const uint64_t& errors,
+        const uint64_t& bypassed);
+
     /**
      * StatisticEntry copy constructor.
      * @param entry
@@ -6,9 +6,14 @@
 #ifndef PADLL_STATISTICS_H
 #define PADLL_STATISTICS_H
 
+#include <array>
+#include <atomic>
 #include <fcntl.h>
 #include <iostream>
+#include <memory>
 #include <padll/library_headers/libc_enums.hpp>
+#include <padll/options/options.hpp>
+#include <padll/statistics/latency_histogram.hpp>
 #include <padll/statistics/statistic_entry.hpp>
 #include <padll/third_party/tabulate.hpp>
 #include <sys/stat.h>
@@ -17,6 +22,7 @@
 #include <vector>
 
 using namespace padll::headers;
+using namespace padll::options;
 using namespace tabulate;
 
 namespace padll::stats {
@@ -24,21 +30,107 @@ namespace padll::stats {
 /**
  * Statistics class.
  * This class keeps track of all statistics entries of a given category.
+ * Counters are sharded per thread: each thread updates its own cache-line-aligned shard with plain
+ * (relaxed) loads and stores, and shards are only aggregated when statistics are read (e.g.,
+ * get_statistic_entry, to_string, and tabulate). Shards are kept until the Statistics object is
+ * destroyed, so counters of terminated threads are not lost.
+ * Shards may also hold per-operation LatencyHistograms (one per LatencyPhase), allocated by the
+ * owner thread on the first latency update of each operation.
  */
 class Statistics {
 
 private:
+    /**
+     * ShardCounter struct: counters of a single operation for a single thread.
+     * Each counter is only written by its owner thread (unless it belongs to m_shared_shard), but
+     * may be read concurrently during aggregation.
+     */
+    struct alignas (64) ShardCounter {
+        std::atomic<uint64_t> m_operation_counter { 0 };
+        std::atomic<uint64_t> m_byte_counter { 0 };
+        std::atomic<uint64_t> m_error_counter { 0 };
+        std::atomic<uint64_t> m_bypass_counter { 0 };
+    };
+
+    /**
+     * StatisticShard struct: counters of all operations of the Statistics object for one thread.
+     * m_latencies holds kLatencyPhases histograms per operation (nullptr until first used).
+     */
+    struct StatisticShard {
+        std::unique_ptr<ShardCounter[]> m_counters { nullptr };
+        std::unique_ptr<std::atomic<LatencyHistogram*>[]> m_latencies { nullptr };
+        std::size_t m_num_latencies { 0 };
+        bool m_exclusive { true };
+
+        ~StatisticShard ();
+    };
+
     std::string m_stats_identifier { "stats" };
     int m_stats_size { 0 };
-    std::vector<StatisticEntry> m_statistic_entries {};
+    std::size_t m_instance_id { 0 };
+    std::vector<std::string> m_entry_names {};
+    std::vector<std::unique_ptr<StatisticShard>> m_shards {};
+    std::unique_ptr<StatisticShard> m_shared_shard { nullptr };
     std::mutex m_stats_mutex;
 
     /**
-     * aggregate_counters:
-     * @param type
+     * get_instance_id: generate a unique identifier for a Statistics object, used to index the
+     * per-thread shard table.
+     * @return Returns the instance identifier.
+     */
+    [[nodiscard]] static std::size_t get_instance_id ();
+
+    /**
+     * get_thread_shard: get the shard of the calling thread, creating (and registering) it on the
+     * first call of each thread.
+     * @return Returns a pointer to the shard of the calling thread.
+     */
+    [[nodiscard]] StatisticShard* get_thread_shard ();
+
+    /**
+     * create_shard: allocate a shard with m_stats_size counters.
+     * @param exclusive Defines if the shard is updated by a single thread.
+     * @return Returns the new shard.
+     */
+    [[nodiscard]] std::unique_ptr<StatisticShard> create_shard (const bool& exclusive) const;
+
+    /**
+     * increment_counter: increment a shard counter. Exclusive shards are updated with a relaxed
+     * load and store (no read-modify-write), while the shared shard uses fetch_add.
+     * @param counter Counter to be incremented.
+     * @param value Value to be added.
+     * @param exclusive Defines if the counter is only updated by the calling thread.
+     */
+    static void increment_counter (std::atomic<uint64_t>& counter,
+        const uint64_t& value,
+        const bool& exclusive);
+
+    /**
+     * aggregate_entry: aggregate the counters of a given operation across all shards.
+     * Must be called while holding m_stats_mutex.
+     * @param position Position of the operation in the statistics container.
+     * @return Returns a StatisticEntry with the aggregated counters.
+     */
+    [[nodiscard]] StatisticEntry aggregate_entry (const int& position) const;
+
+    /**
+     * get_latency_histogram: get (or create) the latency histogram of a given operation and phase
+     * in a shard. Must only be called by the owner thread of the shard.
+     * @param shard Shard of the calling thread.
+     * @param position Position of the operation in the statistics container.
+     * @param phase Latency phase.
+     * @return Returns a pointer to the histogram.
+     */
+    [[nodiscard]] static LatencyHistogram*
+    get_latency_histogram (StatisticShard* shard, const int& position, const LatencyPhase& phase);
+
+    /**
+     * aggregate_counters: sum a given counter over a set of aggregated entries.
+     * @param entries Aggregated entries.
+     * @param type Counter to be summed (0: operations, 1: bytes, 2: errors, 3: bypassed).
      * @return long
      */
-    [[nodiscard]] long aggregate_counters (int type);
+    [[nodiscard]] static long aggregate_counters (std::vector<StatisticEntry>& entries, int type);
 
 public:
     /**
@@ -58,7 +150,7 @@ public:
     ~Statistics ();
 
     /**
-     * initialize: initializes the m_statistic_entries container with the respective operations
+     * initialize: initializes the m_entry_names container with the respective operations
      * to be collected.
      * This method is thread-safe.
      * @param operation_type Defines hte type of statistics to be collected.
@@ -70,16 +162,23 @@ public:
     void initialize (const OperationType& operation_type);
 
     /**
-     * get_statistic_entry: copy a given StatisticObject of the m_statistics_entries container.
+     * aggregate_entries: aggregate the counters of all operations across all thread shards.
+     * This method is thread-safe.
+     * @return Returns a StatisticEntry for each operation, in order.
+     */
+    [[nodiscard]] std::vector<StatisticEntry> aggregate_entries ();
+
+    /**
+     * get_statistic_entry: aggregate the counters of a given operation across all thread shards.
      * This method is thread-safe.
      * @param operation Defines the operation entry to be retrieved.
-     * @return Returns a copy of the respective StatisticEntry object.
+     * @return Returns a StatisticEntry object with the aggregated counters.
      */
     [[nodiscard]] StatisticEntry get_statistic_entry (const int& operation);
 
     /**
-     * update_statistic_entry: update both byte and operation counters of a specific StatisticEntry
-     * of the m_statistics_entries container.
+     * update_statistic_entry: update both byte and operation counters of a specific operation in
+     * the shard of the calling thread.
      * @param operation_type Defines the operation entry to be registered.
      * @param operation_value Defines the value to be incremented in the operation counter.
      * @param byte_value Defines the value to be incremented in the bytes counter.
@@ -90,7 +189,7 @@ public:
 
     /**
      * update_statistic_entry: update both byte, operation, and error counters of a specific
-     * StatisticEntry of the m_statistics_entries container.
+     * operation in the shard of the calling thread.
      * @param operation_type Defines the operation entry to be registered.
      * @param operation_value Defines the value to be incremented in the operation counter.
      * @param byte_value Defines the value to be incremented in the bytes counter.
@@ -102,14 +201,36 @@ public:
         const uint64_t& error_value);
 
     /**
-     * update_bypassed_statistic_entry: updatethe bypassed operation counter of a specific
-     * StatisticEntry of the m_statistics_entries container.
+     * update_bypassed_statistic_entry: update the bypassed operation counter of a specific
+     * operation in the shard of the calling thread.
      * @param operation_type Defines the operation entry to be registered.
      * @param bypassed_value Defines the value to be incremented in the operation counter.
      */
     void update_bypassed_statistic_entry (const int& operation_type,
         const uint64_t& bypassed_value);
 
+    /**
+     * update_latency_entry: record the latency of each phase of a given operation in the shard of
+     * the calling thread. Statistics objects that fall back to the shared shard do not record
+     * latencies.
+     * @param operation_type Defines the operation entry to be registered.
+     * @param interception_ns Time spent in PADLL's interception bookkeeping (in nanoseconds).
+     * @param enforcement_ns Time spent in the PAIO data plane stage (in nanoseconds).
+     * @param syscall_ns Time spent in the original libc call (in nanoseconds).
+     */
+    void update_latency_entry (const int& operation_type,
+        const uint64_t& interception_ns,
+        const uint64_t& enforcement_ns,
+        const uint64_t& syscall_ns);
+
+    /**
+     * latency_to_string: generate a string with the latency histograms (merged across all thread
+     * shards) of all operations with recorded latencies.
+     * @param print_header Defines if the column header is to be printed.
+     * @return Returns the latency report in string-based format.
+     */
+    [[maybe_unused]] std::string latency_to_string (const bool& print_header);
+
     /**
      * get_stats_identifier_call: get the identifier of the Statistics object.
      * @return Returns a copy of the m_stats_identifier parameter.
@@ -123,14 +244,13 @@ public:
     [[nodiscard]] int get_stats_size () const;
 
     /**
-     * to_string: generate a string with all statistic entries stored in the m_statistic_entries
-     * container.
+     * to_string: generate a string with the aggregated counters of all operations.
      * @return Returns the description of all StatisticEntry objects in string-based format.
      */
     [[maybe_unused]] std::string to_string (const bool& print_header);
 
     /**
-     * tabulate:
+     * tabulate: print to stdout the aggregated counters of all operations in tabular format.
      */
     void tabulate ();
 };
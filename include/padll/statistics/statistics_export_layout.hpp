@@ -0,0 +1,91 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_STATISTICS_EXPORT_LAYOUT_HPP
+#define PADLL_STATISTICS_EXPORT_LAYOUT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace padll::stats {
+
+/**
+ * Layout of the shared-memory region where the StatisticsExporter publishes live statistics.
+ * This header is self-contained so that external readers (e.g., padll_stats_reader) can map the
+ * region without linking against PADLL. Any change to the structures below must bump
+ * kExportVersion.
+ */
+constexpr uint32_t kExportMagic { 0x4C4C4450 }; // "PDLL"
+constexpr uint32_t kExportVersion { 1 };
+constexpr std::size_t kExportMaxEntries { 256 };
+constexpr std::size_t kExportRingSize { 32 };
+constexpr std::size_t kExportIdentifierSize { 16 };
+constexpr std::size_t kExportNameSize { 32 };
+
+/**
+ * ExportEntryName struct: identifies an exported counter (statistics container and operation).
+ */
+struct ExportEntryName {
+    char m_stats_identifier[kExportIdentifierSize];
+    char m_entry_name[kExportNameSize];
+};
+
+/**
+ * ExportCounters struct: counters of a single operation. Fields are atomics so that readers can
+ * load them concurrently with the exporter; consistency is given by the snapshot sequence number.
+ */
+struct ExportCounters {
+    std::atomic<uint64_t> m_operations;
+    std::atomic<uint64_t> m_bytes;
+    std::atomic<uint64_t> m_errors;
+    std::atomic<uint64_t> m_bypassed;
+};
+
+/**
+ * ExportSnapshot struct: a slot of the ring, holding cumulative counters (m_totals) and the
+ * difference to the previous snapshot (m_deltas). m_sequence works as a seqlock: it is odd while
+ * the slot is being written, and readers must retry if it is odd or changed during the read.
+ */
+struct alignas (64) ExportSnapshot {
+    std::atomic<uint64_t> m_sequence;
+    std::atomic<uint64_t> m_snapshot_id;
+    std::atomic<uint64_t> m_timestamp_ns;
+    std::atomic<uint64_t> m_interval_ns;
+    ExportCounters m_totals[kExportMaxEntries];
+    ExportCounters m_deltas[kExportMaxEntries];
+};
+
+/**
+ * ExportRegion struct: full shared-memory region. m_published holds the number of snapshots
+ * published so far; the latest snapshot is at m_ring[(m_published - 1) % kExportRingSize].
+ */
+struct ExportRegion {
+    uint32_t m_magic;
+    uint32_t m_version;
+    uint64_t m_region_size;
+    uint32_t m_pid;
+    uint32_t m_num_entries;
+    uint64_t m_interval_ms;
+    alignas (64) std::atomic<uint64_t> m_published;
+    ExportEntryName m_names[kExportMaxEntries];
+    ExportSnapshot m_ring[kExportRingSize];
+};
+
+/**
+ * export_region_path: path of the shared-memory region of a given process.
+ * @param prefix Path prefix (e.g., option_statistics_export_path).
+ * @param pid Process identifier.
+ * @return Returns the path of the region.
+ */
+inline std::string export_region_path (const std::string& prefix, const long& pid)
+{
+    return prefix + "-" + std::to_string (pid);
+}
+
+} // namespace padll::stats
+
+#endif // PADLL_STATISTICS_EXPORT_LAYOUT_HPP
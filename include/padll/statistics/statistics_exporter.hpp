@@ -0,0 +1,117 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_STATISTICS_EXPORTER_HPP
+#define PADLL_STATISTICS_EXPORTER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <padll/library_headers/libc_headers.hpp>
+#include <padll/options/options.hpp>
+#include <padll/statistics/statistics.hpp>
+#include <padll/statistics/statistics_export_layout.hpp>
+#include <padll/utils/log.hpp>
+#include <thread>
+#include <vector>
+
+using namespace padll::headers;
+using namespace padll::options;
+using namespace padll::utils::log;
+
+namespace padll::stats {
+
+/**
+ * StatisticsExporter class.
+ * Background exporter that periodically aggregates a set of Statistics objects and publishes them
+ * into a versioned shared-memory ring (ExportRegion). Each snapshot holds cumulative counters and
+ * the deltas to the previous snapshot, so that readers can compute per-call rates (ops/s, bytes/s)
+ * without issuing any syscall in the application.
+ * All file and memory-mapping calls are issued through the libc dispatch table (libc_dispatch), so
+ * that the exporter does not go through PADLL's own interposed calls.
+ */
+class StatisticsExporter {
+
+private:
+    std::shared_ptr<Log> m_log { nullptr };
+    std::vector<Statistics*> m_statistics {};
+    std::chrono::milliseconds m_interval { 0 };
+    std::string m_region_path {};
+    ExportRegion* m_region { nullptr };
+    pid_t m_owner_pid { -1 };
+    uint64_t m_previous_timestamp_ns { 0 };
+    std::vector<StatisticEntry> m_previous_entries {};
+
+    std::thread m_exporter_thread {};
+    std::mutex m_lock;
+    std::condition_variable m_cv;
+    bool m_running { false };
+
+    /**
+     * create_region: create, size, and map the shared-memory region, and write its header and
+     * names table.
+     * @return Returns true if the region was successfully created.
+     */
+    bool create_region ();
+
+    /**
+     * destroy_region: unmap and remove the shared-memory region.
+     */
+    void destroy_region ();
+
+    /**
+     * export_snapshot: aggregate all Statistics objects and publish a new snapshot in the ring.
+     */
+    void export_snapshot ();
+
+    /**
+     * run: exporter thread loop; publishes a snapshot every m_interval until stopped.
+     */
+    void run ();
+
+public:
+    /**
+     * StatisticsExporter parameterized constructor.
+     * @param log_ptr Shared pointer to a Logging object.
+     * @param statistics Statistics objects to be exported (must outlive the exporter).
+     * @param interval Export interval.
+     * @param region_path Path of the shared-memory region.
+     */
+    StatisticsExporter (std::shared_ptr<Log> log_ptr,
+        std::vector<Statistics*> statistics,
+        const std::chrono::milliseconds& interval,
+        const std::string& region_path);
+
+    /**
+     * StatisticsExporter default destructor. Stops the exporter (if running).
+     */
+    ~StatisticsExporter ();
+
+    StatisticsExporter (const StatisticsExporter&) = delete;
+    StatisticsExporter& operator= (const StatisticsExporter&) = delete;
+
+    /**
+     * start: create the shared-memory region and spawn the exporter thread.
+     * @return Returns true if the exporter was started.
+     */
+    bool start ();
+
+    /**
+     * stop: stop the exporter thread and remove the region. If called from a forked child, the
+     * parent's thread and region are left untouched.
+     */
+    void stop ();
+
+    /**
+     * get_interval_from_env: read the export interval from option_statistics_export_interval_env
+     * (or, if not set, from the runtime configuration).
+     * @return Returns the interval, or 0 if live export is disabled.
+     */
+    [[nodiscard]] static std::chrono::milliseconds get_interval_from_env ();
+};
+} // namespace padll::stats
+
+#endif // PADLL_STATISTICS_EXPORTER_HPP
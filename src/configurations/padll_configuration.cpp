@@ -0,0 +1,542 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <padll/configurations/libc_calls.hpp>
+#include <padll/configurations/padll_configuration.hpp>
+#include <padll/library_headers/libc_dispatch.hpp>
+#include <padll/library_headers/libc_headers.hpp>
+#include <sstream>
+#include <unistd.h>
+
+namespace padll::configurations {
+
+// trim call. Remove leading and trailing whitespaces of a string.
+static std::string trim (const std::string& value)
+{
+    auto begin = value.find_first_not_of (" \t\r");
+    if (begin == std::string::npos) {
+        return {};
+    }
+    auto end = value.find_last_not_of (" \t\r");
+    return value.substr (begin, end - begin + 1);
+}
+
+// parse_boolean call. Parse a "true" or "false" value of a given key.
+static bool parse_boolean (const std::string& key, const std::string& value, bool& flag)
+{
+    if (value != "true" && value != "false") {
+        std::fprintf (stderr,
+            "PADLL: invalid value of %s in configuration (%s); expected true or false.\n",
+            key.c_str (),
+            value.c_str ());
+        return false;
+    }
+
+    flag = (value == "true");
+    return true;
+}
+
+// PadllConfiguration default constructor.
+PadllConfiguration::PadllConfiguration ()
+{
+    this->set_default_intercept_mask ();
+}
+
+// PadllConfiguration parameterized constructor.
+PadllConfiguration::PadllConfiguration (const std::string& path) : m_configuration_path { path }
+{
+    this->set_default_intercept_mask ();
+
+    if (!this->parse_file (path)) {
+        std::fprintf (stderr, "PADLL: ignored invalid entries of %s.\n", path.c_str ());
+    }
+}
+
+// PadllConfiguration default destructor.
+PadllConfiguration::~PadllConfiguration () = default;
+
+// set_default_intercept_mask call. (...)
+void PadllConfiguration::set_default_intercept_mask ()
+{
+    auto& mask = this->m_intercept_mask;
+
+    // data calls
+    mask.set (PosixCall::read, posix_data_calls.padll_intercept_read);
+    mask.set (PosixCall::write, posix_data_calls.padll_intercept_write);
+    mask.set (PosixCall::pread, posix_data_calls.padll_intercept_pread);
+    mask.set (PosixCall::pwrite, posix_data_calls.padll_intercept_pwrite);
+#if defined(__USE_LARGEFILE64)
+    mask.set (PosixCall::pread64, posix_data_calls.padll_intercept_pread64);
+    mask.set (PosixCall::pwrite64, posix_data_calls.padll_intercept_pwrite64);
+#endif
+    mask.set (PosixCall::mmap, posix_data_calls.padll_intercept_mmap);
+    mask.set (PosixCall::munmap, posix_data_calls.padll_intercept_munmap);
+    mask.set (PosixCall::readv, posix_data_calls.padll_intercept_readv);
+    mask.set (PosixCall::writev, posix_data_calls.padll_intercept_writev);
+    mask.set (PosixCall::preadv, posix_data_calls.padll_intercept_preadv);
+    mask.set (PosixCall::pwritev, posix_data_calls.padll_intercept_pwritev);
+    mask.set (PosixCall::preadv2, posix_data_calls.padll_intercept_preadv2);
+    mask.set (PosixCall::pwritev2, posix_data_calls.padll_intercept_pwritev2);
+    mask.set (PosixCall::fread, posix_data_calls.padll_intercept_fread);
+    mask.set (PosixCall::fwrite, posix_data_calls.padll_intercept_fwrite);
+    mask.set (PosixCall::fgets, posix_data_calls.padll_intercept_fgets);
+    mask.set (PosixCall::fputs, posix_data_calls.padll_intercept_fputs);
+    mask.set (PosixCall::fprintf, posix_data_calls.padll_intercept_fprintf);
+    mask.set (PosixCall::vfprintf, posix_data_calls.padll_intercept_vfprintf);
+    mask.set (PosixCall::fflush, posix_data_calls.padll_intercept_fflush);
+    mask.set (PosixCall::copy_file_range, posix_data_calls.padll_intercept_copy_file_range);
+    mask.set (PosixCall::sendfile, posix_data_calls.padll_intercept_sendfile);
+    mask.set (PosixCall::sendfile64, posix_data_calls.padll_intercept_sendfile64);
+    mask.set (PosixCall::splice, posix_data_calls.padll_intercept_splice);
+    mask.set (PosixCall::io_uring_enter, posix_data_calls.padll_intercept_io_uring_enter);
+    mask.set (PosixCall::aio_read, posix_data_calls.padll_intercept_aio_read);
+    mask.set (PosixCall::aio_write, posix_data_calls.padll_intercept_aio_write);
+    mask.set (PosixCall::aio_read64, posix_data_calls.padll_intercept_aio_read64);
+    mask.set (PosixCall::aio_write64, posix_data_calls.padll_intercept_aio_write64);
+    mask.set (PosixCall::lio_listio, posix_data_calls.padll_intercept_lio_listio);
+    mask.set (PosixCall::lio_listio64, posix_data_calls.padll_intercept_lio_listio64);
+
+    // directory calls
+    mask.set (PosixCall::mkdir, posix_directory_calls.padll_intercept_mkdir);
+    mask.set (PosixCall::mkdirat, posix_directory_calls.padll_intercept_mkdirat);
+    mask.set (PosixCall::rmdir, posix_directory_calls.padll_intercept_rmdir);
+    mask.set (PosixCall::mknod, posix_directory_calls.padll_intercept_mknod);
+    mask.set (PosixCall::mknodat, posix_directory_calls.padll_intercept_mknodat);
+    mask.set (PosixCall::opendir, posix_directory_calls.padll_intercept_opendir);
+    mask.set (PosixCall::fdopendir, posix_directory_calls.padll_intercept_fdopendir);
+    mask.set (PosixCall::readdir, posix_directory_calls.padll_intercept_readdir);
+    mask.set (PosixCall::readdir64, posix_directory_calls.padll_intercept_readdir64);
+    mask.set (PosixCall::getdents64, posix_directory_calls.padll_intercept_getdents64);
+    mask.set (PosixCall::closedir, posix_directory_calls.padll_intercept_closedir);
+
+    // extended attributes calls
+    mask.set (PosixCall::getxattr, posix_extended_attributes_calls.padll_intercept_getxattr);
+    mask.set (PosixCall::lgetxattr, posix_extended_attributes_calls.padll_intercept_lgetxattr);
+    mask.set (PosixCall::fgetxattr, posix_extended_attributes_calls.padll_intercept_fgetxattr);
+    mask.set (PosixCall::setxattr, posix_extended_attributes_calls.padll_intercept_setxattr);
+    mask.set (PosixCall::lsetxattr, posix_extended_attributes_calls.padll_intercept_lsetxattr);
+    mask.set (PosixCall::fsetxattr, posix_extended_attributes_calls.padll_intercept_fsetxattr);
+    mask.set (PosixCall::listxattr, posix_extended_attributes_calls.padll_intercept_listxattr);
+    mask.set (PosixCall::llistxattr, posix_extended_attributes_calls.padll_intercept_llistxattr);
+    mask.set (PosixCall::flistxattr, posix_extended_attributes_calls.padll_intercept_flistxattr);
+
+    // metadata calls
+    mask.set (PosixCall::open_variadic, posix_metadata_calls.padll_intercept_open_var);
+    mask.set (PosixCall::open, posix_metadata_calls.padll_intercept_open);
+    mask.set (PosixCall::creat, posix_metadata_calls.padll_intercept_creat);
+    mask.set (PosixCall::creat64, posix_metadata_calls.padll_intercept_creat64);
+    mask.set (PosixCall::openat_variadic, posix_metadata_calls.padll_intercept_openat_var);
+    mask.set (PosixCall::openat, posix_metadata_calls.padll_intercept_openat);
+    mask.set (PosixCall::open64_variadic, posix_metadata_calls.padll_intercept_open64_var);
+    mask.set (PosixCall::open64, posix_metadata_calls.padll_intercept_open64);
+    mask.set (PosixCall::close, posix_metadata_calls.padll_intercept_close);
+    mask.set (PosixCall::sync, posix_metadata_calls.padll_intercept_sync);
+    mask.set (PosixCall::statfs, posix_metadata_calls.padll_intercept_statfs);
+    mask.set (PosixCall::fstatfs, posix_metadata_calls.padll_intercept_fstatfs);
+    mask.set (PosixCall::statfs64, posix_metadata_calls.padll_intercept_statfs64);
+    mask.set (PosixCall::fstatfs64, posix_metadata_calls.padll_intercept_fstatfs64);
+    mask.set (PosixCall::unlink, posix_metadata_calls.padll_intercept_unlink);
+    mask.set (PosixCall::unlinkat, posix_metadata_calls.padll_intercept_unlinkat);
+    mask.set (PosixCall::rename, posix_metadata_calls.padll_intercept_rename);
+    mask.set (PosixCall::renameat, posix_metadata_calls.padll_intercept_renameat);
+    mask.set (PosixCall::fopen, posix_metadata_calls.padll_intercept_fopen);
+    mask.set (PosixCall::fopen64, posix_metadata_calls.padll_intercept_fopen64);
+    mask.set (PosixCall::fclose, posix_metadata_calls.padll_intercept_fclose);
+    mask.set (PosixCall::stat, posix_metadata_calls.padll_intercept_stat);
+    mask.set (PosixCall::lstat, posix_metadata_calls.padll_intercept_lstat);
+    mask.set (PosixCall::fstat, posix_metadata_calls.padll_intercept_fstat);
+    mask.set (PosixCall::fstatat, posix_metadata_calls.padll_intercept_fstatat);
+    mask.set (PosixCall::statx, posix_metadata_calls.padll_intercept_statx);
+    mask.set (PosixCall::access, posix_metadata_calls.padll_intercept_access);
+    mask.set (PosixCall::faccessat, posix_metadata_calls.padll_intercept_faccessat);
+    mask.set (PosixCall::stat64, posix_metadata_calls.padll_intercept_stat64);
+    mask.set (PosixCall::lstat64, posix_metadata_calls.padll_intercept_lstat64);
+    mask.set (PosixCall::fstat64, posix_metadata_calls.padll_intercept_fstat64);
+    mask.set (PosixCall::fstatat64, posix_metadata_calls.padll_intercept_fstatat64);
+    mask.set (PosixCall::fsync, posix_metadata_calls.padll_intercept_fsync);
+    mask.set (PosixCall::fdatasync, posix_metadata_calls.padll_intercept_fdatasync);
+    mask.set (PosixCall::sync_file_range, posix_metadata_calls.padll_intercept_sync_file_range);
+    mask.set (PosixCall::syncfs, posix_metadata_calls.padll_intercept_syncfs);
+    mask.set (PosixCall::truncate, posix_metadata_calls.padll_intercept_truncate);
+    mask.set (PosixCall::ftruncate, posix_metadata_calls.padll_intercept_ftruncate);
+    mask.set (PosixCall::fallocate, posix_metadata_calls.padll_intercept_fallocate);
+    mask.set (PosixCall::posix_fallocate, posix_metadata_calls.padll_intercept_posix_fallocate);
+    mask.set (PosixCall::posix_fadvise, posix_metadata_calls.padll_intercept_posix_fadvise);
+    mask.set (PosixCall::io_uring_setup, posix_metadata_calls.padll_intercept_io_uring_setup);
+    mask.set (PosixCall::aio_fsync, posix_metadata_calls.padll_intercept_aio_fsync);
+    mask.set (PosixCall::aio_fsync64, posix_metadata_calls.padll_intercept_aio_fsync64);
+
+    // special calls
+    mask.set (PosixCall::socket, posix_special_calls.padll_intercept_socket);
+    mask.set (PosixCall::fcntl, posix_special_calls.padll_intercept_fcntl);
+}
+
+// parse_calls call. (...)
+bool PadllConfiguration::parse_calls (const std::string& calls, const bool& value)
+{
+    std::stringstream stream { calls };
+    std::string call;
+    bool valid = true;
+
+    while (std::getline (stream, call, ',')) {
+        call = trim (call);
+
+        if (call == "all") {
+            for (std::size_t i = 0; i < posix_call_names.size (); i++) {
+                this->m_intercept_mask.set (static_cast<PosixCall> (i), value);
+            }
+            continue;
+        }
+
+        bool found = false;
+        for (std::size_t i = 0; i < posix_call_names.size () && !found; i++) {
+            if (posix_call_names[i] == call) {
+                this->m_intercept_mask.set (static_cast<PosixCall> (i), value);
+                found = true;
+            }
+        }
+
+        if (!found) {
+            std::fprintf (stderr, "PADLL: unknown call in configuration (%s).\n", call.c_str ());
+            valid = false;
+        }
+    }
+
+    return valid;
+}
+
+// parse_mount_point call. (...)
+bool PadllConfiguration::parse_mount_point (const std::string& value)
+{
+    auto separator = value.find_first_of (" \t");
+    auto path = value.substr (0, separator);
+    std::vector<uint32_t> workflows {};
+
+    if (path.empty () || path[0] != '/') {
+        std::fprintf (stderr,
+            "PADLL: invalid mount point in configuration (%s).\n",
+            value.c_str ());
+        return false;
+    }
+
+    if (separator != std::string::npos) {
+        std::stringstream stream { value.substr (separator) };
+        std::string workflow;
+
+        while (std::getline (stream, workflow, ',')) {
+            try {
+                workflows.push_back (static_cast<uint32_t> (std::stoul (trim (workflow))));
+            } catch (...) {
+                std::fprintf (stderr,
+                    "PADLL: invalid workflow of mount point in configuration (%s).\n",
+                    value.c_str ());
+                return false;
+            }
+        }
+    }
+
+    this->m_mount_points.emplace_back (path, workflows);
+    return true;
+}
+
+// parse_line call. (...)
+bool PadllConfiguration::parse_line (const std::string& line)
+{
+    // strip comments and skip empty lines
+    auto content = trim (line.substr (0, line.find ('#')));
+    if (content.empty ()) {
+        return true;
+    }
+
+    auto separator = content.find ('=');
+    if (separator == std::string::npos) {
+        std::fprintf (stderr, "PADLL: malformed configuration line (%s).\n", content.c_str ());
+        return false;
+    }
+
+    auto key = trim (content.substr (0, separator));
+    auto value = trim (content.substr (separator + 1));
+
+    if (key == "intercept") {
+        return this->parse_calls (value, true);
+    } else if (key == "passthrough") {
+        return this->parse_calls (value, false);
+    } else if (key == "mount_point_differentiation") {
+        return parse_boolean (key, value, this->m_mount_point_differentiation);
+    } else if (key == "statistic_collection") {
+        return parse_boolean (key, value, this->m_statistic_collection);
+    } else if (key == "latency_collection") {
+        return parse_boolean (key, value, this->m_latency_collection);
+    } else if (key == "remote_mount_point") {
+        this->m_remote_mount_point = value;
+    } else if (key == "log_path") {
+        this->m_log_path = value;
+    } else if (key == "statistics_export_path") {
+        this->m_statistics_export_path = value;
+    } else if (key == "statistics_export_interval") {
+        this->m_statistics_export_interval = value;
+    } else if (key == "workflow_selection") {
+        this->m_workflow_selection = value;
+    } else if (key == "credits") {
+        this->m_credits = value;
+    } else if (key == "space_weight") {
+        this->m_space_weight = value;
+    } else if (key == "io_uring_hold_back") {
+        this->m_io_uring_hold_back = value;
+    } else if (key == "seccomp_interception") {
+        this->m_seccomp_interception = value;
+    } else if (key == "binary_rewriting") {
+        this->m_binary_rewriting = value;
+    } else if (key == "mmap_sampling_interval") {
+        this->m_mmap_sampling_interval = value;
+    } else if (key == "stage_name") {
+        this->m_stage_name = value;
+    } else if (key == "hsk_rules_file") {
+        this->m_hsk_rules_file = value;
+    } else if (key == "dif_rules_file") {
+        this->m_dif_rules_file = value;
+    } else if (key == "enf_rules_file") {
+        this->m_enf_rules_file = value;
+    } else if (key == "mount_point") {
+        return this->parse_mount_point (value);
+    } else {
+        std::fprintf (stderr, "PADLL: unknown configuration key (%s).\n", key.c_str ());
+        return false;
+    }
+
+    return true;
+}
+
+// parse_file call. (...)
+bool PadllConfiguration::parse_file (const std::string& path)
+{
+    // bypass PADLL's interposed calls through the libc dispatch table
+    auto& dispatch = padll::headers::libc_dispatch ();
+    int fd = dispatch.get<padll::headers::libc_open_variadic_t> (PosixCall::open_variadic) (
+        path.c_str (),
+        O_RDONLY);
+
+    std::string contents {};
+    if (fd != -1) {
+        auto libc_read = dispatch.get<padll::headers::libc_read_t> (PosixCall::read);
+        char buffer[4096];
+        ssize_t bytes;
+
+        while ((bytes = libc_read (fd, buffer, sizeof (buffer))) > 0) {
+            contents.append (buffer, static_cast<std::size_t> (bytes));
+        }
+        dispatch.get<padll::headers::libc_close_t> (PosixCall::close) (fd);
+    } else {
+        std::fprintf (stderr, "PADLL: cannot open %s: %s.\n", path.c_str (), std::strerror (errno));
+    }
+
+    if (fd == -1) {
+        return false;
+    }
+
+    // parse all lines (invalid lines are reported and ignored)
+    std::stringstream stream { contents };
+    std::string line;
+    bool valid = true;
+
+    while (std::getline (stream, line)) {
+        valid = this->parse_line (line) && valid;
+    }
+
+    return valid;
+}
+
+// get_intercept_mask call. (...)
+const InterceptMask& PadllConfiguration::get_intercept_mask () const
+{
+    return this->m_intercept_mask;
+}
+
+// is_intercepted call. (...)
+bool PadllConfiguration::is_intercepted (const PosixCall& call) const
+{
+    return this->m_intercept_mask.test (call);
+}
+
+// is_mount_point_differentiation_enabled call. (...)
+bool PadllConfiguration::is_mount_point_differentiation_enabled () const
+{
+    return this->m_mount_point_differentiation;
+}
+
+// is_statistic_collection_enabled call. (...)
+bool PadllConfiguration::is_statistic_collection_enabled () const
+{
+    return this->m_statistic_collection;
+}
+
+// is_latency_collection_enabled call. (...)
+bool PadllConfiguration::is_latency_collection_enabled () const
+{
+    return this->m_latency_collection;
+}
+
+// get_remote_mount_point call. (...)
+const std::string& PadllConfiguration::get_remote_mount_point () const
+{
+    return this->m_remote_mount_point;
+}
+
+// get_log_path call. (...)
+const std::string& PadllConfiguration::get_log_path () const
+{
+    return this->m_log_path;
+}
+
+// get_statistics_export_path call. (...)
+const std::string& PadllConfiguration::get_statistics_export_path () const
+{
+    return this->m_statistics_export_path;
+}
+
+// get_statistics_export_interval call. (...)
+const std::string& PadllConfiguration::get_statistics_export_interval () const
+{
+    return this->m_statistics_export_interval;
+}
+
+// get_workflow_selection call. (...)
+const std::string& PadllConfiguration::get_workflow_selection () const
+{
+    return this->m_workflow_selection;
+}
+
+// get_credits call. (...)
+const std::string& PadllConfiguration::get_credits () const
+{
+    return this->m_credits;
+}
+
+// get_space_weight call. (...)
+const std::string& PadllConfiguration::get_space_weight () const
+{
+    return this->m_space_weight;
+}
+
+// get_io_uring_hold_back call. (...)
+const std::string& PadllConfiguration::get_io_uring_hold_back () const
+{
+    return this->m_io_uring_hold_back;
+}
+
+// get_seccomp_interception call. (...)
+const std::string& PadllConfiguration::get_seccomp_interception () const
+{
+    return this->m_seccomp_interception;
+}
+
+// get_binary_rewriting call. (...)
+const std::string& PadllConfiguration::get_binary_rewriting () const
+{
+    return this->m_binary_rewriting;
+}
+
+// get_mmap_sampling_interval call. (...)
+const std::string& PadllConfiguration::get_mmap_sampling_interval () const
+{
+    return this->m_mmap_sampling_interval;
+}
+
+// get_stage_name call. (...)
+const std::string& PadllConfiguration::get_stage_name () const
+{
+    return this->m_stage_name;
+}
+
+// get_hsk_rules_file call. (...)
+const std::string& PadllConfiguration::get_hsk_rules_file () const
+{
+    return this->m_hsk_rules_file;
+}
+
+// get_dif_rules_file call. (...)
+const std::string& PadllConfiguration::get_dif_rules_file () const
+{
+    return this->m_dif_rules_file;
+}
+
+// get_enf_rules_file call. (...)
+const std::string& PadllConfiguration::get_enf_rules_file () const
+{
+    return this->m_enf_rules_file;
+}
+
+// get_mount_points call. (...)
+const std::vector<std::pair<std::string, std::vector<uint32_t>>>&
+PadllConfiguration::get_mount_points () const
+{
+    return this->m_mount_points;
+}
+
+// get_value call. (...)
+const char* PadllConfiguration::get_value (const std::string_view& env,
+    const std::string& configured)
+{
+    auto value = std::getenv (env.data ());
+    if (value != nullptr) {
+        return value;
+    }
+
+    return configured.empty () ? nullptr : configured.c_str ();
+}
+
+// to_string call. (...)
+std::string PadllConfiguration::to_string () const
+{
+    std::stringstream stream;
+    stream << "PadllConfiguration (";
+    stream << (this->m_configuration_path.empty () ? "compile-time" : this->m_configuration_path);
+    stream << "):" << std::endl;
+
+    stream << "  intercept:";
+    for (std::size_t i = 0; i < posix_call_names.size (); i++) {
+        if (this->m_intercept_mask.test (static_cast<PosixCall> (i))) {
+            stream << " " << posix_call_names[i];
+        }
+    }
+    stream << std::endl;
+
+    stream << "  mount_point_differentiation: " << this->m_mount_point_differentiation << std::endl;
+    stream << "  remote_mount_point: " << this->m_remote_mount_point << std::endl;
+    for (const auto& [path, workflows] : this->m_mount_points) {
+        stream << "  mount_point: " << path;
+        for (const auto& workflow : workflows) {
+            stream << " " << workflow;
+        }
+        stream << std::endl;
+    }
+    stream << "  statistic_collection: " << this->m_statistic_collection << std::endl;
+    stream << "  latency_collection: " << this->m_latency_collection << std::endl;
+    stream << "  log_path: " << this->m_log_path << std::endl;
+    stream << "  statistics_export_path: " << this->m_statistics_export_path << std::endl;
+    stream << "  stage_name: " << this->m_stage_name << std::endl;
+    stream << "  hsk_rules_file: " << this->m_hsk_rules_file << std::endl;
+    stream << "  dif_rules_file: " << this->m_dif_rules_file << std::endl;
+    stream << "  enf_rules_file: " << this->m_enf_rules_file << std::endl;
+
+    return stream.str ();
+}
+
+// padll_configuration call. (...)
+const PadllConfiguration& padll_configuration ()
+{
+    static const PadllConfiguration configuration = [] () {
+        auto path = std::getenv (option_configuration_file_env.data ());
+        return (path == nullptr) ? PadllConfiguration {} : PadllConfiguration { path };
+    }();
+
+    return configuration;
+}
+
+} // namespace padll::configurations
@@ -3,15 +3,136 @@
  *   Copyright (c) 2021-2023 INESC TEC.
  **/
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <padll/interface/ldpreloaded/ld_preloaded_posix.hpp>
+#include <stdio_ext.h>
 
 namespace padll::interface::ldpreloaded {
 
+/**
+ * LatencyTimer struct: timestamps (in nanoseconds) of the intercepted call that is being handled by
+ * the calling thread. Enforcement timestamps are 0 if the call was not submitted to enforcement.
+ */
+struct LatencyTimer {
+    uint64_t m_start;
+    uint64_t m_enforcement_start;
+    uint64_t m_enforcement_end;
+};
+
+// per-thread timer of the intercepted call (trivially destructible)
+static thread_local LatencyTimer latency_timer {};
+
+// latency_clock call. Get the current time (in nanoseconds) of a monotonic clock.
+static inline uint64_t latency_clock ()
+{
+    auto now = std::chrono::steady_clock::now ().time_since_epoch ();
+    return static_cast<uint64_t> (
+        std::chrono::duration_cast<std::chrono::nanoseconds> (now).count ());
+}
+
+// iovec_length call. Get the summed length of the buffers of a vectored call, so that it is
+// enforced as a single request.
+static inline size_t iovec_length (const struct iovec* iov, const int& iovcnt)
+{
+    size_t length = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        length += iov[i].iov_len;
+    }
+
+    return length;
+}
+
+// io_uring_classifier call. Get the PAIO operation type and context of an SQE, and its cost (bytes
+// for reads and writes; 1 token otherwise). SQEs of other operations are not charged (no_op).
+static inline RequestCharge io_uring_classifier (const IoUringSubmission& submission)
+{
+    switch (submission.m_operation) {
+        case IoUringOperation::kRead:
+            return { 0,
+                static_cast<int> (paio::core::POSIX::read),
+                static_cast<int> (paio::core::POSIX_META::data_op),
+                submission.m_bytes };
+
+        case IoUringOperation::kWrite:
+            return { 0,
+                static_cast<int> (paio::core::POSIX::write),
+                static_cast<int> (paio::core::POSIX_META::data_op),
+                submission.m_bytes };
+
+        case IoUringOperation::kFsync:
+            return { 0,
+                static_cast<int> (paio::core::POSIX::fsync),
+                static_cast<int> (descriptors::durability_op),
+                1 };
+
+        case IoUringOperation::kFdatasync:
+            return { 0,
+                static_cast<int> (paio::core::POSIX::fdatasync),
+                static_cast<int> (descriptors::durability_op),
+                1 };
+
+        case IoUringOperation::kOpenat:
+            return { 0,
+                static_cast<int> (paio::core::POSIX::openat),
+                static_cast<int> (paio::core::POSIX_META::meta_op),
+                1 };
+
+        default:
+            return { 0,
+                static_cast<int> (paio::core::POSIX::no_op),
+                static_cast<int> (paio::core::POSIX_META::no_op),
+                0 };
+    }
+}
+
+/**
+ * StreamCall struct: state of the stream call that is being handled by the calling thread, with the
+ * buffer state of the targeted stream captured before the original call.
+ */
+struct StreamCall {
+    bool m_active;
+    size_t m_pending;
+    size_t m_available;
+};
+
+// per-thread state of the intercepted stream call (trivially destructible)
+static thread_local StreamCall stream_call {};
+
+// stream_pending_bytes call. Get the number of bytes written to the buffer of a stream that were
+// not yet flushed to the file.
+static inline size_t stream_pending_bytes (FILE* stream)
+{
+    return __fpending (stream);
+}
+
+// stream_available_bytes call. Get the number of bytes read into the buffer of a stream that were
+// not yet consumed. The read pointers are only exposed by glibc's FILE; elsewhere no bytes are
+// considered buffered, and each read call is charged with its own size.
+static inline size_t stream_available_bytes ([[maybe_unused]] FILE* stream)
+{
+#if defined(__GLIBC__)
+    return (__freading (stream) != 0)
+        ? static_cast<size_t> (stream->_IO_read_end - stream->_IO_read_ptr)
+        : 0;
+#else
+    return 0;
+#endif
+}
+
+// is_latency_tracking_enabled call. Check if latency histograms are to be collected.
+static inline bool is_latency_tracking_enabled (const bool& collect_latency,
+    const std::atomic<bool>& collect)
+{
+    return collect_latency && collect.load (std::memory_order_relaxed);
+}
+
 // LdPreloadedPosix default constructor.
 LdPreloadedPosix::LdPreloadedPosix () :
     m_log { std::make_shared<Log> (option_default_enable_debug_level,
         option_default_enable_debug_with_ld_preload,
-        std::string { option_default_log_path }) },
+        padll_configuration ().get_log_path ()) },
     m_dlsym_hook { option_library_name, this->m_log },
     m_loaded { std::make_shared<std::atomic<bool>> (false) }
 {
@@ -23,6 +144,9 @@ LdPreloadedPosix::LdPreloadedPosix () :
     // write debug logging message
     this->m_log->log_info (stream.str ());
 
+    // start live statistics export (if enabled)
+    this->initialize_statistics_exporter ();
+
     // set loaded
     this->set_loaded (true);
 }
@@ -60,12 +184,15 @@ LdPreloadedPosix::LdPreloadedPosix (const std::string& lib,
             padll::options::option_default_stage_channels,
             padll::options::option_default_stage_object_creation,
             stage_name,
-            padll::options::option_default_hsk_rules_file ().string (),
-            padll::options::option_default_dif_rules_file ().string (),
-            padll::options::option_default_enf_rules_file ().string (),
+            padll_configuration ().get_hsk_rules_file (),
+            padll_configuration ().get_dif_rules_file (),
+            padll_configuration ().get_enf_rules_file (),
             padll::options::option_execute_on_receive);
     }
 
+    // start live statistics export (if enabled)
+    this->initialize_statistics_exporter ();
+
     // set loaded
     this->set_loaded (true);
 }
@@ -76,6 +203,14 @@ LdPreloadedPosix::~LdPreloadedPosix ()
     // create logging message
     this->m_log->log_info ("LdPreloadedPosix default destructor.");
 
+    // stop live statistics export
+    if (this->m_stats_exporter != nullptr) {
+        this->m_stats_exporter->stop ();
+    }
+
+    // stop sampling file-backed mappings
+    this->stop_mmap_sampler ();
+
     // log LdPreloadedPosix statistic counters
     if (option_default_table_format) {
         // print to stdout metadata-based statistics in tabular format
@@ -91,6 +226,12 @@ LdPreloadedPosix::~LdPreloadedPosix ()
     } else {
         this->generate_statistics_report (option_default_statistics_report_path);
     }
+
+    // calls issued during process teardown (e.g., stdio writes of the logging backend) follow
+    // the passthrough workflow
+    if (this->m_loaded != nullptr) {
+        this->m_loaded->store (false);
+    }
 }
 
 // set_loaded call.
@@ -100,6 +241,43 @@ void LdPreloadedPosix::set_loaded (const bool& value)
     this->m_loaded->store (value);
 }
 
+// is_file_descriptor_tracked call. (...)
+bool LdPreloadedPosix::is_file_descriptor_tracked (const int& fd) const
+{
+    return this->m_mount_point_table.is_file_descriptor_registered (fd);
+}
+
+// is_io_uring_tracked call. (...)
+bool LdPreloadedPosix::is_io_uring_tracked (const int& ring_fd)
+{
+    return !this->m_io_uring_table.is_empty () && this->m_io_uring_table.is_shared_ring (ring_fd);
+}
+
+// initialize_statistics_exporter call.
+void LdPreloadedPosix::initialize_statistics_exporter ()
+{
+    auto interval = StatisticsExporter::get_interval_from_env ();
+
+    // live export is disabled
+    if (interval.count () == 0) {
+        return;
+    }
+
+    this->m_stats_exporter = std::make_unique<StatisticsExporter> (this->m_log,
+        std::vector<Statistics*> { &this->m_metadata_stats,
+            &this->m_data_stats,
+            &this->m_dir_stats,
+            &this->m_ext_attr_stats,
+            &this->m_special_stats },
+        interval,
+        export_region_path (padll_configuration ().get_statistics_export_path (), ::getpid ()));
+
+    if (!this->m_stats_exporter->start ()) {
+        this->m_log->log_error ("Error while starting statistics exporter.");
+        this->m_stats_exporter.reset ();
+    }
+}
+
 // set_statistic_collection call.
 void LdPreloadedPosix::set_statistic_collection (bool value)
 {
@@ -107,11 +285,12 @@ void LdPreloadedPosix::set_statistic_collection (bool value)
 }
 
 // set_data_plane_stage_name call. If option_default_stage_name_env environment variable is not set,
-// it assumes the option_default_stage_name.
+// it assumes the configured stage name (or, if not configured, option_default_stage_name).
 std::string LdPreloadedPosix::set_data_plane_stage_name () const
 {
-    // get environment variable for data plane stage
-    auto name_value = std::getenv (padll::options::option_default_stage_name_env.data ());
+    // get environment variable (or configured value) for data plane stage
+    auto name_value = PadllConfiguration::get_value (option_default_stage_name_env,
+        padll_configuration ().get_stage_name ());
 
     if (name_value != nullptr) {
         // log message
@@ -168,6 +347,18 @@ std::string LdPreloadedPosix::to_string ()
     stream << this->m_ext_attr_stats.to_string (false);
     stream << this->m_special_stats.to_string (false);
 
+    // latency histograms (interception, enforcement, and syscall phases)
+    if (this->m_collect_latency) {
+        stream << "----------------------------------------------------------------------\n";
+        stream << "LdPreloadedPosix Latency\n";
+        stream << "----------------------------------------------------------------------\n";
+        stream << this->m_metadata_stats.latency_to_string (true);
+        stream << this->m_data_stats.latency_to_string (false);
+        stream << this->m_dir_stats.latency_to_string (false);
+        stream << this->m_ext_attr_stats.latency_to_string (false);
+        stream << this->m_special_stats.latency_to_string (false);
+    }
+
     return stream.str ();
 }
 
@@ -221,11 +412,21 @@ void LdPreloadedPosix::generate_statistics_report (const std::string_view& path)
     const uint32_t& workflow_id,
     const int& operation_type,
     const int& operation_context,
-    const int& payload)
+    const uint64_t& payload)
 {
+    // enforcement is compiled out of the interception pipeline
+    if constexpr (!option_pipeline_enforcement) {
+        return false;
+    }
+
     // validate if workflow-id is valid
     auto is_valid = (workflow_id != static_cast<uint32_t> (-1));
 
+    // mark start of enforcement phase
+    if (is_latency_tracking_enabled (this->m_collect_latency, this->m_collect)) {
+        latency_timer.m_enforcement_start = latency_clock ();
+    }
+
     if (is_valid) {
         // enforce request to PAIO data plane stage
         this->m_stage->enforce_request (workflow_id, operation_type, operation_context, payload);
@@ -239,9 +440,126 @@ void LdPreloadedPosix::generate_statistics_report (const std::string_view& path)
 #endif
     }
 
+    // mark end of enforcement phase
+    if (is_latency_tracking_enabled (this->m_collect_latency, this->m_collect)) {
+        latency_timer.m_enforcement_end = latency_clock ();
+    }
+
     return is_valid;
 }
 
+// start_latency_tracking call. Mark the start of an intercepted call.
+void LdPreloadedPosix::start_latency_tracking () const
+{
+    if (option_pipeline_statistics
+        && is_latency_tracking_enabled (this->m_collect_latency, this->m_collect)) {
+        latency_timer = { latency_clock (), 0, 0 };
+    }
+}
+
+// begin_stream_call call. (...)
+bool LdPreloadedPosix::begin_stream_call (FILE* stream) const
+{
+    if (stream_call.m_active || stream == nullptr || stream == stdin || stream == stdout
+        || stream == stderr) {
+        return false;
+    }
+
+    stream_call = { true, stream_pending_bytes (stream), stream_available_bytes (stream) };
+    return true;
+}
+
+// stream_payload call. (...)
+size_t
+LdPreloadedPosix::stream_payload (FILE* stream, const bool& is_read, const ssize_t& bytes) const
+{
+    auto transferred = static_cast<size_t> ((bytes > 0) ? bytes : 0);
+
+    if (is_read) {
+        // bytes consumed by the call that were not served by the previously buffered ones
+        auto buffered = stream_available_bytes (stream) + transferred;
+        return (buffered > stream_call.m_available) ? buffered - stream_call.m_available : 0;
+    } else {
+        // previously pending and written bytes that are no longer pending in the buffer
+        auto written = stream_call.m_pending + transferred;
+        auto pending = stream_pending_bytes (stream);
+        return (written > pending) ? written - pending : 0;
+    }
+}
+
+// end_stream_call call. (...)
+void LdPreloadedPosix::end_stream_call () const
+{
+    stream_call.m_active = false;
+}
+
+// begin_directory_batch call. (...)
+std::pair<std::shared_ptr<MountPointEntry>, bool> LdPreloadedPosix::begin_directory_batch (
+    DIR* dirp)
+{
+    auto [found, entry_ptr] = this->m_mount_point_table.get_mount_point_entry (dirp);
+
+    // directory streams that were not registered (opendir not intercepted) are not enforced
+    if (!found) {
+        return std::make_pair (nullptr, false);
+    }
+
+    auto new_batch = entry_ptr->begin_stream_batch ();
+    return std::make_pair (std::move (entry_ptr), new_batch);
+}
+
+// update_latency call. Compute the phases of the intercepted call and record them.
+void LdPreloadedPosix::update_latency (const OperationType& operation_type, const int& operation)
+{
+    auto end = latency_clock ();
+    uint64_t interception = 0;
+    uint64_t enforcement = 0;
+    uint64_t syscall = end - latency_timer.m_start;
+
+    // split the call in phases, if it went through enforce_request
+    if (latency_timer.m_enforcement_start >= latency_timer.m_start
+        && latency_timer.m_enforcement_end >= latency_timer.m_enforcement_start
+        && latency_timer.m_enforcement_start != 0) {
+        interception = latency_timer.m_enforcement_start - latency_timer.m_start;
+        enforcement = latency_timer.m_enforcement_end - latency_timer.m_enforcement_start;
+        syscall = end - latency_timer.m_enforcement_end;
+    }
+
+    switch (operation_type) {
+        case OperationType::metadata_calls:
+            this->m_metadata_stats.update_latency_entry (operation,
+                interception,
+                enforcement,
+                syscall);
+            break;
+
+        case OperationType::data_calls:
+            this->m_data_stats.update_latency_entry (operation, interception, enforcement, syscall);
+            break;
+
+        case OperationType::directory_calls:
+            this->m_dir_stats.update_latency_entry (operation, interception, enforcement, syscall);
+            break;
+
+        case OperationType::ext_attr_calls:
+            this->m_ext_attr_stats.update_latency_entry (operation,
+                interception,
+                enforcement,
+                syscall);
+            break;
+
+        case OperationType::special_calls:
+            this->m_special_stats.update_latency_entry (operation,
+                interception,
+                enforcement,
+                syscall);
+            break;
+
+        default:
+            break;
+    }
+}
+
 // update_statistic_entry_data call.
 void LdPreloadedPosix::update_statistic_entry_data (const int& operation,
     const ssize_t& bytes,
@@ -270,11 +588,11 @@ void LdPreloadedPosix::update_statistic_entry_metadata (const int& operation,
 
 // update_statistic_entry_dir call.
 void LdPreloadedPosix::update_statistic_entry_dir (const int& operation,
-    const int& result,
+    const ssize_t& result,
     const bool& enforced)
 {
     if (enforced) {
-        (result == 0) ? this->m_dir_stats.update_statistic_entry (operation, 1, 0)
+        (result >= 0) ? this->m_dir_stats.update_statistic_entry (operation, 1, result)
                       : this->m_dir_stats.update_statistic_entry (operation, 1, 0, 1);
     } else {
         this->m_dir_stats.update_bypassed_statistic_entry (operation, 1);
@@ -313,7 +631,7 @@ void LdPreloadedPosix::update_statistics (const OperationType& operation_type,
     const long& result,
     const bool& enforced)
 {
-    if (this->m_collect) {
+    if (option_pipeline_statistics && this->m_collect) {
         switch (operation_type) {
             case OperationType::data_calls:
                 this->update_statistic_entry_data (operation, result, enforced);
@@ -338,185 +656,400 @@ void LdPreloadedPosix::update_statistics (const OperationType& operation_type,
             default:
                 break;
         }
+
+        // record the latency of each phase of the intercepted call
+        if (this->m_collect_latency) {
+            this->update_latency (operation_type, operation);
+        }
     }
 }
 
-// ld_preloaded_posix_read call.
-ssize_t LdPreloadedPosix::ld_preloaded_posix_read (int fd, void* buf, size_t counter)
+// get_space_weight call. (...)
+uint64_t LdPreloadedPosix::get_space_weight ()
 {
-    // hook POSIX read operation to m_data_operations.m_read
-    this->m_dlsym_hook.hook_posix_read (m_data_operations.m_read);
+    auto value = PadllConfiguration::get_value (option_space_weight_env,
+        padll_configuration ().get_space_weight ());
 
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
+    return (value == nullptr) ? option_default_space_weight : std::strtoull (value, nullptr, 10);
+}
 
-    // enforce read request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::read),
-        static_cast<int> (paio::core::POSIX_META::data_op),
-        counter);
+// space_payload call. (...)
+size_t LdPreloadedPosix::space_payload (const off_t& length) const
+{
+    if (this->m_space_weight == 0 || length <= 0) {
+        return 1;
+    }
 
-    // perform original POSIX read operation
-    ssize_t result = m_data_operations.m_read (fd, buf, counter);
+    return static_cast<size_t> (1 + static_cast<uint64_t> (length) / this->m_space_weight);
+}
 
-    // update statistic entry
-    this->update_statistics (OperationType::data_calls,
-        static_cast<int> (Data::read),
-        result,
-        enforced);
+// get_io_uring_hold_back call. (...)
+bool LdPreloadedPosix::get_io_uring_hold_back ()
+{
+    auto value = PadllConfiguration::get_value (option_io_uring_hold_back_env,
+        padll_configuration ().get_io_uring_hold_back ());
 
-    return result;
+    return (value == nullptr) ? option_default_io_uring_hold_back
+                              : (std::string_view { value } == "true");
 }
 
-// ld_preloaded_posix_write call.
-ssize_t LdPreloadedPosix::ld_preloaded_posix_write (int fd, const void* buf, size_t counter)
+// get_mmap_sampling_interval call. (...)
+std::chrono::milliseconds LdPreloadedPosix::get_mmap_sampling_interval () const
 {
-    // hook POSIX write operation to m_data_operations.m_write
-    this->m_dlsym_hook.hook_posix_write (m_data_operations.m_write);
-
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
+    auto value = PadllConfiguration::get_value (option_mmap_sampling_interval_env,
+        padll_configuration ().get_mmap_sampling_interval ());
+    long interval = option_default_mmap_sampling_interval;
+
+    if (value != nullptr) {
+        try {
+            interval = std::stol (value);
+        } catch (...) {
+            this->m_log->log_error ("Invalid mmap sampling interval (" + std::string { value }
+                + "); sampling disabled.");
+            interval = 0;
+        }
+    }
 
-    // enforce write request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::write),
-        static_cast<int> (paio::core::POSIX_META::data_op),
-        counter);
+    if (interval <= 0) {
+        return std::chrono::milliseconds { 0 };
+    }
 
-    // perform original POSIX write operation
-    ssize_t result = m_data_operations.m_write (fd, buf, counter);
+    // mappings are only registered by intercepted mmap calls, so sampling would never charge them
+    if (!padll_configuration ().is_intercepted (PosixCall::mmap)) {
+        this->m_log->log_error (
+            "mmap sampling requires mmap to be intercepted; sampling disabled.");
+        return std::chrono::milliseconds { 0 };
+    }
 
-    // update statistic entry
-    this->update_statistics (OperationType::data_calls,
-        static_cast<int> (Data::write),
-        result,
-        enforced);
+    // pages faulted in since the last sample of a mapping are only charged by intercepted munmap
+    if (!padll_configuration ().is_intercepted (PosixCall::munmap)) {
+        this->m_log->log_error ("munmap is not intercepted; pages faulted in since the last sample "
+                                "of a mapping are not charged when it is unmapped.");
+    }
 
-    return result;
+    return std::chrono::milliseconds { interval };
 }
 
-// ld_preloaded_posix_pread call.
-ssize_t LdPreloadedPosix::ld_preloaded_posix_pread (int fd, void* buf, size_t counter, off_t offset)
+// add_request_charge call. (...)
+bool LdPreloadedPosix::add_request_charge (RequestBatch& batch, const RequestCharge& charge)
 {
-    // hook POSIX pread operation to m_data_operations.m_pread
-    this->m_dlsym_hook.hook_posix_pread (m_data_operations.m_pread);
+    auto end = batch.m_charges.begin () + batch.m_size;
+    auto iterator = std::find_if (batch.m_charges.begin (), end, [&] (const RequestCharge& entry) {
+        return entry.m_workflow_id == charge.m_workflow_id
+            && entry.m_operation == charge.m_operation;
+    });
+
+    if (iterator != end) {
+        iterator->m_payload += charge.m_payload;
+        return true;
+    } else if (batch.m_size == batch.m_charges.size ()) {
+        return false;
+    }
 
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
+    batch.m_charges[batch.m_size++] = charge;
+    return true;
+}
 
-    // enforce pread request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::pread),
-        static_cast<int> (paio::core::POSIX_META::data_op),
-        counter);
+// enforce_request_batch call. (...)
+bool LdPreloadedPosix::enforce_request_batch (const std::string_view& function_name,
+    RequestBatch& batch)
+{
+    bool enforced = false;
+    for (size_t i = 0; i < batch.m_size; i++) {
+        const auto& charge = batch.m_charges[i];
+        enforced |= this->enforce_request (function_name,
+            charge.m_workflow_id,
+            charge.m_operation,
+            charge.m_context,
+            charge.m_payload);
+    }
+    batch.m_size = 0;
 
-    // perform original POSIX pread operation
-    ssize_t result = m_data_operations.m_pread (fd, buf, counter, offset);
+    return enforced;
+}
 
-    // update statistic entry
-    this->update_statistics (OperationType::data_calls,
-        static_cast<int> (Data::pread),
-        result,
-        enforced);
+// charge_mapped_pages call. (...)
+bool LdPreloadedPosix::charge_mapped_pages (const std::vector<MmapCharge>& charges)
+{
+    const auto mmap_name = posix_call_names[static_cast<std::size_t> (PosixCall::mmap)];
+    RequestBatch batch {};
+    bool enforced = false;
+    uint64_t bytes = 0;
+
+    for (const auto& charge : charges) {
+        RequestCharge request { charge.m_workflow_id,
+            static_cast<int> (paio::core::POSIX::read),
+            static_cast<int> (paio::core::POSIX_META::data_op),
+            charge.m_bytes };
+
+        // enforce the aggregated charges as soon as the batch is full
+        if (!LdPreloadedPosix::add_request_charge (batch, request)) {
+            enforced |= this->enforce_request_batch (mmap_name, batch);
+            LdPreloadedPosix::add_request_charge (batch, request);
+        }
+        bytes += charge.m_bytes;
+    }
+    enforced |= this->enforce_request_batch (mmap_name, batch);
 
-    return result;
+    // faulted in bytes are accounted in the mmap entry, without counting further operations
+    if (enforced && this->m_collect) {
+        this->m_data_stats.update_statistic_entry (static_cast<int> (Data::mmap), 0, bytes);
+    }
+
+    return enforced;
 }
 
-// ld_preloaded_posix_pwrite call.
-ssize_t
-LdPreloadedPosix::ld_preloaded_posix_pwrite (int fd, const void* buf, size_t counter, off_t offset)
+// start_mmap_sampler call. (...)
+void LdPreloadedPosix::start_mmap_sampler ()
 {
-    // hook POSIX pwrite operation to m_data_operations.m_pwrite
-    this->m_dlsym_hook.hook_posix_pwrite (m_data_operations.m_pwrite);
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_mmap_sampler_lock);
 
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
-
-    // enforce pwrite request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::pwrite),
-        static_cast<int> (paio::core::POSIX_META::data_op),
-        counter);
+    if (this->m_mmap_sampler_running && this->m_mmap_sampler_pid == ::getpid ()) {
+        return;
+    }
 
-    // perform original POSIX pwrite operation
-    ssize_t result = m_data_operations.m_pwrite (fd, buf, counter, offset);
+    // a forked child does not own the parent's sampler thread
+    if (this->m_mmap_sampler.joinable ()) {
+        this->m_mmap_sampler.detach ();
+    }
 
-    // update statistic entry
-    this->update_statistics (OperationType::data_calls,
-        static_cast<int> (Data::pwrite),
-        result,
-        enforced);
+    this->m_mmap_sampler_running = true;
+    this->m_mmap_sampler_pid = ::getpid ();
+    this->m_mmap_sampler = std::thread (&LdPreloadedPosix::run_mmap_sampler, this);
 
-    return result;
+    this->m_log->log_info ("Sampling file-backed mappings every "
+        + std::to_string (this->m_mmap_sampling_interval.count ()) + " ms.");
 }
 
-// ld_preloaded_posix_pread64 call.
-#if defined(__USE_LARGEFILE64)
-ssize_t
-LdPreloadedPosix::ld_preloaded_posix_pread64 (int fd, void* buf, size_t counter, off64_t offset)
+// stop_mmap_sampler call. (...)
+void LdPreloadedPosix::stop_mmap_sampler ()
 {
-    // hook POSIX pread64 operation to m_data_operations.m_pread64
-    this->m_dlsym_hook.hook_posix_pread64 (m_data_operations.m_pread64);
-
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
-
-    // enforce pread64 request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::pread64),
-        static_cast<int> (paio::core::POSIX_META::data_op),
-        counter);
-
-    // perform original POSIX pread64 operation
-    ssize_t result = m_data_operations.m_pread64 (fd, buf, counter, offset);
+    {
+        // unique_lock over mutex
+        std::unique_lock lock (this->m_mmap_sampler_lock);
+        if (!this->m_mmap_sampler_running) {
+            return;
+        }
+        this->m_mmap_sampler_running = false;
+    }
 
-    // update statistic entry
-    this->update_statistics (OperationType::data_calls,
-        static_cast<int> (Data::pread64),
-        result,
-        enforced);
+    // a forked child does not own the sampler thread
+    if (::getpid () != this->m_mmap_sampler_pid) {
+        this->m_mmap_sampler.detach ();
+        return;
+    }
 
-    return result;
+    this->m_mmap_sampler_cv.notify_all ();
+    if (this->m_mmap_sampler.joinable ()) {
+        this->m_mmap_sampler.join ();
+    }
 }
-#endif
 
-// ld_preloaded_posix_pwrite64 call.
-#if defined(__USE_LARGEFILE64)
-ssize_t LdPreloadedPosix::ld_preloaded_posix_pwrite64 (int fd,
-    const void* buf,
-    size_t counter,
-    off64_t offset)
+// run_mmap_sampler call. (...)
+void LdPreloadedPosix::run_mmap_sampler ()
 {
-    // hook POSIX pwrite64 operation to m_data_operations.m_pwrite64
-    this->m_dlsym_hook.hook_posix_pwrite64 (m_data_operations.m_pwrite64);
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_mmap_sampler_lock);
+
+    while (this->m_mmap_sampler_running) {
+        this->m_mmap_sampler_cv.wait_for (lock, this->m_mmap_sampling_interval, [this] () {
+            return !this->m_mmap_sampler_running;
+        });
+        if (!this->m_mmap_sampler_running) {
+            break;
+        }
 
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
+        // the charges are enforced without holding the lock, as they may wait for budget
+        lock.unlock ();
+        auto charges = this->m_mmap_table.sample ();
+        if (!charges.empty ()) {
+            this->charge_mapped_pages (charges);
+        }
+        lock.lock ();
+    }
+}
 
-    // enforce pwrite64 request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::pwrite64),
-        static_cast<int> (paio::core::POSIX_META::data_op),
-        counter);
+// update_batch_statistics call. (...)
+void LdPreloadedPosix::update_batch_statistics (const int& operation,
+    const bool& failed,
+    const uint64_t& requests,
+    const uint64_t& bytes,
+    const bool& enforced)
+{
+    if (this->m_collect) {
+        if (failed) {
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
+        } else if (enforced) {
+            this->m_data_stats.update_statistic_entry (operation, requests, bytes);
+        } else {
+            this->m_data_stats.update_bypassed_statistic_entry (operation, requests);
+        }
 
-    // perform original POSIX pwrite64 operation
-    ssize_t result = m_data_operations.m_pwrite64 (fd, buf, counter, offset);
+        // record the latency of each phase of the intercepted call
+        if (this->m_collect_latency) {
+            this->update_latency (OperationType::data_calls, operation);
+        }
+    }
+}
 
-    // update statistic entry
-    this->update_statistics (OperationType::data_calls,
-        static_cast<int> (Data::pwrite64),
-        result,
-        enforced);
+// enforce_io_uring_submissions call. (...)
+bool LdPreloadedPosix::enforce_io_uring_submissions (const int& ring_fd,
+    const unsigned& first,
+    const unsigned& count,
+    uint64_t& bytes)
+{
+    bool enforced = false;
+    RequestBatch batch {};
+
+    unsigned handled = 0;
+    while (handled < count) {
+        // aggregate the charges of the SQEs while the SQ ring is locked (until the batch is full)
+        auto visited = this->m_io_uring_table.for_each_submission (ring_fd,
+            first + handled,
+            count - handled,
+            [&] (const IoUringSubmission& submission) {
+                auto charge = io_uring_classifier (submission);
+                if (charge.m_operation == static_cast<int> (paio::core::POSIX::no_op)
+                    || submission.m_fixed_file) {
+                    return true;
+                }
+
+                // select the workflow-id of the SQE (openat is classified by its path)
+                charge.m_workflow_id = (submission.m_operation == IoUringOperation::kOpenat)
+                    ? this->select_workflow<KeyKind::kDirectoryPath> (
+                        std::make_pair (submission.m_fd, submission.m_path))
+                    : this->select_workflow<KeyKind::kFileDescriptor> (submission.m_fd);
+                if (charge.m_workflow_id == static_cast<uint32_t> (-1)) {
+                    return true;
+                }
+
+                // the SQE is handled in the next round (after enforcing the batch)
+                if (!LdPreloadedPosix::add_request_charge (batch, charge)) {
+                    return false;
+                }
+
+                if (charge.m_context == static_cast<int> (paio::core::POSIX_META::data_op)) {
+                    bytes += charge.m_payload;
+                }
+                return true;
+            });
+
+        // submit the aggregated requests to the PAIO data plane stage (outside the SQ ring's lock)
+        enforced |= this->enforce_request_batch (descriptors::io_uring_enter::name (), batch);
+
+        // the instance was removed, or no SQE could be handled
+        if (visited == 0) {
+            break;
+        }
+        handled += visited;
+    }
 
-    return result;
+    return enforced;
 }
-#endif
+
+// ld_preloaded_posix_read call.
+ssize_t LdPreloadedPosix::ld_preloaded_posix_read (int fd, void* buf, size_t counter)
+{
+    // hook POSIX read operation to m_data_operations.m_read
+    this->m_dlsym_hook.hook_posix_read (m_data_operations.m_read);
+
+    // submit read request through the interception pipeline
+    return this->intercept<descriptors::read> (fd,
+        counter,
+        m_data_operations.m_read,
+        fd,
+        buf,
+        counter);
+}
+
+// ld_preloaded_posix_write call.
+ssize_t LdPreloadedPosix::ld_preloaded_posix_write (int fd, const void* buf, size_t counter)
+{
+    // hook POSIX write operation to m_data_operations.m_write
+    this->m_dlsym_hook.hook_posix_write (m_data_operations.m_write);
+
+    // submit write request through the interception pipeline
+    return this->intercept<descriptors::write> (fd,
+        counter,
+        m_data_operations.m_write,
+        fd,
+        buf,
+        counter);
+}
+
+// ld_preloaded_posix_pread call.
+ssize_t LdPreloadedPosix::ld_preloaded_posix_pread (int fd, void* buf, size_t counter, off_t offset)
+{
+    // hook POSIX pread operation to m_data_operations.m_pread
+    this->m_dlsym_hook.hook_posix_pread (m_data_operations.m_pread);
+
+    // submit pread request through the interception pipeline
+    return this->intercept<descriptors::pread> (fd,
+        counter,
+        m_data_operations.m_pread,
+        fd,
+        buf,
+        counter,
+        offset);
+}
+
+// ld_preloaded_posix_pwrite call.
+ssize_t
+LdPreloadedPosix::ld_preloaded_posix_pwrite (int fd, const void* buf, size_t counter, off_t offset)
+{
+    // hook POSIX pwrite operation to m_data_operations.m_pwrite
+    this->m_dlsym_hook.hook_posix_pwrite (m_data_operations.m_pwrite);
+
+    // submit pwrite request through the interception pipeline
+    return this->intercept<descriptors::pwrite> (fd,
+        counter,
+        m_data_operations.m_pwrite,
+        fd,
+        buf,
+        counter,
+        offset);
+}
+
+// ld_preloaded_posix_pread64 call.
+#if defined(__USE_LARGEFILE64)
+ssize_t
+LdPreloadedPosix::ld_preloaded_posix_pread64 (int fd, void* buf, size_t counter, off64_t offset)
+{
+    // hook POSIX pread64 operation to m_data_operations.m_pread64
+    this->m_dlsym_hook.hook_posix_pread64 (m_data_operations.m_pread64);
+
+    // submit pread64 request through the interception pipeline
+    return this->intercept<descriptors::pread64> (fd,
+        counter,
+        m_data_operations.m_pread64,
+        fd,
+        buf,
+        counter,
+        offset);
+}
+#endif
+
+// ld_preloaded_posix_pwrite64 call.
+#if defined(__USE_LARGEFILE64)
+ssize_t LdPreloadedPosix::ld_preloaded_posix_pwrite64 (int fd,
+    const void* buf,
+    size_t counter,
+    off64_t offset)
+{
+    // hook POSIX pwrite64 operation to m_data_operations.m_pwrite64
+    this->m_dlsym_hook.hook_posix_pwrite64 (m_data_operations.m_pwrite64);
+
+    // submit pwrite64 request through the interception pipeline
+    return this->intercept<descriptors::pwrite64> (fd,
+        counter,
+        m_data_operations.m_pwrite64,
+        fd,
+        buf,
+        counter,
+        offset);
+}
+#endif
 
 // ld_preloaded_posix_mmap call.
 void* LdPreloadedPosix::ld_preloaded_posix_mmap (void* addr,
@@ -526,6 +1059,9 @@ void* LdPreloadedPosix::ld_preloaded_posix_mmap (void* addr,
     int fd,
     off_t offset)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX mmap operation to m_data_operations.m_mmap
     this->m_dlsym_hook.hook_posix_mmap (m_data_operations.m_mmap);
 
@@ -545,6 +1081,13 @@ void* LdPreloadedPosix::ld_preloaded_posix_mmap (void* addr,
     // validate memory pointer
     auto result = (mem_ptr == MAP_FAILED) ? -1 : 0;
 
+    // sample file-backed mappings over registered mount points, to charge their faulted in pages
+    if (this->m_mmap_sampling_interval.count () > 0 && result == 0
+        && (flags & MAP_ANONYMOUS) == 0 && this->is_file_descriptor_tracked (fd)
+        && this->m_mmap_table.register_mapping (mem_ptr, lenght, workflow_id)) {
+        this->start_mmap_sampler ();
+    }
+
     // update statistic entry
     this->update_statistics (OperationType::data_calls,
         static_cast<int> (Data::mmap),
@@ -557,6 +1100,9 @@ void* LdPreloadedPosix::ld_preloaded_posix_mmap (void* addr,
 // ld_preloaded_posix_munmap call.
 int LdPreloadedPosix::ld_preloaded_posix_munmap (void* addr, size_t lenght)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX munmap operation to m_data_operations.m_munmap
     this->m_dlsym_hook.hook_posix_munmap (m_data_operations.m_munmap);
 
@@ -572,9 +1118,23 @@ int LdPreloadedPosix::ld_preloaded_posix_munmap (void* addr, size_t lenght)
         static_cast<int> (paio::core::POSIX_META::data_op),
         1);
 
+    // charge the pages of sampled mappings that were faulted in since their previous sample
+    auto sampled = !this->m_mmap_table.is_empty ();
+    if (sampled) {
+        auto charges = this->m_mmap_table.sample_mappings (addr, lenght);
+        if (!charges.empty ()) {
+            this->charge_mapped_pages (charges);
+        }
+    }
+
     // perform original POSIX write operation
     auto result = m_data_operations.m_munmap (addr, lenght);
 
+    // mappings are only dropped once unmapped (failed calls keep them, already sampled)
+    if (sampled && result == 0) {
+        this->m_mmap_table.remove_mappings (addr, lenght);
+    }
+
     // update statistic entry
     this->update_statistics (OperationType::data_calls,
         static_cast<int> (Data::munmap),
@@ -584,9 +1144,488 @@ int LdPreloadedPosix::ld_preloaded_posix_munmap (void* addr, size_t lenght)
     return result;
 }
 
+// ld_preloaded_posix_readv call.
+// NOTE: changed POSIX::readv classifier to POSIX::read
+ssize_t LdPreloadedPosix::ld_preloaded_posix_readv (int fd, const struct iovec* iov, int iovcnt)
+{
+    // hook POSIX readv operation to m_data_operations.m_readv
+    this->m_dlsym_hook.hook_posix_readv (m_data_operations.m_readv);
+
+    // submit readv request through the interception pipeline
+    return this->intercept<descriptors::readv> (fd,
+        iovec_length (iov, iovcnt),
+        m_data_operations.m_readv,
+        fd,
+        iov,
+        iovcnt);
+}
+
+// ld_preloaded_posix_writev call.
+// NOTE: changed POSIX::writev classifier to POSIX::write
+ssize_t LdPreloadedPosix::ld_preloaded_posix_writev (int fd, const struct iovec* iov, int iovcnt)
+{
+    // hook POSIX writev operation to m_data_operations.m_writev
+    this->m_dlsym_hook.hook_posix_writev (m_data_operations.m_writev);
+
+    // submit writev request through the interception pipeline
+    return this->intercept<descriptors::writev> (fd,
+        iovec_length (iov, iovcnt),
+        m_data_operations.m_writev,
+        fd,
+        iov,
+        iovcnt);
+}
+
+// ld_preloaded_posix_preadv call.
+// NOTE: changed POSIX::preadv classifier to POSIX::pread
+ssize_t LdPreloadedPosix::ld_preloaded_posix_preadv (int fd,
+    const struct iovec* iov,
+    int iovcnt,
+    off_t offset)
+{
+    // hook POSIX preadv operation to m_data_operations.m_preadv
+    this->m_dlsym_hook.hook_posix_preadv (m_data_operations.m_preadv);
+
+    // submit preadv request through the interception pipeline
+    return this->intercept<descriptors::preadv> (fd,
+        iovec_length (iov, iovcnt),
+        m_data_operations.m_preadv,
+        fd,
+        iov,
+        iovcnt,
+        offset);
+}
+
+// ld_preloaded_posix_pwritev call.
+// NOTE: changed POSIX::pwritev classifier to POSIX::pwrite
+ssize_t LdPreloadedPosix::ld_preloaded_posix_pwritev (int fd,
+    const struct iovec* iov,
+    int iovcnt,
+    off_t offset)
+{
+    // hook POSIX pwritev operation to m_data_operations.m_pwritev
+    this->m_dlsym_hook.hook_posix_pwritev (m_data_operations.m_pwritev);
+
+    // submit pwritev request through the interception pipeline
+    return this->intercept<descriptors::pwritev> (fd,
+        iovec_length (iov, iovcnt),
+        m_data_operations.m_pwritev,
+        fd,
+        iov,
+        iovcnt,
+        offset);
+}
+
+// ld_preloaded_posix_preadv2 call.
+// NOTE: changed POSIX::preadv2 classifier to POSIX::pread
+ssize_t LdPreloadedPosix::ld_preloaded_posix_preadv2 (int fd,
+    const struct iovec* iov,
+    int iovcnt,
+    off_t offset,
+    int flags)
+{
+    // hook POSIX preadv2 operation to m_data_operations.m_preadv2
+    this->m_dlsym_hook.hook_posix_preadv2 (m_data_operations.m_preadv2);
+
+    // submit preadv2 request through the interception pipeline
+    return this->intercept<descriptors::preadv2> (fd,
+        iovec_length (iov, iovcnt),
+        m_data_operations.m_preadv2,
+        fd,
+        iov,
+        iovcnt,
+        offset,
+        flags);
+}
+
+// ld_preloaded_posix_pwritev2 call.
+// NOTE: changed POSIX::pwritev2 classifier to POSIX::pwrite
+ssize_t LdPreloadedPosix::ld_preloaded_posix_pwritev2 (int fd,
+    const struct iovec* iov,
+    int iovcnt,
+    off_t offset,
+    int flags)
+{
+    // hook POSIX pwritev2 operation to m_data_operations.m_pwritev2
+    this->m_dlsym_hook.hook_posix_pwritev2 (m_data_operations.m_pwritev2);
+
+    // submit pwritev2 request through the interception pipeline
+    return this->intercept<descriptors::pwritev2> (fd,
+        iovec_length (iov, iovcnt),
+        m_data_operations.m_pwritev2,
+        fd,
+        iov,
+        iovcnt,
+        offset,
+        flags);
+}
+
+// ld_preloaded_posix_fread call.
+// NOTE: changed POSIX::fread classifier to POSIX::read
+size_t LdPreloadedPosix::ld_preloaded_posix_fread (void* buffer,
+    size_t size,
+    size_t nmemb,
+    FILE* stream)
+{
+    // hook POSIX fread operation to m_data_operations.m_fread
+    this->m_dlsym_hook.hook_posix_fread (m_data_operations.m_fread);
+
+    // submit fread request through the stream interception pipeline
+    return this->intercept_stream<descriptors::fread> (stream,
+        [size] (size_t result) { return static_cast<ssize_t> (result * size); },
+        m_data_operations.m_fread,
+        buffer,
+        size,
+        nmemb,
+        stream);
+}
+
+// ld_preloaded_posix_fwrite call.
+// NOTE: changed POSIX::fwrite classifier to POSIX::write
+size_t LdPreloadedPosix::ld_preloaded_posix_fwrite (const void* buffer,
+    size_t size,
+    size_t nmemb,
+    FILE* stream)
+{
+    // hook POSIX fwrite operation to m_data_operations.m_fwrite
+    this->m_dlsym_hook.hook_posix_fwrite (m_data_operations.m_fwrite);
+
+    // submit fwrite request through the stream interception pipeline
+    return this->intercept_stream<descriptors::fwrite> (stream,
+        [size] (size_t result) { return static_cast<ssize_t> (result * size); },
+        m_data_operations.m_fwrite,
+        buffer,
+        size,
+        nmemb,
+        stream);
+}
+
+// ld_preloaded_posix_fgets call.
+// NOTE: changed POSIX::fgets classifier to POSIX::read
+char* LdPreloadedPosix::ld_preloaded_posix_fgets (char* buffer, int size, FILE* stream)
+{
+    // hook POSIX fgets operation to m_data_operations.m_fgets
+    this->m_dlsym_hook.hook_posix_fgets (m_data_operations.m_fgets);
+
+    // submit fgets request through the stream interception pipeline
+    return this->intercept_stream<descriptors::fgets> (stream,
+        [] (char* result) {
+            return static_cast<ssize_t> ((result != nullptr) ? std::strlen (result) : 0);
+        },
+        m_data_operations.m_fgets,
+        buffer,
+        size,
+        stream);
+}
+
+// ld_preloaded_posix_fputs call.
+// NOTE: changed POSIX::fputs classifier to POSIX::write
+int LdPreloadedPosix::ld_preloaded_posix_fputs (const char* buffer, FILE* stream)
+{
+    // hook POSIX fputs operation to m_data_operations.m_fputs
+    this->m_dlsym_hook.hook_posix_fputs (m_data_operations.m_fputs);
+
+    // submit fputs request through the stream interception pipeline
+    return this->intercept_stream<descriptors::fputs> (stream,
+        [buffer] (int result) {
+            return (result >= 0) ? static_cast<ssize_t> (std::strlen (buffer)) : -1;
+        },
+        m_data_operations.m_fputs,
+        buffer,
+        stream);
+}
+
+// ld_preloaded_posix_fprintf call.
+// NOTE: changed POSIX::fprintf classifier to POSIX::write
+int LdPreloadedPosix::ld_preloaded_posix_fprintf (FILE* stream, const char* format, va_list args)
+{
+    // hook POSIX vfprintf operation to m_data_operations.m_vfprintf
+    this->m_dlsym_hook.hook_posix_vfprintf (m_data_operations.m_vfprintf);
+
+    // submit fprintf request through the stream interception pipeline
+    return this->intercept_stream<descriptors::fprintf> (stream,
+        [] (int result) { return static_cast<ssize_t> (result); },
+        m_data_operations.m_vfprintf,
+        stream,
+        format,
+        args);
+}
+
+// ld_preloaded_posix_vfprintf call.
+// NOTE: changed POSIX::vfprintf classifier to POSIX::write
+int LdPreloadedPosix::ld_preloaded_posix_vfprintf (FILE* stream, const char* format, va_list args)
+{
+    // hook POSIX vfprintf operation to m_data_operations.m_vfprintf
+    this->m_dlsym_hook.hook_posix_vfprintf (m_data_operations.m_vfprintf);
+
+    // submit vfprintf request through the stream interception pipeline
+    return this->intercept_stream<descriptors::vfprintf> (stream,
+        [] (int result) { return static_cast<ssize_t> (result); },
+        m_data_operations.m_vfprintf,
+        stream,
+        format,
+        args);
+}
+
+// ld_preloaded_posix_fflush call.
+// NOTE: changed POSIX::fflush classifier to POSIX::write
+int LdPreloadedPosix::ld_preloaded_posix_fflush (FILE* stream)
+{
+    // hook POSIX fflush operation to m_data_operations.m_fflush
+    this->m_dlsym_hook.hook_posix_fflush (m_data_operations.m_fflush);
+
+    // submit fflush request through the stream interception pipeline
+    return this->intercept_stream<descriptors::fflush> (stream,
+        [] (int result) { return (result == 0) ? ssize_t { 0 } : ssize_t { -1 }; },
+        m_data_operations.m_fflush,
+        stream);
+}
+
+// ld_preloaded_posix_copy_file_range call.
+ssize_t LdPreloadedPosix::ld_preloaded_posix_copy_file_range (int fd_in,
+    off64_t* off_in,
+    int fd_out,
+    off64_t* off_out,
+    size_t len,
+    unsigned int flags)
+{
+    // hook POSIX copy_file_range operation to m_data_operations.m_copy_file_range
+    this->m_dlsym_hook.hook_posix_copy_file_range (m_data_operations.m_copy_file_range);
+
+    // submit copy_file_range request through the transfer interception pipeline
+    return this->intercept_transfer<descriptors::copy_file_range> (fd_in,
+        fd_out,
+        len,
+        [&] (const size_t& chunk) {
+            return m_data_operations.m_copy_file_range (fd_in,
+                off_in,
+                fd_out,
+                off_out,
+                chunk,
+                flags);
+        });
+}
+
+// ld_preloaded_posix_sendfile call.
+ssize_t LdPreloadedPosix::ld_preloaded_posix_sendfile (int out_fd,
+    int in_fd,
+    off_t* offset,
+    size_t count)
+{
+    // hook POSIX sendfile operation to m_data_operations.m_sendfile
+    this->m_dlsym_hook.hook_posix_sendfile (m_data_operations.m_sendfile);
+
+    // submit sendfile request through the transfer interception pipeline
+    return this->intercept_transfer<descriptors::sendfile> (in_fd,
+        out_fd,
+        count,
+        [&] (const size_t& chunk) {
+            return m_data_operations.m_sendfile (out_fd, in_fd, offset, chunk);
+        });
+}
+
+// ld_preloaded_posix_sendfile64 call.
+ssize_t LdPreloadedPosix::ld_preloaded_posix_sendfile64 (int out_fd,
+    int in_fd,
+    off64_t* offset,
+    size_t count)
+{
+    // hook POSIX sendfile64 operation to m_data_operations.m_sendfile64
+    this->m_dlsym_hook.hook_posix_sendfile64 (m_data_operations.m_sendfile64);
+
+    // submit sendfile64 request through the transfer interception pipeline
+    return this->intercept_transfer<descriptors::sendfile64> (in_fd,
+        out_fd,
+        count,
+        [&] (const size_t& chunk) {
+            return m_data_operations.m_sendfile64 (out_fd, in_fd, offset, chunk);
+        });
+}
+
+// ld_preloaded_posix_splice call.
+ssize_t LdPreloadedPosix::ld_preloaded_posix_splice (int fd_in,
+    off64_t* off_in,
+    int fd_out,
+    off64_t* off_out,
+    size_t len,
+    unsigned int flags)
+{
+    // hook POSIX splice operation to m_data_operations.m_splice
+    this->m_dlsym_hook.hook_posix_splice (m_data_operations.m_splice);
+
+    // submit splice request through the transfer interception pipeline
+    return this->intercept_transfer<descriptors::splice> (fd_in,
+        fd_out,
+        len,
+        [&] (const size_t& chunk) {
+            return m_data_operations.m_splice (fd_in, off_in, fd_out, off_out, chunk, flags);
+        });
+}
+
+// ld_preloaded_posix_io_uring_enter call.
+// NOTE: SQEs are charged individually (see enforce_io_uring_submissions); by default, they are
+// enforced after being consumed by the kernel, unless m_io_uring_hold_back is set
+int LdPreloadedPosix::ld_preloaded_posix_io_uring_enter (unsigned int fd,
+    unsigned int to_submit,
+    unsigned int min_complete,
+    unsigned int flags,
+    const void* arg,
+    size_t argsz)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX io_uring_enter operation to m_data_operations.m_io_uring_enter
+    this->m_dlsym_hook.hook_posix_io_uring_enter (m_data_operations.m_io_uring_enter);
+
+    // registered ring descriptors are an index of the submitting task (not a file descriptor)
+    auto ring_fd = static_cast<int> (fd);
+    std::optional<std::pair<unsigned, unsigned>> window {};
+    if (to_submit > 0 && (flags & IORING_ENTER_REGISTERED_RING) == 0
+        && !this->m_io_uring_table.is_empty ()) {
+        window = this->m_io_uring_table.submission_window (ring_fd);
+    }
+
+    bool enforced = false;
+    uint64_t bytes = 0;
+
+    // enforce the pending SQEs before they are submitted to the kernel
+    if (window.has_value () && this->m_io_uring_hold_back) {
+        enforced = this->enforce_io_uring_submissions (ring_fd,
+            window->first,
+            std::min (window->second, to_submit),
+            bytes);
+    }
+
+    // perform original POSIX io_uring_enter operation
+    auto result = static_cast<int> (m_data_operations.m_io_uring_enter (SYS_io_uring_enter,
+        fd,
+        to_submit,
+        min_complete,
+        flags,
+        arg,
+        argsz));
+
+    // enforce the SQEs consumed by the kernel (the next submissions are throttled)
+    if (window.has_value () && !this->m_io_uring_hold_back && result > 0) {
+        enforced = this->enforce_io_uring_submissions (ring_fd,
+            window->first,
+            static_cast<unsigned> (result),
+            bytes);
+    }
+
+    // update statistic entry (each submitted SQE is accounted as an operation)
+    if constexpr (option_pipeline_statistics) {
+        this->update_batch_statistics (descriptors::io_uring_enter::entry,
+            result < 0,
+            (result < 0) ? 0 : static_cast<uint64_t> (result),
+            bytes,
+            enforced);
+    }
+
+    return result;
+}
+
+// ld_preloaded_posix_aio_read call.
+int LdPreloadedPosix::ld_preloaded_posix_aio_read (struct aiocb* aiocbp)
+{
+    // hook POSIX aio_read operation to m_data_operations.m_aio_read
+    this->m_dlsym_hook.hook_posix_aio_read (m_data_operations.m_aio_read);
+
+    // submit aio_read request through the AIO interception pipeline
+    return this->intercept_aio<descriptors::aio_read> (&aiocbp,
+        1,
+        m_data_operations.m_aio_read,
+        aiocbp);
+}
+
+// ld_preloaded_posix_aio_write call.
+int LdPreloadedPosix::ld_preloaded_posix_aio_write (struct aiocb* aiocbp)
+{
+    // hook POSIX aio_write operation to m_data_operations.m_aio_write
+    this->m_dlsym_hook.hook_posix_aio_write (m_data_operations.m_aio_write);
+
+    // submit aio_write request through the AIO interception pipeline
+    return this->intercept_aio<descriptors::aio_write> (&aiocbp,
+        1,
+        m_data_operations.m_aio_write,
+        aiocbp);
+}
+
+// ld_preloaded_posix_aio_read64 call.
+int LdPreloadedPosix::ld_preloaded_posix_aio_read64 (struct aiocb64* aiocbp)
+{
+    // hook POSIX aio_read64 operation to m_data_operations.m_aio_read64
+    this->m_dlsym_hook.hook_posix_aio_read64 (m_data_operations.m_aio_read64);
+
+    // submit aio_read64 request through the AIO interception pipeline
+    return this->intercept_aio<descriptors::aio_read64> (&aiocbp,
+        1,
+        m_data_operations.m_aio_read64,
+        aiocbp);
+}
+
+// ld_preloaded_posix_aio_write64 call.
+int LdPreloadedPosix::ld_preloaded_posix_aio_write64 (struct aiocb64* aiocbp)
+{
+    // hook POSIX aio_write64 operation to m_data_operations.m_aio_write64
+    this->m_dlsym_hook.hook_posix_aio_write64 (m_data_operations.m_aio_write64);
+
+    // submit aio_write64 request through the AIO interception pipeline
+    return this->intercept_aio<descriptors::aio_write64> (&aiocbp,
+        1,
+        m_data_operations.m_aio_write64,
+        aiocbp);
+}
+
+// ld_preloaded_posix_lio_listio call.
+// NOTE: the whole list is classified and enforced at submission, with one request per workflow and
+// operation
+int LdPreloadedPosix::ld_preloaded_posix_lio_listio (int mode,
+    struct aiocb* const list[],
+    int nent,
+    struct sigevent* sig)
+{
+    // hook POSIX lio_listio operation to m_data_operations.m_lio_listio
+    this->m_dlsym_hook.hook_posix_lio_listio (m_data_operations.m_lio_listio);
+
+    // submit lio_listio request through the AIO interception pipeline
+    return this->intercept_aio<descriptors::lio_listio> (list,
+        nent,
+        m_data_operations.m_lio_listio,
+        mode,
+        list,
+        nent,
+        sig);
+}
+
+// ld_preloaded_posix_lio_listio64 call.
+// NOTE: the whole list is classified and enforced at submission, with one request per workflow and
+// operation
+int LdPreloadedPosix::ld_preloaded_posix_lio_listio64 (int mode,
+    struct aiocb64* const list[],
+    int nent,
+    struct sigevent* sig)
+{
+    // hook POSIX lio_listio64 operation to m_data_operations.m_lio_listio64
+    this->m_dlsym_hook.hook_posix_lio_listio64 (m_data_operations.m_lio_listio64);
+
+    // submit lio_listio64 request through the AIO interception pipeline
+    return this->intercept_aio<descriptors::lio_listio64> (list,
+        nent,
+        m_data_operations.m_lio_listio64,
+        mode,
+        list,
+        nent,
+        sig);
+}
+
 // ld_preloaded_posix_open call.
 int LdPreloadedPosix::ld_preloaded_posix_open (const char* path, int flags, mode_t mode)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX open operation to m_metadata_operations.m_open_var
     this->m_dlsym_hook.hook_posix_open_var (m_metadata_operations.m_open_var);
 
@@ -605,7 +1644,7 @@ int LdPreloadedPosix::ld_preloaded_posix_open (const char* path, int flags, mode
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fd,
-        path,
+        this->m_mount_point_table.resolve_path (AT_FDCWD, path),
         mountpoint,
         this->get_metadata_unit (path));
 
@@ -621,6 +1660,9 @@ int LdPreloadedPosix::ld_preloaded_posix_open (const char* path, int flags, mode
 // ld_preloaded_posix_open call.
 int LdPreloadedPosix::ld_preloaded_posix_open (const char* path, int flags)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX open operation to m_metadata_operations.m_open
     this->m_dlsym_hook.hook_posix_open (m_metadata_operations.m_open);
 
@@ -639,7 +1681,7 @@ int LdPreloadedPosix::ld_preloaded_posix_open (const char* path, int flags)
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fd,
-        path,
+        this->m_mount_point_table.resolve_path (AT_FDCWD, path),
         mountpoint,
         this->get_metadata_unit (path));
 
@@ -656,6 +1698,9 @@ int LdPreloadedPosix::ld_preloaded_posix_open (const char* path, int flags)
 // NOTE: changed POSIX::creat classifier to POSIX::open
 int LdPreloadedPosix::ld_preloaded_posix_creat (const char* path, mode_t mode)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX creat operation to m_metadata_operations.m_creat
     this->m_dlsym_hook.hook_posix_creat (m_metadata_operations.m_creat);
 
@@ -674,7 +1719,7 @@ int LdPreloadedPosix::ld_preloaded_posix_creat (const char* path, mode_t mode)
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fd,
-        path,
+        this->m_mount_point_table.resolve_path (AT_FDCWD, path),
         mountpoint,
         this->get_metadata_unit (path));
 
@@ -691,6 +1736,9 @@ int LdPreloadedPosix::ld_preloaded_posix_creat (const char* path, mode_t mode)
 // NOTE: changed POSIX::creat64 classifier to POSIX::open
 int LdPreloadedPosix::ld_preloaded_posix_creat64 (const char* path, mode_t mode)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX creat64 operation to m_metadata_operations.m_creat64
     this->m_dlsym_hook.hook_posix_creat64 (m_metadata_operations.m_creat64);
 
@@ -709,7 +1757,7 @@ int LdPreloadedPosix::ld_preloaded_posix_creat64 (const char* path, mode_t mode)
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fd,
-        path,
+        this->m_mount_point_table.resolve_path (AT_FDCWD, path),
         mountpoint,
         this->get_metadata_unit (path));
 
@@ -729,11 +1777,14 @@ int LdPreloadedPosix::ld_preloaded_posix_openat (int dirfd,
     int flags,
     mode_t mode)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX openat variadic operation to m_metadata_operations.m_openat_var
     this->m_dlsym_hook.hook_posix_openat_var (m_metadata_operations.m_openat_var);
 
     // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (dirfd, path);
 
     // enforce openat request to PAIO data plane stage
     auto enforced = this->enforce_request (__func__,
@@ -747,7 +1798,7 @@ int LdPreloadedPosix::ld_preloaded_posix_openat (int dirfd,
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fd,
-        path,
+        this->m_mount_point_table.resolve_path (dirfd, path),
         mountpoint,
         this->get_metadata_unit (path));
 
@@ -764,11 +1815,14 @@ int LdPreloadedPosix::ld_preloaded_posix_openat (int dirfd,
 // NOTE: changed POSIX::openat classifier to POSIX::open
 int LdPreloadedPosix::ld_preloaded_posix_openat (int dirfd, const char* path, int flags)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX openat operation to m_metadata_operations.m_openat
     this->m_dlsym_hook.hook_posix_openat (m_metadata_operations.m_openat);
 
     // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (dirfd, path);
 
     // enforce openat request to PAIO data plane stage
     auto enforced = this->enforce_request (__func__,
@@ -782,7 +1836,7 @@ int LdPreloadedPosix::ld_preloaded_posix_openat (int dirfd, const char* path, in
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fd,
-        path,
+        this->m_mount_point_table.resolve_path (dirfd, path),
         mountpoint,
         this->get_metadata_unit (path));
 
@@ -799,6 +1853,9 @@ int LdPreloadedPosix::ld_preloaded_posix_openat (int dirfd, const char* path, in
 // NOTE: changed POSIX::open64 classifier to POSIX::open
 int LdPreloadedPosix::ld_preloaded_posix_open64 (const char* path, int flags, mode_t mode)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX open64_var operation to m_metadata_operations.m_open64_var
     this->m_dlsym_hook.hook_posix_open64_variadic (m_metadata_operations.m_open64_var);
 
@@ -817,7 +1874,7 @@ int LdPreloadedPosix::ld_preloaded_posix_open64 (const char* path, int flags, mo
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fd,
-        path,
+        this->m_mount_point_table.resolve_path (AT_FDCWD, path),
         mountpoint,
         this->get_metadata_unit (path));
 
@@ -834,6 +1891,9 @@ int LdPreloadedPosix::ld_preloaded_posix_open64 (const char* path, int flags, mo
 // NOTE: changed POSIX::open64 classifier to POSIX::open
 int LdPreloadedPosix::ld_preloaded_posix_open64 (const char* path, int flags)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX open64 operation to m_metadata_operations.m_open64
     this->m_dlsym_hook.hook_posix_open64 (m_metadata_operations.m_open64);
 
@@ -852,7 +1912,7 @@ int LdPreloadedPosix::ld_preloaded_posix_open64 (const char* path, int flags)
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fd,
-        path,
+        this->m_mount_point_table.resolve_path (AT_FDCWD, path),
         mountpoint,
         this->get_metadata_unit (path));
 
@@ -868,6 +1928,9 @@ int LdPreloadedPosix::ld_preloaded_posix_open64 (const char* path, int flags)
 // ld_preloaded_posix_close call.
 int LdPreloadedPosix::ld_preloaded_posix_close (int fd)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX close operation to m_metadata_operations.m_close
     this->m_dlsym_hook.hook_posix_close (m_metadata_operations.m_close);
 
@@ -894,6 +1957,11 @@ int LdPreloadedPosix::ld_preloaded_posix_close (int fd)
         this->m_mount_point_table.remove_mount_point_entry (fd);
     }
 
+    // release PADLL's view of the io_uring instance (its mappings keep the instance alive)
+    if (result == 0 && !this->m_io_uring_table.is_empty ()) {
+        this->m_io_uring_table.remove_ring (fd);
+    }
+
     // update statistic entry
     this->update_statistics (OperationType::metadata_calls,
         static_cast<int> (Metadata::close),
@@ -906,14 +1974,23 @@ int LdPreloadedPosix::ld_preloaded_posix_close (int fd)
 // ld_preloaded_posix_sync call.
 void LdPreloadedPosix::ld_preloaded_posix_sync ()
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX sync operation to m_metadata_operations.m_sync
     this->m_dlsym_hook.hook_posix_sync (m_metadata_operations.m_sync);
 
-    // enforce sync request to PAIO data plane stage
-    // this->m_stage->enforce_request (this->m_mount_point_table.pick_workflow_id (path),
-    // static_cast<int> (paio::core::POSIX::sync),
-    //    static_cast<int> (paio::core::POSIX_META::meta_op),
-    //    1);
+    // sync flushes all file systems, so a sync request is enforced in a workflow of each mount
+    // point registered by the process
+    auto workflow_ids = this->m_mount_point_table.pick_workflow_ids ();
+    bool enforced = !workflow_ids.empty ();
+    for (const auto& workflow_id : workflow_ids) {
+        enforced &= this->enforce_request (__func__,
+            workflow_id,
+            static_cast<int> (paio::core::POSIX::sync),
+            static_cast<int> (descriptors::durability_op),
+            1);
+    }
 
     // perform original POSIX sync operation
     m_metadata_operations.m_sync ();
@@ -921,8 +1998,8 @@ void LdPreloadedPosix::ld_preloaded_posix_sync ()
     // update statistic entry
     this->update_statistics (OperationType::metadata_calls,
         static_cast<int> (Metadata::sync),
-        1,
-        true);
+        0,
+        enforced);
 }
 
 // ld_preloaded_posix_statfs call.
@@ -931,26 +2008,12 @@ int LdPreloadedPosix::ld_preloaded_posix_statfs (const char* path, struct statfs
     // hook POSIX statfs operation to m_metadata_operations.m_statfs
     this->m_dlsym_hook.hook_posix_statfs (m_metadata_operations.m_statfs);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
-
-    // enforce statfs request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::statfs),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
-
-    // perform original POSIX statfs operation
-    int result = m_metadata_operations.m_statfs (path, buf);
-
-    // update statistic entry
-    this->update_statistics (OperationType::metadata_calls,
-        static_cast<int> (Metadata::statfs),
-        result,
-        enforced);
-
-    return result;
+    // submit statfs request through the interception pipeline
+    return this->intercept<descriptors::statfs> (path,
+        1,
+        m_metadata_operations.m_statfs,
+        path,
+        buf);
 }
 
 // ld_preloaded_posix_fstatfs call.
@@ -959,26 +2022,8 @@ int LdPreloadedPosix::ld_preloaded_posix_fstatfs (int fd, struct statfs* buf)
     // hook POSIX fstatfs operation to m_metadata_operations.m_fstatfs
     this->m_dlsym_hook.hook_posix_fstatfs (m_metadata_operations.m_fstatfs);
 
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
-
-    // enforce fstatfs request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::fstatfs),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
-
-    // perform original POSIX fstatfs operation
-    int result = m_metadata_operations.m_fstatfs (fd, buf);
-
-    // update statistic entry
-    this->update_statistics (OperationType::metadata_calls,
-        static_cast<int> (Metadata::fstatfs),
-        result,
-        enforced);
-
-    return result;
+    // submit fstatfs request through the interception pipeline
+    return this->intercept<descriptors::fstatfs> (fd, 1, m_metadata_operations.m_fstatfs, fd, buf);
 }
 
 // ld_preloaded_posix_statfs64 call.
@@ -987,54 +2032,26 @@ int LdPreloadedPosix::ld_preloaded_posix_statfs64 (const char* path, struct stat
     // hook POSIX statfs64 operation to m_metadata_operations.m_statfs64
     this->m_dlsym_hook.hook_posix_statfs64 (m_metadata_operations.m_statfs64);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
-
-    // enforce statfs64 request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::statfs64),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
+    // submit statfs64 request through the interception pipeline
+    return this->intercept<descriptors::statfs64> (path,
+        1,
+        m_metadata_operations.m_statfs64,
+        path,
+        buf);
+}
 
-    // perform original POSIX statfs64 operation
-    int result = m_metadata_operations.m_statfs64 (path, buf);
+// ld_preloaded_posix_fstatfs64 call.
+int LdPreloadedPosix::ld_preloaded_posix_fstatfs64 (int fd, struct statfs64* buf)
+{
+    // hook POSIX fstatfs64 operation to m_metadata_operations.m_fstatfs64
+    this->m_dlsym_hook.hook_posix_fstatfs64 (m_metadata_operations.m_fstatfs64);
 
-    // update statistic entry
-    this->update_statistics (OperationType::metadata_calls,
-        static_cast<int> (Metadata::statfs64),
-        result,
-        enforced);
-
-    return result;
-}
-
-// ld_preloaded_posix_fstatfs64 call.
-int LdPreloadedPosix::ld_preloaded_posix_fstatfs64 (int fd, struct statfs64* buf)
-{
-    // hook POSIX fstatfs64 operation to m_metadata_operations.m_fstatfs64
-    this->m_dlsym_hook.hook_posix_fstatfs64 (m_metadata_operations.m_fstatfs64);
-
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
-
-    // enforce fstatfs64 request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::fstatfs64),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
-
-    // perform original POSIX fstatfs64 operation
-    int result = m_metadata_operations.m_fstatfs64 (fd, buf);
-
-    // update statistic entry
-    this->update_statistics (OperationType::metadata_calls,
-        static_cast<int> (Metadata::fstatfs64),
-        result,
-        enforced);
-
-    return result;
+    // submit fstatfs64 request through the interception pipeline
+    return this->intercept<descriptors::fstatfs64> (fd,
+        1,
+        m_metadata_operations.m_fstatfs64,
+        fd,
+        buf);
 }
 
 // ld_preloaded_posix_unlink call.
@@ -1043,26 +2060,8 @@ int LdPreloadedPosix::ld_preloaded_posix_unlink (const char* path)
     // hook POSIX unlink operation to m_metadata_operations.m_unlink
     this->m_dlsym_hook.hook_posix_unlink (m_metadata_operations.m_unlink);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
-
-    // enforce unlink request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::unlink),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
-
-    // perform original POSIX unlink operation
-    int result = m_metadata_operations.m_unlink (path);
-
-    // update statistic entry
-    this->update_statistics (OperationType::metadata_calls,
-        static_cast<int> (Metadata::unlink),
-        result,
-        enforced);
-
-    return result;
+    // submit unlink request through the interception pipeline
+    return this->intercept<descriptors::unlink> (path, 1, m_metadata_operations.m_unlink, path);
 }
 
 // ld_preloaded_posix_unlinkat call.
@@ -1072,26 +2071,13 @@ int LdPreloadedPosix::ld_preloaded_posix_unlinkat (int dirfd, const char* pathna
     // hook POSIX unlinkat operation to m_metadata_operations.m_unlinkat
     this->m_dlsym_hook.hook_posix_unlinkat (m_metadata_operations.m_unlinkat);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (pathname);
-
-    // enforce unlinkat request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::unlink),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
-
-    // perform original POSIX unlinkat operation
-    int result = m_metadata_operations.m_unlinkat (dirfd, pathname, flags);
-
-    // update statistic entry
-    this->update_statistics (OperationType::metadata_calls,
-        static_cast<int> (Metadata::unlinkat),
-        result,
-        enforced);
-
-    return result;
+    // submit unlinkat request through the interception pipeline
+    return this->intercept<descriptors::unlinkat> (std::make_pair (dirfd, pathname),
+        1,
+        m_metadata_operations.m_unlinkat,
+        dirfd,
+        pathname,
+        flags);
 }
 
 // ld_preloaded_posix_rename call.
@@ -1100,26 +2086,12 @@ int LdPreloadedPosix::ld_preloaded_posix_rename (const char* old_path, const cha
     // hook POSIX rename operation to m_metadata_operations.m_rename
     this->m_dlsym_hook.hook_posix_rename (m_metadata_operations.m_rename);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (new_path);
-
-    // enforce rename request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::rename),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
-
-    // perform original POSIX rename operation
-    int result = m_metadata_operations.m_rename (old_path, new_path);
-
-    // update statistic entry
-    this->update_statistics (OperationType::metadata_calls,
-        static_cast<int> (Metadata::rename),
-        result,
-        enforced);
-
-    return result;
+    // submit rename request through the interception pipeline
+    return this->intercept<descriptors::rename> (new_path,
+        1,
+        m_metadata_operations.m_rename,
+        old_path,
+        new_path);
 }
 
 // ld_preloaded_posix_renameat call.
@@ -1132,31 +2104,22 @@ int LdPreloadedPosix::ld_preloaded_posix_renameat (int olddirfd,
     // hook POSIX renameat operation to m_metadata_operations.m_renameat
     this->m_dlsym_hook.hook_posix_renameat (m_metadata_operations.m_renameat);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (new_path);
-
-    // enforce renameat request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::rename),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
-
-    // perform original POSIX renameat operation
-    int result = m_metadata_operations.m_renameat (olddirfd, old_path, newdirfd, new_path);
-
-    // update statistic entry
-    this->update_statistics (OperationType::metadata_calls,
-        static_cast<int> (Metadata::renameat),
-        result,
-        enforced);
-
-    return result;
+    // submit renameat request through the interception pipeline
+    return this->intercept<descriptors::renameat> (std::make_pair (newdirfd, new_path),
+        1,
+        m_metadata_operations.m_renameat,
+        olddirfd,
+        old_path,
+        newdirfd,
+        new_path);
 }
 
 // ld_preloaded_posix_fopen call.
 FILE* LdPreloadedPosix::ld_preloaded_posix_fopen (const char* pathname, const char* mode)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX fopen operation to m_metadata_operations.m_fopen
     this->m_dlsym_hook.hook_posix_fopen (m_metadata_operations.m_fopen);
 
@@ -1175,7 +2138,7 @@ FILE* LdPreloadedPosix::ld_preloaded_posix_fopen (const char* pathname, const ch
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fptr,
-        pathname,
+        this->m_mount_point_table.resolve_path (AT_FDCWD, pathname),
         mountpoint,
         this->get_metadata_unit (pathname));
 
@@ -1194,6 +2157,9 @@ FILE* LdPreloadedPosix::ld_preloaded_posix_fopen (const char* pathname, const ch
 // ld_preloaded_posix_fopen64 call.
 FILE* LdPreloadedPosix::ld_preloaded_posix_fopen64 (const char* pathname, const char* mode)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX fopen64 operation to m_metadata_operations.m_fopen64
     this->m_dlsym_hook.hook_posix_fopen64 (m_metadata_operations.m_fopen64);
 
@@ -1212,7 +2178,7 @@ FILE* LdPreloadedPosix::ld_preloaded_posix_fopen64 (const char* pathname, const
 
     // create_mount_point_entry
     this->m_mount_point_table.create_mount_point_entry (fptr,
-        pathname,
+        this->m_mount_point_table.resolve_path (AT_FDCWD, pathname),
         mountpoint,
         this->get_metadata_unit (pathname));
 
@@ -1231,6 +2197,9 @@ FILE* LdPreloadedPosix::ld_preloaded_posix_fopen64 (const char* pathname, const
 // ld_preloaded_posix_fclose call.
 int LdPreloadedPosix::ld_preloaded_posix_fclose (FILE* stream)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX fclose operation to m_metadata_operations.m_fclose
     this->m_dlsym_hook.hook_posix_fclose (m_metadata_operations.m_fclose);
 
@@ -1244,6 +2213,16 @@ int LdPreloadedPosix::ld_preloaded_posix_fclose (FILE* stream)
         static_cast<int> (paio::core::POSIX_META::meta_op),
         1);
 
+    // enforce the buffered bytes that fclose flushes to the file
+    auto pending = (stream != nullptr) ? stream_pending_bytes (stream) : 0;
+    if (pending > 0) {
+        static_cast<void> (this->enforce_request (__func__,
+            workflow_id,
+            static_cast<int> (paio::core::POSIX::write),
+            static_cast<int> (paio::core::POSIX_META::data_op),
+            static_cast<uint64_t> (pending)));
+    }
+
     // perform original POSIX fclose operation
     int result = m_metadata_operations.m_fclose (stream);
 
@@ -1259,379 +2238,846 @@ int LdPreloadedPosix::ld_preloaded_posix_fclose (FILE* stream)
     return result;
 }
 
-// ld_preloaded_posix_mkdir call.
-// NOTE: changed POSIX_META::dir_op classifier to POSIX_META::meta_op
-int LdPreloadedPosix::ld_preloaded_posix_mkdir (const char* path, mode_t mode)
+// ld_preloaded_posix_stat call.
+// NOTE: changed POSIX::stat classifier to POSIX::statfs
+int LdPreloadedPosix::ld_preloaded_posix_stat (const char* path, struct stat* statbuf)
 {
-    // hook POSIX mkdir operation to m_directory_operations.m_mkdir
-    this->m_dlsym_hook.hook_posix_mkdir (m_directory_operations.m_mkdir);
+    // hook POSIX stat operation to m_metadata_operations.m_stat
+    this->m_dlsym_hook.hook_posix_stat (m_metadata_operations.m_stat);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    // submit stat request through the interception pipeline
+    return this->intercept<descriptors::stat> (path,
+        1,
+        m_metadata_operations.m_stat,
+        path,
+        statbuf);
+}
 
-    // enforce mkdir request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::mkdir),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
+// ld_preloaded_posix_lstat call.
+// NOTE: changed POSIX::lstat classifier to POSIX::statfs
+int LdPreloadedPosix::ld_preloaded_posix_lstat (const char* path, struct stat* statbuf)
+{
+    // hook POSIX lstat operation to m_metadata_operations.m_lstat
+    this->m_dlsym_hook.hook_posix_lstat (m_metadata_operations.m_lstat);
 
-    // perform original POSIX mkdir operation
-    int result = m_directory_operations.m_mkdir (path, mode);
+    // submit lstat request through the interception pipeline
+    return this->intercept<descriptors::lstat> (path,
+        1,
+        m_metadata_operations.m_lstat,
+        path,
+        statbuf);
+}
 
-    // update statistic entry
-    this->update_statistics (OperationType::directory_calls,
-        static_cast<int> (Directory::mkdir),
-        result,
-        enforced);
+// ld_preloaded_posix_fstat call.
+// NOTE: changed POSIX::fstat classifier to POSIX::fstatfs
+int LdPreloadedPosix::ld_preloaded_posix_fstat (int fd, struct stat* statbuf)
+{
+    // hook POSIX fstat operation to m_metadata_operations.m_fstat
+    this->m_dlsym_hook.hook_posix_fstat (m_metadata_operations.m_fstat);
 
-    return result;
+    // submit fstat request through the interception pipeline
+    return this->intercept<descriptors::fstat> (fd, 1, m_metadata_operations.m_fstat, fd, statbuf);
 }
 
-// ld_preloaded_posix_mkdirat call.
-// NOTE: changed POSIX::mkdirat classifier to POSIX::mkdir; changed POSIX_META::dir_op classifier to
-// POSIX_META::meta_op
-int LdPreloadedPosix::ld_preloaded_posix_mkdirat (int dirfd, const char* path, mode_t mode)
+// ld_preloaded_posix_fstatat call.
+// NOTE: changed POSIX::fstatat classifier to POSIX::statfs
+int LdPreloadedPosix::ld_preloaded_posix_fstatat (int dirfd,
+    const char* path,
+    struct stat* statbuf,
+    int flags)
 {
-    // hook POSIX mkdirat operation to m_directory_operations.m_mkdirat
-    this->m_dlsym_hook.hook_posix_mkdirat (m_directory_operations.m_mkdirat);
+    // hook POSIX fstatat operation to m_metadata_operations.m_fstatat
+    this->m_dlsym_hook.hook_posix_fstatat (m_metadata_operations.m_fstatat);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    // submit fstatat request through the interception pipeline
+    return this->intercept<descriptors::fstatat> (std::make_pair (dirfd, path),
+        1,
+        m_metadata_operations.m_fstatat,
+        dirfd,
+        path,
+        statbuf,
+        flags);
+}
 
-    // enforce mkdirat request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::mkdir),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
+// ld_preloaded_posix_statx call.
+// NOTE: changed POSIX::statx classifier to POSIX::statfs
+int LdPreloadedPosix::ld_preloaded_posix_statx (int dirfd,
+    const char* path,
+    int flags,
+    unsigned int mask,
+    struct statx* statxbuf)
+{
+    // hook POSIX statx operation to m_metadata_operations.m_statx
+    this->m_dlsym_hook.hook_posix_statx (m_metadata_operations.m_statx);
 
-    // perform original POSIX mkdirat operation
-    int result = m_directory_operations.m_mkdirat (dirfd, path, mode);
+    // submit statx request through the interception pipeline
+    return this->intercept<descriptors::statx> (std::make_pair (dirfd, path),
+        1,
+        m_metadata_operations.m_statx,
+        dirfd,
+        path,
+        flags,
+        mask,
+        statxbuf);
+}
 
-    // update statistic entry
-    this->update_statistics (OperationType::directory_calls,
-        static_cast<int> (Directory::mkdirat),
-        result,
-        enforced);
+// ld_preloaded_posix_access call.
+// NOTE: changed POSIX::access classifier to POSIX::statfs
+int LdPreloadedPosix::ld_preloaded_posix_access (const char* path, int mode)
+{
+    // hook POSIX access operation to m_metadata_operations.m_access
+    this->m_dlsym_hook.hook_posix_access (m_metadata_operations.m_access);
 
-    return result;
+    // submit access request through the interception pipeline
+    return this->intercept<descriptors::access> (path,
+        1,
+        m_metadata_operations.m_access,
+        path,
+        mode);
 }
 
-// ld_preloaded_posix_mknod call.
-// NOTE: changed POSIX_META::dir_op classifier to POSIX_META::meta_op
-int LdPreloadedPosix::ld_preloaded_posix_mknod (const char* path, mode_t mode, dev_t dev)
+// ld_preloaded_posix_faccessat call.
+// NOTE: changed POSIX::faccessat classifier to POSIX::statfs
+int LdPreloadedPosix::ld_preloaded_posix_faccessat (int dirfd,
+    const char* path,
+    int mode,
+    int flags)
 {
-    // hook POSIX mknod operation to m_directory_operations.m_mknod
-    this->m_dlsym_hook.hook_posix_mknod (m_directory_operations.m_mknod);
+    // hook POSIX faccessat operation to m_metadata_operations.m_faccessat
+    this->m_dlsym_hook.hook_posix_faccessat (m_metadata_operations.m_faccessat);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    // submit faccessat request through the interception pipeline
+    return this->intercept<descriptors::faccessat> (std::make_pair (dirfd, path),
+        1,
+        m_metadata_operations.m_faccessat,
+        dirfd,
+        path,
+        mode,
+        flags);
+}
 
-    // enforce mknod request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::mknod),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
+// ld_preloaded_posix_stat64 call.
+// NOTE: changed POSIX::stat64 classifier to POSIX::statfs
+int LdPreloadedPosix::ld_preloaded_posix_stat64 (const char* path, struct stat64* statbuf)
+{
+    // hook POSIX stat64 operation to m_metadata_operations.m_stat64
+    this->m_dlsym_hook.hook_posix_stat64 (m_metadata_operations.m_stat64);
 
-    // perform original POSIX mknod operation
-    int result = m_directory_operations.m_mknod (path, mode, dev);
+    // submit stat64 request through the interception pipeline
+    return this->intercept<descriptors::stat64> (path,
+        1,
+        m_metadata_operations.m_stat64,
+        path,
+        statbuf);
+}
 
-    // update statistic entry
-    this->update_statistics (OperationType::directory_calls,
-        static_cast<int> (Directory::mknod),
-        result,
-        enforced);
+// ld_preloaded_posix_lstat64 call.
+// NOTE: changed POSIX::lstat64 classifier to POSIX::statfs
+int LdPreloadedPosix::ld_preloaded_posix_lstat64 (const char* path, struct stat64* statbuf)
+{
+    // hook POSIX lstat64 operation to m_metadata_operations.m_lstat64
+    this->m_dlsym_hook.hook_posix_lstat64 (m_metadata_operations.m_lstat64);
 
-    return result;
+    // submit lstat64 request through the interception pipeline
+    return this->intercept<descriptors::lstat64> (path,
+        1,
+        m_metadata_operations.m_lstat64,
+        path,
+        statbuf);
 }
 
-// ld_preloaded_posix_mknodat call.
-// NOTE: changed POSIX::mknodat classifier to POSIX::mknod; changed POSIX_META::dir_op classifier to
-// POSIX_META::meta_op
-int LdPreloadedPosix::ld_preloaded_posix_mknodat (int dirfd,
-    const char* path,
-    mode_t mode,
-    dev_t dev)
+// ld_preloaded_posix_fstat64 call.
+// NOTE: changed POSIX::fstat64 classifier to POSIX::fstatfs
+int LdPreloadedPosix::ld_preloaded_posix_fstat64 (int fd, struct stat64* statbuf)
 {
-    // hook POSIX mknodat operation to m_directory_operations.m_mknodat
-    this->m_dlsym_hook.hook_posix_mknodat (m_directory_operations.m_mknodat);
+    // hook POSIX fstat64 operation to m_metadata_operations.m_fstat64
+    this->m_dlsym_hook.hook_posix_fstat64 (m_metadata_operations.m_fstat64);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    // submit fstat64 request through the interception pipeline
+    return this->intercept<descriptors::fstat64> (fd,
+        1,
+        m_metadata_operations.m_fstat64,
+        fd,
+        statbuf);
+}
 
-    // enforce mknodat request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::mknod),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
+// ld_preloaded_posix_fstatat64 call.
+// NOTE: changed POSIX::fstatat64 classifier to POSIX::statfs
+int LdPreloadedPosix::ld_preloaded_posix_fstatat64 (int dirfd,
+    const char* path,
+    struct stat64* statbuf,
+    int flags)
+{
+    // hook POSIX fstatat64 operation to m_metadata_operations.m_fstatat64
+    this->m_dlsym_hook.hook_posix_fstatat64 (m_metadata_operations.m_fstatat64);
 
-    // perform original POSIX mknod operation
-    int result = m_directory_operations.m_mknodat (dirfd, path, mode, dev);
+    // submit fstatat64 request through the interception pipeline
+    return this->intercept<descriptors::fstatat64> (std::make_pair (dirfd, path),
+        1,
+        m_metadata_operations.m_fstatat64,
+        dirfd,
+        path,
+        statbuf,
+        flags);
+}
 
-    // update statistic entry
-    this->update_statistics (OperationType::directory_calls,
-        static_cast<int> (Directory::mknodat),
-        result,
-        enforced);
+// ld_preloaded_posix_fsync call.
+int LdPreloadedPosix::ld_preloaded_posix_fsync (int fd)
+{
+    // hook POSIX fsync operation to m_metadata_operations.m_fsync
+    this->m_dlsym_hook.hook_posix_fsync (m_metadata_operations.m_fsync);
 
-    return result;
+    // submit fsync request through the interception pipeline
+    return this->intercept<descriptors::fsync> (fd, 1, m_metadata_operations.m_fsync, fd);
 }
 
-// ld_preloaded_posix_rmdir call.
-int LdPreloadedPosix::ld_preloaded_posix_rmdir (const char* path)
+// ld_preloaded_posix_fdatasync call.
+int LdPreloadedPosix::ld_preloaded_posix_fdatasync (int fd)
 {
-    // hook POSIX rmdir operation to m_directory_operations.m_rmdir
-    this->m_dlsym_hook.hook_posix_rmdir (m_directory_operations.m_rmdir);
+    // hook POSIX fdatasync operation to m_metadata_operations.m_fdatasync
+    this->m_dlsym_hook.hook_posix_fdatasync (m_metadata_operations.m_fdatasync);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    // submit fdatasync request through the interception pipeline
+    return this->intercept<descriptors::fdatasync> (fd, 1, m_metadata_operations.m_fdatasync, fd);
+}
 
-    // enforce rmdir request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::rmdir),
-        static_cast<int> (paio::core::POSIX_META::dir_op),
-        1);
+// ld_preloaded_posix_sync_file_range call.
+// NOTE: changed POSIX::sync_file_range classifier to POSIX::fdatasync
+int LdPreloadedPosix::ld_preloaded_posix_sync_file_range (int fd,
+    off64_t offset,
+    off64_t nbytes,
+    unsigned int flags)
+{
+    // hook POSIX sync_file_range operation to m_metadata_operations.m_sync_file_range
+    this->m_dlsym_hook.hook_posix_sync_file_range (m_metadata_operations.m_sync_file_range);
 
-    // perform original POSIX rmdir operation
-    int result = m_directory_operations.m_rmdir (path);
+    // submit sync_file_range request through the interception pipeline
+    return this->intercept<descriptors::sync_file_range> (fd,
+        1,
+        m_metadata_operations.m_sync_file_range,
+        fd,
+        offset,
+        nbytes,
+        flags);
+}
 
-    // update statistic entry
-    this->update_statistics (OperationType::directory_calls,
-        static_cast<int> (Directory::rmdir),
-        result,
-        enforced);
+// ld_preloaded_posix_syncfs call.
+int LdPreloadedPosix::ld_preloaded_posix_syncfs (int fd)
+{
+    // hook POSIX syncfs operation to m_metadata_operations.m_syncfs
+    this->m_dlsym_hook.hook_posix_syncfs (m_metadata_operations.m_syncfs);
 
-    return result;
+    // submit syncfs request through the interception pipeline
+    return this->intercept<descriptors::syncfs> (fd, 1, m_metadata_operations.m_syncfs, fd);
 }
 
-// ld_preloaded_posix_getxattr call.
-ssize_t LdPreloadedPosix::ld_preloaded_posix_getxattr (const char* path,
-    const char* name,
-    void* value,
-    size_t size)
+// ld_preloaded_posix_truncate call.
+int LdPreloadedPosix::ld_preloaded_posix_truncate (const char* path, off_t length)
 {
-    // hook POSIX getxattr operation to m_extattr_operations.m_getxattr
-    this->m_dlsym_hook.hook_posix_getxattr (m_extattr_operations.m_getxattr);
+    // hook POSIX truncate operation to m_metadata_operations.m_truncate
+    this->m_dlsym_hook.hook_posix_truncate (m_metadata_operations.m_truncate);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    // submit truncate request through the interception pipeline
+    return this->intercept<descriptors::truncate> (path,
+        this->space_payload (length),
+        m_metadata_operations.m_truncate,
+        path,
+        length);
+}
 
-    // enforce getxattr request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::getxattr),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
+// ld_preloaded_posix_ftruncate call.
+int LdPreloadedPosix::ld_preloaded_posix_ftruncate (int fd, off_t length)
+{
+    // hook POSIX ftruncate operation to m_metadata_operations.m_ftruncate
+    this->m_dlsym_hook.hook_posix_ftruncate (m_metadata_operations.m_ftruncate);
 
-    // perform original POSIX getxattr operation
-    ssize_t result = m_extattr_operations.m_getxattr (path, name, value, size);
+    // submit ftruncate request through the interception pipeline
+    return this->intercept<descriptors::ftruncate> (fd,
+        this->space_payload (length),
+        m_metadata_operations.m_ftruncate,
+        fd,
+        length);
+}
 
-    // update statistic entry
-    this->update_statistics (OperationType::ext_attr_calls,
-        static_cast<int> (ExtendedAttributes::getxattr),
-        result,
-        enforced);
+// ld_preloaded_posix_fallocate call.
+// NOTE: changed POSIX::fallocate classifier to POSIX::ftruncate
+int LdPreloadedPosix::ld_preloaded_posix_fallocate (int fd, int mode, off_t offset, off_t length)
+{
+    // hook POSIX fallocate operation to m_metadata_operations.m_fallocate
+    this->m_dlsym_hook.hook_posix_fallocate (m_metadata_operations.m_fallocate);
 
-    return result;
+    // submit fallocate request through the interception pipeline
+    return this->intercept<descriptors::fallocate> (fd,
+        this->space_payload (length),
+        m_metadata_operations.m_fallocate,
+        fd,
+        mode,
+        offset,
+        length);
 }
 
-// ld_preloaded_posix_lgetxattr call.
-// NOTE: changed POSIX::lgetxattr classifier to POSIX::getxattr
-ssize_t LdPreloadedPosix::ld_preloaded_posix_lgetxattr (const char* path,
-    const char* name,
-    void* value,
-    size_t size)
+// ld_preloaded_posix_posix_fallocate call.
+// NOTE: changed POSIX::posix_fallocate classifier to POSIX::ftruncate
+int LdPreloadedPosix::ld_preloaded_posix_posix_fallocate (int fd, off_t offset, off_t length)
 {
-    // hook POSIX lgetxattr operation to m_extattr_operations.m_lgetxattr
-    this->m_dlsym_hook.hook_posix_lgetxattr (m_extattr_operations.m_lgetxattr);
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    // hook POSIX posix_fallocate operation to m_metadata_operations.m_posix_fallocate
+    this->m_dlsym_hook.hook_posix_posix_fallocate (m_metadata_operations.m_posix_fallocate);
 
-    // enforce lgetxattr request to PAIO data plane stage
+    // enforce posix_fallocate request to PAIO data plane stage
     auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::getxattr),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
+        this->select_workflow<descriptors::posix_fallocate::key> (fd),
+        descriptors::posix_fallocate::operation,
+        descriptors::posix_fallocate::context,
+        static_cast<uint64_t> (this->space_payload (length)));
+
+    // perform original POSIX posix_fallocate operation
+    int result = m_metadata_operations.m_posix_fallocate (fd, offset, length);
+
+    // update statistic entry (posix_fallocate returns the error number instead of setting errno)
+    this->update_statistics (descriptors::posix_fallocate::type,
+        descriptors::posix_fallocate::entry,
+        (result == 0) ? 0 : -1,
+        enforced);
 
-    // perform original POSIX lgetxattr operation
-    ssize_t result = m_extattr_operations.m_lgetxattr (path, name, value, size);
+    return result;
+}
+
+// ld_preloaded_posix_posix_fadvise call.
+// NOTE: posix_fadvise hints are not enforced; they are accounted as enforced if the file belongs
+// to a workflow
+int LdPreloadedPosix::ld_preloaded_posix_posix_fadvise (int fd,
+    off_t offset,
+    off_t length,
+    int advice)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX posix_fadvise operation to m_metadata_operations.m_posix_fadvise
+    this->m_dlsym_hook.hook_posix_posix_fadvise (m_metadata_operations.m_posix_fadvise);
+
+    // verify if the targeted file belongs to a workflow
+    auto enforced = (this->select_workflow<descriptors::posix_fadvise::key> (fd)
+        != static_cast<uint32_t> (-1));
+
+    // perform original POSIX posix_fadvise operation
+    int result = m_metadata_operations.m_posix_fadvise (fd, offset, length, advice);
+
+    // update statistic entry (posix_fadvise returns the error number instead of setting errno)
+    this->update_statistics (descriptors::posix_fadvise::type,
+        descriptors::posix_fadvise::entry,
+        (result == 0) ? 0 : -1,
+        enforced);
+
+    // account the advised length of prefetch hints as bytes, to identify prefetching applications
+    if (option_pipeline_statistics && this->m_collect && enforced && result == 0
+        && advice == POSIX_FADV_WILLNEED && length > 0) {
+        this->m_metadata_stats.update_statistic_entry (descriptors::posix_fadvise::entry,
+            0,
+            static_cast<uint64_t> (length));
+    }
+
+    return result;
+}
+
+// ld_preloaded_posix_io_uring_setup call.
+// NOTE: io_uring_setup is not enforced; it is accounted as enforced if the instance was registered
+// (i.e., if its submissions can be inspected)
+int LdPreloadedPosix::ld_preloaded_posix_io_uring_setup (unsigned int entries,
+    struct io_uring_params* params)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX io_uring_setup operation to m_metadata_operations.m_io_uring_setup
+    this->m_dlsym_hook.hook_posix_io_uring_setup (m_metadata_operations.m_io_uring_setup);
+
+    // perform original POSIX io_uring_setup operation
+    auto result = static_cast<int> (
+        m_metadata_operations.m_io_uring_setup (SYS_io_uring_setup, entries, params));
+
+    // register the instance in the IoUringTable
+    auto enforced = (result >= 0 && params != nullptr)
+        ? this->m_io_uring_table.register_ring (result, *params)
+        : false;
 
     // update statistic entry
-    this->update_statistics (OperationType::ext_attr_calls,
-        static_cast<int> (ExtendedAttributes::lgetxattr),
+    this->update_statistics (descriptors::io_uring_setup::type,
+        descriptors::io_uring_setup::entry,
         result,
         enforced);
 
     return result;
 }
 
-// ld_preloaded_posix_fgetxattr call.
-// NOTE: changed POSIX::fgetxattr classifier to POSIX::getxattr; changed POSIX_META::ext_attr_op
-// classifier to POSIX_META::meta_op
-ssize_t
-LdPreloadedPosix::ld_preloaded_posix_fgetxattr (int fd, const char* name, void* value, size_t size)
+// ld_preloaded_posix_aio_fsync call.
+// NOTE: O_DSYNC requests are submitted with the POSIX::fdatasync classifier
+int LdPreloadedPosix::ld_preloaded_posix_aio_fsync (int op, struct aiocb* aiocbp)
 {
-    // hook POSIX fgetxattr operation to m_extattr_operations.m_fgetxattr
-    this->m_dlsym_hook.hook_posix_fgetxattr (m_extattr_operations.m_fgetxattr);
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
 
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
+    // hook POSIX aio_fsync operation to m_metadata_operations.m_aio_fsync
+    this->m_dlsym_hook.hook_posix_aio_fsync (m_metadata_operations.m_aio_fsync);
 
-    // enforce fgetxattr request to PAIO data plane stage
+    // select workflow-id and enforce aio_fsync request to PAIO data plane stage
+    auto fd = (aiocbp != nullptr) ? aiocbp->aio_fildes : -1;
+    auto operation = (op == O_DSYNC) ? paio::core::POSIX::fdatasync : paio::core::POSIX::fsync;
     auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::getxattr),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
+        this->select_workflow<descriptors::aio_fsync::key> (fd),
+        static_cast<int> (operation),
+        descriptors::aio_fsync::context,
         1);
 
-    // perform original POSIX fgetxattr operation
-    ssize_t result = m_extattr_operations.m_fgetxattr (fd, name, value, size);
+    // perform original POSIX aio_fsync operation
+    int result = m_metadata_operations.m_aio_fsync (op, aiocbp);
 
     // update statistic entry
-    this->update_statistics (OperationType::ext_attr_calls,
-        static_cast<int> (ExtendedAttributes::fgetxattr),
+    this->update_statistics (descriptors::aio_fsync::type,
+        descriptors::aio_fsync::entry,
         result,
         enforced);
 
     return result;
 }
 
-// ld_preloaded_posix_setxattr call.
-// NOTE: changed POSIX_META::ext_attr_op classifier to POSIX_META::meta_op
-int LdPreloadedPosix::ld_preloaded_posix_setxattr (const char* path,
-    const char* name,
-    const void* value,
-    size_t size,
-    int flags)
+// ld_preloaded_posix_aio_fsync64 call.
+// NOTE: O_DSYNC requests are submitted with the POSIX::fdatasync classifier
+int LdPreloadedPosix::ld_preloaded_posix_aio_fsync64 (int op, struct aiocb64* aiocbp)
 {
-    // hook POSIX setxattr operation to m_extattr_operations.m_setxattr
-    this->m_dlsym_hook.hook_posix_setxattr (m_extattr_operations.m_setxattr);
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    // hook POSIX aio_fsync64 operation to m_metadata_operations.m_aio_fsync64
+    this->m_dlsym_hook.hook_posix_aio_fsync64 (m_metadata_operations.m_aio_fsync64);
 
-    // enforce setxattr request to PAIO data plane stage
+    // select workflow-id and enforce aio_fsync64 request to PAIO data plane stage
+    auto fd = (aiocbp != nullptr) ? aiocbp->aio_fildes : -1;
+    auto operation = (op == O_DSYNC) ? paio::core::POSIX::fdatasync : paio::core::POSIX::fsync;
     auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::setxattr),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
+        this->select_workflow<descriptors::aio_fsync64::key> (fd),
+        static_cast<int> (operation),
+        descriptors::aio_fsync64::context,
         1);
 
-    // perform original POSIX setxattr operation
-    int result = m_extattr_operations.m_setxattr (path, name, value, size, flags);
+    // perform original POSIX aio_fsync64 operation
+    int result = m_metadata_operations.m_aio_fsync64 (op, aiocbp);
 
     // update statistic entry
-    this->update_statistics (OperationType::ext_attr_calls,
-        static_cast<int> (ExtendedAttributes::setxattr),
+    this->update_statistics (descriptors::aio_fsync64::type,
+        descriptors::aio_fsync64::entry,
         result,
         enforced);
 
     return result;
 }
 
-// ld_preloaded_posix_lsetxattr call.
-// NOTE: changed POSIX::lsetxattr classifier to POSIX::setxattr; changed POSIX_META::ext_attr_op
-// classifier to POSIX_META::meta_op
-int LdPreloadedPosix::ld_preloaded_posix_lsetxattr (const char* path,
-    const char* name,
-    const void* value,
-    size_t size,
-    int flags)
+// ld_preloaded_posix_mkdir call.
+// NOTE: changed POSIX_META::dir_op classifier to POSIX_META::meta_op
+int LdPreloadedPosix::ld_preloaded_posix_mkdir (const char* path, mode_t mode)
 {
-    // hook POSIX lsetxattr operation to m_extattr_operations.m_lsetxattr
-    this->m_dlsym_hook.hook_posix_lsetxattr (m_extattr_operations.m_lsetxattr);
+    // hook POSIX mkdir operation to m_directory_operations.m_mkdir
+    this->m_dlsym_hook.hook_posix_mkdir (m_directory_operations.m_mkdir);
+
+    // submit mkdir request through the interception pipeline
+    return this->intercept<descriptors::mkdir> (path,
+        1,
+        m_directory_operations.m_mkdir,
+        path,
+        mode);
+}
+
+// ld_preloaded_posix_mkdirat call.
+// NOTE: changed POSIX::mkdirat classifier to POSIX::mkdir; changed POSIX_META::dir_op classifier to
+// POSIX_META::meta_op
+int LdPreloadedPosix::ld_preloaded_posix_mkdirat (int dirfd, const char* path, mode_t mode)
+{
+    // hook POSIX mkdirat operation to m_directory_operations.m_mkdirat
+    this->m_dlsym_hook.hook_posix_mkdirat (m_directory_operations.m_mkdirat);
+
+    // submit mkdirat request through the interception pipeline
+    return this->intercept<descriptors::mkdirat> (std::make_pair (dirfd, path),
+        1,
+        m_directory_operations.m_mkdirat,
+        dirfd,
+        path,
+        mode);
+}
+
+// ld_preloaded_posix_mknod call.
+// NOTE: changed POSIX_META::dir_op classifier to POSIX_META::meta_op
+int LdPreloadedPosix::ld_preloaded_posix_mknod (const char* path, mode_t mode, dev_t dev)
+{
+    // hook POSIX mknod operation to m_directory_operations.m_mknod
+    this->m_dlsym_hook.hook_posix_mknod (m_directory_operations.m_mknod);
+
+    // submit mknod request through the interception pipeline
+    return this->intercept<descriptors::mknod> (path,
+        1,
+        m_directory_operations.m_mknod,
+        path,
+        mode,
+        dev);
+}
+
+// ld_preloaded_posix_mknodat call.
+// NOTE: changed POSIX::mknodat classifier to POSIX::mknod; changed POSIX_META::dir_op classifier to
+// POSIX_META::meta_op
+int LdPreloadedPosix::ld_preloaded_posix_mknodat (int dirfd,
+    const char* path,
+    mode_t mode,
+    dev_t dev)
+{
+    // hook POSIX mknodat operation to m_directory_operations.m_mknodat
+    this->m_dlsym_hook.hook_posix_mknodat (m_directory_operations.m_mknodat);
+
+    // submit mknodat request through the interception pipeline
+    return this->intercept<descriptors::mknodat> (std::make_pair (dirfd, path),
+        1,
+        m_directory_operations.m_mknodat,
+        dirfd,
+        path,
+        mode,
+        dev);
+}
+
+// ld_preloaded_posix_rmdir call.
+int LdPreloadedPosix::ld_preloaded_posix_rmdir (const char* path)
+{
+    // hook POSIX rmdir operation to m_directory_operations.m_rmdir
+    this->m_dlsym_hook.hook_posix_rmdir (m_directory_operations.m_rmdir);
+
+    // submit rmdir request through the interception pipeline
+    return this->intercept<descriptors::rmdir> (path, 1, m_directory_operations.m_rmdir, path);
+}
+
+// ld_preloaded_posix_opendir call.
+// NOTE: changed POSIX::opendir classifier to POSIX::open; changed POSIX_META::meta_op classifier to
+// POSIX_META::dir_op
+DIR* LdPreloadedPosix::ld_preloaded_posix_opendir (const char* path)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX opendir operation to m_directory_operations.m_opendir
+    this->m_dlsym_hook.hook_posix_opendir (m_directory_operations.m_opendir);
 
     // extract mountpoint and pick workflow-id
     auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
 
-    // enforce lsetxattr request to PAIO data plane stage
+    // enforce opendir request to PAIO data plane stage
     auto enforced = this->enforce_request (__func__,
         workflow_id,
-        static_cast<int> (paio::core::POSIX::setxattr),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
+        static_cast<int> (paio::core::POSIX::open),
+        static_cast<int> (paio::core::POSIX_META::dir_op),
         1);
 
-    // perform original POSIX lsetxattr operation
-    int result = m_extattr_operations.m_lsetxattr (path, name, value, size, flags);
+    // perform original POSIX opendir operation
+    DIR* dir_ptr = m_directory_operations.m_opendir (path);
+
+    // create_mount_point_entry for the directory stream and its file descriptor (used by
+    // getdents64 and by *at calls relative to the directory)
+    if (dir_ptr != nullptr) {
+        auto resolved_path = this->m_mount_point_table.resolve_path (AT_FDCWD, path);
+        auto metadata_unit = this->get_metadata_unit (path);
+
+        this->m_mount_point_table.create_mount_point_entry (dir_ptr,
+            resolved_path,
+            mountpoint,
+            metadata_unit);
+        this->m_mount_point_table.create_mount_point_entry (::dirfd (dir_ptr),
+            resolved_path,
+            mountpoint,
+            metadata_unit);
+    }
 
     // update statistic entry
-    this->update_statistics (OperationType::ext_attr_calls,
-        static_cast<int> (ExtendedAttributes::lsetxattr),
-        result,
+    this->update_statistics (OperationType::directory_calls,
+        static_cast<int> (Directory::opendir),
+        (dir_ptr != nullptr) ? 0 : -1,
         enforced);
 
-    return result;
+    return dir_ptr;
 }
 
-// ld_preloaded_posix_fsetxattr call.
-// NOTE: changed POSIX::fsetxattr classifier to POSIX::setxattr; changed POSIX_META::ext_attr_op
-// classifier to POSIX_META::meta_op
-int LdPreloadedPosix::ld_preloaded_posix_fsetxattr (int fd,
-    const char* name,
-    const void* value,
-    size_t size,
-    int flags)
+// ld_preloaded_posix_fdopendir call.
+// NOTE: changed POSIX::fdopendir classifier to POSIX::open; changed POSIX_META::meta_op classifier
+// to POSIX_META::dir_op
+DIR* LdPreloadedPosix::ld_preloaded_posix_fdopendir (int fd)
 {
-    // hook POSIX fsetxattr operation to m_extattr_operations.m_fsetxattr
-    this->m_dlsym_hook.hook_posix_fsetxattr (m_extattr_operations.m_fsetxattr);
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX fdopendir operation to m_directory_operations.m_fdopendir
+    this->m_dlsym_hook.hook_posix_fdopendir (m_directory_operations.m_fdopendir);
 
     // select workflow-id to submit I/O request
     auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
 
-    // enforce fsetxattr request to PAIO data plane stage
+    // enforce fdopendir request to PAIO data plane stage
     auto enforced = this->enforce_request (__func__,
         workflow_id,
-        static_cast<int> (paio::core::POSIX::setxattr),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
+        static_cast<int> (paio::core::POSIX::open),
+        static_cast<int> (paio::core::POSIX_META::dir_op),
         1);
 
-    // perform original POSIX fsetxattr operation
-    int result = m_extattr_operations.m_fsetxattr (fd, name, value, size, flags);
+    // perform original POSIX fdopendir operation
+    DIR* dir_ptr = m_directory_operations.m_fdopendir (fd);
+
+    // create_mount_point_entry for the directory stream, from the entry of its file descriptor
+    if (dir_ptr != nullptr) {
+        auto [found, entry_ptr] = this->m_mount_point_table.get_mount_point_entry (fd);
+
+        if (found) {
+            this->m_mount_point_table.create_mount_point_entry (dir_ptr,
+                entry_ptr->get_path (),
+                entry_ptr->get_mount_point (),
+                entry_ptr->get_metadata_server_unit ());
+        }
+    }
 
     // update statistic entry
-    this->update_statistics (OperationType::ext_attr_calls,
-        static_cast<int> (ExtendedAttributes::fsetxattr),
-        result,
+    this->update_statistics (OperationType::directory_calls,
+        static_cast<int> (Directory::fdopendir),
+        (dir_ptr != nullptr) ? 0 : -1,
         enforced);
 
-    return result;
+    return dir_ptr;
 }
 
-// ld_preloaded_posix_listxattr call.
-// NOTE: changed POSIX_META::ext_attr_op classifier to POSIX_META::meta_op
-ssize_t LdPreloadedPosix::ld_preloaded_posix_listxattr (const char* path, char* list, size_t size)
+// ld_preloaded_posix_readdir call.
+// NOTE: changed POSIX::readdir classifier to POSIX::read; changed POSIX_META::meta_op classifier to
+// POSIX_META::dir_op
+struct dirent* LdPreloadedPosix::ld_preloaded_posix_readdir (DIR* dirp)
 {
-    // hook POSIX listxattr operation to m_extattr_operations.m_listxattr
-    this->m_dlsym_hook.hook_posix_listxattr (m_extattr_operations.m_listxattr);
+    // hook POSIX readdir operation to m_directory_operations.m_readdir
+    this->m_dlsym_hook.hook_posix_readdir (m_directory_operations.m_readdir);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
+    // submit readdir request through the directory stream pipeline (charged once per refill)
+    return this->intercept_directory_stream<descriptors::readdir> (dirp,
+        m_directory_operations.m_readdir,
+        dirp);
+}
+
+// ld_preloaded_posix_readdir64 call.
+// NOTE: changed POSIX::readdir64 classifier to POSIX::read; changed POSIX_META::meta_op classifier
+// to POSIX_META::dir_op
+struct dirent64* LdPreloadedPosix::ld_preloaded_posix_readdir64 (DIR* dirp)
+{
+    // hook POSIX readdir64 operation to m_directory_operations.m_readdir64
+    this->m_dlsym_hook.hook_posix_readdir64 (m_directory_operations.m_readdir64);
+
+    // submit readdir64 request through the directory stream pipeline (charged once per refill)
+    return this->intercept_directory_stream<descriptors::readdir64> (dirp,
+        m_directory_operations.m_readdir64,
+        dirp);
+}
+
+// ld_preloaded_posix_getdents64 call.
+// NOTE: changed POSIX::getdents64 classifier to POSIX::read; changed POSIX_META::meta_op classifier
+// to POSIX_META::dir_op
+ssize_t LdPreloadedPosix::ld_preloaded_posix_getdents64 (int fd, void* buffer, size_t count)
+{
+    // hook POSIX getdents64 operation to m_directory_operations.m_getdents64
+    this->m_dlsym_hook.hook_posix_getdents64 (m_directory_operations.m_getdents64);
+
+    // submit getdents64 request through the interception pipeline (each call reads a batch of
+    // directory entries, and is charged as a single request)
+    return this->intercept<descriptors::getdents64> (fd,
+        1,
+        m_directory_operations.m_getdents64,
+        fd,
+        buffer,
+        count);
+}
+
+// ld_preloaded_posix_closedir call.
+// NOTE: changed POSIX::closedir classifier to POSIX::close; changed POSIX_META::meta_op classifier
+// to POSIX_META::dir_op
+int LdPreloadedPosix::ld_preloaded_posix_closedir (DIR* dirp)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX closedir operation to m_directory_operations.m_closedir
+    this->m_dlsym_hook.hook_posix_closedir (m_directory_operations.m_closedir);
 
-    // enforce listxattr request to PAIO data plane stage
+    // select workflow-id to submit I/O request
+    auto workflow_id = this->m_mount_point_table.pick_workflow_id (dirp);
+
+    // enforce closedir request to PAIO data plane stage
     auto enforced = this->enforce_request (__func__,
         workflow_id,
-        static_cast<int> (paio::core::POSIX::listxattr),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
+        static_cast<int> (paio::core::POSIX::close),
+        static_cast<int> (paio::core::POSIX_META::dir_op),
         1);
 
-    // perform original POSIX listxattr operation
-    ssize_t result = m_extattr_operations.m_listxattr (path, list, size);
+    // file descriptor of the directory stream (closed along with it)
+    int fd = (dirp != nullptr) ? ::dirfd (dirp) : -1;
+
+    // perform original POSIX closedir operation
+    int result = m_directory_operations.m_closedir (dirp);
+
+    // remove entries from MountPointTable
+    this->m_mount_point_table.remove_mount_point_entry (dirp);
+    if (option_hard_remove) {
+        this->m_mount_point_table.remove_mount_point_entry (fd);
+    }
 
     // update statistic entry
-    this->update_statistics (OperationType::ext_attr_calls,
-        static_cast<int> (ExtendedAttributes::listxattr),
+    this->update_statistics (OperationType::directory_calls,
+        static_cast<int> (Directory::closedir),
         result,
         enforced);
 
     return result;
 }
 
+// ld_preloaded_posix_getxattr call.
+ssize_t LdPreloadedPosix::ld_preloaded_posix_getxattr (const char* path,
+    const char* name,
+    void* value,
+    size_t size)
+{
+    // hook POSIX getxattr operation to m_extattr_operations.m_getxattr
+    this->m_dlsym_hook.hook_posix_getxattr (m_extattr_operations.m_getxattr);
+
+    // submit getxattr request through the interception pipeline
+    return this->intercept<descriptors::getxattr> (path,
+        1,
+        m_extattr_operations.m_getxattr,
+        path,
+        name,
+        value,
+        size);
+}
+
+// ld_preloaded_posix_lgetxattr call.
+// NOTE: changed POSIX::lgetxattr classifier to POSIX::getxattr
+ssize_t LdPreloadedPosix::ld_preloaded_posix_lgetxattr (const char* path,
+    const char* name,
+    void* value,
+    size_t size)
+{
+    // hook POSIX lgetxattr operation to m_extattr_operations.m_lgetxattr
+    this->m_dlsym_hook.hook_posix_lgetxattr (m_extattr_operations.m_lgetxattr);
+
+    // submit lgetxattr request through the interception pipeline
+    return this->intercept<descriptors::lgetxattr> (path,
+        1,
+        m_extattr_operations.m_lgetxattr,
+        path,
+        name,
+        value,
+        size);
+}
+
+// ld_preloaded_posix_fgetxattr call.
+// NOTE: changed POSIX::fgetxattr classifier to POSIX::getxattr; changed POSIX_META::ext_attr_op
+// classifier to POSIX_META::meta_op
+ssize_t
+LdPreloadedPosix::ld_preloaded_posix_fgetxattr (int fd, const char* name, void* value, size_t size)
+{
+    // hook POSIX fgetxattr operation to m_extattr_operations.m_fgetxattr
+    this->m_dlsym_hook.hook_posix_fgetxattr (m_extattr_operations.m_fgetxattr);
+
+    // submit fgetxattr request through the interception pipeline
+    return this->intercept<descriptors::fgetxattr> (fd,
+        1,
+        m_extattr_operations.m_fgetxattr,
+        fd,
+        name,
+        value,
+        size);
+}
+
+// ld_preloaded_posix_setxattr call.
+// NOTE: changed POSIX_META::ext_attr_op classifier to POSIX_META::meta_op
+int LdPreloadedPosix::ld_preloaded_posix_setxattr (const char* path,
+    const char* name,
+    const void* value,
+    size_t size,
+    int flags)
+{
+    // hook POSIX setxattr operation to m_extattr_operations.m_setxattr
+    this->m_dlsym_hook.hook_posix_setxattr (m_extattr_operations.m_setxattr);
+
+    // submit setxattr request through the interception pipeline
+    return this->intercept<descriptors::setxattr> (path,
+        1,
+        m_extattr_operations.m_setxattr,
+        path,
+        name,
+        value,
+        size,
+        flags);
+}
+
+// ld_preloaded_posix_lsetxattr call.
+// NOTE: changed POSIX::lsetxattr classifier to POSIX::setxattr; changed POSIX_META::ext_attr_op
+// classifier to POSIX_META::meta_op
+int LdPreloadedPosix::ld_preloaded_posix_lsetxattr (const char* path,
+    const char* name,
+    const void* value,
+    size_t size,
+    int flags)
+{
+    // hook POSIX lsetxattr operation to m_extattr_operations.m_lsetxattr
+    this->m_dlsym_hook.hook_posix_lsetxattr (m_extattr_operations.m_lsetxattr);
+
+    // submit lsetxattr request through the interception pipeline
+    return this->intercept<descriptors::lsetxattr> (path,
+        1,
+        m_extattr_operations.m_lsetxattr,
+        path,
+        name,
+        value,
+        size,
+        flags);
+}
+
+// ld_preloaded_posix_fsetxattr call.
+// NOTE: changed POSIX::fsetxattr classifier to POSIX::setxattr; changed POSIX_META::ext_attr_op
+// classifier to POSIX_META::meta_op
+int LdPreloadedPosix::ld_preloaded_posix_fsetxattr (int fd,
+    const char* name,
+    const void* value,
+    size_t size,
+    int flags)
+{
+    // hook POSIX fsetxattr operation to m_extattr_operations.m_fsetxattr
+    this->m_dlsym_hook.hook_posix_fsetxattr (m_extattr_operations.m_fsetxattr);
+
+    // submit fsetxattr request through the interception pipeline
+    return this->intercept<descriptors::fsetxattr> (fd,
+        1,
+        m_extattr_operations.m_fsetxattr,
+        fd,
+        name,
+        value,
+        size,
+        flags);
+}
+
+// ld_preloaded_posix_listxattr call.
+// NOTE: changed POSIX_META::ext_attr_op classifier to POSIX_META::meta_op
+ssize_t LdPreloadedPosix::ld_preloaded_posix_listxattr (const char* path, char* list, size_t size)
+{
+    // hook POSIX listxattr operation to m_extattr_operations.m_listxattr
+    this->m_dlsym_hook.hook_posix_listxattr (m_extattr_operations.m_listxattr);
+
+    // submit listxattr request through the interception pipeline
+    return this->intercept<descriptors::listxattr> (path,
+        1,
+        m_extattr_operations.m_listxattr,
+        path,
+        list,
+        size);
+}
+
 // ld_preloaded_posix_llistxattr call.
 // NOTE: changed POSIX::llistxattr classifier to POSIX::listxattr; changed POSIX_META::ext_attr_op
 // classifier to POSIX_META::meta_op
@@ -1640,26 +3086,13 @@ ssize_t LdPreloadedPosix::ld_preloaded_posix_llistxattr (const char* path, char*
     // hook POSIX llistxattr operation to m_extattr_operations.m_llistxattr
     this->m_dlsym_hook.hook_posix_llistxattr (m_extattr_operations.m_llistxattr);
 
-    // extract mountpoint and pick workflow-id
-    auto [mountpoint, workflow_id] = this->m_mount_point_table.pick_workflow_id (path);
-
-    // enforce llistxattr request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::listxattr),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
-
-    // perform original POSIX llistxattr operation
-    ssize_t result = m_extattr_operations.m_llistxattr (path, list, size);
-
-    // update statistic entry
-    this->update_statistics (OperationType::ext_attr_calls,
-        static_cast<int> (ExtendedAttributes::llistxattr),
-        result,
-        enforced);
-
-    return result;
+    // submit llistxattr request through the interception pipeline
+    return this->intercept<descriptors::llistxattr> (path,
+        1,
+        m_extattr_operations.m_llistxattr,
+        path,
+        list,
+        size);
 }
 
 // ld_preloaded_posix_flistxattr call.
@@ -1670,31 +3103,21 @@ ssize_t LdPreloadedPosix::ld_preloaded_posix_flistxattr (int fd, char* list, siz
     // hook POSIX flistxattr operation to m_extattr_operations.m_flistxattr
     this->m_dlsym_hook.hook_posix_flistxattr (m_extattr_operations.m_flistxattr);
 
-    // select workflow-id to submit I/O request
-    auto workflow_id = this->m_mount_point_table.pick_workflow_id (fd);
-
-    // enforce flistxattr request to PAIO data plane stage
-    auto enforced = this->enforce_request (__func__,
-        workflow_id,
-        static_cast<int> (paio::core::POSIX::listxattr),
-        static_cast<int> (paio::core::POSIX_META::meta_op),
-        1);
-
-    // perform original POSIX flistxattr operation
-    ssize_t result = m_extattr_operations.m_flistxattr (fd, list, size);
-
-    // update statistic entry
-    this->update_statistics (OperationType::ext_attr_calls,
-        static_cast<int> (ExtendedAttributes::flistxattr),
-        result,
-        enforced);
-
-    return result;
+    // submit flistxattr request through the interception pipeline
+    return this->intercept<descriptors::flistxattr> (fd,
+        1,
+        m_extattr_operations.m_flistxattr,
+        fd,
+        list,
+        size);
 }
 
 // ld_preloaded_posix_socket call.
 int LdPreloadedPosix::ld_preloaded_posix_socket (int domain, int type, int protocol)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX socket operation to m_special_operations.m_socket
     this->m_dlsym_hook.hook_posix_socket (m_special_operations.m_socket);
 
@@ -1718,6 +3141,9 @@ int LdPreloadedPosix::ld_preloaded_posix_socket (int domain, int type, int proto
 // ld_preloaded_posix_fcntl call.
 int LdPreloadedPosix::ld_preloaded_posix_fcntl (int fd, int cmd, void* arg)
 {
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
     // hook POSIX fcntl operation to m_special_operations.m_socket
     this->m_dlsym_hook.hook_posix_fcntl (m_special_operations.m_fcntl);
 
@@ -1732,11 +3158,9 @@ int LdPreloadedPosix::ld_preloaded_posix_fcntl (int fd, int cmd, void* arg)
             this->m_log->log_debug (std::string { __func__ } + " duplicated file descriptor "
                 + std::to_string (fd) + " to " + std::to_string (result_value));
 #endif
-            // replace fd with entry in m_fd_table
-            auto replaced = this->m_mount_point_table.replace_file_descriptor (fd, result_value);
-
-            if (!replaced) {
-                this->m_log->log_error ("Error while replacing file descriptor.");
+            // the duplicate file descriptor shares the entry of fd
+            if (result_value >= 0) {
+                this->m_mount_point_table.duplicate_file_descriptor (fd, result_value);
             }
             break;
         }
@@ -1760,4 +3184,152 @@ int LdPreloadedPosix::ld_preloaded_posix_fcntl (int fd, int cmd, void* arg)
     return result_value;
 }
 
+// ld_preloaded_posix_chdir call.
+int LdPreloadedPosix::ld_preloaded_posix_chdir (const char* path)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX chdir operation to m_special_operations.m_chdir
+    this->m_dlsym_hook.hook_posix_chdir (m_special_operations.m_chdir);
+
+    // perform original POSIX chdir operation
+    int result = m_special_operations.m_chdir (path);
+
+    // refresh the working directory used to classify relative paths
+    if (result == 0) {
+        this->m_mount_point_table.update_working_directory ();
+    }
+
+    // update statistic entry
+    this->update_statistics (OperationType::special_calls,
+        static_cast<int> (Special::chdir),
+        result,
+        false);
+
+    return result;
+}
+
+// ld_preloaded_posix_fchdir call.
+int LdPreloadedPosix::ld_preloaded_posix_fchdir (int fd)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX fchdir operation to m_special_operations.m_fchdir
+    this->m_dlsym_hook.hook_posix_fchdir (m_special_operations.m_fchdir);
+
+    // perform original POSIX fchdir operation
+    int result = m_special_operations.m_fchdir (fd);
+
+    // refresh the working directory used to classify relative paths
+    if (result == 0) {
+        this->m_mount_point_table.update_working_directory ();
+    }
+
+    // update statistic entry
+    this->update_statistics (OperationType::special_calls,
+        static_cast<int> (Special::fchdir),
+        result,
+        false);
+
+    return result;
+}
+
+// ld_preloaded_posix_dup call.
+int LdPreloadedPosix::ld_preloaded_posix_dup (int oldfd)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX dup operation to m_special_operations.m_dup
+    this->m_dlsym_hook.hook_posix_dup (m_special_operations.m_dup);
+
+    // perform original POSIX dup operation
+    int fd = m_special_operations.m_dup (oldfd);
+
+    // the duplicate file descriptor shares the entry of oldfd
+    if (fd >= 0) {
+        this->m_mount_point_table.duplicate_file_descriptor (oldfd, fd);
+    }
+
+// detailed logging message
+#if OPTION_DETAILED_LOGGING
+    this->m_log->log_debug (std::string { __func__ } + " duplicated file descriptor "
+        + std::to_string (oldfd) + " to " + std::to_string (fd));
+#endif
+
+    // update statistic entry
+    this->update_statistics (OperationType::special_calls,
+        static_cast<int> (Special::dup),
+        fd,
+        false);
+
+    return fd;
+}
+
+// ld_preloaded_posix_dup2 call.
+int LdPreloadedPosix::ld_preloaded_posix_dup2 (int oldfd, int newfd)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX dup2 operation to m_special_operations.m_dup2
+    this->m_dlsym_hook.hook_posix_dup2 (m_special_operations.m_dup2);
+
+    // perform original POSIX dup2 operation
+    int fd = m_special_operations.m_dup2 (oldfd, newfd);
+
+    // the duplicate file descriptor shares the entry of oldfd
+    if (fd >= 0) {
+        this->m_mount_point_table.duplicate_file_descriptor (oldfd, fd);
+    }
+
+// detailed logging message
+#if OPTION_DETAILED_LOGGING
+    this->m_log->log_debug (std::string { __func__ } + " duplicated file descriptor "
+        + std::to_string (oldfd) + " to " + std::to_string (fd));
+#endif
+
+    // update statistic entry
+    this->update_statistics (OperationType::special_calls,
+        static_cast<int> (Special::dup2),
+        fd,
+        false);
+
+    return fd;
+}
+
+// ld_preloaded_posix_dup3 call.
+int LdPreloadedPosix::ld_preloaded_posix_dup3 (int oldfd, int newfd, int flags)
+{
+    // start tracking the latency of the intercepted call
+    this->start_latency_tracking ();
+
+    // hook POSIX dup3 operation to m_special_operations.m_dup3
+    this->m_dlsym_hook.hook_posix_dup3 (m_special_operations.m_dup3);
+
+    // perform original POSIX dup3 operation
+    int fd = m_special_operations.m_dup3 (oldfd, newfd, flags);
+
+    // the duplicate file descriptor shares the entry of oldfd
+    if (fd >= 0) {
+        this->m_mount_point_table.duplicate_file_descriptor (oldfd, fd);
+    }
+
+// detailed logging message
+#if OPTION_DETAILED_LOGGING
+    this->m_log->log_debug (std::string { __func__ } + " duplicated file descriptor "
+        + std::to_string (oldfd) + " to " + std::to_string (fd));
+#endif
+
+    // update statistic entry
+    this->update_statistics (OperationType::special_calls,
+        static_cast<int> (Special::dup3),
+        fd,
+        false);
+
+    return fd;
+}
+
 } // namespace padll::interface::ldpreloaded
@@ -0,0 +1,335 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cstddef>
+#include <cstring>
+#include <future>
+#include <link.h>
+#include <linux/audit.h>
+#include <padll/configurations/padll_configuration.hpp>
+#include <padll/interface/native/seccomp_supervisor.hpp>
+#include <padll/library_headers/libc_dispatch.hpp>
+#include <sys/auxv.h>
+#include <sys/ioctl.h>
+#include <sys/prctl.h>
+#include <thread>
+
+// flags of recent kernels (Linux 5.5 and 5.19), which may be missing from older headers
+#ifndef SECCOMP_USER_NOTIF_FLAG_CONTINUE
+#define SECCOMP_USER_NOTIF_FLAG_CONTINUE (1UL << 0)
+#endif
+#ifndef SECCOMP_FILTER_FLAG_WAIT_KILLABLE_RECV
+#define SECCOMP_FILTER_FLAG_WAIT_KILLABLE_RECV (1UL << 5)
+#endif
+
+namespace padll::interface::native {
+
+// audit architecture of the filtered calls (the filter is only supported in little-endian x86-64
+// and AArch64, as the instruction pointer is checked in two 32-bit words)
+#if defined(__x86_64__)
+static constexpr uint32_t kAuditArch { AUDIT_ARCH_X86_64 };
+#elif defined(__aarch64__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+static constexpr uint32_t kAuditArch { AUDIT_ARCH_AARCH64 };
+#else
+static constexpr uint32_t kAuditArch { 0 };
+#endif
+
+// offsets of the fields of seccomp_data checked by the filter
+static constexpr uint32_t kArchOffset { offsetof (struct seccomp_data, arch) };
+static constexpr uint32_t kNumberOffset { offsetof (struct seccomp_data, nr) };
+static constexpr uint32_t kPointerLowOffset { offsetof (struct seccomp_data, instruction_pointer) };
+static constexpr uint32_t kPointerHighOffset { kPointerLowOffset + sizeof (uint32_t) };
+
+/**
+ * SegmentSearch struct: addresses whose objects are to be found by collect_segments, and the
+ * executable segments of the objects found.
+ */
+struct SegmentSearch {
+    std::vector<uintptr_t> m_addresses {};
+    std::vector<std::pair<uintptr_t, uintptr_t>> m_segments {};
+};
+
+/**
+ * collect_segments: dl_iterate_phdr callback that collects the executable segments of the
+ * objects that contain any of the searched addresses.
+ * @param info
+ * @param size
+ * @param data SegmentSearch object.
+ * @return Returns 0, to continue the iteration.
+ */
+static int collect_segments (struct dl_phdr_info* info, size_t size, void* data)
+{
+    (void)size;
+    auto* search = static_cast<SegmentSearch*> (data);
+
+    // check if the object contains any of the searched addresses
+    bool found = false;
+    for (int i = 0; i < info->dlpi_phnum && !found; i++) {
+        const auto& header = info->dlpi_phdr[i];
+        if (header.p_type != PT_LOAD) {
+            continue;
+        }
+
+        auto start = info->dlpi_addr + header.p_vaddr;
+        for (const auto& address : search->m_addresses) {
+            found |= (address >= start && address < start + header.p_memsz);
+        }
+    }
+
+    // collect its executable segments
+    for (int i = 0; i < info->dlpi_phnum && found; i++) {
+        const auto& header = info->dlpi_phdr[i];
+        if (header.p_type == PT_LOAD && (header.p_flags & PF_X) != 0) {
+            auto start = info->dlpi_addr + header.p_vaddr;
+            search->m_segments.emplace_back (start, start + header.p_memsz);
+        }
+    }
+
+    return 0;
+}
+
+// SeccompSupervisor parameterized constructor.
+SeccompSupervisor::SeccompSupervisor (std::shared_ptr<Log> log_ptr, Handler handler) :
+    m_log { log_ptr },
+    m_handler { handler }
+{
+    this->m_log->log_info ("SeccompSupervisor parameterized constructor.");
+}
+
+// SeccompSupervisor default destructor.
+SeccompSupervisor::~SeccompSupervisor ()
+{
+    this->m_log->log_info ("SeccompSupervisor default destructor.");
+}
+
+// is_enabled call. (...)
+bool SeccompSupervisor::is_enabled ()
+{
+    auto value = padll::configurations::PadllConfiguration::get_value (
+        option_seccomp_interception_env,
+        padll::configurations::padll_configuration ().get_seccomp_interception ());
+
+    return (value == nullptr) ? option_default_seccomp_interception
+                              : (std::string_view { value } == "true");
+}
+
+// collect_allowed_ranges call. (...)
+bool SeccompSupervisor::collect_allowed_ranges ()
+{
+    SegmentSearch search {};
+
+    // libc (found through the libc symbol of a call) and the dynamic loader (if any)
+    auto libc_read = padll::headers::libc_dispatch ().get<libc_read_t> (PosixCall::read);
+    if (libc_read == nullptr) {
+        return false;
+    }
+    search.m_addresses.push_back (reinterpret_cast<uintptr_t> (libc_read));
+
+    auto loader_base = ::getauxval (AT_BASE);
+    if (loader_base != 0) {
+        search.m_addresses.push_back (static_cast<uintptr_t> (loader_base));
+    }
+
+    ::dl_iterate_phdr (collect_segments, &search);
+    this->m_allowed_ranges = std::move (search.m_segments);
+
+    return !this->m_allowed_ranges.empty ();
+}
+
+// build_filter call. (...)
+std::vector<struct sock_filter> SeccompSupervisor::build_filter (
+    const std::vector<long>& syscalls) const
+{
+    // split the allowed ranges into [first, last] intervals that do not cross a 4 GiB boundary,
+    // since the instruction pointer is checked in two 32-bit words
+    std::vector<std::pair<uint64_t, uint64_t>> intervals {};
+    for (const auto& [start, end] : this->m_allowed_ranges) {
+        uint64_t first = start;
+        uint64_t last = end - 1;
+        while ((first >> 32) != (last >> 32)) {
+            uint64_t boundary = ((first >> 32) + 1) << 32;
+            intervals.emplace_back (first, boundary - 1);
+            first = boundary;
+        }
+        intervals.emplace_back (first, last);
+    }
+
+    // BPF jumps are limited to 255 instructions
+    if (syscalls.size () + 5 * intervals.size () > 255) {
+        return {};
+    }
+
+    std::vector<struct sock_filter> program {};
+
+    // allow calls of other architectures
+    program.push_back (BPF_STMT (BPF_LD | BPF_W | BPF_ABS, kArchOffset));
+    program.push_back (BPF_JUMP (BPF_JMP | BPF_JEQ | BPF_K, kAuditArch, 1, 0));
+    program.push_back (BPF_STMT (BPF_RET | BPF_K, SECCOMP_RET_ALLOW));
+
+    // jump to the instruction pointer checks if the call is in the set, or allow it otherwise
+    program.push_back (BPF_STMT (BPF_LD | BPF_W | BPF_ABS, kNumberOffset));
+    auto checks = program.size () + syscalls.size () + 1;
+    for (const auto& syscall : syscalls) {
+        auto offset = checks - program.size () - 1;
+        program.push_back (BPF_JUMP (BPF_JMP | BPF_JEQ | BPF_K,
+            static_cast<uint32_t> (syscall),
+            static_cast<uint8_t> (offset),
+            0));
+    }
+    program.push_back (BPF_STMT (BPF_RET | BPF_K, SECCOMP_RET_ALLOW));
+
+    // allow calls issued from the allowed intervals (five instructions each), or trap them
+    auto allow = checks + 5 * intervals.size () + 1;
+    for (const auto& [first, last] : intervals) {
+        auto offset = allow - program.size () - 5;
+        program.push_back (BPF_STMT (BPF_LD | BPF_W | BPF_ABS, kPointerHighOffset));
+        program.push_back (
+            BPF_JUMP (BPF_JMP | BPF_JEQ | BPF_K, static_cast<uint32_t> (first >> 32), 0, 3));
+        program.push_back (BPF_STMT (BPF_LD | BPF_W | BPF_ABS, kPointerLowOffset));
+        program.push_back (
+            BPF_JUMP (BPF_JMP | BPF_JGE | BPF_K, static_cast<uint32_t> (first), 0, 1));
+        program.push_back (BPF_JUMP (BPF_JMP | BPF_JGT | BPF_K,
+            static_cast<uint32_t> (last),
+            0,
+            static_cast<uint8_t> (offset)));
+    }
+    program.push_back (BPF_STMT (BPF_RET | BPF_K, SECCOMP_RET_USER_NOTIF));
+    program.push_back (BPF_STMT (BPF_RET | BPF_K, SECCOMP_RET_ALLOW));
+
+    return program;
+}
+
+// install_filter call. (...)
+int SeccompSupervisor::install_filter (std::vector<struct sock_filter>& program)
+{
+    struct sock_fprog filter {};
+    filter.len = static_cast<unsigned short> (program.size ());
+    filter.filter = program.data ();
+
+    // unprivileged threads can only install filters with no_new_privs set
+    if (::prctl (PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) == -1) {
+        this->m_log->log_error (
+            "Error while setting no_new_privs: " + std::string { std::strerror (errno) });
+        return -1;
+    }
+
+    // once a trapped call is received, only fatal signals interrupt the calling thread; otherwise,
+    // an interrupted call (which may have already been performed) would be restarted
+    auto listener = ::syscall (SYS_seccomp,
+        SECCOMP_SET_MODE_FILTER,
+        SECCOMP_FILTER_FLAG_NEW_LISTENER | SECCOMP_FILTER_FLAG_WAIT_KILLABLE_RECV,
+        &filter);
+
+    if (listener == -1 && errno == EINVAL) {
+        this->m_log->log_error (
+            "SECCOMP_FILTER_FLAG_WAIT_KILLABLE_RECV not supported: trapped calls interrupted by "
+            "signals may be restarted.");
+        listener = ::syscall (SYS_seccomp,
+            SECCOMP_SET_MODE_FILTER,
+            SECCOMP_FILTER_FLAG_NEW_LISTENER,
+            &filter);
+    }
+
+    if (listener == -1) {
+        this->m_log->log_error (
+            "Error while installing seccomp filter: " + std::string { std::strerror (errno) });
+    }
+
+    return static_cast<int> (listener);
+}
+
+// is_own_thread call. (...)
+bool SeccompSupervisor::is_own_thread (const pid_t& tid)
+{
+    return ::syscall (SYS_tgkill, ::getpid (), tid, 0) == 0;
+}
+
+// serve call. (...)
+void SeccompSupervisor::serve (const int listener, const Handler handler)
+{
+    while (true) {
+        struct seccomp_notif request {};
+        if (::ioctl (listener, SECCOMP_IOCTL_NOTIF_RECV, &request) == -1) {
+            // the calling thread may have been interrupted before the call was received
+            if (errno == EINTR || errno == ENOENT) {
+                continue;
+            }
+            return;
+        }
+
+        struct seccomp_notif_resp response {};
+        response.id = request.id;
+
+        // calls of other processes (e.g., forked children), and calls declined by the handler, are
+        // performed by the calling thread
+        if (!SeccompSupervisor::is_own_thread (static_cast<pid_t> (request.pid))
+            || !handler (request, response)) {
+            response.val = 0;
+            response.error = 0;
+            response.flags = SECCOMP_USER_NOTIF_FLAG_CONTINUE;
+        }
+
+        // the calling thread may have been killed meanwhile (ENOENT)
+        ::ioctl (listener, SECCOMP_IOCTL_NOTIF_SEND, &response);
+    }
+}
+
+// start call. (...)
+bool SeccompSupervisor::start (const std::vector<long>& syscalls, const int& workers)
+{
+    if (kAuditArch == 0) {
+        this->m_log->log_error ("Seccomp interception is not supported in this architecture.");
+        return false;
+    }
+
+    if (syscalls.empty () || workers <= 0) {
+        this->m_log->log_error ("Seccomp interception enabled without calls nor workers.");
+        return false;
+    }
+
+    if (!this->collect_allowed_ranges ()) {
+        this->m_log->log_error ("Error while collecting the executable segments of libc.");
+        return false;
+    }
+
+    auto program = this->build_filter (syscalls);
+    if (program.empty ()) {
+        this->m_log->log_error ("Error while building seccomp filter (too many segments).");
+        return false;
+    }
+
+    // spawn the supervisor threads before installing the filter, so that they are not filtered;
+    // they start serving once the listener is published (or exit if it could not be created)
+    std::promise<int> listener_promise {};
+    std::shared_future<int> listener { listener_promise.get_future ().share () };
+    for (int i = 0; i < workers; i++) {
+        std::thread ([listener, handler = this->m_handler] () {
+            if (listener.get () != -1) {
+                SeccompSupervisor::serve (listener.get (), handler);
+            }
+        }).detach ();
+    }
+
+    this->m_listener = this->install_filter (program);
+    listener_promise.set_value (this->m_listener);
+
+    if (this->m_listener != -1) {
+        std::stringstream stream;
+        stream << "SeccompSupervisor: trapping " << syscalls.size () << " calls (";
+        stream << this->m_allowed_ranges.size () << " allowed segments, " << workers;
+        stream << " workers).";
+        this->m_log->log_info (stream.str ());
+    }
+
+    return this->m_listener != -1;
+}
+
+// is_running call. (...)
+bool SeccompSupervisor::is_running () const
+{
+    return this->m_listener != -1;
+}
+
+} // namespace padll::interface::native
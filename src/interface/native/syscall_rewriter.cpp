@@ -0,0 +1,801 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <dlfcn.h>
+#include <link.h>
+#include <padll/configurations/padll_configuration.hpp>
+#include <padll/interface/native/syscall_rewriter.hpp>
+#include <sstream>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// flag of recent kernels (Linux 4.17), which may be missing from older headers
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+namespace padll::interface::native {
+
+// size of the region of the trampolines, and maximum distance from the rewritten functions
+static constexpr std::size_t kTrampolinesSize { 64 * 1024 };
+static constexpr uintptr_t kTrampolinesStep { 1024 * 1024 };
+static constexpr uintptr_t kTrampolinesReach { 1024 * 1024 * 1024 };
+
+// the first bytes of the region hold the address of padll_rewrite_entry
+static constexpr std::size_t kEntrySlotSize { 16 };
+
+// length of a 32-bit relative jump (the patch), of a system call instruction, and maximum length
+// of an x86-64 instruction
+static constexpr std::size_t kJumpLength { 5 };
+static constexpr std::size_t kSyscallLength { 2 };
+static constexpr std::size_t kMaxInstructionLength { 15 };
+
+/**
+ * RewriteContext struct: registers of an intercepted system call, as saved by
+ * padll_rewrite_entry: the call number (rax), and its arguments (rdi, rsi, rdx, r10, r8, and r9).
+ */
+struct RewriteContext {
+    __u64 m_number;
+    __u64 m_args[6];
+};
+
+// handler of the intercepted calls (set before any instruction is rewritten)
+static SyscallRewriter::Handler s_handler { nullptr };
+
+// set while the calling thread is handling a call, so that the calls it issues are performed as is
+static thread_local bool s_dispatching { false };
+
+/**
+ * padll_rewrite_dispatch: single C-ABI dispatcher of the rewritten system call instructions,
+ * called by padll_rewrite_entry.
+ * @param context Registers of the call; its number is replaced by the result of handled calls.
+ * @return Returns 1 if the call was handled, or 0 if it is to be performed as is.
+ */
+extern "C" __attribute__ ((visibility ("hidden"), used)) int padll_rewrite_dispatch (
+    RewriteContext* context)
+{
+    // calls issued while handling a call (e.g., the libc call that performs it) are performed as is
+    if (s_dispatching || s_handler == nullptr) {
+        return 0;
+    }
+
+    // errno is only to be set by the libc wrapper, from the result of the call
+    auto error = errno;
+    long result = 0;
+    s_dispatching = true;
+    auto handled = s_handler (static_cast<long> (context->m_number), context->m_args, result);
+    s_dispatching = false;
+    errno = error;
+
+    if (handled) {
+        context->m_number = static_cast<__u64> (result);
+    }
+
+    return handled ? 1 : 0;
+}
+
+#if defined(__x86_64__)
+/**
+ * padll_rewrite_entry: entry point of the trampolines, called below the red zone of the
+ * interrupted code. It saves the flags, the registers of the call (RewriteContext), and the SSE
+ * registers (which a system call instruction preserves), calls padll_rewrite_dispatch, and
+ * returns in rcx whether the call was handled (with its result in rax). Otherwise, the registers of
+ * the call are restored, for the trampoline to perform it. rcx and r11 are clobbered, as by a
+ * system call instruction.
+ */
+extern "C" void padll_rewrite_entry ();
+
+asm (R"(
+    .text
+    .p2align 4
+    .globl padll_rewrite_entry
+    .hidden padll_rewrite_entry
+    .type padll_rewrite_entry, @function
+padll_rewrite_entry:
+    pushfq
+    pushq %rbp
+    movq %rsp, %rbp
+    pushq %r9
+    pushq %r8
+    pushq %r10
+    pushq %rdx
+    pushq %rsi
+    pushq %rdi
+    pushq %rax
+    movq %rsp, %rdi
+    andq $-16, %rsp
+    subq $256, %rsp
+    movaps %xmm0, 0(%rsp)
+    movaps %xmm1, 16(%rsp)
+    movaps %xmm2, 32(%rsp)
+    movaps %xmm3, 48(%rsp)
+    movaps %xmm4, 64(%rsp)
+    movaps %xmm5, 80(%rsp)
+    movaps %xmm6, 96(%rsp)
+    movaps %xmm7, 112(%rsp)
+    movaps %xmm8, 128(%rsp)
+    movaps %xmm9, 144(%rsp)
+    movaps %xmm10, 160(%rsp)
+    movaps %xmm11, 176(%rsp)
+    movaps %xmm12, 192(%rsp)
+    movaps %xmm13, 208(%rsp)
+    movaps %xmm14, 224(%rsp)
+    movaps %xmm15, 240(%rsp)
+    call padll_rewrite_dispatch
+    movaps 0(%rsp), %xmm0
+    movaps 16(%rsp), %xmm1
+    movaps 32(%rsp), %xmm2
+    movaps 48(%rsp), %xmm3
+    movaps 64(%rsp), %xmm4
+    movaps 80(%rsp), %xmm5
+    movaps 96(%rsp), %xmm6
+    movaps 112(%rsp), %xmm7
+    movaps 128(%rsp), %xmm8
+    movaps 144(%rsp), %xmm9
+    movaps 160(%rsp), %xmm10
+    movaps 176(%rsp), %xmm11
+    movaps 192(%rsp), %xmm12
+    movaps 208(%rsp), %xmm13
+    movaps 224(%rsp), %xmm14
+    movaps 240(%rsp), %xmm15
+    leaq -56(%rbp), %rsp
+    movl %eax, %ecx
+    popq %rax
+    popq %rdi
+    popq %rsi
+    popq %rdx
+    popq %r10
+    popq %r8
+    popq %r9
+    popq %rbp
+    popfq
+    ret
+    .size padll_rewrite_entry, .-padll_rewrite_entry
+)");
+
+/**
+ * Instruction struct: decoded x86-64 instruction, with the properties needed to relocate it.
+ */
+struct Instruction {
+    uintptr_t m_address { 0 };
+    std::size_t m_length { 0 };
+    bool m_syscall { false };
+    bool m_relocatable { true };
+    bool m_branch { false };
+    uintptr_t m_target { 0 };
+};
+
+/**
+ * in_range: check if an opcode is within [first, last].
+ */
+static inline bool in_range (const unsigned char& opcode,
+    const unsigned char& first,
+    const unsigned char& last)
+{
+    return opcode >= first && opcode <= last;
+}
+
+/**
+ * has_immediate_0f: check if an opcode of the 0F map (legacy or VEX/EVEX encoded) with a ModRM
+ * byte takes an 8-bit immediate.
+ */
+static inline bool has_immediate_0f (const unsigned char& opcode)
+{
+    return in_range (opcode, 0x70, 0x73) || opcode == 0xA4 || opcode == 0xAC || opcode == 0xBA
+        || in_range (opcode, 0xC2, 0xC6);
+}
+
+/**
+ * decode_instruction: length decoder of x86-64 instructions (general-purpose, x87, SSE, and
+ * VEX/EVEX encoded). Besides the length, it identifies system call instructions, relative branches
+ * (and their targets), and instructions that cannot be executed at another address (RIP-relative
+ * operands, branches, and returns).
+ * @param code Bytes of the instruction.
+ * @param available Number of bytes that can be read.
+ * @param instruction Decoded instruction (its address must be set).
+ * @return Returns false if the instruction is invalid or not supported.
+ */
+static bool decode_instruction (const unsigned char* code,
+    const std::size_t& available,
+    Instruction& instruction)
+{
+    std::size_t length = 0;
+    auto next = [&] (unsigned char& byte) {
+        if (length >= available || length >= kMaxInstructionLength) {
+            return false;
+        }
+        byte = code[length++];
+        return true;
+    };
+
+    // legacy prefixes, and REX prefix (which must precede the opcode)
+    bool operand_16 = false;
+    bool address_32 = false;
+    unsigned char opcode = 0;
+    do {
+        if (!next (opcode)) {
+            return false;
+        }
+        operand_16 |= (opcode == 0x66);
+        address_32 |= (opcode == 0x67);
+    } while (opcode == 0x66 || opcode == 0x67 || opcode == 0xF0 || opcode == 0xF2 || opcode == 0xF3
+        || opcode == 0x2E || opcode == 0x36 || opcode == 0x3E || opcode == 0x26 || opcode == 0x64
+        || opcode == 0x65);
+
+    bool rex_w = false;
+    if ((opcode & 0xF0) == 0x40) {
+        rex_w = (opcode & 0x08) != 0;
+        if (!next (opcode)) {
+            return false;
+        }
+    }
+
+    const std::size_t immediate_z = operand_16 ? 2 : 4;
+    std::size_t immediate = 0;
+    std::size_t relative = 0;
+    bool modrm = false;
+    int map = 0;
+
+    if (opcode == 0x0F) {
+        if (!next (opcode)) {
+            return false;
+        }
+
+        if (opcode == 0x38 || opcode == 0x3A) {
+            map = (opcode == 0x38) ? 2 : 3;
+            if (!next (opcode)) {
+                return false;
+            }
+            modrm = true;
+            immediate = (map == 3) ? 1 : 0;
+        } else {
+            map = 1;
+            if (opcode == 0x05) {
+                instruction.m_syscall = true;
+                instruction.m_relocatable = false;
+            } else if (opcode == 0x07 || opcode == 0x0B || opcode == 0x34 || opcode == 0x35) {
+                instruction.m_relocatable = false;
+            } else if (in_range (opcode, 0x80, 0x8F)) {
+                relative = 4;
+            } else if (opcode == 0x06 || opcode == 0x08 || opcode == 0x09 || opcode == 0x0E
+                || in_range (opcode, 0x30, 0x33) || opcode == 0x37 || opcode == 0x77
+                || in_range (opcode, 0xA0, 0xA2) || in_range (opcode, 0xA8, 0xAA)
+                || in_range (opcode, 0xC8, 0xCF)) {
+                // no operands
+            } else if (opcode == 0x04 || opcode == 0x0A || opcode == 0x0C || opcode == 0x0F
+                || in_range (opcode, 0x24, 0x27) || opcode == 0x36 || opcode == 0x39
+                || in_range (opcode, 0x3B, 0x3F)) {
+                return false;
+            } else {
+                modrm = true;
+                immediate = has_immediate_0f (opcode) ? 1 : 0;
+            }
+        }
+    } else if (opcode == 0xC4 || opcode == 0xC5 || opcode == 0x62) {
+        // VEX (two and three bytes) and EVEX prefixes, with the map in the first payload byte
+        unsigned char payload = 0;
+        if (!next (payload)) {
+            return false;
+        }
+        map = (opcode == 0xC5) ? 1 : ((opcode == 0xC4) ? (payload & 0x1F) : (payload & 0x07));
+        for (int i = (opcode == 0xC5) ? 0 : ((opcode == 0xC4) ? 1 : 2); i > 0; i--) {
+            if (!next (payload)) {
+                return false;
+            }
+        }
+        if (!next (opcode) || map < 1 || map > 6 || map == 4) {
+            return false;
+        }
+
+        // vzeroupper and vzeroall have no operands
+        modrm = !(map == 1 && opcode == 0x77);
+        immediate = (map == 3 || (map == 1 && has_immediate_0f (opcode))) ? 1 : 0;
+    } else if (opcode < 0x40) {
+        // arithmetic instructions (the remaining opcodes are prefixes or invalid in 64-bit mode)
+        auto column = opcode & 0x07;
+        if (column > 5) {
+            return false;
+        }
+        modrm = column < 4;
+        immediate = (column == 4) ? 1 : ((column == 5) ? immediate_z : 0);
+    } else if (opcode < 0x50) {
+        // REX prefix not followed by the opcode
+        return false;
+    } else if (in_range (opcode, 0x50, 0x5F) || in_range (opcode, 0x6C, 0x6F)
+        || in_range (opcode, 0x90, 0x99) || in_range (opcode, 0x9B, 0x9F)
+        || in_range (opcode, 0xA4, 0xA7) || in_range (opcode, 0xAA, 0xAF) || opcode == 0xC9
+        || opcode == 0xD7 || in_range (opcode, 0xEC, 0xEF) || opcode == 0xF5
+        || in_range (opcode, 0xF8, 0xFD)) {
+        // no operands
+    } else if (opcode == 0x63 || in_range (opcode, 0x84, 0x8F) || in_range (opcode, 0xD0, 0xD3)
+        || in_range (opcode, 0xD8, 0xDF) || in_range (opcode, 0xF6, 0xF7)
+        || in_range (opcode, 0xFE, 0xFF)) {
+        modrm = true;
+    } else if (opcode == 0x6B || opcode == 0x80 || opcode == 0x83 || in_range (opcode, 0xC0, 0xC1)
+        || opcode == 0xC6) {
+        modrm = true;
+        immediate = 1;
+    } else if (opcode == 0x69 || opcode == 0x81 || opcode == 0xC7) {
+        modrm = true;
+        immediate = immediate_z;
+    } else if (opcode == 0x6A || opcode == 0xA8 || in_range (opcode, 0xB0, 0xB7)
+        || in_range (opcode, 0xE4, 0xE7)) {
+        immediate = 1;
+    } else if (opcode == 0x68 || opcode == 0xA9) {
+        immediate = immediate_z;
+    } else if (in_range (opcode, 0xB8, 0xBF)) {
+        immediate = rex_w ? 8 : immediate_z;
+    } else if (in_range (opcode, 0xA0, 0xA3)) {
+        immediate = address_32 ? 4 : 8;
+    } else if (opcode == 0xC8) {
+        immediate = 3;
+    } else if (in_range (opcode, 0x70, 0x7F) || in_range (opcode, 0xE0, 0xE3) || opcode == 0xEB) {
+        relative = 1;
+    } else if (opcode == 0xE8 || opcode == 0xE9) {
+        relative = 4;
+    } else if (opcode == 0xC2 || opcode == 0xCA) {
+        immediate = 2;
+        instruction.m_relocatable = false;
+    } else if (opcode == 0xCD) {
+        immediate = 1;
+        instruction.m_relocatable = false;
+    } else if (opcode == 0xC3 || opcode == 0xCB || opcode == 0xCC || opcode == 0xCF
+        || opcode == 0xF1 || opcode == 0xF4) {
+        instruction.m_relocatable = false;
+    } else {
+        return false;
+    }
+
+    if (modrm) {
+        unsigned char byte = 0;
+        if (!next (byte)) {
+            return false;
+        }
+
+        auto mod = byte >> 6;
+        auto reg = (byte >> 3) & 0x07;
+        auto rm = byte & 0x07;
+        std::size_t displacement = (mod == 1) ? 1 : ((mod == 2) ? 4 : 0);
+
+        if (mod != 3 && rm == 4) {
+            unsigned char sib = 0;
+            if (!next (sib)) {
+                return false;
+            }
+            displacement = (mod == 0 && (sib & 0x07) == 5) ? 4 : displacement;
+        } else if (mod == 0 && rm == 5) {
+            // RIP-relative operand
+            displacement = 4;
+            instruction.m_relocatable = false;
+        }
+        length += displacement;
+
+        if (map == 0 && (opcode == 0xF6 || opcode == 0xF7) && reg < 2) {
+            // test r/m, imm
+            immediate = (opcode == 0xF6) ? 1 : immediate_z;
+        } else if (map == 0 && opcode == 0xFF && reg >= 2 && reg <= 5) {
+            // indirect calls and jumps
+            instruction.m_relocatable = false;
+        } else if (map == 0 && opcode == 0xC7 && byte == 0xF8) {
+            // xbegin
+            relative = immediate;
+            immediate = 0;
+        }
+    }
+
+    length += immediate + relative;
+    if (length > available || length > kMaxInstructionLength) {
+        return false;
+    }
+    instruction.m_length = length;
+
+    if (relative > 0) {
+        int64_t offset = 0;
+        if (relative == 1) {
+            offset = static_cast<int8_t> (code[length - 1]);
+        } else {
+            int32_t offset_32 = 0;
+            std::memcpy (&offset_32, code + length - relative, sizeof (offset_32));
+            offset = offset_32;
+        }
+        instruction.m_branch = true;
+        instruction.m_relocatable = false;
+        instruction.m_target = instruction.m_address + length + offset;
+    }
+
+    return true;
+}
+
+/**
+ * select_window: select the instructions to be relocated with a system call instruction, so that
+ * they cover the 5 bytes of a jump: the instruction and its successors or, otherwise, its
+ * predecessors. Instructions (other than the system call) must be relocatable, and only the first
+ * one of the window may be the target of a branch.
+ * @param instructions Decoded instructions of the function.
+ * @param targets Targets of the branches of the function.
+ * @param site Index of the system call instruction.
+ * @param lower Index of the first instruction that is not part of a previous window.
+ * @param first Index of the first instruction of the window.
+ * @param last Index of the last instruction of the window.
+ * @return Returns true if a window was found.
+ */
+static bool select_window (const std::vector<Instruction>& instructions,
+    const std::vector<uintptr_t>& targets,
+    const std::size_t& site,
+    const std::size_t& lower,
+    std::size_t& first,
+    std::size_t& last)
+{
+    auto is_target = [&targets] (const Instruction& instruction) {
+        return std::find (targets.begin (), targets.end (), instruction.m_address) != targets.end ();
+    };
+
+    // the system call instruction and its successors
+    first = site;
+    last = site;
+    std::size_t covered = instructions[site].m_length;
+    while (covered < kJumpLength && last + 1 < instructions.size ()
+        && instructions[last + 1].m_relocatable && !is_target (instructions[last + 1])) {
+        covered += instructions[++last].m_length;
+    }
+
+    if (covered >= kJumpLength) {
+        return true;
+    }
+
+    // the system call instruction and its predecessors
+    last = site;
+    covered = instructions[site].m_length;
+    while (covered < kJumpLength) {
+        if (first <= lower || is_target (instructions[first])
+            || !instructions[first - 1].m_relocatable) {
+            return false;
+        }
+        covered += instructions[--first].m_length;
+    }
+
+    return true;
+}
+
+/**
+ * fits_relative_32: check if the distance of a 32-bit relative jump fits its displacement.
+ */
+static inline bool fits_relative_32 (const uintptr_t& from, const uintptr_t& to)
+{
+    auto distance = static_cast<int64_t> (to - from);
+    return distance >= INT32_MIN && distance <= INT32_MAX;
+}
+
+/**
+ * append_relative_32: append the 32-bit displacement from the end of an instruction to a target.
+ */
+static inline void append_relative_32 (std::vector<unsigned char>& code,
+    const uintptr_t& end,
+    const uintptr_t& target)
+{
+    auto displacement = static_cast<int32_t> (static_cast<int64_t> (target - end));
+    unsigned char bytes[sizeof (displacement)];
+    std::memcpy (bytes, &displacement, sizeof (displacement));
+    code.insert (code.end (), bytes, bytes + sizeof (bytes));
+}
+#endif
+
+// SyscallRewriter parameterized constructor.
+SyscallRewriter::SyscallRewriter (std::shared_ptr<Log> log_ptr, Handler handler) :
+    m_log { log_ptr },
+    m_handler { handler }
+{
+    this->m_log->log_info ("SyscallRewriter parameterized constructor.");
+}
+
+// SyscallRewriter default destructor.
+SyscallRewriter::~SyscallRewriter ()
+{
+    this->m_log->log_info ("SyscallRewriter default destructor.");
+}
+
+// is_enabled call. (...)
+bool SyscallRewriter::is_enabled ()
+{
+    auto value = padll::configurations::PadllConfiguration::get_value (option_binary_rewriting_env,
+        padll::configurations::padll_configuration ().get_binary_rewriting ());
+
+    return (value == nullptr) ? option_default_binary_rewriting
+                              : (std::string_view { value } == "true");
+}
+
+// direct_system_call call. (...)
+long SyscallRewriter::direct_system_call (long number,
+    long arg0,
+    long arg1,
+    long arg2,
+    long arg3,
+    long arg4,
+    long arg5)
+{
+#if defined(__x86_64__)
+    long result;
+    register long r10 asm ("r10") = arg3;
+    register long r8 asm ("r8") = arg4;
+    register long r9 asm ("r9") = arg5;
+    asm volatile ("syscall"
+                  : "=a"(result)
+                  : "a"(number), "D"(arg0), "S"(arg1), "d"(arg2), "r"(r10), "r"(r8), "r"(r9)
+                  : "rcx", "r11", "memory");
+    return result;
+#else
+    (void)number;
+    (void)arg0;
+    (void)arg1;
+    (void)arg2;
+    (void)arg3;
+    (void)arg4;
+    (void)arg5;
+    return -ENOSYS;
+#endif
+}
+
+// is_interposed call. (...)
+bool SyscallRewriter::is_interposed (const char* symbol)
+{
+    Dl_info definition {};
+    Dl_info own {};
+    auto* address = ::dlsym (RTLD_DEFAULT, symbol);
+
+    if (address == nullptr || ::dladdr (address, &definition) == 0
+        || ::dladdr (reinterpret_cast<const void*> (&s_handler), &own) == 0) {
+        return false;
+    }
+
+    return definition.dli_fbase == own.dli_fbase;
+}
+
+// allocate_trampolines call. (...)
+bool SyscallRewriter::allocate_trampolines (const uintptr_t& address)
+{
+#if defined(__x86_64__)
+    // search a free range below (and then above) the function, so that older kernels, which take
+    // the address as a hint, cannot map the region elsewhere
+    auto base = address & ~(static_cast<uintptr_t> (kTrampolinesSize) - 1);
+    for (uintptr_t distance = kTrampolinesStep; distance < kTrampolinesReach;
+         distance += kTrampolinesStep) {
+        for (auto candidate : { base - distance, base + distance }) {
+            if (distance > base && candidate == base - distance) {
+                continue;
+            }
+
+            auto* region = ::mmap (reinterpret_cast<void*> (candidate),
+                kTrampolinesSize,
+                PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                -1,
+                0);
+
+            if (region == MAP_FAILED) {
+                continue;
+            } else if (reinterpret_cast<uintptr_t> (region) != candidate) {
+                ::munmap (region, kTrampolinesSize);
+                continue;
+            }
+
+            // the trampolines call padll_rewrite_entry through the slot at the start of the region
+            auto entry = reinterpret_cast<uintptr_t> (&padll_rewrite_entry);
+            this->m_trampolines = static_cast<unsigned char*> (region);
+            std::memcpy (this->m_trampolines, &entry, sizeof (entry));
+            this->m_trampolines_used = kEntrySlotSize;
+
+            return true;
+        }
+    }
+#else
+    (void)address;
+#endif
+
+    return false;
+}
+
+// rewrite_site call. (...)
+bool SyscallRewriter::rewrite_site (const uintptr_t& first,
+    const uintptr_t& site,
+    const uintptr_t& end)
+{
+#if defined(__x86_64__)
+    if (this->m_trampolines == nullptr && !this->allocate_trampolines (first)) {
+        this->m_log->log_error ("Error while mapping the trampolines of the SyscallRewriter.");
+        return false;
+    }
+
+    auto address = reinterpret_cast<uintptr_t> (this->m_trampolines + this->m_trampolines_used);
+    std::vector<unsigned char> code {};
+
+    // instructions that precede the system call
+    code.insert (code.end (),
+        reinterpret_cast<const unsigned char*> (first),
+        reinterpret_cast<const unsigned char*> (site));
+
+    // lea -128(%rsp), %rsp (skip the red zone); call *entry_slot(%rip); lea 128(%rsp), %rsp
+    code.insert (code.end (), { 0x48, 0x8D, 0x64, 0x24, 0x80, 0xFF, 0x15 });
+    append_relative_32 (code,
+        address + code.size () + sizeof (int32_t),
+        reinterpret_cast<uintptr_t> (this->m_trampolines));
+    code.insert (code.end (), { 0x48, 0x8D, 0xA4, 0x24, 0x80, 0x00, 0x00, 0x00 });
+
+    // jrcxz +2 (the call was not handled); jmp +2; syscall
+    code.insert (code.end (), { 0xE3, 0x02, 0xEB, 0x02, 0x0F, 0x05 });
+
+    // instructions that follow the system call, and jmp end
+    code.insert (code.end (),
+        reinterpret_cast<const unsigned char*> (site + kSyscallLength),
+        reinterpret_cast<const unsigned char*> (end));
+    code.push_back (0xE9);
+    append_relative_32 (code, address + code.size () + sizeof (int32_t), end);
+
+    auto reserved = (code.size () + 15) & ~static_cast<std::size_t> (15);
+    if (this->m_trampolines_used + reserved > kTrampolinesSize
+        || !fits_relative_32 (first + kJumpLength, address)
+        || !fits_relative_32 (address + code.size (), end)) {
+        return false;
+    }
+
+    std::memcpy (this->m_trampolines + this->m_trampolines_used, code.data (), code.size ());
+    this->m_trampolines_used += reserved;
+
+    // jmp trampoline, with the remaining bytes of the window filled with int3
+    Patch patch { first, { 0xE9 } };
+    append_relative_32 (patch.m_bytes, first + kJumpLength, address);
+    patch.m_bytes.resize (end - first, 0xCC);
+    this->m_patches.push_back (std::move (patch));
+
+    return true;
+#else
+    (void)first;
+    (void)site;
+    (void)end;
+    return false;
+#endif
+}
+
+// rewrite_function call. (...)
+int SyscallRewriter::rewrite_function (void* function)
+{
+#if defined(__x86_64__)
+    Dl_info info {};
+    void* entry = nullptr;
+    if (::dladdr1 (function, &info, &entry, RTLD_DL_SYMENT) == 0 || entry == nullptr
+        || info.dli_saddr == nullptr) {
+        return -1;
+    }
+
+    const auto* symbol = static_cast<const ElfW (Sym)*> (entry);
+    if (symbol->st_size == 0) {
+        return -1;
+    }
+
+    // decode the function, and collect the targets of its branches
+    auto start = reinterpret_cast<uintptr_t> (info.dli_saddr);
+    auto end = start + symbol->st_size;
+    std::vector<Instruction> instructions {};
+    std::vector<uintptr_t> targets {};
+
+    for (auto address = start; address < end;) {
+        Instruction instruction {};
+        instruction.m_address = address;
+        if (!decode_instruction (reinterpret_cast<const unsigned char*> (address),
+                end - address,
+                instruction)) {
+            return -1;
+        }
+
+        if (instruction.m_branch) {
+            targets.push_back (instruction.m_target);
+        }
+        instructions.push_back (instruction);
+        address += instruction.m_length;
+    }
+
+    int rewritten = 0;
+    std::size_t lower = 0;
+    for (std::size_t i = 0; i < instructions.size (); i++) {
+        std::size_t first = 0;
+        std::size_t last = 0;
+        if (!instructions[i].m_syscall || i < lower
+            || !select_window (instructions, targets, i, lower, first, last)) {
+            continue;
+        }
+
+        const auto& tail = instructions[last];
+        if (this->rewrite_site (instructions[first].m_address,
+                instructions[i].m_address,
+                tail.m_address + tail.m_length)) {
+            rewritten++;
+            lower = last + 1;
+        }
+    }
+
+    return rewritten;
+#else
+    (void)function;
+    return -1;
+#endif
+}
+
+// apply_patch call. (...)
+bool SyscallRewriter::apply_patch (const Patch& patch)
+{
+    auto page_size = static_cast<uintptr_t> (::sysconf (_SC_PAGESIZE));
+    auto begin = patch.m_address & ~(page_size - 1);
+    auto end = (patch.m_address + patch.m_bytes.size () + page_size - 1) & ~(page_size - 1);
+    auto* pages = reinterpret_cast<void*> (begin);
+
+    // pages remain executable, since the calling thread may be running code of the same pages
+    if (::mprotect (pages, end - begin, PROT_READ | PROT_WRITE | PROT_EXEC) != 0) {
+        this->m_log->log_error (
+            "Error while unprotecting libc's code: " + std::string { std::strerror (errno) });
+        return false;
+    }
+
+    std::memcpy (reinterpret_cast<void*> (patch.m_address),
+        patch.m_bytes.data (),
+        patch.m_bytes.size ());
+
+    return ::mprotect (pages, end - begin, PROT_READ | PROT_EXEC) == 0;
+}
+
+// start call. (...)
+bool SyscallRewriter::start (const std::vector<void*>& functions)
+{
+#if defined(__x86_64__)
+    if (functions.empty ()) {
+        this->m_log->log_error ("Binary rewriting enabled without calls.");
+        return false;
+    }
+
+    s_handler = this->m_handler;
+
+    int skipped = 0;
+    for (auto* function : functions) {
+        if (this->rewrite_function (function) < 0) {
+            skipped++;
+        }
+    }
+
+    // trampolines must be executable before any jump to them is written
+    if (this->m_trampolines == nullptr
+        || ::mprotect (this->m_trampolines, kTrampolinesSize, PROT_READ | PROT_EXEC) != 0) {
+        this->m_log->log_error ("Error while rewriting libc's system call instructions.");
+        return false;
+    }
+
+    for (const auto& patch : this->m_patches) {
+        if (!this->apply_patch (patch)) {
+            break;
+        }
+        this->m_rewritten_sites++;
+    }
+
+    std::stringstream stream;
+    stream << "SyscallRewriter: rewrote " << this->m_rewritten_sites << " of ";
+    stream << this->m_patches.size () << " system call instructions (" << functions.size ();
+    stream << " functions, " << skipped << " not decoded).";
+    this->m_log->log_info (stream.str ());
+
+    return this->is_running ();
+#else
+    (void)functions;
+    this->m_log->log_error ("Binary rewriting is not supported in this architecture.");
+    return false;
+#endif
+}
+
+// is_running call. (...)
+bool SyscallRewriter::is_running () const
+{
+    return this->m_rewritten_sites > 0;
+}
+
+} // namespace padll::interface::native
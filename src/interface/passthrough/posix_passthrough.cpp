@@ -3,6 +3,7 @@
  *   Copyright (c) 2021-2023 INESC TEC.
  **/
 
+#include <cstring>
 #include <padll/interface/passthrough/posix_passthrough.hpp>
 #include <utility>
 
@@ -69,6 +70,10 @@ PosixPassthrough::~PosixPassthrough ()
     if (this->m_lib_handle != nullptr && !::dlclose (this->m_lib_handle)) {
         this->m_log->log_error ("PosixPassthrough::Error while closing dynamic link.\n");
     }
+
+    // stop statistic collection, since calls issued during process teardown (e.g., stdio writes
+    // of the logging backend) may still reach this object
+    this->m_collect = false;
 }
 
 // to_string call.
@@ -134,6 +139,13 @@ void PosixPassthrough::initialize ()
             + (this->m_lib_name.empty () ? "<undefined lib>" : this->m_lib_name) + ".");
         return;
     }
+
+    // resolve the libc dispatch table (shared with DlsymHookLibc)
+    auto unresolved = libc_dispatch ().initialize ();
+    if (unresolved > 0) {
+        this->m_log->log_error ("PosixPassthrough::Error while resolving "
+            + std::to_string (unresolved) + " libc symbols.");
+    }
 }
 
 // set_statistic_collection call.
@@ -170,7 +182,7 @@ StatisticEntry PosixPassthrough::get_statistic_entry (const OperationType& opera
 // passthrough_posix_read call.
 ssize_t PosixPassthrough::passthrough_posix_read (int fd, void* buf, size_t counter)
 {
-    ssize_t result = ((libc_read_t)dlsym (RTLD_NEXT, "read")) (fd, buf, counter);
+    ssize_t result = libc_dispatch ().get<libc_read_t> (PosixCall::read) (fd, buf, counter);
 
     // update statistic entry
     if (this->m_collect) {
@@ -187,7 +199,7 @@ ssize_t PosixPassthrough::passthrough_posix_read (int fd, void* buf, size_t coun
 // passthrough_posix_write call.
 ssize_t PosixPassthrough::passthrough_posix_write (int fd, const void* buf, size_t counter)
 {
-    ssize_t result = ((libc_write_t)dlsym (RTLD_NEXT, "write")) (fd, buf, counter);
+    ssize_t result = libc_dispatch ().get<libc_write_t> (PosixCall::write) (fd, buf, counter);
 
     // update statistic entry
     if (this->m_collect) {
@@ -204,7 +216,10 @@ ssize_t PosixPassthrough::passthrough_posix_write (int fd, const void* buf, size
 // passthrough_posix_pread call.
 ssize_t PosixPassthrough::passthrough_posix_pread (int fd, void* buf, size_t counter, off_t offset)
 {
-    ssize_t result = ((libc_pread_t)dlsym (RTLD_NEXT, "pread")) (fd, buf, counter, offset);
+    ssize_t result = libc_dispatch ().get<libc_pread_t> (PosixCall::pread) (fd,
+        buf,
+        counter,
+        offset);
 
     // update statistic entry
     if (this->m_collect) {
@@ -222,7 +237,10 @@ ssize_t PosixPassthrough::passthrough_posix_pread (int fd, void* buf, size_t cou
 ssize_t
 PosixPassthrough::passthrough_posix_pwrite (int fd, const void* buf, size_t counter, off_t offset)
 {
-    ssize_t result = ((libc_pwrite_t)dlsym (RTLD_NEXT, "pwrite")) (fd, buf, counter, offset);
+    ssize_t result = libc_dispatch ().get<libc_pwrite_t> (PosixCall::pwrite) (fd,
+        buf,
+        counter,
+        offset);
 
     // update statistic entry
     if (this->m_collect) {
@@ -241,7 +259,10 @@ PosixPassthrough::passthrough_posix_pwrite (int fd, const void* buf, size_t coun
 ssize_t
 PosixPassthrough::passthrough_posix_pread64 (int fd, void* buf, size_t counter, off64_t offset)
 {
-    ssize_t result = ((libc_pread64_t)dlsym (RTLD_NEXT, "pread64")) (fd, buf, counter, offset);
+    ssize_t result = libc_dispatch ().get<libc_pread64_t> (PosixCall::pread64) (fd,
+        buf,
+        counter,
+        offset);
 
     // update statistic entry
     if (this->m_collect) {
@@ -263,7 +284,10 @@ ssize_t PosixPassthrough::passthrough_posix_pwrite64 (int fd,
     size_t counter,
     off64_t offset)
 {
-    ssize_t result = ((libc_pwrite64_t)dlsym (RTLD_NEXT, "pwrite64")) (fd, buf, counter, offset);
+    ssize_t result = libc_dispatch ().get<libc_pwrite64_t> (PosixCall::pwrite64) (fd,
+        buf,
+        counter,
+        offset);
 
     // update statistic entry
     if (this->m_collect) {
@@ -288,7 +312,12 @@ void* PosixPassthrough::passthrough_posix_mmap (void* addr,
     int fd,
     off_t offset)
 {
-    void* result = ((libc_mmap_t)dlsym (RTLD_NEXT, "mmap")) (addr, length, prot, flags, fd, offset);
+    void* result = libc_dispatch ().get<libc_mmap_t> (PosixCall::mmap) (addr,
+        length,
+        prot,
+        flags,
+        fd,
+        offset);
 
     // update statistic entry
     if (this->m_collect) {
@@ -305,7 +334,7 @@ void* PosixPassthrough::passthrough_posix_mmap (void* addr,
 // pass_through_posix_munmap call.
 int PosixPassthrough::passthrough_posix_munmap (void* addr, size_t length)
 {
-    int result = ((libc_munmap_t)dlsym (RTLD_NEXT, "munmap")) (addr, length);
+    int result = libc_dispatch ().get<libc_munmap_t> (PosixCall::munmap) (addr, length);
 
     // update statistic entry
     if (this->m_collect) {
@@ -319,535 +348,1605 @@ int PosixPassthrough::passthrough_posix_munmap (void* addr, size_t length)
     return result;
 }
 
-// passthrough_posix_open call.
-int PosixPassthrough::passthrough_posix_open (const char* path, int flags, mode_t mode)
+// passthrough_posix_readv call.
+ssize_t PosixPassthrough::passthrough_posix_readv (int fd, const struct iovec* iov, int iovcnt)
 {
-    int result = ((libc_open_variadic_t)dlsym (RTLD_NEXT, "open")) (path, flags, mode);
+    ssize_t result = libc_dispatch ().get<libc_readv_t> (PosixCall::readv) (fd, iov, iovcnt);
 
     // update statistic entry
     if (this->m_collect) {
         if (result >= 0) {
-            this->m_metadata_stats.update_statistic_entry (
-                static_cast<int> (Metadata::open_variadic),
-                1,
-                0);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::readv), 1, result);
         } else {
-            this->m_metadata_stats
-                .update_statistic_entry (static_cast<int> (Metadata::open_variadic), 1, 0, 1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::readv), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_open call.
-int PosixPassthrough::passthrough_posix_open (const char* path, int flags)
+// passthrough_posix_writev call.
+ssize_t PosixPassthrough::passthrough_posix_writev (int fd, const struct iovec* iov, int iovcnt)
 {
-    int result = ((libc_open_t)dlsym (RTLD_NEXT, "open")) (path, flags);
+    ssize_t result = libc_dispatch ().get<libc_writev_t> (PosixCall::writev) (fd, iov, iovcnt);
 
     // update statistic entry
     if (this->m_collect) {
         if (result >= 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open), 1, 0);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::writev), 1, result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::writev), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_creat call.
-int PosixPassthrough::passthrough_posix_creat (const char* path, mode_t mode)
+// passthrough_posix_preadv call.
+ssize_t PosixPassthrough::passthrough_posix_preadv (int fd,
+    const struct iovec* iov,
+    int iovcnt,
+    off_t offset)
 {
-    int result = ((libc_creat_t)dlsym (RTLD_NEXT, "creat")) (path, mode);
+    ssize_t result = libc_dispatch ().get<libc_preadv_t> (PosixCall::preadv) (fd,
+        iov,
+        iovcnt,
+        offset);
 
     // update statistic entry
     if (this->m_collect) {
         if (result >= 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::creat),
-                1,
-                0);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::preadv), 1, result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::creat),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::preadv), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_creat64 call.
-int PosixPassthrough::passthrough_posix_creat64 (const char* path, mode_t mode)
+// passthrough_posix_pwritev call.
+ssize_t PosixPassthrough::passthrough_posix_pwritev (int fd,
+    const struct iovec* iov,
+    int iovcnt,
+    off_t offset)
 {
-    int result = ((libc_creat64_t)dlsym (RTLD_NEXT, "creat64")) (path, mode);
+    ssize_t result = libc_dispatch ().get<libc_pwritev_t> (PosixCall::pwritev) (fd,
+        iov,
+        iovcnt,
+        offset);
 
     // update statistic entry
     if (this->m_collect) {
         if (result >= 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::creat64),
-                1,
-                0);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::pwritev), 1, result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::creat64),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::pwritev), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_openat call.
-int PosixPassthrough::passthrough_posix_openat (int dirfd, const char* path, int flags, mode_t mode)
+// passthrough_posix_preadv2 call.
+ssize_t PosixPassthrough::passthrough_posix_preadv2 (int fd,
+    const struct iovec* iov,
+    int iovcnt,
+    off_t offset,
+    int flags)
 {
-    int result = ((libc_openat_variadic_t)dlsym (RTLD_NEXT, "openat")) (dirfd, path, flags, mode);
+    ssize_t result = libc_dispatch ().get<libc_preadv2_t> (PosixCall::preadv2) (fd,
+        iov,
+        iovcnt,
+        offset,
+        flags);
 
     // update statistic entry
     if (this->m_collect) {
         if (result >= 0) {
-            this->m_metadata_stats.update_statistic_entry (
-                static_cast<int> (Metadata::openat_variadic),
-                1,
-                0);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::preadv2), 1, result);
         } else {
-            this->m_metadata_stats
-                .update_statistic_entry (static_cast<int> (Metadata::openat_variadic), 1, 0, 1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::preadv2), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_openat call.
-int PosixPassthrough::passthrough_posix_openat (int dirfd, const char* path, int flags)
+// passthrough_posix_pwritev2 call.
+ssize_t PosixPassthrough::passthrough_posix_pwritev2 (int fd,
+    const struct iovec* iov,
+    int iovcnt,
+    off_t offset,
+    int flags)
 {
-    int result = ((libc_openat_t)dlsym (RTLD_NEXT, "openat")) (dirfd, path, flags);
+    ssize_t result = libc_dispatch ().get<libc_pwritev2_t> (PosixCall::pwritev2) (fd,
+        iov,
+        iovcnt,
+        offset,
+        flags);
 
     // update statistic entry
     if (this->m_collect) {
         if (result >= 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::openat),
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::pwritev2),
                 1,
-                0);
+                result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::openat),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::pwritev2), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_open64 call.
-int PosixPassthrough::passthrough_posix_open64 (const char* path, int flags, mode_t mode)
+// passthrough_posix_fread call.
+size_t PosixPassthrough::passthrough_posix_fread (void* buffer,
+    size_t size,
+    size_t nmemb,
+    FILE* stream)
 {
-    int result = ((libc_open64_variadic_t)dlsym (RTLD_NEXT, "open64")) (path, flags, mode);
+    size_t result = libc_dispatch ().get<libc_fread_t> (PosixCall::fread) (buffer,
+        size,
+        nmemb,
+        stream);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result >= 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open64),
-                1,
-                0);
-        } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open64),
-                1,
-                0,
-                1);
-        }
+        this->m_data_stats.update_statistic_entry (static_cast<int> (Data::fread),
+            1,
+            result * size);
     }
 
     return result;
 }
 
-// passthrough_posix_open64 call.
-int PosixPassthrough::passthrough_posix_open64 (const char* path, int flags)
+// passthrough_posix_fwrite call.
+size_t PosixPassthrough::passthrough_posix_fwrite (const void* buffer,
+    size_t size,
+    size_t nmemb,
+    FILE* stream)
 {
-    int result = ((libc_open64_t)dlsym (RTLD_NEXT, "open64")) (path, flags);
+    size_t result = libc_dispatch ().get<libc_fwrite_t> (PosixCall::fwrite) (buffer,
+        size,
+        nmemb,
+        stream);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result >= 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open64),
-                1,
-                0);
-        } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open64),
-                1,
-                0,
-                1);
-        }
+        this->m_data_stats.update_statistic_entry (static_cast<int> (Data::fwrite),
+            1,
+            result * size);
     }
 
     return result;
 }
 
-// passthrough_posix_close call.
-int PosixPassthrough::passthrough_posix_close (int fd)
+// passthrough_posix_fgets call.
+char* PosixPassthrough::passthrough_posix_fgets (char* buffer, int size, FILE* stream)
 {
-    int result = ((libc_close_t)dlsym (RTLD_NEXT, "close")) (fd);
+    char* result = libc_dispatch ().get<libc_fgets_t> (PosixCall::fgets) (buffer, size, stream);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result >= 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::close),
-                1,
-                0);
-        } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::close),
-                1,
-                0,
-                1);
-        }
+        this->m_data_stats.update_statistic_entry (static_cast<int> (Data::fgets),
+            1,
+            (result != nullptr) ? std::strlen (result) : 0);
     }
 
     return result;
 }
 
-// passthrough_posix_sync call.
-void PosixPassthrough::passthrough_posix_sync ()
-{
-    return ((libc_sync_t)dlsym (RTLD_NEXT, "sync")) ();
-
-    // update statistic entry
-    if (this->m_collect) {
-        this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::sync), 1, 0);
-    }
-}
-
-// passthrough_posix_statfs call.
-int PosixPassthrough::passthrough_posix_statfs (const char* path, struct statfs* buf)
+// passthrough_posix_fputs call.
+int PosixPassthrough::passthrough_posix_fputs (const char* buffer, FILE* stream)
 {
-    int result = ((libc_statfs_t)dlsym (RTLD_NEXT, "statfs")) (path, buf);
+    int result = libc_dispatch ().get<libc_fputs_t> (PosixCall::fputs) (buffer, stream);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result == 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statfs),
+        if (result >= 0) {
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::fputs),
                 1,
-                0);
+                std::strlen (buffer));
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statfs),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::fputs), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_fstatfs call.
-int PosixPassthrough::passthrough_posix_fstatfs (int fd, struct statfs* buf)
+// passthrough_posix_fprintf call.
+int PosixPassthrough::passthrough_posix_fprintf (FILE* stream, const char* format, va_list args)
 {
-    int result = ((libc_fstatfs_t)dlsym (RTLD_NEXT, "fstatfs")) (fd, buf);
+    int result = libc_dispatch ().get<libc_vfprintf_t> (PosixCall::vfprintf) (stream, format, args);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result == 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatfs),
-                1,
-                0);
+        if (result >= 0) {
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::fprintf), 1, result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatfs),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::fprintf), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_statfs64 call.
-int PosixPassthrough::passthrough_posix_statfs64 (const char* path, struct statfs64* buf)
+// passthrough_posix_vfprintf call.
+int PosixPassthrough::passthrough_posix_vfprintf (FILE* stream, const char* format, va_list args)
 {
-    int result = ((libc_statfs64_t)dlsym (RTLD_NEXT, "statfs64")) (path, buf);
+    int result = libc_dispatch ().get<libc_vfprintf_t> (PosixCall::vfprintf) (stream, format, args);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result == 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statfs64),
+        if (result >= 0) {
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::vfprintf),
                 1,
-                0);
+                result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statfs64),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::vfprintf), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_fstatfs64 call.
-int PosixPassthrough::passthrough_posix_fstatfs64 (int fd, struct statfs64* buf)
+// passthrough_posix_fflush call.
+int PosixPassthrough::passthrough_posix_fflush (FILE* stream)
 {
-    int result = ((libc_fstatfs64_t)dlsym (RTLD_NEXT, "fstatfs64")) (fd, buf);
+    int result = libc_dispatch ().get<libc_fflush_t> (PosixCall::fflush) (stream);
 
     // update statistic entry
     if (this->m_collect) {
         if (result == 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatfs64),
-                1,
-                0);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::fflush), 1, 0);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatfs64),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (static_cast<int> (Data::fflush), 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_unlink call.
-int PosixPassthrough::passthrough_posix_unlink (const char* old_path)
+// passthrough_posix_copy_file_range call.
+ssize_t PosixPassthrough::passthrough_posix_copy_file_range (int fd_in,
+    off64_t* off_in,
+    int fd_out,
+    off64_t* off_out,
+    size_t len,
+    unsigned int flags)
 {
-    int result = ((libc_unlink_t)dlsym (RTLD_NEXT, "unlink")) (old_path);
+    ssize_t result
+        = libc_dispatch ().get<libc_copy_file_range_t> (PosixCall::copy_file_range) (fd_in,
+            off_in,
+            fd_out,
+            off_out,
+            len,
+            flags);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result == 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::unlink),
-                1,
-                0);
+        auto operation = static_cast<int> (Data::copy_file_range);
+        if (result >= 0) {
+            this->m_data_stats.update_statistic_entry (operation, 1, result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::unlink),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_unlinkat call.
-int PosixPassthrough::passthrough_posix_unlinkat (int dirfd, const char* pathname, int flags)
+// passthrough_posix_sendfile call.
+ssize_t PosixPassthrough::passthrough_posix_sendfile (int out_fd,
+    int in_fd,
+    off_t* offset,
+    size_t count)
 {
-    int result = ((libc_unlinkat_t)dlsym (RTLD_NEXT, "unlinkat")) (dirfd, pathname, flags);
+    ssize_t result = libc_dispatch ().get<libc_sendfile_t> (PosixCall::sendfile) (out_fd,
+        in_fd,
+        offset,
+        count);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result == 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::unlinkat),
-                1,
-                0);
+        auto operation = static_cast<int> (Data::sendfile);
+        if (result >= 0) {
+            this->m_data_stats.update_statistic_entry (operation, 1, result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::unlinkat),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_rename call.
-int PosixPassthrough::passthrough_posix_rename (const char* old_path, const char* new_path)
+// passthrough_posix_sendfile64 call.
+ssize_t PosixPassthrough::passthrough_posix_sendfile64 (int out_fd,
+    int in_fd,
+    off64_t* offset,
+    size_t count)
 {
-    int result = ((libc_rename_t)dlsym (RTLD_NEXT, "rename")) (old_path, new_path);
+    ssize_t result = libc_dispatch ().get<libc_sendfile64_t> (PosixCall::sendfile64) (out_fd,
+        in_fd,
+        offset,
+        count);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result == 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::rename),
-                1,
-                0);
+        auto operation = static_cast<int> (Data::sendfile64);
+        if (result >= 0) {
+            this->m_data_stats.update_statistic_entry (operation, 1, result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::rename),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_renameat call.
-int PosixPassthrough::passthrough_posix_renameat (int olddirfd,
-    const char* old_path,
-    int newdirfd,
-    const char* new_path)
+// passthrough_posix_splice call.
+ssize_t PosixPassthrough::passthrough_posix_splice (int fd_in,
+    off64_t* off_in,
+    int fd_out,
+    off64_t* off_out,
+    size_t len,
+    unsigned int flags)
 {
-    int result
-        = ((libc_renameat_t)dlsym (RTLD_NEXT, "renameat")) (olddirfd, old_path, newdirfd, new_path);
+    ssize_t result = libc_dispatch ().get<libc_splice_t> (PosixCall::splice) (fd_in,
+        off_in,
+        fd_out,
+        off_out,
+        len,
+        flags);
 
     // update statistic entry
     if (this->m_collect) {
-        if (result == 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::renameat),
-                1,
-                0);
+        auto operation = static_cast<int> (Data::splice);
+        if (result >= 0) {
+            this->m_data_stats.update_statistic_entry (operation, 1, result);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::renameat),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_fopen call.
-FILE* PosixPassthrough::passthrough_posix_fopen (const char* pathname, const char* mode)
+// passthrough_posix_io_uring_enter call.
+int PosixPassthrough::passthrough_posix_io_uring_enter (unsigned int fd,
+    unsigned int to_submit,
+    unsigned int min_complete,
+    unsigned int flags,
+    const void* arg,
+    size_t argsz)
 {
-    FILE* result = ((libc_fopen_t)dlsym (RTLD_NEXT, "fopen")) (pathname, mode);
+    auto result = static_cast<int> (
+        libc_dispatch ().get<libc_io_uring_enter_t> (PosixCall::io_uring_enter) (SYS_io_uring_enter,
+            fd,
+            to_submit,
+            min_complete,
+            flags,
+            arg,
+            argsz));
 
     // update statistic entry
     if (this->m_collect) {
-        if (result != nullptr) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fopen),
-                1,
-                0);
+        auto operation = static_cast<int> (Data::io_uring_enter);
+        if (result >= 0) {
+            this->m_data_stats.update_statistic_entry (operation, 1, 0);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fopen),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_fopen64 call.
-FILE* PosixPassthrough::passthrough_posix_fopen64 (const char* pathname, const char* mode)
+// passthrough_posix_aio_read call.
+int PosixPassthrough::passthrough_posix_aio_read (struct aiocb* aiocbp)
 {
-    FILE* result = ((libc_fopen64_t)dlsym (RTLD_NEXT, "fopen64")) (pathname, mode);
+    int result = libc_dispatch ().get<libc_aio_read_t> (PosixCall::aio_read) (aiocbp);
 
-    // update statistic entry
+    // update statistic entry (the request is accounted with its size once queued)
     if (this->m_collect) {
-        if (result != nullptr) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fopen64),
-                1,
-                0);
+        auto operation = static_cast<int> (Data::aio_read);
+        if (result == 0) {
+            this->m_data_stats.update_statistic_entry (operation, 1, aiocbp->aio_nbytes);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fopen64),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_fclose call.
-int PosixPassthrough::passthrough_posix_fclose (FILE* stream)
+// passthrough_posix_aio_write call.
+int PosixPassthrough::passthrough_posix_aio_write (struct aiocb* aiocbp)
 {
-    int result = ((libc_fclose_t)dlsym (RTLD_NEXT, "fclose")) (stream);
+    int result = libc_dispatch ().get<libc_aio_write_t> (PosixCall::aio_write) (aiocbp);
 
-    // update statistic entry
+    // update statistic entry (the request is accounted with its size once queued)
     if (this->m_collect) {
+        auto operation = static_cast<int> (Data::aio_write);
         if (result == 0) {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fclose),
-                1,
-                0);
+            this->m_data_stats.update_statistic_entry (operation, 1, aiocbp->aio_nbytes);
         } else {
-            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fclose),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_mkdir call.
-int PosixPassthrough::passthrough_posix_mkdir (const char* path, mode_t mode)
+// passthrough_posix_aio_read64 call.
+int PosixPassthrough::passthrough_posix_aio_read64 (struct aiocb64* aiocbp)
 {
-    int result = ((libc_mkdir_t)dlsym (RTLD_NEXT, "mkdir")) (path, mode);
+    int result = libc_dispatch ().get<libc_aio_read64_t> (PosixCall::aio_read64) (aiocbp);
 
-    // update statistic entry
+    // update statistic entry (the request is accounted with its size once queued)
     if (this->m_collect) {
+        auto operation = static_cast<int> (Data::aio_read64);
         if (result == 0) {
-            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mkdir), 1, 0);
+            this->m_data_stats.update_statistic_entry (operation, 1, aiocbp->aio_nbytes);
         } else {
-            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mkdir), 1, 0, 1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_mkdirat call.
-int PosixPassthrough::passthrough_posix_mkdirat (int dirfd, const char* path, mode_t mode)
+// passthrough_posix_aio_write64 call.
+int PosixPassthrough::passthrough_posix_aio_write64 (struct aiocb64* aiocbp)
 {
-    int result = ((libc_mkdirat_t)dlsym (RTLD_NEXT, "mkdirat")) (dirfd, path, mode);
+    int result = libc_dispatch ().get<libc_aio_write64_t> (PosixCall::aio_write64) (aiocbp);
 
-    // update statistic entry
+    // update statistic entry (the request is accounted with its size once queued)
     if (this->m_collect) {
+        auto operation = static_cast<int> (Data::aio_write64);
         if (result == 0) {
-            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mkdirat), 1, 0);
+            this->m_data_stats.update_statistic_entry (operation, 1, aiocbp->aio_nbytes);
         } else {
-            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mkdirat),
-                1,
-                0,
-                1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_rmdir call.
-int PosixPassthrough::passthrough_posix_rmdir (const char* path)
+// passthrough_posix_lio_listio call.
+int PosixPassthrough::passthrough_posix_lio_listio (int mode,
+    struct aiocb* const list[],
+    int nent,
+    struct sigevent* sig)
 {
-    int result = ((libc_rmdir_t)dlsym (RTLD_NEXT, "rmdir")) (path);
+    int result = libc_dispatch ().get<libc_lio_listio_t> (PosixCall::lio_listio) (mode,
+        list,
+        nent,
+        sig);
 
-    // update statistic entry
+    // update statistic entry (each control block is accounted as an operation)
     if (this->m_collect) {
+        auto operation = static_cast<int> (Data::lio_listio);
         if (result == 0) {
-            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::rmdir), 1, 0);
+            uint64_t requests = 0;
+            uint64_t bytes = 0;
+            for (int i = 0; list != nullptr && i < nent; i++) {
+                if (list[i] != nullptr && list[i]->aio_lio_opcode != LIO_NOP) {
+                    requests++;
+                    bytes += list[i]->aio_nbytes;
+                }
+            }
+            this->m_data_stats.update_statistic_entry (operation, requests, bytes);
         } else {
-            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::rmdir), 1, 0, 1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_mknod call.
-int PosixPassthrough::passthrough_posix_mknod (const char* path, mode_t mode, dev_t dev)
+// passthrough_posix_lio_listio64 call.
+int PosixPassthrough::passthrough_posix_lio_listio64 (int mode,
+    struct aiocb64* const list[],
+    int nent,
+    struct sigevent* sig)
 {
-    int result = ((libc_mknod_t)dlsym (RTLD_NEXT, "mknod")) (path, mode, dev);
+    int result = libc_dispatch ().get<libc_lio_listio64_t> (PosixCall::lio_listio64) (mode,
+        list,
+        nent,
+        sig);
 
-    // update statistic entry
+    // update statistic entry (each control block is accounted as an operation)
     if (this->m_collect) {
+        auto operation = static_cast<int> (Data::lio_listio64);
         if (result == 0) {
-            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mknod), 1, 0);
+            uint64_t requests = 0;
+            uint64_t bytes = 0;
+            for (int i = 0; list != nullptr && i < nent; i++) {
+                if (list[i] != nullptr && list[i]->aio_lio_opcode != LIO_NOP) {
+                    requests++;
+                    bytes += list[i]->aio_nbytes;
+                }
+            }
+            this->m_data_stats.update_statistic_entry (operation, requests, bytes);
         } else {
-            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mknod), 1, 0, 1);
+            this->m_data_stats.update_statistic_entry (operation, 1, 0, 1);
         }
     }
 
     return result;
 }
 
-// passthrough_posix_mknodat call.
-int PosixPassthrough::passthrough_posix_mknodat (int dirfd,
-    const char* path,
-    mode_t mode,
-    dev_t dev)
-{
-    int result = ((libc_mknodat_t)dlsym (RTLD_NEXT, "mknodat")) (dirfd, path, mode, dev);
+// passthrough_posix_open call.
+int PosixPassthrough::passthrough_posix_open (const char* path, int flags, mode_t mode)
+{
+    int result = libc_dispatch ().get<libc_open_variadic_t> (PosixCall::open_variadic) (path,
+        flags,
+        mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (
+                static_cast<int> (Metadata::open_variadic),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats
+                .update_statistic_entry (static_cast<int> (Metadata::open_variadic), 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_open call.
+int PosixPassthrough::passthrough_posix_open (const char* path, int flags)
+{
+    int result = libc_dispatch ().get<libc_open_t> (PosixCall::open) (path, flags);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open), 1, 0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_creat call.
+int PosixPassthrough::passthrough_posix_creat (const char* path, mode_t mode)
+{
+    int result = libc_dispatch ().get<libc_creat_t> (PosixCall::creat) (path, mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::creat),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::creat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_creat64 call.
+int PosixPassthrough::passthrough_posix_creat64 (const char* path, mode_t mode)
+{
+    int result = libc_dispatch ().get<libc_creat64_t> (PosixCall::creat64) (path, mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::creat64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::creat64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_openat call.
+int PosixPassthrough::passthrough_posix_openat (int dirfd, const char* path, int flags, mode_t mode)
+{
+    int result = libc_dispatch ().get<libc_openat_variadic_t> (PosixCall::openat_variadic) (dirfd,
+        path,
+        flags,
+        mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (
+                static_cast<int> (Metadata::openat_variadic),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats
+                .update_statistic_entry (static_cast<int> (Metadata::openat_variadic), 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_openat call.
+int PosixPassthrough::passthrough_posix_openat (int dirfd, const char* path, int flags)
+{
+    int result = libc_dispatch ().get<libc_openat_t> (PosixCall::openat) (dirfd, path, flags);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::openat),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::openat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_open64 call.
+int PosixPassthrough::passthrough_posix_open64 (const char* path, int flags, mode_t mode)
+{
+    int result = libc_dispatch ().get<libc_open64_variadic_t> (PosixCall::open64_variadic) (path,
+        flags,
+        mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_open64 call.
+int PosixPassthrough::passthrough_posix_open64 (const char* path, int flags)
+{
+    int result = libc_dispatch ().get<libc_open64_t> (PosixCall::open64) (path, flags);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::open64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_close call.
+int PosixPassthrough::passthrough_posix_close (int fd)
+{
+    int result = libc_dispatch ().get<libc_close_t> (PosixCall::close) (fd);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::close),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::close),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_sync call.
+void PosixPassthrough::passthrough_posix_sync ()
+{
+    libc_dispatch ().get<libc_sync_t> (PosixCall::sync) ();
+
+    // update statistic entry
+    if (this->m_collect) {
+        this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::sync), 1, 0);
+    }
+}
+
+// passthrough_posix_statfs call.
+int PosixPassthrough::passthrough_posix_statfs (const char* path, struct statfs* buf)
+{
+    int result = libc_dispatch ().get<libc_statfs_t> (PosixCall::statfs) (path, buf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statfs),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statfs),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fstatfs call.
+int PosixPassthrough::passthrough_posix_fstatfs (int fd, struct statfs* buf)
+{
+    int result = libc_dispatch ().get<libc_fstatfs_t> (PosixCall::fstatfs) (fd, buf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatfs),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatfs),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_statfs64 call.
+int PosixPassthrough::passthrough_posix_statfs64 (const char* path, struct statfs64* buf)
+{
+    int result = libc_dispatch ().get<libc_statfs64_t> (PosixCall::statfs64) (path, buf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statfs64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statfs64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fstatfs64 call.
+int PosixPassthrough::passthrough_posix_fstatfs64 (int fd, struct statfs64* buf)
+{
+    int result = libc_dispatch ().get<libc_fstatfs64_t> (PosixCall::fstatfs64) (fd, buf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatfs64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatfs64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_unlink call.
+int PosixPassthrough::passthrough_posix_unlink (const char* old_path)
+{
+    int result = libc_dispatch ().get<libc_unlink_t> (PosixCall::unlink) (old_path);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::unlink),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::unlink),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_unlinkat call.
+int PosixPassthrough::passthrough_posix_unlinkat (int dirfd, const char* pathname, int flags)
+{
+    int result = libc_dispatch ().get<libc_unlinkat_t> (PosixCall::unlinkat) (dirfd,
+        pathname,
+        flags);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::unlinkat),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::unlinkat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_rename call.
+int PosixPassthrough::passthrough_posix_rename (const char* old_path, const char* new_path)
+{
+    int result = libc_dispatch ().get<libc_rename_t> (PosixCall::rename) (old_path, new_path);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::rename),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::rename),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_renameat call.
+int PosixPassthrough::passthrough_posix_renameat (int olddirfd,
+    const char* old_path,
+    int newdirfd,
+    const char* new_path)
+{
+    int result
+        = libc_dispatch ().get<libc_renameat_t> (PosixCall::renameat) (olddirfd,
+            old_path,
+            newdirfd,
+            new_path);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::renameat),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::renameat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fopen call.
+FILE* PosixPassthrough::passthrough_posix_fopen (const char* pathname, const char* mode)
+{
+    FILE* result = libc_dispatch ().get<libc_fopen_t> (PosixCall::fopen) (pathname, mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result != nullptr) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fopen),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fopen),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fopen64 call.
+FILE* PosixPassthrough::passthrough_posix_fopen64 (const char* pathname, const char* mode)
+{
+    FILE* result = libc_dispatch ().get<libc_fopen64_t> (PosixCall::fopen64) (pathname, mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result != nullptr) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fopen64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fopen64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fclose call.
+int PosixPassthrough::passthrough_posix_fclose (FILE* stream)
+{
+    int result = libc_dispatch ().get<libc_fclose_t> (PosixCall::fclose) (stream);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fclose),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fclose),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_stat call.
+int PosixPassthrough::passthrough_posix_stat (const char* path, struct stat* statbuf)
+{
+    int result = libc_dispatch ().get<libc_stat_t> (PosixCall::stat) (path, statbuf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::stat), 1, 0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::stat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_lstat call.
+int PosixPassthrough::passthrough_posix_lstat (const char* path, struct stat* statbuf)
+{
+    int result = libc_dispatch ().get<libc_lstat_t> (PosixCall::lstat) (path, statbuf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::lstat),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::lstat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fstat call.
+int PosixPassthrough::passthrough_posix_fstat (int fd, struct stat* statbuf)
+{
+    int result = libc_dispatch ().get<libc_fstat_t> (PosixCall::fstat) (fd, statbuf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstat),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fstatat call.
+int PosixPassthrough::passthrough_posix_fstatat (int dirfd,
+    const char* path,
+    struct stat* statbuf,
+    int flags)
+{
+    int result = libc_dispatch ().get<libc_fstatat_t> (PosixCall::fstatat) (dirfd,
+        path,
+        statbuf,
+        flags);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatat),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_statx call.
+int PosixPassthrough::passthrough_posix_statx (int dirfd,
+    const char* path,
+    int flags,
+    unsigned int mask,
+    struct statx* statxbuf)
+{
+    int result = libc_dispatch ().get<libc_statx_t> (PosixCall::statx) (dirfd,
+        path,
+        flags,
+        mask,
+        statxbuf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statx),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::statx),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_access call.
+int PosixPassthrough::passthrough_posix_access (const char* path, int mode)
+{
+    int result = libc_dispatch ().get<libc_access_t> (PosixCall::access) (path, mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::access),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::access),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_faccessat call.
+int PosixPassthrough::passthrough_posix_faccessat (int dirfd, const char* path, int mode, int flags)
+{
+    int result = libc_dispatch ().get<libc_faccessat_t> (PosixCall::faccessat) (dirfd,
+        path,
+        mode,
+        flags);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::faccessat),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::faccessat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_stat64 call.
+int PosixPassthrough::passthrough_posix_stat64 (const char* path, struct stat64* statbuf)
+{
+    int result = libc_dispatch ().get<libc_stat64_t> (PosixCall::stat64) (path, statbuf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::stat64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::stat64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_lstat64 call.
+int PosixPassthrough::passthrough_posix_lstat64 (const char* path, struct stat64* statbuf)
+{
+    int result = libc_dispatch ().get<libc_lstat64_t> (PosixCall::lstat64) (path, statbuf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::lstat64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::lstat64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fstat64 call.
+int PosixPassthrough::passthrough_posix_fstat64 (int fd, struct stat64* statbuf)
+{
+    int result = libc_dispatch ().get<libc_fstat64_t> (PosixCall::fstat64) (fd, statbuf);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstat64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstat64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fstatat64 call.
+int PosixPassthrough::passthrough_posix_fstatat64 (int dirfd,
+    const char* path,
+    struct stat64* statbuf,
+    int flags)
+{
+    int result = libc_dispatch ().get<libc_fstatat64_t> (PosixCall::fstatat64) (dirfd,
+        path,
+        statbuf,
+        flags);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatat64),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fstatat64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fsync call.
+int PosixPassthrough::passthrough_posix_fsync (int fd)
+{
+    int result = libc_dispatch ().get<libc_fsync_t> (PosixCall::fsync) (fd);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fsync),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fsync),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fdatasync call.
+int PosixPassthrough::passthrough_posix_fdatasync (int fd)
+{
+    int result = libc_dispatch ().get<libc_fdatasync_t> (PosixCall::fdatasync) (fd);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fdatasync),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fdatasync),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_sync_file_range call.
+int PosixPassthrough::passthrough_posix_sync_file_range (int fd,
+    off64_t offset,
+    off64_t nbytes,
+    unsigned int flags)
+{
+    auto operation = static_cast<int> (Metadata::sync_file_range);
+    int result = libc_dispatch ().get<libc_sync_file_range_t> (PosixCall::sync_file_range) (fd,
+        offset,
+        nbytes,
+        flags);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_syncfs call.
+int PosixPassthrough::passthrough_posix_syncfs (int fd)
+{
+    int result = libc_dispatch ().get<libc_syncfs_t> (PosixCall::syncfs) (fd);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::syncfs),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::syncfs),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_truncate call.
+int PosixPassthrough::passthrough_posix_truncate (const char* path, off_t length)
+{
+    int result = libc_dispatch ().get<libc_truncate_t> (PosixCall::truncate) (path, length);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::truncate),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::truncate),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_ftruncate call.
+int PosixPassthrough::passthrough_posix_ftruncate (int fd, off_t length)
+{
+    int result = libc_dispatch ().get<libc_ftruncate_t> (PosixCall::ftruncate) (fd, length);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::ftruncate),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::ftruncate),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fallocate call.
+int PosixPassthrough::passthrough_posix_fallocate (int fd, int mode, off_t offset, off_t length)
+{
+    int result = libc_dispatch ().get<libc_fallocate_t> (PosixCall::fallocate) (fd,
+        mode,
+        offset,
+        length);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fallocate),
+                1,
+                0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (static_cast<int> (Metadata::fallocate),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_posix_fallocate call.
+int PosixPassthrough::passthrough_posix_posix_fallocate (int fd, off_t offset, off_t length)
+{
+    int result = libc_dispatch ().get<libc_posix_fallocate_t> (PosixCall::posix_fallocate) (fd,
+        offset,
+        length);
+
+    // update statistic entry
+    if (this->m_collect) {
+        auto operation = static_cast<int> (Metadata::posix_fallocate);
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_posix_fadvise call. (...)
+int PosixPassthrough::passthrough_posix_posix_fadvise (int fd,
+    off_t offset,
+    off_t length,
+    int advice)
+{
+    int result = libc_dispatch ().get<libc_posix_fadvise_t> (PosixCall::posix_fadvise) (fd,
+        offset,
+        length,
+        advice);
+
+    // update statistic entry (prefetch hints account the advised length as bytes)
+    if (this->m_collect) {
+        auto operation = static_cast<int> (Metadata::posix_fadvise);
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (operation,
+                1,
+                (advice == POSIX_FADV_WILLNEED && length > 0) ? static_cast<uint64_t> (length) : 0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_io_uring_setup call.
+int PosixPassthrough::passthrough_posix_io_uring_setup (unsigned int entries,
+    struct io_uring_params* params)
+{
+    auto result = static_cast<int> (
+        libc_dispatch ().get<libc_io_uring_setup_t> (PosixCall::io_uring_setup) (SYS_io_uring_setup,
+            entries,
+            params));
+
+    // update statistic entry
+    if (this->m_collect) {
+        auto operation = static_cast<int> (Metadata::io_uring_setup);
+        if (result >= 0) {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_aio_fsync call.
+int PosixPassthrough::passthrough_posix_aio_fsync (int op, struct aiocb* aiocbp)
+{
+    int result = libc_dispatch ().get<libc_aio_fsync_t> (PosixCall::aio_fsync) (op, aiocbp);
+
+    // update statistic entry
+    if (this->m_collect) {
+        auto operation = static_cast<int> (Metadata::aio_fsync);
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_aio_fsync64 call.
+int PosixPassthrough::passthrough_posix_aio_fsync64 (int op, struct aiocb64* aiocbp)
+{
+    int result = libc_dispatch ().get<libc_aio_fsync64_t> (PosixCall::aio_fsync64) (op, aiocbp);
+
+    // update statistic entry
+    if (this->m_collect) {
+        auto operation = static_cast<int> (Metadata::aio_fsync64);
+        if (result == 0) {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0);
+        } else {
+            this->m_metadata_stats.update_statistic_entry (operation, 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_mkdir call.
+int PosixPassthrough::passthrough_posix_mkdir (const char* path, mode_t mode)
+{
+    int result = libc_dispatch ().get<libc_mkdir_t> (PosixCall::mkdir) (path, mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mkdir), 1, 0);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mkdir), 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_mkdirat call.
+int PosixPassthrough::passthrough_posix_mkdirat (int dirfd, const char* path, mode_t mode)
+{
+    int result = libc_dispatch ().get<libc_mkdirat_t> (PosixCall::mkdirat) (dirfd, path, mode);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mkdirat), 1, 0);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mkdirat),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_rmdir call.
+int PosixPassthrough::passthrough_posix_rmdir (const char* path)
+{
+    int result = libc_dispatch ().get<libc_rmdir_t> (PosixCall::rmdir) (path);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::rmdir), 1, 0);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::rmdir), 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_mknod call.
+int PosixPassthrough::passthrough_posix_mknod (const char* path, mode_t mode, dev_t dev)
+{
+    int result = libc_dispatch ().get<libc_mknod_t> (PosixCall::mknod) (path, mode, dev);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mknod), 1, 0);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::mknod), 1, 0, 1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_mknodat call.
+int PosixPassthrough::passthrough_posix_mknodat (int dirfd,
+    const char* path,
+    mode_t mode,
+    dev_t dev)
+{
+    int result = libc_dispatch ().get<libc_mknodat_t> (PosixCall::mknodat) (dirfd, path, mode, dev);
 
     // update statistic entry
     if (this->m_collect) {
@@ -864,13 +1963,158 @@ int PosixPassthrough::passthrough_posix_mknodat (int dirfd,
     return result;
 }
 
+// passthrough_posix_opendir call.
+DIR* PosixPassthrough::passthrough_posix_opendir (const char* path)
+{
+    DIR* result = libc_dispatch ().get<libc_opendir_t> (PosixCall::opendir) (path);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result != nullptr) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::opendir), 1, 0);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::opendir),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_fdopendir call.
+DIR* PosixPassthrough::passthrough_posix_fdopendir (int fd)
+{
+    DIR* result = libc_dispatch ().get<libc_fdopendir_t> (PosixCall::fdopendir) (fd);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result != nullptr) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::fdopendir),
+                1,
+                0);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::fdopendir),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_readdir call.
+struct dirent* PosixPassthrough::passthrough_posix_readdir (DIR* dirp)
+{
+    // readdir returns nullptr both at the end of the stream and on error (errno is set)
+    int saved_errno = errno;
+    errno = 0;
+    struct dirent* result = libc_dispatch ().get<libc_readdir_t> (PosixCall::readdir) (dirp);
+    bool failed = (result == nullptr && errno != 0);
+    if (!failed) {
+        errno = saved_errno;
+    }
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (!failed) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::readdir), 1, 0);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::readdir),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_readdir64 call.
+struct dirent64* PosixPassthrough::passthrough_posix_readdir64 (DIR* dirp)
+{
+    // readdir returns nullptr both at the end of the stream and on error (errno is set)
+    int saved_errno = errno;
+    errno = 0;
+    struct dirent64* result = libc_dispatch ().get<libc_readdir64_t> (PosixCall::readdir64) (dirp);
+    bool failed = (result == nullptr && errno != 0);
+    if (!failed) {
+        errno = saved_errno;
+    }
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (!failed) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::readdir64),
+                1,
+                0);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::readdir64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_getdents64 call.
+ssize_t PosixPassthrough::passthrough_posix_getdents64 (int fd, void* buffer, size_t count)
+{
+    ssize_t result = libc_dispatch ().get<libc_getdents64_t> (PosixCall::getdents64) (fd,
+        buffer,
+        count);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result >= 0) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::getdents64),
+                1,
+                result);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::getdents64),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
+// passthrough_posix_closedir call.
+int PosixPassthrough::passthrough_posix_closedir (DIR* dirp)
+{
+    int result = libc_dispatch ().get<libc_closedir_t> (PosixCall::closedir) (dirp);
+
+    // update statistic entry
+    if (this->m_collect) {
+        if (result == 0) {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::closedir), 1, 0);
+        } else {
+            this->m_dir_stats.update_statistic_entry (static_cast<int> (Directory::closedir),
+                1,
+                0,
+                1);
+        }
+    }
+
+    return result;
+}
+
 // passthrough_posix_getxattr call.
 ssize_t PosixPassthrough::passthrough_posix_getxattr (const char* path,
     const char* name,
     void* value,
     size_t size)
 {
-    ssize_t result = ((libc_getxattr_t)dlsym (RTLD_NEXT, "getxattr")) (path, name, value, size);
+    ssize_t result = libc_dispatch ().get<libc_getxattr_t> (PosixCall::getxattr) (path,
+        name,
+        value,
+        size);
 
     // update statistic entry
     if (this->m_collect) {
@@ -894,7 +2138,10 @@ ssize_t PosixPassthrough::passthrough_posix_lgetxattr (const char* path,
     void* value,
     size_t size)
 {
-    ssize_t result = ((libc_lgetxattr_t)dlsym (RTLD_NEXT, "lgetxattr")) (path, name, value, size);
+    ssize_t result = libc_dispatch ().get<libc_lgetxattr_t> (PosixCall::lgetxattr) (path,
+        name,
+        value,
+        size);
 
     // update statistic entry
     if (this->m_collect) {
@@ -916,7 +2163,10 @@ ssize_t PosixPassthrough::passthrough_posix_lgetxattr (const char* path,
 ssize_t
 PosixPassthrough::passthrough_posix_fgetxattr (int fd, const char* name, void* value, size_t size)
 {
-    ssize_t result = ((libc_fgetxattr_t)dlsym (RTLD_NEXT, "fgetxattr")) (fd, name, value, size);
+    ssize_t result = libc_dispatch ().get<libc_fgetxattr_t> (PosixCall::fgetxattr) (fd,
+        name,
+        value,
+        size);
 
     // update statistic entry
     if (this->m_collect) {
@@ -941,7 +2191,11 @@ int PosixPassthrough::passthrough_posix_setxattr (const char* path,
     size_t size,
     int flags)
 {
-    int result = ((libc_setxattr_t)dlsym (RTLD_NEXT, "setxattr")) (path, name, value, size, flags);
+    int result = libc_dispatch ().get<libc_setxattr_t> (PosixCall::setxattr) (path,
+        name,
+        value,
+        size,
+        flags);
 
     // update statistic entry
     if (this->m_collect) {
@@ -967,7 +2221,11 @@ int PosixPassthrough::passthrough_posix_lsetxattr (const char* path,
     int flags)
 {
     int result
-        = ((libc_lsetxattr_t)dlsym (RTLD_NEXT, "lsetxattr")) (path, name, value, size, flags);
+        = libc_dispatch ().get<libc_lsetxattr_t> (PosixCall::lsetxattr) (path,
+            name,
+            value,
+            size,
+            flags);
 
     // update statistic entry
     if (this->m_collect) {
@@ -992,7 +2250,11 @@ int PosixPassthrough::passthrough_posix_fsetxattr (int fd,
     size_t size,
     int flags)
 {
-    int result = ((libc_fsetxattr_t)dlsym (RTLD_NEXT, "fsetxattr")) (fd, name, value, size, flags);
+    int result = libc_dispatch ().get<libc_fsetxattr_t> (PosixCall::fsetxattr) (fd,
+        name,
+        value,
+        size,
+        flags);
 
     // update statistic entry
     if (this->m_collect) {
@@ -1013,7 +2275,9 @@ int PosixPassthrough::passthrough_posix_fsetxattr (int fd,
 // passthrough_posix_listxattr call.
 ssize_t PosixPassthrough::passthrough_posix_listxattr (const char* path, char* list, size_t size)
 {
-    ssize_t result = ((libc_listxattr_t)dlsym (RTLD_NEXT, "listxattr")) (path, list, size);
+    ssize_t result = libc_dispatch ().get<libc_listxattr_t> (PosixCall::listxattr) (path,
+        list,
+        size);
 
     // update statistic entry
     if (this->m_collect) {
@@ -1034,7 +2298,9 @@ ssize_t PosixPassthrough::passthrough_posix_listxattr (const char* path, char* l
 // passthrough_posix_llistxattr call.
 ssize_t PosixPassthrough::passthrough_posix_llistxattr (const char* path, char* list, size_t size)
 {
-    ssize_t result = ((libc_llistxattr_t)dlsym (RTLD_NEXT, "llistxattr")) (path, list, size);
+    ssize_t result = libc_dispatch ().get<libc_llistxattr_t> (PosixCall::llistxattr) (path,
+        list,
+        size);
 
     // update statistic entry
     if (this->m_collect) {
@@ -1058,7 +2324,9 @@ ssize_t PosixPassthrough::passthrough_posix_llistxattr (const char* path, char*
 // passthrough_posix_flistxattr call.
 ssize_t PosixPassthrough::passthrough_posix_flistxattr (int fd, char* list, size_t size)
 {
-    ssize_t result = ((libc_flistxattr_t)dlsym (RTLD_NEXT, "flistxattr")) (fd, list, size);
+    ssize_t result = libc_dispatch ().get<libc_flistxattr_t> (PosixCall::flistxattr) (fd,
+        list,
+        size);
 
     // update statistic entry
     if (this->m_collect) {
@@ -1082,7 +2350,7 @@ ssize_t PosixPassthrough::passthrough_posix_flistxattr (int fd, char* list, size
 // passthrough_posix_socket call.
 int PosixPassthrough::passthrough_posix_socket (int domain, int type, int protocol)
 {
-    int result = ((libc_socket_t)dlsym (RTLD_NEXT, "socket")) (domain, type, protocol);
+    int result = libc_dispatch ().get<libc_socket_t> (PosixCall::socket) (domain, type, protocol);
 
     // update statistic entry
     if (this->m_collect) {
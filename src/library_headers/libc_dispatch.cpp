@@ -0,0 +1,94 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <dlfcn.h>
+#include <padll/library_headers/libc_dispatch.hpp>
+#include <padll/options/options.hpp>
+#include <string>
+
+namespace padll::headers {
+
+// get_library_handle call. (...)
+void* LibcDispatch::get_library_handle ()
+{
+    auto* handle = this->m_lib_handle.load (std::memory_order_acquire);
+    if (handle != nullptr) {
+        return handle;
+    }
+
+    // open the library; the handle of a concurrent opener takes precedence
+    handle = ::dlopen (padll::options::option_library_name.data (), RTLD_LAZY);
+    if (handle == nullptr) {
+        return nullptr;
+    }
+
+    void* expected = nullptr;
+    if (!this->m_lib_handle.compare_exchange_strong (expected,
+            handle,
+            std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+        ::dlclose (handle);
+        handle = expected;
+    }
+
+    return handle;
+}
+
+// resolve call. (...)
+void* LibcDispatch::resolve (const PosixCall& call)
+{
+    auto index = static_cast<std::size_t> (call);
+    if (index >= kNumCalls) {
+        return nullptr;
+    }
+
+    // resolve the symbol through the library handle, or through the next operation link
+    std::string symbol_name { posix_call_symbol (call) };
+    auto* handle = this->get_library_handle ();
+    void* symbol = (handle != nullptr) ? ::dlsym (handle, symbol_name.c_str ()) : nullptr;
+    if (symbol == nullptr) {
+        symbol = ::dlsym (RTLD_NEXT, symbol_name.c_str ());
+    }
+
+    // concurrent resolvers publish the same symbol
+    if (symbol != nullptr) {
+        this->m_symbols[index].store (symbol, std::memory_order_release);
+    }
+
+    return symbol;
+}
+
+// initialize call. (...)
+int LibcDispatch::initialize ()
+{
+    int unresolved = 0;
+    for (std::size_t i = 0; i < kNumCalls; i++) {
+        auto call = static_cast<PosixCall> (i);
+        if (!this->is_resolved (call) && this->resolve (call) == nullptr) {
+            unresolved++;
+        }
+    }
+
+    return unresolved;
+}
+
+// replace call. (...)
+void LibcDispatch::replace (const PosixCall& call, void* symbol)
+{
+    auto index = static_cast<std::size_t> (call);
+    if (index < kNumCalls && symbol != nullptr) {
+        this->m_symbols[index].store (symbol, std::memory_order_release);
+    }
+}
+
+// is_resolved call. (...)
+bool LibcDispatch::is_resolved (const PosixCall& call) const
+{
+    auto index = static_cast<std::size_t> (call);
+    return (index < kNumCalls)
+        && (this->m_symbols[index].load (std::memory_order_acquire) != nullptr);
+}
+
+} // namespace padll::headers
@@ -0,0 +1,48 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cstdio>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <padll/options/options.hpp>
+#include <string>
+
+/**
+ * libpadll_loader.so: loads PADLL with local symbols (RTLD_LOCAL), so that they do not interpose
+ * libc's, and enables the binary-rewriting backend (SyscallRewriter), through which calls reach
+ * PADLL instead. The loader itself defines no POSIX symbols.
+ *  $ LD_PRELOAD=/path/to/libpadll_loader.so ./application
+ */
+
+/**
+ * load_padll: constructor of the loader. It is executed when the loader is loaded, before the
+ * program executes its main () (and creates threads).
+ */
+static __attribute__ ((constructor)) void load_padll ()
+{
+    // binary rewriting is enabled, unless explicitly disabled
+    ::setenv (std::string { padll::options::option_binary_rewriting_env }.c_str (), "true", 0);
+
+    // libpadll.so is searched in the loader's directory, unless its path is given
+    std::string path {};
+    const auto* configured
+        = std::getenv (std::string { padll::options::option_library_path_env }.c_str ());
+
+    if (configured != nullptr) {
+        path = configured;
+    } else {
+        Dl_info info {};
+        if (::dladdr (reinterpret_cast<void*> (&load_padll), &info) != 0
+            && info.dli_fname != nullptr) {
+            std::string loader { info.dli_fname };
+            path = loader.substr (0, loader.find_last_of ('/') + 1);
+        }
+        path += "libpadll.so";
+    }
+
+    if (::dlopen (path.c_str (), RTLD_NOW | RTLD_LOCAL) == nullptr) {
+        std::fprintf (stderr, "PADLL loader: %s\n", ::dlerror ());
+    }
+}
@@ -3,7 +3,11 @@
  *   Copyright (c) 2021-2023 INESC TEC.
  **/
 
+#include <algorithm>
+#include <array>
+#include <padll/configurations/padll_configuration.hpp>
 #include <padll/stage/data_plane_stage.hpp>
+#include <sstream>
 
 namespace padll::stage {
 
@@ -22,6 +26,9 @@ DataPlaneStage::DataPlaneStage () :
     // write debug logging message
     this->m_log->log_info (stream.str ());
 
+    // register stage, so that exiting threads can refund their credits
+    this->register_stage ();
+
     // set initialization status to true (stage is ready to receive requests)
     this->set_stage_initialized (true);
 }
@@ -57,6 +64,10 @@ DataPlaneStage::DataPlaneStage (std::shared_ptr<Log> log_ptr,
     // initialize PosixLayer instance
     this->m_posix_instance = std::make_unique<paio::PosixLayer> (this->m_stage);
 
+    // initialize per-workflow credit sizes
+    this->initialize_credit_sizes ();
+    this->register_stage ();
+
     // set initialization status to true (stage is ready to receive requests)
     this->set_stage_initialized (true);
 
@@ -90,6 +101,10 @@ DataPlaneStage::DataPlaneStage (std::shared_ptr<Log> log_ptr,
     // initialize PosixLayer instance
     this->m_posix_instance = std::make_unique<paio::PosixLayer> (this->m_stage);
 
+    // initialize per-workflow credit sizes
+    this->initialize_credit_sizes ();
+    this->register_stage ();
+
     // set initialization status to true (stage is ready to receive requests)
     this->set_stage_initialized (true);
 
@@ -100,31 +115,275 @@ DataPlaneStage::DataPlaneStage (std::shared_ptr<Log> log_ptr,
 // DataPlaneStage default destructor.
 DataPlaneStage::~DataPlaneStage ()
 {
+    {
+        // lock_guard over mutex (live stages)
+        std::lock_guard registry_lock (DataPlaneStage::live_stages_lock ());
+        DataPlaneStage::live_stages ().erase (this->m_generation);
+    }
+
     this->m_log->log_info ("DataPlaneStage destructor.\n");
 }
 
+// CreditTable default destructor. Refund the unused tokens of the exiting thread.
+DataPlaneStage::CreditTable::~CreditTable ()
+{
+    auto now = std::chrono::steady_clock::now ();
+
+    // lock_guard over mutex (live stages)
+    std::lock_guard registry_lock (DataPlaneStage::live_stages_lock ());
+
+    for (const auto& entry : this->m_entries) {
+        if (entry.m_generation == 0 || entry.m_tokens == 0 || entry.m_expiry <= now) {
+            continue;
+        }
+
+        // tokens of destroyed stages are dropped
+        auto iterator = DataPlaneStage::live_stages ().find (entry.m_generation);
+        if (iterator != DataPlaneStage::live_stages ().end ()) {
+            iterator->second->refund_credit (entry);
+        }
+    }
+}
+
+// next_generation call.
+uint64_t DataPlaneStage::next_generation ()
+{
+    static std::atomic<uint64_t> generation { 0 };
+    return generation.fetch_add (1) + 1;
+}
+
+// live_stages call.
+std::unordered_map<uint64_t, DataPlaneStage*>& DataPlaneStage::live_stages ()
+{
+    static std::unordered_map<uint64_t, DataPlaneStage*> stages {};
+    return stages;
+}
+
+// live_stages_lock call.
+std::mutex& DataPlaneStage::live_stages_lock ()
+{
+    static std::mutex lock {};
+    return lock;
+}
+
+// register_stage call.
+void DataPlaneStage::register_stage ()
+{
+    // lock_guard over mutex (live stages)
+    std::lock_guard registry_lock (DataPlaneStage::live_stages_lock ());
+    DataPlaneStage::live_stages ()[this->m_generation] = this;
+}
+
+// refund_credit call.
+void DataPlaneStage::refund_credit (const CreditEntry& entry)
+{
+    // lock_guard over mutex (refunds)
+    std::lock_guard refunds_lock (this->m_refunds_lock);
+
+    auto iterator = std::find_if (this->m_refunds.begin (),
+        this->m_refunds.end (),
+        [&entry] (const CreditEntry& refund) {
+            return refund.m_workflow_id == entry.m_workflow_id
+                && refund.m_operation_type == entry.m_operation_type
+                && refund.m_operation_context == entry.m_operation_context;
+        });
+
+    // merged refunds expire with the earliest of their credits
+    if (iterator == this->m_refunds.end ()) {
+        this->m_refunds.push_back (entry);
+    } else {
+        iterator->m_tokens += entry.m_tokens;
+        iterator->m_expiry = std::min (iterator->m_expiry, entry.m_expiry);
+    }
+
+    this->m_has_refunds.store (true);
+}
+
+// reclaim_credit call.
+void DataPlaneStage::reclaim_credit (CreditEntry& entry,
+    const std::chrono::steady_clock::time_point& now)
+{
+    if (!this->m_has_refunds.load (std::memory_order_relaxed)) {
+        return;
+    }
+
+    // lock_guard over mutex (refunds)
+    std::lock_guard refunds_lock (this->m_refunds_lock);
+
+    for (auto iterator = this->m_refunds.begin (); iterator != this->m_refunds.end ();) {
+        if (iterator->m_expiry <= now) {
+            iterator = this->m_refunds.erase (iterator);
+        } else if (iterator->m_workflow_id == entry.m_workflow_id
+            && iterator->m_operation_type == entry.m_operation_type
+            && iterator->m_operation_context == entry.m_operation_context) {
+            entry.m_expiry = (entry.m_tokens == 0) ? iterator->m_expiry
+                                                   : std::min (entry.m_expiry, iterator->m_expiry);
+            entry.m_tokens += iterator->m_tokens;
+            iterator = this->m_refunds.erase (iterator);
+        } else {
+            iterator++;
+        }
+    }
+
+    this->m_has_refunds.store (!this->m_refunds.empty ());
+}
+
 // set_stage_initialized call.
 void DataPlaneStage::set_stage_initialized (const bool& status)
 {
     this->m_stage_initialized.store (status);
 }
 
-// enforce_request call.
-void DataPlaneStage::enforce_request (const uint32_t& workflow_id,
+// initialize_credit_sizes call.
+void DataPlaneStage::initialize_credit_sizes ()
+{
+    auto credits_value = padll::configurations::PadllConfiguration::get_value (
+        option_credit_size_env,
+        padll::configurations::padll_configuration ().get_credits ());
+    if (credits_value == nullptr) {
+        return;
+    }
+
+    std::stringstream stream { credits_value };
+    std::string entry;
+
+    // parse comma-separated list of <workflow-id>:<credit> (or <credit>) entries
+    while (std::getline (stream, entry, ',')) {
+        try {
+            auto separator = entry.find (':');
+            if (separator == std::string::npos) {
+                this->m_default_credit_size = std::max (1UL, std::stoul (entry));
+            } else {
+                auto workflow_id = std::stoul (entry.substr (0, separator));
+                auto credit = std::max (1UL, std::stoul (entry.substr (separator + 1)));
+
+                if (workflow_id >= this->m_credit_sizes.size ()) {
+                    this->m_credit_sizes.resize (workflow_id + 1, 0);
+                }
+                this->m_credit_sizes[workflow_id] = static_cast<uint32_t> (credit);
+            }
+        } catch (const std::exception& e) {
+            this->m_log->log_error ("Invalid credit entry (" + entry + ") in "
+                + std::string { option_credit_size_env } + ".");
+        }
+    }
+
+    // workflows without an explicit credit use the default one
+    for (auto& credit : this->m_credit_sizes) {
+        credit = (credit == 0) ? this->m_default_credit_size : credit;
+    }
+
+    this->m_log->log_info ("DataPlaneStage credit-based enforcement (default credit: "
+        + std::to_string (this->m_default_credit_size) + ").");
+}
+
+// get_credit_size call.
+uint32_t DataPlaneStage::get_credit_size (const uint32_t& workflow_id) const
+{
+    return (workflow_id < this->m_credit_sizes.size ()) ? this->m_credit_sizes[workflow_id]
+                                                          : this->m_default_credit_size;
+}
+
+// get_credit_entry call.
+DataPlaneStage::CreditEntry* DataPlaneStage::get_credit_entry (const uint32_t& workflow_id,
     const int& operation_type,
-    const int& operation_context,
-    const uint64_t& operation_size)
+    const int& operation_context) const
 {
+    // per-thread credit table (refunded to the stages at thread exit)
+    thread_local CreditTable credit_table {};
+
+    auto hash = (static_cast<std::size_t> (workflow_id) * 31 + operation_type) * 31
+        + static_cast<std::size_t> (operation_context);
+
+    for (std::size_t i = 0; i < option_credit_table_size; i++) {
+        auto& entry = credit_table.m_entries[(hash + i) % option_credit_table_size];
 
+        // found the entry of the key
+        if (entry.m_generation == this->m_generation && entry.m_workflow_id == workflow_id
+            && entry.m_operation_type == operation_type
+            && entry.m_operation_context == operation_context) {
+            return &entry;
+        }
+
+        // empty entry: register the key
+        if (entry.m_generation == 0) {
+            entry = { this->m_generation, workflow_id, operation_type, operation_context, 0, {} };
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+// submit_request call.
+void DataPlaneStage::submit_request (const uint32_t& workflow_id,
+    const int& operation_type,
+    const int& operation_context,
+    const uint64_t& operation_size,
+    const int& total_operations)
+{
     // create Context object
     auto context_obj = this->m_posix_instance->build_context_object (workflow_id,
         operation_type,
         operation_context,
         operation_size,
-        1);
+        total_operations);
 
     // submit request through posix_base
     this->m_posix_instance->posix_base (nullptr, operation_size, context_obj);
+}
+
+// enforce_request call.
+void DataPlaneStage::enforce_request (const uint32_t& workflow_id,
+    const int& operation_type,
+    const int& operation_context,
+    const uint64_t& operation_size)
+{
+    auto credit_size = this->get_credit_size (workflow_id);
+    auto* credit = (credit_size > 1)
+        ? this->get_credit_entry (workflow_id, operation_type, operation_context)
+        : nullptr;
+
+    if (credit == nullptr) {
+        // enforce request individually
+        this->submit_request (workflow_id, operation_type, operation_context, operation_size, 1);
+    } else {
+        // drop expired tokens, and reclaim the ones refunded by exited threads if needed
+        auto now = std::chrono::steady_clock::now ();
+        if (credit->m_expiry <= now) {
+            credit->m_tokens = 0;
+        }
+        if (credit->m_tokens < operation_size) {
+            this->reclaim_credit (*credit, now);
+        }
+
+        if (credit->m_tokens >= operation_size) {
+            // consume locally available tokens
+            credit->m_tokens -= operation_size;
+        } else {
+            // acquire a new credit (credit_size operations' worth of tokens) in a single call;
+            // the bytes prefetched by data requests are capped (option_credit_max_prefetch_bytes)
+            uint64_t operations = credit_size;
+            if (operation_context == static_cast<int> (paio::core::POSIX_META::data_op)) {
+                auto prefetched = std::min (operation_size * (credit_size - 1),
+                    option_credit_max_prefetch_bytes);
+                operations = 1 + ((operation_size > 0) ? prefetched / operation_size : 0);
+            }
+
+            auto tokens = operation_size * operations;
+            this->submit_request (workflow_id,
+                operation_type,
+                operation_context,
+                tokens,
+                static_cast<int> (operations));
+
+            // the request may block (throttled) for as long as the credit takes to be granted, so
+            // the credit's lifetime starts when it is granted
+            credit->m_tokens += tokens - operation_size;
+            credit->m_expiry = std::chrono::steady_clock::now ()
+                + std::chrono::milliseconds { option_credit_lifetime };
+        }
+    }
 
     // create debug message
 #if OPTION_DETAILED_LOGGING
@@ -0,0 +1,292 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <padll/stage/file_descriptor_table.hpp>
+
+namespace padll::stage {
+
+// FileDescriptorTable default constructor.
+FileDescriptorTable::FileDescriptorTable () :
+    m_capacity { FileDescriptorTable::compute_capacity () },
+    m_num_segments { (this->m_capacity + option_fd_table_segment_size - 1)
+        / option_fd_table_segment_size },
+    m_segments { std::make_unique<std::atomic<Segment*>[]> (this->m_num_segments) }
+{
+    for (std::size_t i = 0; i < this->m_num_segments; i++) {
+        this->m_segments[i].store (nullptr, std::memory_order_relaxed);
+    }
+}
+
+// FileDescriptorTable default destructor.
+FileDescriptorTable::~FileDescriptorTable ()
+{
+    // lock_guard over mutex (write_lock)
+    std::lock_guard write_lock (this->m_write_lock);
+
+    for (std::size_t i = 0; i < this->m_num_segments; i++) {
+        auto* segment = this->m_segments[i].exchange (nullptr, std::memory_order_acq_rel);
+        // slots release their references to the entries
+        delete segment;
+    }
+}
+
+// compute_capacity call. (...)
+std::size_t FileDescriptorTable::compute_capacity ()
+{
+    struct rlimit limit {};
+    std::size_t capacity = option_fd_table_max_capacity;
+
+    // use the hard limit, since the soft limit can be raised at runtime up to that value
+    if (::getrlimit (RLIMIT_NOFILE, &limit) == 0 && limit.rlim_max != RLIM_INFINITY
+        && limit.rlim_max < option_fd_table_max_capacity) {
+        capacity = static_cast<std::size_t> (limit.rlim_max);
+    }
+
+    // guarantee that at least one segment is available
+    return std::max (capacity, option_fd_table_segment_size);
+}
+
+// encode_tag call. (...)
+uint64_t FileDescriptorTable::encode_tag (const MountPointEntry& entry)
+{
+    auto mount_point = static_cast<uint64_t> (entry.get_mount_point ()) & 0x7FFFFFFFULL;
+    return kValidTag | (mount_point << 32) | entry.get_metadata_server_unit ();
+}
+
+// capacity call. (...)
+std::size_t FileDescriptorTable::capacity () const
+{
+    return this->m_capacity;
+}
+
+// is_within_capacity call. (...)
+bool FileDescriptorTable::is_within_capacity (const int& fd) const
+{
+    return fd >= 0 && static_cast<std::size_t> (fd) < this->m_capacity;
+}
+
+// get_slot call. (...)
+FileDescriptorTable::Slot* FileDescriptorTable::get_slot (const int& fd) const
+{
+    if (!this->is_within_capacity (fd)) {
+        return nullptr;
+    }
+
+    auto* segment = this->m_segments[static_cast<std::size_t> (fd) / option_fd_table_segment_size]
+                        .load (std::memory_order_acquire);
+
+    return (segment == nullptr)
+        ? nullptr
+        : &segment->m_slots[static_cast<std::size_t> (fd) % option_fd_table_segment_size];
+}
+
+// get_or_create_slot call. (...)
+FileDescriptorTable::Slot* FileDescriptorTable::get_or_create_slot (const int& fd)
+{
+    if (!this->is_within_capacity (fd)) {
+        return nullptr;
+    }
+
+    auto& segment_ptr
+        = this->m_segments[static_cast<std::size_t> (fd) / option_fd_table_segment_size];
+    auto* segment = segment_ptr.load (std::memory_order_acquire);
+
+    // allocate segment on first use and publish it to readers
+    if (segment == nullptr) {
+        segment = new Segment {};
+        segment_ptr.store (segment, std::memory_order_release);
+    }
+
+    return &segment->m_slots[static_cast<std::size_t> (fd) % option_fd_table_segment_size];
+}
+
+// publish call. (...)
+std::shared_ptr<MountPointEntry> FileDescriptorTable::publish (Slot* slot,
+    std::shared_ptr<MountPointEntry> entry)
+{
+    // an odd sequence marks the slot as being published, so readers never pair the tag of an entry
+    // with the path hash of another
+    auto sequence = slot->m_sequence.load (std::memory_order_relaxed);
+    slot->m_sequence.store (sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+
+    slot->m_tag.store ((entry != nullptr) ? FileDescriptorTable::encode_tag (*entry) : 0,
+        std::memory_order_relaxed);
+    slot->m_path_hash.store ((entry != nullptr) ? entry->get_path_hash () : 0,
+        std::memory_order_relaxed);
+    slot->m_sequence.store (sequence + 2, std::memory_order_release);
+
+    // the previous entry is only released once no reader holds a copy of it
+    return std::atomic_exchange (&slot->m_owner, std::move (entry));
+}
+
+// insert call. (...)
+bool FileDescriptorTable::insert (const int& fd, std::unique_ptr<MountPointEntry> entry)
+{
+    // lock_guard over mutex (write_lock)
+    std::lock_guard write_lock (this->m_write_lock);
+
+    auto* slot = this->get_or_create_slot (fd);
+    if (slot == nullptr) {
+        return false;
+    }
+
+    auto previous = this->publish (slot, std::move (entry));
+
+    return (previous == nullptr);
+}
+
+// lookup call. (...)
+FileDescriptorTag FileDescriptorTable::lookup (const int& fd) const
+{
+    FileDescriptorTag tag {};
+    auto* slot = this->get_slot (fd);
+
+    if (slot != nullptr) {
+        uint64_t value = 0;
+        uint64_t path_hash = 0;
+
+        // retry while the slot is being published, or if it was published during the read
+        while (true) {
+            auto sequence = slot->m_sequence.load (std::memory_order_acquire);
+            if ((sequence & 1) != 0) {
+                continue;
+            }
+
+            value = slot->m_tag.load (std::memory_order_relaxed);
+            path_hash = slot->m_path_hash.load (std::memory_order_relaxed);
+            std::atomic_thread_fence (std::memory_order_acquire);
+
+            if (slot->m_sequence.load (std::memory_order_relaxed) == sequence) {
+                break;
+            }
+        }
+
+        if ((value & kValidTag) != 0) {
+            tag.m_valid = true;
+            tag.m_mount_point = static_cast<MountPoint> ((value >> 32) & 0x7FFFFFFFULL);
+            tag.m_metadata_server_unit = static_cast<uint32_t> (value);
+            tag.m_path_hash = path_hash;
+        }
+    }
+
+    return tag;
+}
+
+// get call. (...)
+std::shared_ptr<MountPointEntry> FileDescriptorTable::get (const int& fd) const
+{
+    auto* slot = this->get_slot (fd);
+    return (slot == nullptr) ? nullptr : std::atomic_load (&slot->m_owner);
+}
+
+// remove call. (...)
+bool FileDescriptorTable::remove (const int& fd)
+{
+    // lock_guard over mutex (write_lock)
+    std::lock_guard write_lock (this->m_write_lock);
+
+    auto* slot = this->get_slot (fd);
+    if (slot == nullptr) {
+        return false;
+    }
+
+    auto previous = this->publish (slot, nullptr);
+
+    return (previous != nullptr);
+}
+
+// move call. (...)
+bool FileDescriptorTable::move (const int& old_fd, const int& new_fd)
+{
+    // lock_guard over mutex (write_lock)
+    std::lock_guard write_lock (this->m_write_lock);
+
+    auto* old_slot = this->get_slot (old_fd);
+    if (old_slot == nullptr || old_slot->m_owner == nullptr) {
+        return false;
+    }
+
+    // moving an entry onto itself is a no-op
+    if (old_fd == new_fd) {
+        return true;
+    }
+
+    auto* new_slot = this->get_or_create_slot (new_fd);
+    if (new_slot == nullptr) {
+        return false;
+    }
+
+    // publish the entry at new_fd before unregistering old_fd
+    this->publish (new_slot, old_slot->m_owner);
+    this->publish (old_slot, nullptr);
+
+    return true;
+}
+
+// duplicate call. (...)
+bool FileDescriptorTable::duplicate (const int& old_fd, const int& new_fd)
+{
+    // lock_guard over mutex (write_lock)
+    std::lock_guard write_lock (this->m_write_lock);
+
+    auto* old_slot = this->get_slot (old_fd);
+    auto entry = (old_slot == nullptr) ? nullptr : old_slot->m_owner;
+
+    // duplicating a file descriptor onto itself is a no-op
+    if (old_fd == new_fd) {
+        return (entry != nullptr);
+    }
+
+    // an unregistered old_fd only requires clearing the (possibly allocated) slot of new_fd
+    auto* new_slot = (entry == nullptr) ? this->get_slot (new_fd)
+                                        : this->get_or_create_slot (new_fd);
+    if (new_slot == nullptr) {
+        return false;
+    }
+
+    // replace the entry of new_fd in a single publish
+    this->publish (new_slot, entry);
+
+    return (entry != nullptr);
+}
+
+// references call. (...)
+long FileDescriptorTable::references (const int& fd)
+{
+    // lock_guard over mutex (write_lock)
+    std::lock_guard write_lock (this->m_write_lock);
+
+    auto* slot = this->get_slot (fd);
+    return (slot == nullptr) ? 0 : slot->m_owner.use_count ();
+}
+
+// to_string call. (...)
+std::string FileDescriptorTable::to_string ()
+{
+    // lock_guard over mutex (write_lock)
+    std::lock_guard write_lock (this->m_write_lock);
+
+    std::stringstream stream;
+    stream << "FileDescriptorTable: " << std::endl;
+    for (std::size_t i = 0; i < this->m_num_segments; i++) {
+        auto* segment = this->m_segments[i].load (std::memory_order_acquire);
+        if (segment == nullptr) {
+            continue;
+        }
+
+        for (std::size_t j = 0; j < option_fd_table_segment_size; j++) {
+            const auto& entry = segment->m_slots[j].m_owner;
+            if (entry != nullptr) {
+                stream << "  " << (i * option_fd_table_segment_size + j) << ": ";
+                stream << entry->to_string () << std::endl;
+            }
+        }
+    }
+
+    return stream.str ();
+}
+
+} // namespace padll::stage
@@ -0,0 +1,237 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <padll/library_headers/libc_dispatch.hpp>
+#include <padll/library_headers/libc_headers.hpp>
+#include <padll/stage/io_uring_table.hpp>
+#include <sys/mman.h>
+
+using namespace padll::headers;
+
+namespace padll::stage {
+
+// IoUringTable default constructor.
+IoUringTable::IoUringTable () = default;
+
+// IoUringTable default destructor.
+IoUringTable::~IoUringTable ()
+{
+    // unique_lock over shared_timed_mutex
+    std::unique_lock lock (this->m_shared_lock);
+
+    for (const auto& [ring_fd, ring] : this->m_rings) {
+        IoUringTable::unmap_ring (ring);
+    }
+    this->m_rings.clear ();
+    this->m_size.store (0);
+}
+
+// unmap_ring call. (...)
+void IoUringTable::unmap_ring (const IoUringRing& ring)
+{
+    // PADLL's own mappings are released through libc, so they are not accounted as application's
+    auto munmap_ptr = libc_dispatch ().get<libc_munmap_t> (PosixCall::munmap);
+    if (ring.m_sq_ring != nullptr) {
+        munmap_ptr (ring.m_sq_ring, ring.m_sq_ring_size);
+    }
+    if (ring.m_sqes != nullptr) {
+        munmap_ptr (ring.m_sqes, ring.m_sqes_size);
+    }
+}
+
+// decode_submission call. (...)
+IoUringSubmission IoUringTable::decode_submission (const struct io_uring_sqe* sqe)
+{
+    IoUringSubmission submission {};
+    submission.m_fd = sqe->fd;
+    submission.m_fixed_file = (sqe->flags & IOSQE_FIXED_FILE) != 0;
+
+    switch (sqe->opcode) {
+        case IORING_OP_READ:
+        case IORING_OP_READ_FIXED:
+            submission.m_operation = IoUringOperation::kRead;
+            submission.m_bytes = sqe->len;
+            break;
+
+        case IORING_OP_WRITE:
+        case IORING_OP_WRITE_FIXED:
+            submission.m_operation = IoUringOperation::kWrite;
+            submission.m_bytes = sqe->len;
+            break;
+
+        case IORING_OP_READV:
+        case IORING_OP_WRITEV: {
+            // vectored operations hold the iovec array (and its length) of the application
+            submission.m_operation = (sqe->opcode == IORING_OP_READV) ? IoUringOperation::kRead
+                                                                      : IoUringOperation::kWrite;
+            const auto* iov = reinterpret_cast<const struct iovec*> (sqe->addr);
+            for (unsigned i = 0; iov != nullptr && i < sqe->len; i++) {
+                submission.m_bytes += iov[i].iov_len;
+            }
+            break;
+        }
+
+        case IORING_OP_FSYNC:
+            submission.m_operation = ((sqe->fsync_flags & IORING_FSYNC_DATASYNC) != 0)
+                ? IoUringOperation::kFdatasync
+                : IoUringOperation::kFsync;
+            break;
+
+        case IORING_OP_OPENAT:
+            submission.m_operation = IoUringOperation::kOpenat;
+            submission.m_path = reinterpret_cast<const char*> (sqe->addr);
+            break;
+
+        default:
+            break;
+    }
+
+    return submission;
+}
+
+// register_ring call. (...)
+bool IoUringTable::register_ring (const int& ring_fd, const struct io_uring_params& params)
+{
+    // instances polled by a kernel thread are not submitted through io_uring_enter
+    if ((params.flags & IORING_SETUP_SQPOLL) != 0) {
+        return false;
+    }
+
+#ifdef IORING_SETUP_NO_MMAP
+    // rings allocated by the application cannot be mapped through the ring's file descriptor
+    if ((params.flags & IORING_SETUP_NO_MMAP) != 0) {
+        return false;
+    }
+#endif
+
+    IoUringRing ring {};
+    ring.m_entries = params.sq_entries;
+#ifdef IORING_SETUP_SINGLE_ISSUER
+    ring.m_single_issuer = (params.flags & IORING_SETUP_SINGLE_ISSUER) != 0;
+#endif
+    ring.m_sqe_size = sizeof (struct io_uring_sqe)
+        << (((params.flags & IORING_SETUP_SQE128) != 0) ? 1 : 0);
+    ring.m_sqes_size = params.sq_entries * ring.m_sqe_size;
+    ring.m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof (unsigned);
+
+    bool has_array = true;
+#ifdef IORING_SETUP_NO_SQARRAY
+    // instances without SQ array index the SQE array directly
+    if ((params.flags & IORING_SETUP_NO_SQARRAY) != 0) {
+        has_array = false;
+        ring.m_sq_ring_size = params.sq_off.ring_entries + sizeof (unsigned);
+    }
+#endif
+
+    // map PADLL's (read-only) view of the SQ ring and of the SQE array
+    auto mmap_ptr = libc_dispatch ().get<libc_mmap_t> (PosixCall::mmap);
+    ring.m_sq_ring = mmap_ptr (nullptr,
+        ring.m_sq_ring_size,
+        PROT_READ,
+        MAP_SHARED | MAP_POPULATE,
+        ring_fd,
+        static_cast<off_t> (IORING_OFF_SQ_RING));
+    ring.m_sqes = mmap_ptr (nullptr,
+        ring.m_sqes_size,
+        PROT_READ,
+        MAP_SHARED | MAP_POPULATE,
+        ring_fd,
+        static_cast<off_t> (IORING_OFF_SQES));
+
+    if (ring.m_sq_ring == MAP_FAILED || ring.m_sqes == MAP_FAILED) {
+        ring.m_sq_ring = (ring.m_sq_ring == MAP_FAILED) ? nullptr : ring.m_sq_ring;
+        ring.m_sqes = (ring.m_sqes == MAP_FAILED) ? nullptr : ring.m_sqes;
+        IoUringTable::unmap_ring (ring);
+        return false;
+    }
+
+    auto* base = static_cast<const char*> (ring.m_sq_ring);
+    ring.m_head = reinterpret_cast<const unsigned*> (base + params.sq_off.head);
+    ring.m_tail = reinterpret_cast<const unsigned*> (base + params.sq_off.tail);
+    ring.m_mask = reinterpret_cast<const unsigned*> (base + params.sq_off.ring_mask);
+    ring.m_array = has_array ? reinterpret_cast<const unsigned*> (base + params.sq_off.array)
+                             : nullptr;
+
+    // unique_lock over shared_timed_mutex
+    std::unique_lock lock (this->m_shared_lock);
+
+    auto [iterator, inserted] = this->m_rings.try_emplace (ring_fd, ring);
+    if (!inserted) {
+        // the file descriptor of a previous instance was reused
+        IoUringTable::unmap_ring (iterator->second);
+        iterator->second = ring;
+    }
+    this->m_size.store (this->m_rings.size ());
+
+    return true;
+}
+
+// remove_ring call. (...)
+bool IoUringTable::remove_ring (const int& ring_fd)
+{
+    // unique_lock over shared_timed_mutex
+    std::unique_lock lock (this->m_shared_lock);
+
+    auto iterator = this->m_rings.find (ring_fd);
+    if (iterator == this->m_rings.end ()) {
+        return false;
+    }
+
+    IoUringTable::unmap_ring (iterator->second);
+    this->m_rings.erase (iterator);
+    this->m_size.store (this->m_rings.size ());
+
+    return true;
+}
+
+// is_empty call. (...)
+bool IoUringTable::is_empty () const
+{
+    return this->m_size.load (std::memory_order_relaxed) == 0;
+}
+
+// submission_window call. (...)
+std::optional<std::pair<unsigned, unsigned>> IoUringTable::submission_window (const int& ring_fd)
+{
+    std::shared_lock lock (this->m_shared_lock);
+
+    auto iterator = this->m_rings.find (ring_fd);
+    if (iterator == this->m_rings.end ()) {
+        return std::nullopt;
+    }
+
+    // the head is updated by the kernel, and the tail by the application
+    const auto& ring = iterator->second;
+    auto head = __atomic_load_n (ring.m_head, __ATOMIC_ACQUIRE);
+    auto tail = __atomic_load_n (ring.m_tail, __ATOMIC_ACQUIRE);
+
+    return std::make_pair (head, tail - head);
+}
+
+// is_shared_ring call. (...)
+bool IoUringTable::is_shared_ring (const int& ring_fd)
+{
+    std::shared_lock lock (this->m_shared_lock);
+
+    auto iterator = this->m_rings.find (ring_fd);
+    return iterator != this->m_rings.end () && !iterator->second.m_single_issuer;
+}
+
+// to_string call. (...)
+std::string IoUringTable::to_string ()
+{
+    std::shared_lock lock (this->m_shared_lock);
+
+    std::stringstream stream;
+    stream << "IoUringTable: " << std::endl;
+    for (const auto& [ring_fd, ring] : this->m_rings) {
+        stream << "  " << ring_fd << ": " << ring.m_entries << " entries";
+        stream << ((ring.m_array != nullptr) ? "" : " (no SQ array)") << std::endl;
+    }
+
+    return stream.str ();
+}
+
+} // namespace padll::stage
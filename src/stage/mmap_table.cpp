@@ -0,0 +1,204 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <algorithm>
+#include <padll/stage/mmap_table.hpp>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace padll::stage {
+
+// MmapTable default constructor.
+MmapTable::MmapTable () : m_page_size { static_cast<size_t> (::sysconf (_SC_PAGESIZE)) }
+{ }
+
+// MmapTable default destructor.
+MmapTable::~MmapTable () = default;
+
+// sample_region call. (...)
+bool MmapTable::sample_region (const uintptr_t& address,
+    MappedRegion& region,
+    uint64_t& bytes) const
+{
+    auto pages = region.m_resident.size ();
+    std::vector<unsigned char> residency (std::min (pages, option_mmap_sampling_chunk));
+
+    for (size_t first = 0; first < pages; first += residency.size ()) {
+        auto count = std::min (pages - first, residency.size ());
+
+        // fails with ENOMEM if (part of) the range is no longer mapped
+        if (::mincore (reinterpret_cast<void*> (address + first * this->m_page_size),
+                count * this->m_page_size,
+                residency.data ())
+            != 0) {
+            return false;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            bool resident = (residency[i] & 1) != 0;
+            if (resident && !region.m_resident[first + i]) {
+                bytes += this->m_page_size;
+            }
+            region.m_resident[first + i] = resident;
+        }
+    }
+
+    return true;
+}
+
+// remove_regions call. (...)
+void MmapTable::remove_regions (const uintptr_t& start, const uintptr_t& end)
+{
+    // start from the last mapping that begins before the range (it may overlap with it)
+    auto iterator = this->m_regions.upper_bound (start);
+    if (iterator != this->m_regions.begin ()) {
+        iterator--;
+    }
+
+    while (iterator != this->m_regions.end () && iterator->first < end) {
+        auto base = iterator->first;
+        auto limit = base + iterator->second.m_resident.size () * this->m_page_size;
+        if (limit <= start) {
+            iterator++;
+            continue;
+        }
+
+        auto region = std::move (iterator->second);
+        iterator = this->m_regions.erase (iterator);
+
+        // keep the parts of the mapping that are not within the range
+        if (base < start) {
+            auto pages = (start - base) / this->m_page_size;
+            this->m_regions[base] = { region.m_workflow_id,
+                std::vector<bool> (region.m_resident.begin (),
+                    region.m_resident.begin () + static_cast<long> (pages)) };
+        }
+        if (limit > end) {
+            auto pages = (end - base) / this->m_page_size;
+            this->m_regions[end] = { region.m_workflow_id,
+                std::vector<bool> (region.m_resident.begin () + static_cast<long> (pages),
+                    region.m_resident.end ()) };
+        }
+    }
+
+    this->m_size.store (this->m_regions.size ());
+}
+
+// register_mapping call. (...)
+bool MmapTable::register_mapping (void* address, const size_t& length, const uint32_t& workflow_id)
+{
+    auto start = reinterpret_cast<uintptr_t> (address);
+    auto pages = (length + this->m_page_size - 1) / this->m_page_size;
+    if (pages == 0) {
+        return false;
+    }
+
+    // pages that are already resident are not charged
+    MappedRegion region { workflow_id, std::vector<bool> (pages, false) };
+    uint64_t bytes = 0;
+    if (!this->sample_region (start, region, bytes)) {
+        return false;
+    }
+
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_lock);
+
+    // mappings replaced by this one (e.g., MAP_FIXED) are dropped
+    this->remove_regions (start, start + pages * this->m_page_size);
+    this->m_regions[start] = std::move (region);
+    this->m_size.store (this->m_regions.size ());
+
+    return true;
+}
+
+// sample_mappings call. (...)
+std::vector<MmapCharge> MmapTable::sample_mappings (void* address, const size_t& length)
+{
+    std::vector<MmapCharge> charges {};
+    auto start = reinterpret_cast<uintptr_t> (address);
+    auto pages = (length + this->m_page_size - 1) / this->m_page_size;
+    auto end = start + pages * this->m_page_size;
+
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_lock);
+
+    // start from the last mapping that begins before the range (it may overlap with it)
+    auto iterator = this->m_regions.upper_bound (start);
+    if (iterator != this->m_regions.begin ()) {
+        iterator--;
+    }
+
+    for (; iterator != this->m_regions.end () && iterator->first < end; iterator++) {
+        auto limit = iterator->first + iterator->second.m_resident.size () * this->m_page_size;
+        uint64_t bytes = 0;
+        if (limit > start && this->sample_region (iterator->first, iterator->second, bytes)
+            && bytes > 0) {
+            charges.push_back ({ iterator->second.m_workflow_id, bytes });
+        }
+    }
+
+    return charges;
+}
+
+// remove_mappings call. (...)
+void MmapTable::remove_mappings (void* address, const size_t& length)
+{
+    auto start = reinterpret_cast<uintptr_t> (address);
+    auto pages = (length + this->m_page_size - 1) / this->m_page_size;
+
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_lock);
+    this->remove_regions (start, start + pages * this->m_page_size);
+}
+
+// sample call. (...)
+std::vector<MmapCharge> MmapTable::sample ()
+{
+    std::vector<MmapCharge> charges {};
+
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_lock);
+
+    for (auto iterator = this->m_regions.begin (); iterator != this->m_regions.end ();) {
+        uint64_t bytes = 0;
+        if (!this->sample_region (iterator->first, iterator->second, bytes)) {
+            iterator = this->m_regions.erase (iterator);
+            continue;
+        }
+
+        if (bytes > 0) {
+            charges.push_back ({ iterator->second.m_workflow_id, bytes });
+        }
+        iterator++;
+    }
+    this->m_size.store (this->m_regions.size ());
+
+    return charges;
+}
+
+// is_empty call. (...)
+bool MmapTable::is_empty () const
+{
+    return this->m_size.load (std::memory_order_relaxed) == 0;
+}
+
+// to_string call. (...)
+std::string MmapTable::to_string ()
+{
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_lock);
+
+    std::stringstream stream;
+    stream << "MmapTable: " << std::endl;
+    for (const auto& [address, region] : this->m_regions) {
+        stream << "  " << reinterpret_cast<void*> (address) << ": ";
+        stream << region.m_resident.size () << " pages (workflow " << region.m_workflow_id << ")";
+        stream << std::endl;
+    }
+
+    return stream.str ();
+}
+
+} // namespace padll::stage
@@ -0,0 +1,296 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <padll/stage/mount_point_classifier.hpp>
+#include <queue>
+
+namespace padll::stage {
+
+// MountPointClassifier default constructor.
+MountPointClassifier::MountPointClassifier () = default;
+
+// MountPointClassifier default destructor.
+MountPointClassifier::~MountPointClassifier () = default;
+
+// next_component call. (...)
+bool MountPointClassifier::next_component (const std::string_view& path,
+    std::size_t& position,
+    std::string_view& component)
+{
+    // skip separators
+    while (position < path.size () && path[position] == '/') {
+        position++;
+    }
+
+    if (position >= path.size ()) {
+        return false;
+    }
+
+    auto end = path.find ('/', position);
+    end = (end == std::string_view::npos) ? path.size () : end;
+    component = path.substr (position, end - position);
+    position = end;
+
+    return true;
+}
+
+// normalize call. (...)
+std::string MountPointClassifier::normalize (const std::string_view& prefix)
+{
+    if (prefix.empty () || prefix[0] != '/') {
+        return {};
+    }
+
+    std::vector<std::string_view> components {};
+    std::string_view component;
+    std::size_t position = 0;
+
+    while (MountPointClassifier::next_component (prefix, position, component)) {
+        if (component == ".") {
+            continue;
+        } else if (component == "..") {
+            if (!components.empty ()) {
+                components.pop_back ();
+            }
+        } else {
+            components.push_back (component);
+        }
+    }
+
+    std::string normalized {};
+    for (const auto& value : components) {
+        normalized.append ("/").append (value);
+    }
+
+    return normalized.empty () ? std::string { "/" } : normalized;
+}
+
+// register_mount_point call. (...)
+bool MountPointClassifier::register_mount_point (const std::string_view& prefix,
+    const MountPoint& mount_point)
+{
+    auto normalized = MountPointClassifier::normalize (prefix);
+    if (normalized.empty ()) {
+        return false;
+    }
+
+    // validate that the prefix can be matched by classify
+    std::size_t depth = 0;
+    std::size_t position = 0;
+    std::string_view component;
+    while (MountPointClassifier::next_component (normalized, position, component)) {
+        depth++;
+    }
+    if (depth >= kMaxDepth) {
+        return false;
+    }
+
+    // replace the mount point of an already registered prefix
+    bool replaced = false;
+    for (auto& [registered_prefix, registered_mount_point] : this->m_mount_points) {
+        if (registered_prefix == normalized) {
+            registered_mount_point = mount_point;
+            replaced = true;
+        }
+    }
+
+    if (!replaced) {
+        this->m_mount_points.emplace_back (normalized, mount_point);
+    }
+
+    this->compile ();
+    return true;
+}
+
+// compile call. (...)
+void MountPointClassifier::compile ()
+{
+    // build a (temporary) pointer-based trie, with sorted children
+    struct BuildNode {
+        std::map<std::string, std::unique_ptr<BuildNode>> m_children {};
+        bool m_terminal { false };
+        MountPoint m_mount_point { MountPoint::kNone };
+    };
+
+    BuildNode root {};
+    for (const auto& [prefix, mount_point] : this->m_mount_points) {
+        auto* node = &root;
+        std::size_t position = 0;
+        std::string_view component;
+
+        while (MountPointClassifier::next_component (prefix, position, component)) {
+            auto& child = node->m_children[std::string { component }];
+            if (child == nullptr) {
+                child = std::make_unique<BuildNode> ();
+            }
+            node = child.get ();
+        }
+
+        node->m_terminal = true;
+        node->m_mount_point = mount_point;
+    }
+
+    // flatten the trie in breadth-first order, so the children of each node are contiguous
+    std::vector<Node> nodes {};
+    std::vector<Edge> edges {};
+    std::string components {};
+    std::queue<const BuildNode*> queue {};
+
+    nodes.push_back ({ 0, 0, root.m_terminal, root.m_mount_point });
+    queue.push (&root);
+
+    for (uint32_t index = 0; !queue.empty (); index++) {
+        const auto* node = queue.front ();
+        queue.pop ();
+
+        nodes[index].m_first_edge = static_cast<uint32_t> (edges.size ());
+        nodes[index].m_num_edges = static_cast<uint32_t> (node->m_children.size ());
+
+        for (const auto& [component, child] : node->m_children) {
+            edges.push_back ({ static_cast<uint32_t> (components.size ()),
+                static_cast<uint32_t> (component.size ()),
+                static_cast<uint32_t> (nodes.size ()) });
+            components.append (component);
+
+            nodes.push_back ({ 0, 0, child->m_terminal, child->m_mount_point });
+            queue.push (child.get ());
+        }
+    }
+
+    // mark the mount points that have other mount points below them (children are always stored
+    // after their parent, so a reverse pass visits all descendants first)
+    std::vector<bool> below (nodes.size (), false);
+    std::vector<uint8_t> nested {};
+    for (auto index = nodes.size (); index-- > 0;) {
+        const auto& node = nodes[index];
+        for (auto edge = node.m_first_edge; edge < node.m_first_edge + node.m_num_edges; edge++) {
+            auto child = edges[edge].m_node;
+            below[index] = below[index] || below[child] || nodes[child].m_terminal;
+        }
+
+        // 0: not registered; 1: without nested mount points; 2: with nested mount points
+        if (node.m_terminal) {
+            auto position = static_cast<std::size_t> (node.m_mount_point);
+            if (position >= nested.size ()) {
+                nested.resize (position + 1, 0);
+            }
+            auto state = static_cast<uint8_t> (below[index] ? 2 : 1);
+            nested[position] = std::max (nested[position], state);
+        }
+    }
+
+    this->m_nested_mount_points = std::move (nested);
+    this->m_nodes = std::move (nodes);
+    this->m_edges = std::move (edges);
+    this->m_components = std::move (components);
+}
+
+// find_child call. (...)
+uint32_t MountPointClassifier::find_child (const uint32_t& node,
+    const std::string_view& component) const
+{
+    // binary search over the (sorted) edges of the node
+    auto low = this->m_nodes[node].m_first_edge;
+    auto high = low + this->m_nodes[node].m_num_edges;
+
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        const auto& edge = this->m_edges[middle];
+        std::string_view label { this->m_components.data () + edge.m_offset, edge.m_length };
+        auto comparison = label.compare (component);
+
+        if (comparison == 0) {
+            return edge.m_node;
+        } else if (comparison < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return static_cast<uint32_t> (-1);
+}
+
+// classify call. (...)
+std::pair<bool, MountPoint> MountPointClassifier::classify (const std::string_view& path) const
+{
+    if (path.empty () || path[0] != '/') {
+        return { false, MountPoint::kNone };
+    }
+
+    // stack of the matched trie nodes, and depth of the unmatched components below them
+    std::array<uint32_t, kMaxDepth> stack {};
+    std::size_t depth = 0;
+    std::size_t unmatched = 0;
+    stack[0] = 0;
+
+    std::size_t position = 0;
+    std::string_view component;
+
+    while (MountPointClassifier::next_component (path, position, component)) {
+        if (component == ".") {
+            continue;
+        } else if (component == "..") {
+            if (unmatched > 0) {
+                unmatched--;
+            } else if (depth > 0) {
+                depth--;
+            }
+        } else if (unmatched > 0) {
+            unmatched++;
+        } else {
+            auto child = (depth + 1 < kMaxDepth) ? this->find_child (stack[depth], component)
+                                                 : static_cast<uint32_t> (-1);
+            if (child == static_cast<uint32_t> (-1)) {
+                unmatched++;
+            } else {
+                stack[++depth] = child;
+            }
+        }
+    }
+
+    // longest matched prefix
+    for (auto level = static_cast<long> (depth); level >= 0; level--) {
+        const auto& node = this->m_nodes[stack[static_cast<std::size_t> (level)]];
+        if (node.m_terminal) {
+            return { true, node.m_mount_point };
+        }
+    }
+
+    return { false, MountPoint::kNone };
+}
+
+// has_nested_mount_points call. (...)
+bool MountPointClassifier::has_nested_mount_points (const MountPoint& mount_point) const
+{
+    auto position = static_cast<std::size_t> (mount_point);
+    return (position >= this->m_nested_mount_points.size ())
+        || this->m_nested_mount_points[position] != 1;
+}
+
+// get_mount_points call. (...)
+const std::vector<std::pair<std::string, MountPoint>>&
+MountPointClassifier::get_mount_points () const
+{
+    return this->m_mount_points;
+}
+
+// get_prefix call. (...)
+std::string MountPointClassifier::get_prefix (const MountPoint& mount_point) const
+{
+    for (const auto& [prefix, registered_mount_point] : this->m_mount_points) {
+        if (registered_mount_point == mount_point) {
+            return prefix;
+        }
+    }
+
+    return {};
+}
+
+} // namespace padll::stage
@@ -4,6 +4,7 @@
  **/
 
 #include <padll/stage/mount_point_entry.hpp>
+#include <padll/stage/workflow_selector.hpp>
 
 namespace padll::stage {
 
@@ -13,7 +14,8 @@ MountPointEntry::MountPointEntry () = default;
 // MountPointEntry parameterized constructor.
 MountPointEntry::MountPointEntry (const std::string& path, const MountPoint& mount_point) :
     m_path { path },
-    m_mount_point { mount_point }
+    m_mount_point { mount_point },
+    m_path_hash { WorkflowSelector::hash_path (path) }
 { }
 
 // MountPointEntry parameterized constructor.
@@ -22,7 +24,8 @@ MountPointEntry::MountPointEntry (const std::string& path,
     const uint32_t& metadata_instance) :
     m_path { path },
     m_mount_point { mount_point },
-    m_metadata_server_unit { metadata_instance }
+    m_metadata_server_unit { metadata_instance },
+    m_path_hash { WorkflowSelector::hash_path (path) }
 { }
 
 // MountPointEntry default destructor.
@@ -46,6 +49,32 @@ const uint32_t& MountPointEntry::get_metadata_server_unit () const
     return this->m_metadata_server_unit;
 }
 
+// get_path_hash call. (...)
+const uint64_t& MountPointEntry::get_path_hash () const
+{
+    return this->m_path_hash;
+}
+
+// begin_stream_batch call. (...)
+bool MountPointEntry::begin_stream_batch ()
+{
+    return this->m_stream_refilled.exchange (false, std::memory_order_relaxed);
+}
+
+// end_stream_call call. (...)
+void MountPointEntry::end_stream_call (const void* entry)
+{
+    if (entry == nullptr) {
+        return;
+    }
+
+    auto position = reinterpret_cast<uintptr_t> (entry);
+    auto previous = this->m_stream_position.exchange (position, std::memory_order_relaxed);
+    if (previous != 0 && position <= previous) {
+        this->m_stream_refilled.store (true, std::memory_order_relaxed);
+    }
+}
+
 // to_string call. (...)
 std::string MountPointEntry::to_string () const
 {
@@ -4,6 +4,7 @@
  **/
 
 #include <padll/stage/mount_point_table.hpp>
+#include <tuple>
 
 namespace padll::stage {
 
@@ -46,9 +47,9 @@ MountPointTable::~MountPointTable ()
 // is_file_descriptor_valid call. (...)
 bool MountPointTable::is_file_descriptor_valid (const int& fd) const
 {
-    if (fd <= 2) {
+    if (fd < 0) {
         this->m_log->log_error (
-            "Accessing special (or inexistent) file descriptor (" + std::to_string (fd) + ").");
+            "Accessing inexistent file descriptor (" + std::to_string (fd) + ").");
         return false;
     }
     return true;
@@ -71,11 +72,21 @@ bool MountPointTable::is_file_pointer_valid (const FILE* fptr) const
     return true;
 }
 
+// is_directory_pointer_valid call. (...)
+bool MountPointTable::is_directory_pointer_valid (const DIR* dptr) const
+{
+    if (dptr == nullptr) {
+        this->m_log->log_error ("Accessing inexistent directory stream.");
+        return false;
+    }
+    return true;
+}
+
 // initialize call. (...)
 void MountPointTable::initialize ()
 {
     // if mount point differentiation is enabled, register local and remote workflows
-    if (option_mount_point_differentiation_enabled) {
+    if (this->m_mount_point_differentiation) {
         // FIXME: Needing refactor or cleanup -@gsd at 4/13/2022, 2:14:55 PM
         // Do not consider right now differentiation between local and remote mount points.
 
@@ -84,13 +95,29 @@ void MountPointTable::initialize ()
         //     this->m_default_workflows.default_local_mount_point_workflows);
         // register remote mount point workflows
 
+        this->m_mount_point_classifier.register_mount_point (this->m_remote_mount_point,
+            MountPoint::kRemote);
         this->register_mount_point_type (MountPoint::kRemote,
             this->m_default_workflows.default_remote_mount_point_workflows);
+
+        // register additional mount points of the runtime configuration
+        const auto& configuration = padll::configurations::padll_configuration ();
+        for (const auto& [prefix, workflows] : configuration.get_mount_points ()) {
+            auto [registered, mount_point] = this->register_mount_point (prefix,
+                workflows.empty () ? this->m_default_workflows.default_remote_mount_point_workflows
+                                   : workflows);
+            if (!registered) {
+                this->m_log->log_error ("Mount point " + prefix + " could not be registered.");
+            }
+        }
     } else {
         // register all mount point workflows
         this->register_mount_point_type (MountPoint::kNone,
             this->m_default_workflows.default_mount_point_workflows);
     }
+
+    // resolve (and classify) the working directory, used for relative paths
+    this->update_working_directory ();
 }
 
 // create_mount_point_entry call. (...)
@@ -104,18 +131,19 @@ bool MountPointTable::create_mount_point_entry (const int& fd,
         return false;
     }
 
-    // lock_guard over shared_timed_mutex (write_lock)
-    std::lock_guard write_lock (this->m_fd_shared_lock);
+    // check if key can be indexed by the file descriptor table
+    if (!this->m_file_descriptors_table.is_within_capacity (fd)) {
+        this->m_log->log_error ("File descriptor " + std::to_string (fd)
+            + " exceeds the file descriptor table capacity.");
+        return false;
+    }
 
-    // create entry for the 'fd' file descriptor
-    auto [iter, inserted] = this->m_file_descriptors_table.emplace (std::make_pair (fd,
-        std::make_unique<MountPointEntry> (path, mount_point, metadata_server_unit)));
+    // create (or replace) entry for the 'fd' file descriptor
+    auto inserted = this->m_file_descriptors_table.insert (fd,
+        std::make_unique<MountPointEntry> (path, mount_point, metadata_server_unit));
 
-    // check if the insertion was successful
+    // check if the insertion replaced a previous entry
     if (!inserted) {
-        // replace key-value pair in file_descriptors_table
-        this->m_file_descriptors_table.at (fd)
-            = std::make_unique<MountPointEntry> (path, mount_point, metadata_server_unit);
 // submit error message to the logging facility
 #if OPTION_DETAILED_LOGGING
         this->m_log->log_debug ("Replacing value at file descriptor " + std::to_string (fd) + ".");
@@ -161,31 +189,60 @@ bool MountPointTable::create_mount_point_entry (FILE* file_ptr,
     return inserted;
 }
 
+// create_mount_point_entry call. (...)
+bool MountPointTable::create_mount_point_entry (DIR* dir_ptr,
+    const std::string& path,
+    const MountPoint& mount_point,
+    const uint32_t& metadata_server_unit)
+{
+    // check if key is an inexistent directory stream
+    if (!this->is_directory_pointer_valid (dir_ptr)) {
+        return false;
+    }
+
+    // lock_guard over shared_timed_mutex (write_lock)
+    std::lock_guard write_lock (this->m_dptr_shared_lock);
+
+    // create (or replace) entry for the 'dir_ptr' directory stream
+    auto [iter, inserted] = this->m_dir_ptr_table.insert_or_assign (dir_ptr,
+        std::make_unique<MountPointEntry> (path, mount_point, metadata_server_unit));
+
+// submit error message to the logging facility
+#if OPTION_DETAILED_LOGGING
+    if (!inserted) {
+        std::stringstream stream;
+        stream << "Replacing value at directory stream " << dir_ptr << ".";
+        this->m_log->log_debug (stream.str ());
+    }
+#endif
+
+    return inserted;
+}
+
 // get_mount_point_entry call. (...)
-std::pair<bool, MountPointEntry*> MountPointTable::get_mount_point_entry (const int& key)
+std::pair<bool, std::shared_ptr<MountPointEntry>> MountPointTable::get_mount_point_entry (
+    const int& key)
 {
     // check if key is a reserved or inexistent file descriptor
     if (!this->is_file_descriptor_valid (key)) {
         return std::make_pair (false, nullptr);
     }
 
-    // shared_lock over shared_timed_mutex (read_lock)
-    std::shared_lock read_lock (this->m_fd_shared_lock);
-
     // get the entry for the 'key' file descriptor
-    auto iterator = this->m_file_descriptors_table.find (key);
+    auto entry_ptr = this->m_file_descriptors_table.get (key);
     // check if the entry exists
-    if (iterator == this->m_file_descriptors_table.end ()) {
+    if (entry_ptr == nullptr) {
         this->m_log->log_error ("Mount point entry does not exist (" + std::to_string (key) + ").");
         return std::make_pair (false, nullptr);
     } else {
-        // return pointer to entry's value
-        return std::make_pair (true, iterator->second.get ());
+        // return (shared) pointer to entry's value
+        return std::make_pair (true, std::move (entry_ptr));
     }
 }
 
 // get_mount_point_entry call. (...)
-std::pair<bool, MountPointEntry*> MountPointTable::get_mount_point_entry (FILE* key)
+std::pair<bool, std::shared_ptr<MountPointEntry>> MountPointTable::get_mount_point_entry (
+    FILE* key)
 {
     // check if key is a reserved or inexistent file descriptor
     if (!this->is_file_pointer_valid (key)) {
@@ -202,8 +259,32 @@ std::pair<bool, MountPointEntry*> MountPointTable::get_mount_point_entry (FILE*
         this->m_log->log_error ("Mount point entry does not exist.");
         return std::make_pair (false, nullptr);
     } else {
-        // return pointer to entry's value
-        return std::make_pair (true, iterator->second.get ());
+        // return (shared) pointer to entry's value, which outlives its removal from the table
+        return std::make_pair (true, iterator->second);
+    }
+}
+
+// get_mount_point_entry call. (...)
+std::pair<bool, std::shared_ptr<MountPointEntry>> MountPointTable::get_mount_point_entry (
+    DIR* key)
+{
+    // check if key is an inexistent directory stream
+    if (!this->is_directory_pointer_valid (key)) {
+        return std::make_pair (false, nullptr);
+    }
+
+    // shared_lock over shared_time_mutex (read_lock)
+    std::shared_lock read_lock (this->m_dptr_shared_lock);
+
+    // get the entry for the 'key' directory stream
+    auto iterator = this->m_dir_ptr_table.find (key);
+    // check if the entry exists
+    if (iterator == this->m_dir_ptr_table.end ()) {
+        this->m_log->log_error ("Mount point entry does not exist.");
+        return std::make_pair (false, nullptr);
+    } else {
+        // return (shared) pointer to entry's value, which outlives its removal from the table
+        return std::make_pair (true, iterator->second);
     }
 }
 
@@ -215,11 +296,8 @@ bool MountPointTable::remove_mount_point_entry (const int& key)
         return false;
     }
 
-    // lock_guard over shared_timed_mutex (write_lock)
-    std::lock_guard write_lock (this->m_fd_shared_lock);
-
     // remove entry for the 'key' file descriptor and check if the removal was successful
-    if (this->m_file_descriptors_table.erase (key) == 0) {
+    if (!this->m_file_descriptors_table.remove (key)) {
         // submit error message to the logging facility
         this->m_log->log_error (
             "File descriptor " + std::to_string (key) + " could not be removed.");
@@ -254,6 +332,30 @@ bool MountPointTable::remove_mount_point_entry (FILE* key)
     return true;
 }
 
+// remove_mount_point_entry call. (...)
+bool MountPointTable::remove_mount_point_entry (DIR* key)
+{
+    // check if key is an inexistent directory stream
+    if (!this->is_directory_pointer_valid (key)) {
+        return false;
+    }
+
+    // lock_guard over shared_timed_mutex (write_lock)
+    std::lock_guard write_lock (this->m_dptr_shared_lock);
+
+    // check if the removal was successful
+    if (this->m_dir_ptr_table.erase (key) == 0) {
+        std::stringstream stream;
+        stream << "Directory stream " << key << " could not be removed.";
+        // submit error message to the logging facility
+        this->m_log->log_error (stream.str ());
+
+        return false;
+    }
+
+    return true;
+}
+
 // replace_file_descriptor call. (...)
 bool MountPointTable::replace_file_descriptor (const int& old_fd, const int& new_fd)
 {
@@ -262,75 +364,122 @@ bool MountPointTable::replace_file_descriptor (const int& old_fd, const int& new
         return false;
     }
 
-    // lock_guard over shared_timed_mutex (write_lock)
-    std::lock_guard write_lock (this->m_fd_shared_lock);
+    // move the entry of 'old_fd' to 'new_fd' and check if it was successful
+    if (!this->m_file_descriptors_table.move (old_fd, new_fd)) {
+        this->m_log->log_error ("Cannot replace file descriptor " + std::to_string (old_fd) + ".");
+        return false;
+    }
 
-    // get the entry for the 'old_fd' file descriptor
-    auto iterator = this->m_file_descriptors_table.find (old_fd);
+    return true;
+}
 
-    // check if the entry exists
-    if (iterator == this->m_file_descriptors_table.end ()) {
-        this->m_log->log_error ("Cannot replace file descriptor " + std::to_string (old_fd) + ".");
+// duplicate_file_descriptor call. (...)
+bool MountPointTable::duplicate_file_descriptor (const int& old_fd, const int& new_fd)
+{
+    // check if old_fd and new_fd belong to inexistent file descriptors
+    if (!this->is_file_descriptor_valid (old_fd) || !this->is_file_descriptor_valid (new_fd)) {
         return false;
-    } else {
-        // extract key-value pair from file_descriptors_table
-        auto node_entry = this->m_file_descriptors_table.extract (iterator);
-        // replace node_entry's key with new_fd
-        node_entry.key () = new_fd;
-        // insert node_entry into file_descriptors_table
-        this->m_file_descriptors_table.insert (std::move (node_entry));
+    }
+
+    // share the entry of 'old_fd' with 'new_fd' (duplicates of unregistered file descriptors,
+    // such as sockets and pipes, are expected and not reported as errors)
+    auto shared = this->m_file_descriptors_table.duplicate (old_fd, new_fd);
 
-        return true;
+// submit debug message to the logging facility
+#if OPTION_DETAILED_LOGGING
+    if (!shared) {
+        this->m_log->log_debug ("File descriptor " + std::to_string (old_fd)
+            + " is not registered; unregistering " + std::to_string (new_fd) + ".");
     }
+#endif
+
+    return shared;
 }
 
 // register_mount_point_type call. (...)
 void MountPointTable::register_mount_point_type (const MountPoint& type,
     const std::vector<uint32_t>& workflows)
 {
-    // find the mount point type
-    auto iterator = this->m_mount_point_workflows.find (type);
-
-    // if the mount point type does not exist, create it
-    if (iterator == this->m_mount_point_workflows.end ()) {
-        // create the mount point type
-        auto [iter, inserted] = this->m_mount_point_workflows.try_emplace (type, workflows);
-
-        // validate if <MountPoint, Workflows> entry was emplaced
-        if (!inserted) {
-            std::stringstream stream;
-            stream << "Mount point type " << padll::options::mount_point_to_string (type)
-                   << " could not be registered.";
-            // submit error message to the logging facility
-            this->m_log->log_error (stream.str ());
+    // validate that the mount point type has workflows to select from
+    if (workflows.empty ()) {
+        std::stringstream stream;
+        stream << "Mount point type " << padll::options::mount_point_to_string (type)
+               << " could not be registered (no workflows).";
+        // submit error message to the logging facility
+        this->m_log->log_error (stream.str ());
+        return;
+    }
+
+    // register (or replace) the workflows of the mount point type
+    this->m_workflow_selector.register_workflows (type, workflows);
+}
+
+// register_mount_point call. (...)
+std::pair<bool, MountPoint> MountPointTable::register_mount_point (const std::string& prefix,
+    const std::vector<uint32_t>& workflows)
+{
+    // reuse the identifier of an already registered prefix
+    auto normalized = MountPointClassifier::normalize (prefix);
+    for (const auto& [registered_prefix, registered_mount_point] :
+        this->m_mount_point_classifier.get_mount_points ()) {
+        if (registered_prefix == normalized) {
+            this->register_mount_point_type (registered_mount_point, workflows);
+            return { true, registered_mount_point };
         }
+    }
 
-    } else {
-        iterator->second = workflows;
+    // validate prefix, workflows, and number of registered mount points
+    if (normalized.empty () || workflows.empty ()
+        || this->m_next_mount_point >= option_max_mount_points) {
+        return { false, MountPoint::kNone };
+    }
+
+    auto mount_point = static_cast<MountPoint> (this->m_next_mount_point);
+    if (!this->m_mount_point_classifier.register_mount_point (normalized, mount_point)) {
+        return { false, MountPoint::kNone };
     }
+
+    this->m_next_mount_point++;
+    this->register_mount_point_type (mount_point, workflows);
+
+    // the working directory may now belong to the new mount point
+    this->update_working_directory ();
+
+    return { true, mount_point };
 }
 
 // extract_mount_point call. (...)
-MountPoint MountPointTable::extract_mount_point (const std::string_view& path) const
+MountPoint MountPointTable::extract_mount_point (const std::string_view& path,
+    const int& dirfd) const
 {
     // get namespace type
-    return (!option_mount_point_differentiation_enabled)
+    return (!this->m_mount_point_differentiation)
         ? MountPoint::kNone
-        : this->extract_mount_point_from_path (path);
+        : this->extract_mount_point_from_path (dirfd, path);
 }
 
 // pick_workflow_id call. (...)
 std::pair<MountPoint, uint32_t> MountPointTable::pick_workflow_id (const std::string_view& path)
+{
+    return this->pick_workflow_id (AT_FDCWD, path);
+}
+
+// pick_workflow_id call. (...)
+std::pair<MountPoint, uint32_t> MountPointTable::pick_workflow_id (const int& dirfd,
+    const std::string_view& path)
 {
     // extract mount point of the given path
-    auto namespace_type = (!option_mount_point_differentiation_enabled)
+    auto namespace_type = (!this->m_mount_point_differentiation)
         ? MountPoint::kNone
-        : this->extract_mount_point_from_path (path);
+        : this->extract_mount_point_from_path (dirfd, path);
 
     // select workflow identifier
     auto workflow_id = (option_select_workflow_by_metadata_unit)
         ? this->select_workflow_from_metadata_unit (path)
-        : this->select_workflow_from_mountpoint (namespace_type);
+        : this->select_workflow_from_mountpoint (namespace_type,
+            (this->m_workflow_selector.get_strategy () == WorkflowSelection::kPathHash)
+                ? WorkflowSelector::hash_path (path)
+                : 0);
 
     // verify if the workflow identifier was not found
     if (workflow_id == static_cast<uint32_t> (-1)) {
@@ -344,19 +493,27 @@ std::pair<MountPoint, uint32_t> MountPointTable::pick_workflow_id (const std::st
 uint32_t MountPointTable::pick_workflow_id (const int& fd)
 {
     auto workflow_id = static_cast<uint32_t> (-1);
-    // get MountPointEntry of the given file descriptor
-    auto [return_value, entry_ptr] = this->get_mount_point_entry (fd);
+
+    // check if key is a reserved or inexistent file descriptor
+    if (!this->is_file_descriptor_valid (fd)) {
+        return workflow_id;
+    }
+
+    // get the classification of the given file descriptor (lock-free, no entry dereference)
+    auto tag = this->m_file_descriptors_table.lookup (fd);
 
     // check if the mount point entry was found
-    if (return_value) {
+    if (!tag.m_valid) {
+        this->m_log->log_error ("Mount point entry does not exist (" + std::to_string (fd) + ").");
+    } else {
         // BUG: Reported defects -@rgmacedo at 4/12/2022, 1:38:18 PM
         // This will only work if all file descriptors are registered ...; in the future support the
         // option to no 'LD_PRELOAD' open calls, but register the MountPointEntry for 'LD_PRELOADED'
         // read and write calls get mount_point
         // select workflow-id from Mount Point or Metadata Server unit
         workflow_id = (option_select_workflow_by_metadata_unit)
-            ? this->select_workflow_from_metadata_unit (entry_ptr->get_metadata_server_unit ())
-            : this->select_workflow_from_mountpoint (entry_ptr->get_mount_point ());
+            ? this->select_workflow_from_metadata_unit (tag.m_metadata_server_unit)
+            : this->select_workflow_from_mountpoint (tag.m_mount_point, tag.m_path_hash);
 
         // verify if the workflow identifier was not found
         if (workflow_id == static_cast<uint32_t> (-1)) {
@@ -373,10 +530,10 @@ uint32_t MountPointTable::pick_workflow_id_by_force ()
 {
     // define MountPoint value
     auto mount_point
-        = option_mount_point_differentiation_enabled ? MountPoint::kRemote : MountPoint::kNone;
+        = this->m_mount_point_differentiation ? MountPoint::kRemote : MountPoint::kNone;
 
     // select workflow-id from MountPoint
-    auto workflow_id = this->select_workflow_from_mountpoint (mount_point);
+    auto workflow_id = this->select_workflow_from_mountpoint (mount_point, 0);
 
     // verify if the workflow identifier was not found
     if (workflow_id == static_cast<uint32_t> (-1)) {
@@ -386,6 +543,31 @@ uint32_t MountPointTable::pick_workflow_id_by_force ()
     return workflow_id;
 }
 
+// pick_workflow_ids call. (...)
+std::vector<uint32_t> MountPointTable::pick_workflow_ids () const
+{
+    std::vector<uint32_t> workflow_ids {};
+
+    // select a workflow-id of each registered MountPoint (including the MountPoint enum values)
+    for (int mount_point = 0; mount_point < this->m_next_mount_point; mount_point++) {
+        auto workflow_id
+            = this->select_workflow_from_mountpoint (static_cast<MountPoint> (mount_point), 0);
+
+        // mount points without registered workflows are not considered
+        if (workflow_id != static_cast<uint32_t> (-1)) {
+            workflow_ids.push_back (workflow_id);
+        }
+    }
+
+    return workflow_ids;
+}
+
+// is_file_descriptor_registered call. (...)
+bool MountPointTable::is_file_descriptor_registered (const int& fd) const
+{
+    return fd >= 0 && this->m_file_descriptors_table.lookup (fd).m_valid;
+}
+
 // pick_workflow_id call. (...)
 uint32_t MountPointTable::pick_workflow_id (FILE* file_ptr)
 {
@@ -398,7 +580,32 @@ uint32_t MountPointTable::pick_workflow_id (FILE* file_ptr)
         // select workflow-id from Mount Point or Metadata Server unit
         workflow_id = (option_select_workflow_by_metadata_unit)
             ? this->select_workflow_from_metadata_unit (entry_ptr->get_metadata_server_unit ())
-            : this->select_workflow_from_mountpoint (entry_ptr->get_mount_point ());
+            : this->select_workflow_from_mountpoint (entry_ptr->get_mount_point (),
+                entry_ptr->get_path_hash ());
+
+        // verify if the workflow identifier was not found
+        if (workflow_id == static_cast<uint32_t> (-1)) {
+            this->m_log->log_error ("Error while selecting workflow id.");
+        }
+    }
+
+    return workflow_id;
+}
+
+// pick_workflow_id call. (...)
+uint32_t MountPointTable::pick_workflow_id (DIR* dir_ptr)
+{
+    auto workflow_id = static_cast<uint32_t> (-1);
+    // get MountPointEntry of the given directory stream
+    auto [return_value, entry_ptr] = this->get_mount_point_entry (dir_ptr);
+
+    // check if the mount point entry was found
+    if (return_value) {
+        // select workflow-id from Mount Point or Metadata Server unit
+        workflow_id = (option_select_workflow_by_metadata_unit)
+            ? this->select_workflow_from_metadata_unit (entry_ptr->get_metadata_server_unit ())
+            : this->select_workflow_from_mountpoint (entry_ptr->get_mount_point (),
+                entry_ptr->get_path_hash ());
 
         // verify if the workflow identifier was not found
         if (workflow_id == static_cast<uint32_t> (-1)) {
@@ -427,63 +634,90 @@ uint32_t MountPointTable::pick_workflow_id (FILE* file_ptr)
 //     return return_value;
 // }
 
-// compare_first_with_remote_mount_point call. (...)
-MountPoint compare_first_with_remote_mount_point (const std::string_view& path)
+// parse_path call. (...)
+MountPoint MountPointTable::extract_mount_point_from_path (const int& dirfd,
+    const std::string_view& path) const
 {
     auto return_value = MountPoint::kNone;
 
-    // check if the path is in remote mount point
-    if (path.find (option_default_remote_mount_point) != std::string::npos) {
-        return_value = MountPoint::kRemote;
+    if (this->m_mount_point_differentiation) {
+        bool found = false;
+
+        if (PathResolver::is_absolute (path)) {
+            // longest registered prefix of the path
+            std::tie (found, return_value) = this->m_mount_point_classifier.classify (path);
+        } else {
+            // classification of the base directory (working directory or dirfd)
+            std::pair<bool, MountPoint> base { false, MountPoint::kNone };
+            if (dirfd == AT_FDCWD) {
+                base = this->m_path_resolver.get_working_directory_mount_point ();
+            } else {
+                auto tag = this->m_file_descriptors_table.lookup (dirfd);
+                base = { tag.m_valid && tag.m_mount_point != MountPoint::kNone,
+                    tag.m_mount_point };
+            }
+
+            if (base.first && !PathResolver::has_parent_reference (path)
+                && !this->m_mount_point_classifier.has_nested_mount_points (base.second)) {
+                // the path cannot reach any other mount point; inherit the base's classification
+                std::tie (found, return_value) = base;
+            } else {
+                // resolve the path from the base directory and classify it
+                auto resolved = this->resolve_base_path (dirfd, path);
+                if (!resolved.empty ()) {
+                    std::tie (found, return_value)
+                        = this->m_mount_point_classifier.classify (resolved);
+                }
+            }
+        }
+
+        // if the mount point is not found, create debug message
+        if (!found) {
+            this->m_log->log_error ("Extracted path does not belong to any defined mountpoint.");
+        }
     }
-    // FIXME: Needing refactor or cleanup -@gsd at 4/13/2022, 2:19:53 PM
-    // Do not consider right now differentiation between local and remote mountpoints.
-    // else if (path.find (option_default_local_mount_point) != std::string::npos) {
-    //     return_value = MountPoint::kLocal;
-    // }
 
     return return_value;
 }
 
-// parse_path call. (...)
-MountPoint MountPointTable::extract_mount_point_from_path (const std::string_view& path) const
+// resolve_base_path call. (...)
+std::string MountPointTable::resolve_base_path (const int& dirfd,
+    const std::string_view& path) const
 {
-    auto return_value = MountPoint::kNone;
-
-    if (option_mount_point_differentiation_enabled) {
-        return_value = compare_first_with_remote_mount_point (path);
-        // FIXME: Needing refactor or cleanup -@gsd at 4/13/2022, 2:20:39 PM
-        // Do not consider right now differentiation between local and remote mountpoints.
-        // return_value = option_check_local_mount_point_first
-        //     ? compare_first_with_local_mount_point (path)
-        //     : compare_first_with_remote_mount_point (path);
+    if (PathResolver::is_absolute (path) || dirfd == AT_FDCWD) {
+        return this->m_path_resolver.resolve (path);
+    }
 
-        // if the mount point is not found, create debug message
-        if (return_value == MountPoint::kNone) {
-            this->m_log->log_error ("Extracted path does not belong to any defined mountpoint.");
-        }
+    // path of the directory registered for dirfd
+    auto entry_ptr = this->m_file_descriptors_table.get (dirfd);
+    if (entry_ptr == nullptr || !PathResolver::is_absolute (entry_ptr->get_path ())) {
+        return {};
     }
 
-    return return_value;
+    return PathResolver::join (entry_ptr->get_path (), path);
 }
 
-// select_workflow_from_mountpoint call. (...)
-uint32_t MountPointTable::select_workflow_from_mountpoint (const MountPoint& namespace_name)
+// resolve_path call. (...)
+std::string MountPointTable::resolve_path (const int& dirfd, const std::string_view& path)
 {
-    // get iterator to the mount point entry
-    auto iterator = this->m_mount_point_workflows.find (namespace_name);
-    auto return_value = static_cast<uint32_t> (-1);
+    auto resolved = this->resolve_base_path (dirfd, path);
+    return resolved.empty () ? std::string { path } : resolved;
+}
 
-    // if the namespace exists, pick a random workflow
-    if (iterator != this->m_mount_point_workflows.end ()) {
-        // generate random item to pick
-        auto random_item = static_cast<int> (this->m_prng () % iterator->second.size ());
-        // return workflow identifier
-        return_value = iterator->second.begin ()[random_item];
+// update_working_directory call. (...)
+void MountPointTable::update_working_directory ()
+{
+    if (!this->m_path_resolver.update_working_directory ()) {
+        this->m_log->log_error ("Working directory could not be resolved.");
     }
+}
 
-    // if the namespace entry is not found, return -1
-    return return_value;
+// select_workflow_from_mountpoint call. (...)
+uint32_t MountPointTable::select_workflow_from_mountpoint (const MountPoint& namespace_name,
+    const uint64_t& path_hash) const
+{
+    // if the namespace entry is not found, returns -1
+    return this->m_workflow_selector.select (namespace_name, path_hash);
 }
 
 // select_workflow_from_metadata_unit call. (...)
@@ -506,14 +740,26 @@ uint32_t MountPointTable::select_workflow_from_metadata_unit (const std::string_
 std::string MountPointTable::to_string () const
 {
     std::stringstream stream;
-    stream << "MountPointTable: " << std::endl;
+    stream << "MountPointTable (";
+    stream << workflow_selection_to_string (this->m_workflow_selector.get_strategy ());
+    stream << "): " << std::endl;
+
+    for (int i = 0; i < this->m_next_mount_point; i++) {
+        auto mount_point = static_cast<MountPoint> (i);
+        auto workflows = this->m_workflow_selector.get_workflows (mount_point);
+        if (workflows.empty ()) {
+            continue;
+        }
 
-    for (auto const& [entry_mountpoint, entry_workflows] : this->m_mount_point_workflows) {
         stream << "  ";
-        stream << padll::options::mount_point_to_string (entry_mountpoint);
+        stream << padll::options::mount_point_to_string (mount_point);
+        auto prefix = this->m_mount_point_classifier.get_prefix (mount_point);
+        if (!prefix.empty ()) {
+            stream << " (" << prefix << ")";
+        }
         stream << ": ";
 
-        for (auto const& workflow : entry_workflows) {
+        for (auto const& workflow : workflows) {
             stream << workflow << " ";
         }
         stream << std::endl;
@@ -523,30 +769,36 @@ std::string MountPointTable::to_string () const
 
 // fd_table_to_string call. (...)
 std::string MountPointTable::fd_table_to_string ()
+{
+    return this->m_file_descriptors_table.to_string ();
+}
+
+// fp_table_to_string call. (...)
+std::string MountPointTable::fp_table_to_string ()
 {
     // shared_lock over shared_timed_mutex (read_lock)
-    std::shared_lock read_lock (this->m_fd_shared_lock);
+    std::shared_lock read_lock (this->m_fptr_shared_lock);
 
     std::stringstream stream;
-    stream << "FileDescriptorTable: " << std::endl;
-    for (auto const& [entry_fd, mnt_entry_ptr] : this->m_file_descriptors_table) {
-        stream << "  " << entry_fd << ": ";
+    stream << "FilePtrTable: " << std::endl;
+    for (auto const& [entry_file_ptr, mnt_entry_ptr] : this->m_file_ptr_table) {
+        stream << "  " << entry_file_ptr << ": ";
         stream << mnt_entry_ptr->to_string () << std::endl;
     }
 
     return stream.str ();
 }
 
-// fp_table_to_string call. (...)
-std::string MountPointTable::fp_table_to_string ()
+// dp_table_to_string call. (...)
+std::string MountPointTable::dp_table_to_string ()
 {
     // shared_lock over shared_timed_mutex (read_lock)
-    std::shared_lock read_lock (this->m_fd_shared_lock);
+    std::shared_lock read_lock (this->m_dptr_shared_lock);
 
     std::stringstream stream;
-    stream << "FilePtrTable: " << std::endl;
-    for (auto const& [entry_file_ptr, mnt_entry_ptr] : this->m_file_ptr_table) {
-        stream << "  " << entry_file_ptr << ": ";
+    stream << "DirPtrTable: " << std::endl;
+    for (auto const& [entry_dir_ptr, mnt_entry_ptr] : this->m_dir_ptr_table) {
+        stream << "  " << entry_dir_ptr << ": ";
         stream << mnt_entry_ptr->to_string () << std::endl;
     }
 
@@ -0,0 +1,114 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <mutex>
+#include <padll/stage/path_resolver.hpp>
+#include <unistd.h>
+
+namespace padll::stage {
+
+// PathResolver parameterized constructor.
+PathResolver::PathResolver (const MountPointClassifier& classifier) : m_classifier { classifier }
+{ }
+
+// PathResolver default destructor.
+PathResolver::~PathResolver () = default;
+
+// is_absolute call. (...)
+bool PathResolver::is_absolute (const std::string_view& path)
+{
+    return !path.empty () && path[0] == '/';
+}
+
+// has_parent_reference call. (...)
+bool PathResolver::has_parent_reference (const std::string_view& path)
+{
+    std::size_t position = 0;
+    std::string_view component;
+
+    while (MountPointClassifier::next_component (path, position, component)) {
+        if (component == "..") {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// join call. (...)
+std::string PathResolver::join (const std::string_view& base, const std::string_view& path)
+{
+    std::string joined {};
+    joined.reserve (base.size () + path.size () + 1);
+    joined.append (base);
+    if (joined.empty () || joined.back () != '/') {
+        joined.push_back ('/');
+    }
+    joined.append (path);
+
+    return joined;
+}
+
+// update_working_directory call. (...)
+bool PathResolver::update_working_directory ()
+{
+    // getcwd is not interposed by PADLL; errno is restored since callers succeeded already
+    auto saved_errno = errno;
+    std::array<char, PATH_MAX> buffer {};
+    const char* result = ::getcwd (buffer.data (), buffer.size ());
+    errno = saved_errno;
+
+    // lock_guard over shared_timed_mutex (write_lock)
+    std::lock_guard write_lock (this->m_working_directory_lock);
+
+    if (result == nullptr) {
+        this->m_working_directory.clear ();
+        this->m_working_directory_mount_point.store (kUnknown, std::memory_order_release);
+        return false;
+    }
+
+    this->m_working_directory.assign (result);
+    auto [found, mount_point] = this->m_classifier.classify (this->m_working_directory);
+    this->m_working_directory_mount_point.store (found ? static_cast<int> (mount_point) : kUnknown,
+        std::memory_order_release);
+
+    return true;
+}
+
+// get_working_directory_mount_point call. (...)
+std::pair<bool, MountPoint> PathResolver::get_working_directory_mount_point () const
+{
+    auto value = this->m_working_directory_mount_point.load (std::memory_order_acquire);
+    return (value == kUnknown) ? std::make_pair (false, MountPoint::kNone)
+                               : std::make_pair (true, static_cast<MountPoint> (value));
+}
+
+// get_working_directory call. (...)
+std::string PathResolver::get_working_directory () const
+{
+    // shared_lock over shared_timed_mutex (read_lock)
+    std::shared_lock read_lock (this->m_working_directory_lock);
+    return this->m_working_directory;
+}
+
+// resolve call. (...)
+std::string PathResolver::resolve (const std::string_view& path) const
+{
+    if (PathResolver::is_absolute (path)) {
+        return std::string { path };
+    }
+
+    // shared_lock over shared_timed_mutex (read_lock)
+    std::shared_lock read_lock (this->m_working_directory_lock);
+
+    return this->m_working_directory.empty ()
+        ? std::string {}
+        : PathResolver::join (this->m_working_directory, path);
+}
+
+} // namespace padll::stage
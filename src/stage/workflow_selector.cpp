@@ -0,0 +1,124 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cstdlib>
+#include <padll/configurations/padll_configuration.hpp>
+#include <padll/stage/workflow_selector.hpp>
+#include <unistd.h>
+
+namespace padll::stage {
+
+// WorkflowSelector default constructor.
+WorkflowSelector::WorkflowSelector () : m_strategy { WorkflowSelector::get_strategy_from_env () }
+{ }
+
+// WorkflowSelector parameterized constructor.
+WorkflowSelector::WorkflowSelector (const WorkflowSelection& strategy) : m_strategy { strategy }
+{ }
+
+// WorkflowSelector default destructor.
+WorkflowSelector::~WorkflowSelector () = default;
+
+// get_thread_state call. (...)
+WorkflowSelector::ThreadState& WorkflowSelector::get_thread_state ()
+{
+    static std::atomic<uint32_t> thread_counter { 0 };
+    thread_local ThreadState state {};
+
+    if (!state.m_initialized) {
+        state.m_thread_index = thread_counter.fetch_add (1, std::memory_order_relaxed);
+        auto seed = (static_cast<uint64_t> (::getpid ()) << 32) | state.m_thread_index;
+        state.m_prng = XoshiroCpp::Xoshiro128StarStar { seed };
+        state.m_round_robin = state.m_thread_index;
+        state.m_initialized = true;
+    }
+
+    return state;
+}
+
+// register_workflows call. (...)
+void WorkflowSelector::register_workflows (const MountPoint& mount_point,
+    const std::vector<uint32_t>& workflows)
+{
+    auto index = static_cast<std::size_t> (mount_point);
+    if (index >= this->m_ranges.size ()) {
+        this->m_ranges.resize (index + 1);
+    }
+
+    // rebuild the flat array, replacing the workflows of the given mount point
+    std::vector<uint32_t> flat_workflows {};
+    std::vector<WorkflowRange> ranges (this->m_ranges.size ());
+
+    for (std::size_t i = 0; i < this->m_ranges.size (); i++) {
+        ranges[i].m_offset = static_cast<uint32_t> (flat_workflows.size ());
+
+        if (i == index) {
+            flat_workflows.insert (flat_workflows.end (), workflows.begin (), workflows.end ());
+        } else {
+            auto begin = this->m_workflows.begin () + this->m_ranges[i].m_offset;
+            flat_workflows.insert (flat_workflows.end (), begin, begin + this->m_ranges[i].m_size);
+        }
+
+        ranges[i].m_size = static_cast<uint32_t> (flat_workflows.size ()) - ranges[i].m_offset;
+    }
+
+    this->m_workflows = std::move (flat_workflows);
+    this->m_ranges = std::move (ranges);
+}
+
+// get_workflows call. (...)
+std::vector<uint32_t> WorkflowSelector::get_workflows (const MountPoint& mount_point) const
+{
+    auto index = static_cast<std::size_t> (mount_point);
+    if (index >= this->m_ranges.size ()) {
+        return {};
+    }
+
+    auto begin = this->m_workflows.begin () + this->m_ranges[index].m_offset;
+    return { begin, begin + this->m_ranges[index].m_size };
+}
+
+// get_strategy call. (...)
+WorkflowSelection WorkflowSelector::get_strategy () const
+{
+    return this->m_strategy;
+}
+
+// hash_path call. (...)
+uint64_t WorkflowSelector::hash_path (const std::string_view& path)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (auto character : path) {
+        hash ^= static_cast<unsigned char> (character);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// get_strategy_from_env call. (...)
+WorkflowSelection WorkflowSelector::get_strategy_from_env ()
+{
+    auto value = padll::configurations::PadllConfiguration::get_value (
+        option_workflow_selection_env,
+        padll::configurations::padll_configuration ().get_workflow_selection ());
+    if (value == nullptr) {
+        return option_default_workflow_selection;
+    }
+
+    std::string_view strategy { value };
+    for (auto option : { WorkflowSelection::kRandom,
+             WorkflowSelection::kRoundRobin,
+             WorkflowSelection::kThreadAffinity,
+             WorkflowSelection::kPathHash }) {
+        if (strategy == workflow_selection_to_string (option)) {
+            return option;
+        }
+    }
+
+    return option_default_workflow_selection;
+}
+
+} // namespace padll::stage
@@ -0,0 +1,152 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <padll/statistics/latency_histogram.hpp>
+
+namespace padll::stats {
+
+// LatencyHistogram default constructor.
+LatencyHistogram::LatencyHistogram () = default;
+
+// LatencyHistogram default destructor.
+LatencyHistogram::~LatencyHistogram () = default;
+
+// bucket_index call. (...)
+std::size_t LatencyHistogram::bucket_index (const uint64_t& value)
+{
+    // first power-of-two ranges are linear
+    if (value < kSubBuckets) {
+        return static_cast<std::size_t> (value);
+    }
+
+    // position of the most significant bit selects the range, the following bits the sub-bucket
+    auto msb = 63 - __builtin_clzll (value);
+    if (msb > kMaxExponent) {
+        return kBuckets - 1;
+    }
+
+    auto shift = msb - kSubBucketBits;
+    auto sub_bucket = (value >> shift) & (kSubBuckets - 1);
+
+    return static_cast<std::size_t> ((msb - kSubBucketBits + 1) * kSubBuckets + sub_bucket);
+}
+
+// bucket_upper_bound call. (...)
+uint64_t LatencyHistogram::bucket_upper_bound (const std::size_t& index)
+{
+    if (index < kSubBuckets) {
+        return index;
+    }
+
+    auto range = index / kSubBuckets;
+    auto sub_bucket = index % kSubBuckets;
+    auto shift = range - 1;
+
+    return ((kSubBuckets + sub_bucket + 1) << shift) - 1;
+}
+
+// add call. (...)
+void LatencyHistogram::add (std::atomic<uint64_t>& counter, const uint64_t& value)
+{
+    counter.store (counter.load (std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// record call. (...)
+void LatencyHistogram::record (const uint64_t& value)
+{
+    LatencyHistogram::add (this->m_buckets[LatencyHistogram::bucket_index (value)], 1);
+    LatencyHistogram::add (this->m_count, 1);
+    LatencyHistogram::add (this->m_sum, value);
+
+    if (value > this->m_max.load (std::memory_order_relaxed)) {
+        this->m_max.store (value, std::memory_order_relaxed);
+    }
+}
+
+// merge call. (...)
+void LatencyHistogram::merge (const LatencyHistogram& other)
+{
+    for (std::size_t i = 0; i < kBuckets; i++) {
+        LatencyHistogram::add (this->m_buckets[i],
+            other.m_buckets[i].load (std::memory_order_relaxed));
+    }
+
+    LatencyHistogram::add (this->m_count, other.m_count.load (std::memory_order_relaxed));
+    LatencyHistogram::add (this->m_sum, other.m_sum.load (std::memory_order_relaxed));
+
+    auto other_max = other.m_max.load (std::memory_order_relaxed);
+    if (other_max > this->m_max.load (std::memory_order_relaxed)) {
+        this->m_max.store (other_max, std::memory_order_relaxed);
+    }
+}
+
+// get_count call. (...)
+uint64_t LatencyHistogram::get_count () const
+{
+    return this->m_count.load (std::memory_order_relaxed);
+}
+
+// get_mean call. (...)
+double LatencyHistogram::get_mean () const
+{
+    auto count = this->get_count ();
+    return (count == 0) ? 0
+                        : static_cast<double> (this->m_sum.load (std::memory_order_relaxed))
+            / static_cast<double> (count);
+}
+
+// get_max call. (...)
+uint64_t LatencyHistogram::get_max () const
+{
+    return this->m_max.load (std::memory_order_relaxed);
+}
+
+// get_percentile call. (...)
+uint64_t LatencyHistogram::get_percentile (const double& percentile) const
+{
+    auto count = this->get_count ();
+    if (count == 0) {
+        return 0;
+    }
+
+    // rank of the targeted value (at least the first one)
+    auto rank = static_cast<uint64_t> ((percentile / 100.0) * static_cast<double> (count) + 0.5);
+    rank = (rank == 0) ? 1 : rank;
+
+    uint64_t accumulated = 0;
+    for (std::size_t i = 0; i < kBuckets; i++) {
+        accumulated += this->m_buckets[i].load (std::memory_order_relaxed);
+        if (accumulated >= rank) {
+            // the bucket bound cannot be higher than the highest recorded value
+            return std::min (LatencyHistogram::bucket_upper_bound (i), this->get_max ());
+        }
+    }
+
+    return this->get_max ();
+}
+
+// to_string call. (...)
+std::string LatencyHistogram::to_string (const std::string& name) const
+{
+    // TODO: use fmtlib/fmt for easier and faster formatting
+    char stream[128];
+    std::snprintf (stream,
+        sizeof (stream),
+        "%28s %12" PRIu64 " %10.2f %10.2f %10.2f %10.2f %12.2f",
+        name.c_str (),
+        this->get_count (),
+        this->get_mean () / 1000.0,
+        static_cast<double> (this->get_percentile (50)) / 1000.0,
+        static_cast<double> (this->get_percentile (99)) / 1000.0,
+        static_cast<double> (this->get_percentile (99.9)) / 1000.0,
+        static_cast<double> (this->get_max ()) / 1000.0);
+
+    return { stream };
+}
+
+} // namespace padll::stats
@@ -15,6 +15,19 @@ StatisticEntry::StatisticEntry () = default;
 StatisticEntry::StatisticEntry (const std::string& name) : m_entry_name { name }
 { }
 
+// StatisticEntry parameterized constructor.
+StatisticEntry::StatisticEntry (const std::string& name,
+    const uint64_t& operations,
+    const uint64_t& bytes,
+    const uint64_t& errors,
+    const uint64_t& bypassed) :
+    m_entry_name { name },
+    m_operation_counter { operations },
+    m_byte_counter { bytes },
+    m_error_counter { errors },
+    m_bypass_counter { bypassed }
+{ }
+
 // StatisticEntry copy constructor.
 StatisticEntry::StatisticEntry (const StatisticEntry& entry) :
     m_entry_name { entry.m_entry_name },
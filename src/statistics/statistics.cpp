@@ -3,16 +3,19 @@
  *   Copyright (c) 2021-2023 INESC TEC.
  **/
 
+#include <padll/configurations/padll_configuration.hpp>
 #include <padll/statistics/statistics.hpp>
 
 namespace padll::stats {
 
 // Statistics default constructor.
-Statistics::Statistics () = default;
+Statistics::Statistics () : m_instance_id { Statistics::get_instance_id () }
+{ }
 
 // Statistics parameterized constructor.
 Statistics::Statistics (const std::string& identifier, const OperationType& operation_type) :
-    m_stats_identifier { identifier }
+    m_stats_identifier { identifier },
+    m_instance_id { Statistics::get_instance_id () }
 {
     this->initialize (operation_type);
 }
@@ -32,7 +35,7 @@ void Statistics::initialize (const OperationType& operation_type)
             this->m_stats_size = Metadata::_size ();
             // retrieves all Metadata operations' names in order
             for (Metadata elem : Metadata::_values ()) {
-                this->m_statistic_entries.emplace_back (elem._to_string ());
+                this->m_entry_names.emplace_back (elem._to_string ());
             }
 
             break;
@@ -43,7 +46,7 @@ void Statistics::initialize (const OperationType& operation_type)
             this->m_stats_size = Data::_size ();
             // retrieves all Data operations' names in order
             for (Data elem : Data::_values ()) {
-                this->m_statistic_entries.emplace_back (elem._to_string ());
+                this->m_entry_names.emplace_back (elem._to_string ());
             }
 
             break;
@@ -54,7 +57,7 @@ void Statistics::initialize (const OperationType& operation_type)
             this->m_stats_size = Directory::_size ();
             // retrieves all Directory operations' names in order
             for (Directory elem : Directory::_values ()) {
-                this->m_statistic_entries.emplace_back (elem._to_string ());
+                this->m_entry_names.emplace_back (elem._to_string ());
             }
 
             break;
@@ -65,7 +68,7 @@ void Statistics::initialize (const OperationType& operation_type)
             this->m_stats_size = ExtendedAttributes::_size ();
             // retrieves all ExtendedAttributes operations' names in order
             for (ExtendedAttributes elem : ExtendedAttributes::_values ()) {
-                this->m_statistic_entries.emplace_back (elem._to_string ());
+                this->m_entry_names.emplace_back (elem._to_string ());
             }
 
             break;
@@ -76,7 +79,7 @@ void Statistics::initialize (const OperationType& operation_type)
             this->m_stats_size = Special::_size ();
             // retrieves all ExtendedAttributes operations' names in order
             for (Special elem : Special::_values ()) {
-                this->m_statistic_entries.emplace_back (elem._to_string ());
+                this->m_entry_names.emplace_back (elem._to_string ());
             }
 
             break;
@@ -85,6 +88,147 @@ void Statistics::initialize (const OperationType& operation_type)
         default:
             break;
     }
+
+    // Statistics objects beyond the per-thread shard table share a single (atomic) shard
+    if (this->m_instance_id >= option_max_statistics_instances) {
+        this->m_shared_shard = this->create_shard (false);
+    }
+}
+
+// get_instance_id call. (...)
+std::size_t Statistics::get_instance_id ()
+{
+    static std::atomic<std::size_t> instance_counter { 0 };
+    return instance_counter.fetch_add (1, std::memory_order_relaxed);
+}
+
+// StatisticShard default destructor.
+Statistics::StatisticShard::~StatisticShard ()
+{
+    for (std::size_t i = 0; i < this->m_num_latencies; i++) {
+        delete this->m_latencies[i].load (std::memory_order_acquire);
+    }
+}
+
+// create_shard call. (...)
+std::unique_ptr<Statistics::StatisticShard> Statistics::create_shard (const bool& exclusive) const
+{
+    auto shard = std::make_unique<StatisticShard> ();
+    shard->m_counters = std::make_unique<ShardCounter[]> (this->m_stats_size);
+    shard->m_exclusive = exclusive;
+
+    // latency histograms are single-writer, so they are only kept in exclusive shards
+    const auto& configuration = padll::configurations::padll_configuration ();
+    if (configuration.is_latency_collection_enabled () && exclusive) {
+        shard->m_num_latencies = static_cast<std::size_t> (this->m_stats_size) * kLatencyPhases;
+        shard->m_latencies
+            = std::make_unique<std::atomic<LatencyHistogram*>[]> (shard->m_num_latencies);
+        for (std::size_t i = 0; i < shard->m_num_latencies; i++) {
+            shard->m_latencies[i].store (nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    return shard;
+}
+
+// get_latency_histogram call. (...)
+LatencyHistogram* Statistics::get_latency_histogram (StatisticShard* shard,
+    const int& position,
+    const LatencyPhase& phase)
+{
+    auto& slot = shard->m_latencies[position * kLatencyPhases + static_cast<int> (phase)];
+    auto* histogram = slot.load (std::memory_order_relaxed);
+
+    // first latency of this operation and phase: allocate and publish the histogram
+    if (histogram == nullptr) {
+        histogram = new LatencyHistogram ();
+        slot.store (histogram, std::memory_order_release);
+    }
+
+    return histogram;
+}
+
+// get_thread_shard call. (...)
+Statistics::StatisticShard* Statistics::get_thread_shard ()
+{
+    // per-thread shard table, indexed by the Statistics' instance identifier; it only holds raw
+    // pointers so that it is trivially destructible (shards are owned by m_shards)
+    thread_local std::array<StatisticShard*, option_max_statistics_instances> thread_shards {};
+
+    if (this->m_instance_id >= option_max_statistics_instances) {
+        return this->m_shared_shard.get ();
+    }
+
+    auto* shard = thread_shards[this->m_instance_id];
+
+    // first update of the calling thread: create and register its shard
+    if (shard == nullptr) {
+        // unique_lock over mutex
+        std::unique_lock lock (this->m_stats_mutex);
+
+        auto new_shard = this->create_shard (true);
+        shard = new_shard.get ();
+        this->m_shards.push_back (std::move (new_shard));
+        thread_shards[this->m_instance_id] = shard;
+    }
+
+    return shard;
+}
+
+// increment_counter call. (...)
+void Statistics::increment_counter (std::atomic<uint64_t>& counter,
+    const uint64_t& value,
+    const bool& exclusive)
+{
+    if (exclusive) {
+        // single writer: plain load and store, no read-modify-write needed
+        counter.store (counter.load (std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    } else {
+        counter.fetch_add (value, std::memory_order_relaxed);
+    }
+}
+
+// aggregate_entry call. (...)
+StatisticEntry Statistics::aggregate_entry (const int& position) const
+{
+    uint64_t operations = 0;
+    uint64_t bytes = 0;
+    uint64_t errors = 0;
+    uint64_t bypassed = 0;
+
+    auto aggregate_shard = [&] (const StatisticShard& shard) {
+        const auto& counter = shard.m_counters[position];
+        operations += counter.m_operation_counter.load (std::memory_order_relaxed);
+        bytes += counter.m_byte_counter.load (std::memory_order_relaxed);
+        errors += counter.m_error_counter.load (std::memory_order_relaxed);
+        bypassed += counter.m_bypass_counter.load (std::memory_order_relaxed);
+    };
+
+    for (const auto& shard : this->m_shards) {
+        aggregate_shard (*shard);
+    }
+
+    if (this->m_shared_shard != nullptr) {
+        aggregate_shard (*this->m_shared_shard);
+    }
+
+    return StatisticEntry { this->m_entry_names[position], operations, bytes, errors, bypassed };
+}
+
+// aggregate_entries call. (...)
+std::vector<StatisticEntry> Statistics::aggregate_entries ()
+{
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_stats_mutex);
+
+    std::vector<StatisticEntry> entries {};
+    entries.reserve (this->m_entry_names.size ());
+
+    for (int i = 0; i < this->m_stats_size; i++) {
+        entries.push_back (this->aggregate_entry (i));
+    }
+
+    return entries;
 }
 
 // get_stats_identifier call. (...)
@@ -101,7 +245,7 @@ StatisticEntry Statistics::get_statistic_entry (const int& operation)
     // calculate the operation's position in the statistics container
     int position = operation % this->m_stats_size;
 
-    return StatisticEntry { this->m_statistic_entries[position] };
+    return this->aggregate_entry (position);
 }
 
 // update_statistics_entry call. (...)
@@ -112,9 +256,15 @@ void Statistics::update_statistic_entry (const int& operation_type,
     // calculate the operation's position (index) in the statistics container
     int position = operation_type % this->m_stats_size;
 
+    // get the counters of the calling thread
+    auto* shard = this->get_thread_shard ();
+    auto& counter = shard->m_counters[position];
+
     // update operation and byte counters
-    this->m_statistic_entries[position].increment_operation_counter (operation_value);
-    this->m_statistic_entries[position].increment_byte_counter (byte_value);
+    Statistics::increment_counter (counter.m_operation_counter,
+        operation_value,
+        shard->m_exclusive);
+    Statistics::increment_counter (counter.m_byte_counter, byte_value, shard->m_exclusive);
 }
 
 // update_statistics_entry call. (...)
@@ -126,10 +276,16 @@ void Statistics::update_statistic_entry (const int& operation_type,
     // calculate the operation's position (index) in the statistics container
     int position = operation_type % this->m_stats_size;
 
+    // get the counters of the calling thread
+    auto* shard = this->get_thread_shard ();
+    auto& counter = shard->m_counters[position];
+
     // update operation, byte, and error counters
-    this->m_statistic_entries[position].increment_operation_counter (operation_value);
-    this->m_statistic_entries[position].increment_byte_counter (byte_value);
-    this->m_statistic_entries[position].increment_error_counter (error_value);
+    Statistics::increment_counter (counter.m_operation_counter,
+        operation_value,
+        shard->m_exclusive);
+    Statistics::increment_counter (counter.m_byte_counter, byte_value, shard->m_exclusive);
+    Statistics::increment_counter (counter.m_error_counter, error_value, shard->m_exclusive);
 }
 
 // update_bypass_statistic_entry call. (...)
@@ -139,8 +295,87 @@ void Statistics::update_bypassed_statistic_entry (const int& operation_type,
     // calculate the operation's position (index) in the statistics container
     int position = operation_type % this->m_stats_size;
 
+    // get the counters of the calling thread
+    auto* shard = this->get_thread_shard ();
+
     // update bypass counters
-    this->m_statistic_entries[position].increment_bypass_counter (bypass_value);
+    Statistics::increment_counter (shard->m_counters[position].m_bypass_counter,
+        bypass_value,
+        shard->m_exclusive);
+}
+
+// update_latency_entry call. (...)
+void Statistics::update_latency_entry (const int& operation_type,
+    const uint64_t& interception_ns,
+    const uint64_t& enforcement_ns,
+    const uint64_t& syscall_ns)
+{
+    // calculate the operation's position (index) in the statistics container
+    int position = operation_type % this->m_stats_size;
+
+    // get the histograms of the calling thread
+    auto* shard = this->get_thread_shard ();
+    if (shard->m_latencies == nullptr) {
+        return;
+    }
+
+    Statistics::get_latency_histogram (shard, position, LatencyPhase::interception)
+        ->record (interception_ns);
+    Statistics::get_latency_histogram (shard, position, LatencyPhase::enforcement)
+        ->record (enforcement_ns);
+    Statistics::get_latency_histogram (shard, position, LatencyPhase::syscall)
+        ->record (syscall_ns);
+}
+
+// latency_to_string call. (...)
+std::string Statistics::latency_to_string (const bool& print_header)
+{
+    std::stringstream stream;
+
+    if (print_header) {
+        // TODO: use fmtlib/fmt for easier and faster formatting
+        char header[128];
+        std::snprintf (header,
+            sizeof (header),
+            "%28s %12s %10s %10s %10s %10s %12s",
+            "syscall (phase)",
+            "calls",
+            "mean(us)",
+            "p50(us)",
+            "p99(us)",
+            "p99.9(us)",
+            "max(us)");
+        stream << header << "\n";
+    }
+
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_stats_mutex);
+
+    for (int position = 0; position < this->m_stats_size; position++) {
+        for (int phase = 0; phase < kLatencyPhases; phase++) {
+            // merge the histograms of all thread shards
+            auto merged = std::make_unique<LatencyHistogram> ();
+            for (const auto& shard : this->m_shards) {
+                if (shard->m_latencies == nullptr) {
+                    continue;
+                }
+
+                auto* histogram = shard->m_latencies[position * kLatencyPhases + phase].load (
+                    std::memory_order_acquire);
+                if (histogram != nullptr) {
+                    merged->merge (*histogram);
+                }
+            }
+
+            if (merged->get_count () > 0) {
+                stream << merged->to_string (this->m_entry_names[position] + " ("
+                              + latency_phase_to_string (static_cast<LatencyPhase> (phase)) + ")")
+                       << "\n";
+            }
+        }
+    }
+
+    return stream.str ();
 }
 
 // get_stats_size call. (...)
@@ -155,7 +390,8 @@ std::string Statistics::to_string (const bool& print_header)
     std::stringstream stream;
     std::vector<StatisticEntry> entries {};
 
-    for (auto& elem : this->m_statistic_entries) {
+    // aggregate per-thread counters
+    for (auto& elem : this->aggregate_entries ()) {
         if ((elem.get_operation_counter () + elem.get_error_counter () + elem.get_bypass_counter ())
             > 0) {
             entries.push_back (elem);
@@ -194,34 +430,34 @@ std::string Statistics::to_string (const bool& print_header)
 }
 
 // aggregate_counters call. (...)
-long Statistics::aggregate_counters (int counter_type)
+long Statistics::aggregate_counters (std::vector<StatisticEntry>& entries, int counter_type)
 {
     long sum_value = 0;
     switch (counter_type) {
         // aggregate operation counter
         case 0:
-            for (auto& element : this->m_statistic_entries) {
+            for (auto& element : entries) {
                 sum_value += element.get_operation_counter ();
             }
             break;
 
         // aggregate byte counter
         case 1:
-            for (auto& element : this->m_statistic_entries) {
+            for (auto& element : entries) {
                 sum_value += element.get_byte_counter ();
             }
             break;
 
         // aggregate error counter
         case 2:
-            for (auto& element : this->m_statistic_entries) {
+            for (auto& element : entries) {
                 sum_value += element.get_error_counter ();
             }
             break;
 
         // aggregate bypass counter
         case 3:
-            for (auto& element : this->m_statistic_entries) {
+            for (auto& element : entries) {
                 sum_value += element.get_bypass_counter ();
             }
             break;
@@ -240,6 +476,9 @@ void Statistics::tabulate ()
     int columns = 5;
     Table table_stats;
 
+    // aggregate per-thread counters
+    auto entries = this->aggregate_entries ();
+
     // add table header
     table_stats.add_row ({ this->m_stats_identifier, "#iops", "#bytes", "#errors", "#bypass" });
     rows++;
@@ -253,7 +492,7 @@ void Statistics::tabulate ()
         .width (20);
 
     // add statistic entries
-    for (auto& elem : this->m_statistic_entries) {
+    for (auto& elem : entries) {
         table_stats.add_row ({
             elem.get_entry_name (),
             std::to_string (elem.get_operation_counter ()),
@@ -266,10 +505,10 @@ void Statistics::tabulate ()
 
     // cumulative statistics entry
     table_stats.add_row ({ "total",
-        std::to_string (this->aggregate_counters (0)),
-        std::to_string (this->aggregate_counters (1)),
-        std::to_string (this->aggregate_counters (2)),
-        std::to_string (this->aggregate_counters (3)) });
+        std::to_string (Statistics::aggregate_counters (entries, 0)),
+        std::to_string (Statistics::aggregate_counters (entries, 1)),
+        std::to_string (Statistics::aggregate_counters (entries, 2)),
+        std::to_string (Statistics::aggregate_counters (entries, 3)) });
     rows++;
 
     // format header cells
@@ -0,0 +1,275 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cstring>
+#include <padll/configurations/padll_configuration.hpp>
+#include <padll/library_headers/libc_dispatch.hpp>
+#include <padll/statistics/statistics_exporter.hpp>
+
+namespace padll::stats {
+
+// StatisticsExporter parameterized constructor.
+StatisticsExporter::StatisticsExporter (std::shared_ptr<Log> log_ptr,
+    std::vector<Statistics*> statistics,
+    const std::chrono::milliseconds& interval,
+    const std::string& region_path) :
+    m_log { log_ptr },
+    m_statistics { std::move (statistics) },
+    m_interval { interval },
+    m_region_path { region_path }
+{
+    this->m_log->log_info ("StatisticsExporter parameterized constructor.");
+}
+
+// StatisticsExporter default destructor.
+StatisticsExporter::~StatisticsExporter ()
+{
+    this->m_log->log_info ("StatisticsExporter default destructor.");
+    this->stop ();
+}
+
+// get_interval_from_env call. (...)
+std::chrono::milliseconds StatisticsExporter::get_interval_from_env ()
+{
+    auto value = padll::configurations::PadllConfiguration::get_value (
+        option_statistics_export_interval_env,
+        padll::configurations::padll_configuration ().get_statistics_export_interval ());
+    long interval = 0;
+
+    if (value != nullptr) {
+        try {
+            interval = std::stol (value);
+        } catch (...) {
+            interval = 0;
+        }
+    }
+
+    return std::chrono::milliseconds { (interval > 0) ? interval : 0 };
+}
+
+// create_region call. (...)
+bool StatisticsExporter::create_region ()
+{
+    // bypass PADLL's interposed calls through the libc dispatch table
+    auto& dispatch = padll::headers::libc_dispatch ();
+    auto region_size = sizeof (ExportRegion);
+    int fd = dispatch.get<padll::headers::libc_open_variadic_t> (PosixCall::open_variadic) (
+        this->m_region_path.c_str (),
+        O_CREAT | O_RDWR | O_TRUNC,
+        0644);
+
+    if (fd == -1) {
+        this->m_log->log_error ("Error while creating statistics region (" + this->m_region_path
+            + "): " + std::strerror (errno));
+        return false;
+    }
+
+    // size and map the region
+    void* address = MAP_FAILED;
+    if (dispatch.get<padll::headers::libc_ftruncate_t> (PosixCall::ftruncate) (fd,
+            static_cast<off_t> (region_size))
+        == 0) {
+        address = dispatch.get<padll::headers::libc_mmap_t> (PosixCall::mmap) (nullptr,
+            region_size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED,
+            fd,
+            0);
+    }
+    dispatch.get<padll::headers::libc_close_t> (PosixCall::close) (fd);
+
+    if (address == MAP_FAILED) {
+        this->m_log->log_error ("Error while mapping statistics region (" + this->m_region_path
+            + "): " + std::strerror (errno));
+        dispatch.get<padll::headers::libc_unlink_t> (PosixCall::unlink) (
+            this->m_region_path.c_str ());
+        return false;
+    }
+
+    // ftruncate zero-fills the region, so all atomics start at 0
+    this->m_region = static_cast<ExportRegion*> (address);
+    this->m_region->m_version = kExportVersion;
+    this->m_region->m_region_size = region_size;
+    this->m_region->m_pid = static_cast<uint32_t> (this->m_owner_pid);
+    this->m_region->m_interval_ms = static_cast<uint64_t> (this->m_interval.count ());
+
+    // write names table, in the same order used by export_snapshot
+    std::size_t index = 0;
+    for (auto* stats : this->m_statistics) {
+        for (auto& entry : stats->aggregate_entries ()) {
+            if (index >= kExportMaxEntries) {
+                break;
+            }
+            auto& name = this->m_region->m_names[index++];
+            std::strncpy (name.m_stats_identifier,
+                stats->get_stats_identifier ().c_str (),
+                kExportIdentifierSize - 1);
+            std::strncpy (name.m_entry_name,
+                entry.get_entry_name ().c_str (),
+                kExportNameSize - 1);
+        }
+    }
+    this->m_region->m_num_entries = static_cast<uint32_t> (index);
+
+    if (index == kExportMaxEntries) {
+        this->m_log->log_error ("Statistics region is full: some entries will not be exported.");
+    }
+
+    // magic is written last, so readers never see a partially initialized header
+    std::atomic_thread_fence (std::memory_order_release);
+    this->m_region->m_magic = kExportMagic;
+
+    return true;
+}
+
+// destroy_region call. (...)
+void StatisticsExporter::destroy_region ()
+{
+    if (this->m_region != nullptr) {
+        auto& dispatch = padll::headers::libc_dispatch ();
+        dispatch.get<padll::headers::libc_munmap_t> (PosixCall::munmap) (this->m_region,
+            sizeof (ExportRegion));
+        dispatch.get<padll::headers::libc_unlink_t> (PosixCall::unlink) (
+            this->m_region_path.c_str ());
+        this->m_region = nullptr;
+    }
+}
+
+// export_snapshot call. (...)
+void StatisticsExporter::export_snapshot ()
+{
+    auto now = std::chrono::steady_clock::now ().time_since_epoch ();
+    auto timestamp = static_cast<uint64_t> (
+        std::chrono::duration_cast<std::chrono::nanoseconds> (now).count ());
+
+    // aggregate all Statistics objects, in the same order of the names table
+    std::vector<StatisticEntry> entries {};
+    entries.reserve (this->m_region->m_num_entries);
+    for (auto* stats : this->m_statistics) {
+        for (auto& entry : stats->aggregate_entries ()) {
+            if (entries.size () >= this->m_region->m_num_entries) {
+                break;
+            }
+            entries.push_back (entry);
+        }
+    }
+
+    auto published = this->m_region->m_published.load (std::memory_order_relaxed);
+    auto& slot = this->m_region->m_ring[published % kExportRingSize];
+
+    // seqlock: mark slot as being written
+    auto sequence = slot.m_sequence.load (std::memory_order_relaxed);
+    slot.m_sequence.store (sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+
+    slot.m_snapshot_id.store (published, std::memory_order_relaxed);
+    slot.m_timestamp_ns.store (timestamp, std::memory_order_relaxed);
+    slot.m_interval_ns.store ((this->m_previous_timestamp_ns == 0)
+            ? 0
+            : (timestamp - this->m_previous_timestamp_ns),
+        std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < entries.size (); i++) {
+        auto& current = entries[i];
+        auto& totals = slot.m_totals[i];
+        auto& deltas = slot.m_deltas[i];
+        bool has_previous = i < this->m_previous_entries.size ();
+        auto& previous = has_previous ? this->m_previous_entries[i] : current;
+
+        totals.m_operations.store (current.get_operation_counter (), std::memory_order_relaxed);
+        totals.m_bytes.store (current.get_byte_counter (), std::memory_order_relaxed);
+        totals.m_errors.store (current.get_error_counter (), std::memory_order_relaxed);
+        totals.m_bypassed.store (current.get_bypass_counter (), std::memory_order_relaxed);
+
+        deltas.m_operations.store (has_previous
+                ? current.get_operation_counter () - previous.get_operation_counter ()
+                : 0,
+            std::memory_order_relaxed);
+        deltas.m_bytes.store (has_previous
+                ? current.get_byte_counter () - previous.get_byte_counter ()
+                : 0,
+            std::memory_order_relaxed);
+        deltas.m_errors.store (has_previous
+                ? current.get_error_counter () - previous.get_error_counter ()
+                : 0,
+            std::memory_order_relaxed);
+        deltas.m_bypassed.store (has_previous
+                ? current.get_bypass_counter () - previous.get_bypass_counter ()
+                : 0,
+            std::memory_order_relaxed);
+    }
+
+    // seqlock: mark slot as stable and publish it
+    slot.m_sequence.store (sequence + 2, std::memory_order_release);
+    this->m_region->m_published.store (published + 1, std::memory_order_release);
+
+    this->m_previous_timestamp_ns = timestamp;
+    this->m_previous_entries = std::move (entries);
+}
+
+// run call. (...)
+void StatisticsExporter::run ()
+{
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_lock);
+
+    while (this->m_running) {
+        this->export_snapshot ();
+        this->m_cv.wait_for (lock, this->m_interval, [this] () { return !this->m_running; });
+    }
+}
+
+// start call. (...)
+bool StatisticsExporter::start ()
+{
+    // unique_lock over mutex
+    std::unique_lock lock (this->m_lock);
+
+    if (this->m_running || this->m_interval.count () <= 0) {
+        return false;
+    }
+
+    this->m_owner_pid = ::getpid ();
+    if (!this->create_region ()) {
+        return false;
+    }
+
+    this->m_running = true;
+    this->m_exporter_thread = std::thread (&StatisticsExporter::run, this);
+
+    this->m_log->log_info ("Exporting statistics to " + this->m_region_path + " every "
+        + std::to_string (this->m_interval.count ()) + " ms.");
+
+    return true;
+}
+
+// stop call. (...)
+void StatisticsExporter::stop ()
+{
+    {
+        // unique_lock over mutex
+        std::unique_lock lock (this->m_lock);
+        if (!this->m_running) {
+            return;
+        }
+        this->m_running = false;
+    }
+
+    // a forked child does not own the exporter thread nor the region
+    if (::getpid () != this->m_owner_pid) {
+        this->m_exporter_thread.detach ();
+        return;
+    }
+
+    this->m_cv.notify_all ();
+    if (this->m_exporter_thread.joinable ()) {
+        this->m_exporter_thread.join ();
+    }
+
+    // release region (the final counters are reported by generate_statistics_report)
+    this->destroy_region ();
+}
+
+} // namespace padll::stats
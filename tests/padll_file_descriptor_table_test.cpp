@@ -0,0 +1,337 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <padll/stage/file_descriptor_table.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace padll::stage;
+
+namespace padll::tests {
+
+/**
+ * FileDescriptorTableTest class.
+ * Validates the FileDescriptorTable under concurrent writers (insert, move, duplicate, and remove)
+ * and lock-free readers (lookup and get).
+ */
+class FileDescriptorTableTest {
+
+private:
+    FILE* m_fd { stdout };
+
+public:
+    /**
+     * FileDescriptorTableTest default constructor.
+     */
+    FileDescriptorTableTest () = default;
+
+    /**
+     * FileDescriptorTableTest parameterized constructor.
+     */
+    explicit FileDescriptorTableTest (FILE* fd) : m_fd { fd } {};
+
+    /**
+     * test_single_thread: validate insert, lookup, move, and remove over a single thread.
+     * @param table_ptr Pointer to the FileDescriptorTable.
+     * @return Returns the number of failed checks.
+     */
+    int test_single_thread (FileDescriptorTable* table_ptr)
+    {
+        int errors = 0;
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+        std::fprintf (this->m_fd, "FileDescriptorTableTest (test_single_thread)\n");
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+
+        // out of range file descriptors are refused
+        auto entry = std::make_unique<MountPointEntry> ("/tmp/a", MountPoint::kNone, 0);
+        errors += table_ptr->insert (-1, std::move (entry)) ? 1 : 0;
+        errors += table_ptr->lookup (static_cast<int> (table_ptr->capacity ())).m_valid ? 1 : 0;
+
+        // insert in an empty slot, then replace it
+        entry = std::make_unique<MountPointEntry> ("/tmp/a", MountPoint::kNone, 7);
+        errors += table_ptr->insert (3, std::move (entry)) ? 0 : 1;
+        entry = std::make_unique<MountPointEntry> ("/tmp/b", MountPoint::kRemote, 8);
+        errors += table_ptr->insert (3, std::move (entry)) ? 1 : 0;
+
+        auto tag = table_ptr->lookup (3);
+        errors += (tag.m_valid && tag.m_mount_point == MountPoint::kRemote
+                      && tag.m_metadata_server_unit == 8)
+            ? 0
+            : 1;
+
+        // move the entry to a file descriptor in another segment
+        auto new_fd = static_cast<int> (option_fd_table_segment_size) + 3;
+        if (table_ptr->is_within_capacity (new_fd)) {
+            errors += table_ptr->move (3, new_fd) ? 0 : 1;
+            errors += table_ptr->lookup (3).m_valid ? 1 : 0;
+            errors += table_ptr->lookup (new_fd).m_valid ? 0 : 1;
+            errors += table_ptr->remove (new_fd) ? 0 : 1;
+        } else {
+            errors += table_ptr->remove (3) ? 0 : 1;
+        }
+
+        // removing an unregistered file descriptor fails
+        errors += table_ptr->remove (3) ? 1 : 0;
+
+        std::fprintf (this->m_fd, "capacity: %zu; errors: %d\n", table_ptr->capacity (), errors);
+        return errors;
+    }
+
+    /**
+     * test_duplicate: validate that duplicated file descriptors share the entry of the original
+     * file descriptor (dup, dup2), which remains registered while any of them is.
+     * @param table_ptr Pointer to the FileDescriptorTable.
+     * @return Returns the number of failed checks.
+     */
+    int test_duplicate (FileDescriptorTable* table_ptr)
+    {
+        int errors = 0;
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+        std::fprintf (this->m_fd, "FileDescriptorTableTest (test_duplicate)\n");
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+
+        auto entry = std::make_unique<MountPointEntry> ("/tmp/a", MountPoint::kRemote, 1);
+        errors += table_ptr->insert (10, std::move (entry)) ? 0 : 1;
+        entry = std::make_unique<MountPointEntry> ("/tmp/b", MountPoint::kNone, 2);
+        errors += table_ptr->insert (12, std::move (entry)) ? 0 : 1;
+
+        // dup: both file descriptors share the same entry
+        errors += table_ptr->duplicate (10, 11) ? 0 : 1;
+        errors += (table_ptr->get (10) == table_ptr->get (11)) ? 0 : 1;
+        errors += (table_ptr->references (11) == 2) ? 0 : 1;
+
+        // dup2 onto a registered file descriptor replaces its entry
+        errors += table_ptr->duplicate (10, 12) ? 0 : 1;
+        auto tag = table_ptr->lookup (12);
+        errors += (tag.m_valid && tag.m_mount_point == MountPoint::kRemote) ? 0 : 1;
+        errors += (table_ptr->references (10) == 3) ? 0 : 1;
+
+        // the original file descriptor is kept registered, and its removal keeps the duplicates
+        errors += table_ptr->remove (10) ? 0 : 1;
+        errors += table_ptr->lookup (11).m_valid ? 0 : 1;
+        errors += (table_ptr->get (11)->get_path () == "/tmp/a") ? 0 : 1;
+        errors += (table_ptr->references (12) == 2) ? 0 : 1;
+
+        // duplicating an unregistered file descriptor unregisters the target
+        errors += table_ptr->duplicate (10, 12) ? 1 : 0;
+        errors += table_ptr->lookup (12).m_valid ? 1 : 0;
+        errors += (table_ptr->references (11) == 1) ? 0 : 1;
+
+        // duplicating onto itself is a no-op
+        errors += table_ptr->duplicate (11, 11) ? 0 : 1;
+        errors += table_ptr->remove (11) ? 0 : 1;
+        errors += table_ptr->lookup (11).m_valid ? 1 : 0;
+
+        std::fprintf (this->m_fd, "errors: %d\n", errors);
+        return errors;
+    }
+
+    /**
+     * test_concurrent_access: a writer thread continuously registers and unregisters file
+     * descriptors, while reader threads perform lookups. Each published tag must be consistent
+     * with the entry inserted for that file descriptor.
+     * @param table_ptr Pointer to the FileDescriptorTable.
+     * @param num_readers Number of reader threads.
+     * @param num_fds Number of file descriptors to be used.
+     * @param iterations Number of insert/remove iterations of the writer.
+     * @return Returns the number of inconsistent lookups.
+     */
+    int test_concurrent_access (FileDescriptorTable* table_ptr,
+        const int& num_readers,
+        const int& num_fds,
+        const int& iterations)
+    {
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+        std::fprintf (this->m_fd, "FileDescriptorTableTest (test_concurrent_access)\n");
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+
+        std::atomic<bool> running { true };
+        std::atomic<int> errors { 0 };
+        std::atomic<long> lookups { 0 };
+        std::vector<std::thread> readers {};
+
+        for (int i = 0; i < num_readers; i++) {
+            readers.emplace_back ([&] () {
+                long local_lookups = 0;
+                while (running.load ()) {
+                    for (int fd = 3; fd < num_fds + 3; fd++) {
+                        auto tag = table_ptr->lookup (fd);
+                        // metadata server unit always matches the file descriptor
+                        if (tag.m_valid
+                            && tag.m_metadata_server_unit != static_cast<uint32_t> (fd)) {
+                            errors.fetch_add (1);
+                        }
+                        local_lookups++;
+                    }
+                }
+                lookups.fetch_add (local_lookups);
+            });
+        }
+
+        auto start = std::chrono::high_resolution_clock::now ();
+        for (int i = 0; i < iterations; i++) {
+            for (int fd = 3; fd < num_fds + 3; fd++) {
+                (void)table_ptr->insert (fd,
+                    std::make_unique<MountPointEntry> ("/tmp/file-" + std::to_string (fd),
+                        MountPoint::kNone,
+                        static_cast<uint32_t> (fd)));
+            }
+            for (int fd = 3; fd < num_fds + 3; fd++) {
+                (void)table_ptr->remove (fd);
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now ();
+
+        running.store (false);
+        for (auto& reader : readers) {
+            reader.join ();
+        }
+
+        std::fprintf (this->m_fd,
+            "writer: %d ops in %ld ms; readers: %ld lookups; errors: %d\n",
+            2 * iterations * num_fds,
+            static_cast<long> (
+                std::chrono::duration_cast<std::chrono::milliseconds> (end - start).count ()),
+            lookups.load (),
+            errors.load ());
+
+        return errors.load ();
+    }
+    /**
+     * test_concurrent_close: writer threads continuously close (remove) and dup2 (duplicate) file
+     * descriptors, while reader threads get and dereference their entries, and look up their tags.
+     * Entries returned by get must remain valid while in use, and each entry (and tag) must be
+     * consistent with the file descriptor it was inserted for, even if a duplicate replaced it.
+     * @param table_ptr Pointer to the FileDescriptorTable.
+     * @param num_readers Number of reader threads.
+     * @param num_fds Number of file descriptors to be used.
+     * @param iterations Number of close/dup2 iterations of each writer.
+     * @return Returns the number of inconsistent reads.
+     */
+    int test_concurrent_close (FileDescriptorTable* table_ptr,
+        const int& num_readers,
+        const int& num_fds,
+        const int& iterations)
+    {
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+        std::fprintf (this->m_fd, "FileDescriptorTableTest (test_concurrent_close)\n");
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+
+        constexpr int kFirstFd = 3;
+        std::atomic<bool> running { true };
+        std::atomic<int> errors { 0 };
+        std::atomic<long> reads { 0 };
+        std::vector<std::thread> threads {};
+
+        // path hash of the entry inserted for each file descriptor
+        std::vector<uint64_t> path_hashes {};
+        for (int fd = kFirstFd; fd < num_fds + kFirstFd; fd++) {
+            path_hashes.push_back (
+                MountPointEntry { "/tmp/file-" + std::to_string (fd), MountPoint::kNone, 0 }
+                    .get_path_hash ());
+        }
+
+        for (int i = 0; i < num_readers; i++) {
+            threads.emplace_back ([&] () {
+                long local_reads = 0;
+                while (running.load ()) {
+                    for (int fd = kFirstFd; fd < num_fds + kFirstFd; fd++) {
+                        auto entry = table_ptr->get (fd);
+                        if (entry != nullptr) {
+                            auto unit = static_cast<int> (entry->get_metadata_server_unit ());
+                            if (entry->get_path () != "/tmp/file-" + std::to_string (unit)) {
+                                errors.fetch_add (1);
+                            }
+                        }
+
+                        auto tag = table_ptr->lookup (fd);
+                        if (tag.m_valid) {
+                            auto unit = static_cast<int> (tag.m_metadata_server_unit);
+                            if (unit < kFirstFd || unit >= num_fds + kFirstFd
+                                || tag.m_path_hash
+                                    != path_hashes[static_cast<std::size_t> (unit - kFirstFd)]) {
+                                errors.fetch_add (1);
+                            }
+                        }
+                        local_reads++;
+                    }
+                }
+                reads.fetch_add (local_reads);
+            });
+        }
+
+        // each writer closes and re-creates its file descriptors, and dup2s over the others'
+        std::vector<std::thread> writers {};
+        for (int w = 0; w < 2; w++) {
+            writers.emplace_back ([&, w] () {
+                for (int i = 0; i < iterations; i++) {
+                    for (int fd = kFirstFd + w; fd < num_fds + kFirstFd; fd += 2) {
+                        (void)table_ptr->insert (fd,
+                            std::make_unique<MountPointEntry> ("/tmp/file-" + std::to_string (fd),
+                                MountPoint::kNone,
+                                static_cast<uint32_t> (fd)));
+                    }
+                    for (int fd = kFirstFd + w; fd + 1 < num_fds + kFirstFd; fd += 2) {
+                        (void)table_ptr->duplicate (fd, fd + 1);
+                    }
+                    for (int fd = kFirstFd + w; fd < num_fds + kFirstFd; fd += 2) {
+                        (void)table_ptr->remove (fd);
+                    }
+                }
+            });
+        }
+
+        for (auto& writer : writers) {
+            writer.join ();
+        }
+        running.store (false);
+        for (auto& thread : threads) {
+            thread.join ();
+        }
+
+        // clear the remaining duplicates
+        for (int fd = kFirstFd; fd < num_fds + kFirstFd; fd++) {
+            (void)table_ptr->remove (fd);
+        }
+
+        std::fprintf (this->m_fd,
+            "writers: 2 x %d iterations; readers: %ld reads; errors: %d\n",
+            iterations,
+            reads.load (),
+            errors.load ());
+
+        return errors.load ();
+    }
+};
+} // namespace padll::tests
+
+using namespace padll::tests;
+
+int main (int argc, char** argv)
+{
+    int num_readers = 4;
+    int num_fds = 1000;
+    int iterations = 100;
+
+    // parse number of reader threads
+    if (argc > 1) {
+        num_readers = std::stoi (argv[1]);
+    }
+
+    FileDescriptorTable table {};
+    FileDescriptorTableTest test {};
+
+    int errors = test.test_single_thread (&table);
+    errors += test.test_duplicate (&table);
+    errors += test.test_concurrent_access (&table, num_readers, num_fds, iterations);
+    errors += test.test_concurrent_close (&table, num_readers, num_fds, iterations);
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,260 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <chrono>
+#include <cstdio>
+#include <fcntl.h>
+#include <padll/stage/mount_point_classifier.hpp>
+#include <padll/stage/mount_point_table.hpp>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace padll::stage;
+
+namespace padll::tests {
+
+/**
+ * MountPointClassifierTest class.
+ * Validates the longest-prefix classification of the MountPointClassifier, and measures the cost
+ * of a classification.
+ */
+class MountPointClassifierTest {
+
+private:
+    FILE* m_fd { stdout };
+
+    /**
+     * check: validate the classification of a given path.
+     * @return Returns 1 if the classification does not match the expected one; 0 otherwise.
+     */
+    int check (const MountPointClassifier& classifier,
+        const std::string& path,
+        const bool& expected_found,
+        const int& expected_mount_point)
+    {
+        auto [found, mount_point] = classifier.classify (path);
+        bool valid = (found == expected_found)
+            && (!found || static_cast<int> (mount_point) == expected_mount_point);
+
+        if (!valid) {
+            std::fprintf (this->m_fd,
+                "Error: %s classified as (%d, %d); expected (%d, %d)\n",
+                path.c_str (),
+                found,
+                static_cast<int> (mount_point),
+                expected_found,
+                expected_mount_point);
+        }
+
+        return valid ? 0 : 1;
+    }
+
+public:
+    /**
+     * MountPointClassifierTest default constructor.
+     */
+    MountPointClassifierTest () = default;
+
+    /**
+     * MountPointClassifierTest parameterized constructor.
+     */
+    explicit MountPointClassifierTest (FILE* fd) : m_fd { fd } {};
+
+    /**
+     * test_classify: validate prefix matching over nested and sibling mount points.
+     * @return Returns the number of failed checks.
+     */
+    int test_classify ()
+    {
+        int errors = 0;
+        MountPointClassifier classifier {};
+
+        errors += classifier.register_mount_point ("/tmp", static_cast<MountPoint> (2)) ? 0 : 1;
+        errors += classifier.register_mount_point ("/mnt/lustre/", static_cast<MountPoint> (3))
+            ? 0
+            : 1;
+        errors
+            += classifier.register_mount_point ("/mnt/lustre/scratch", static_cast<MountPoint> (4))
+            ? 0
+            : 1;
+        errors += classifier.register_mount_point ("/mnt/./gpfs", static_cast<MountPoint> (5)) ? 0
+                                                                                             : 1;
+        errors += classifier.register_mount_point ("relative", static_cast<MountPoint> (6)) ? 1 : 0;
+
+        // component-wise prefix matching
+        errors += this->check (classifier, "/tmp", true, 2);
+        errors += this->check (classifier, "/tmp/file", true, 2);
+        errors += this->check (classifier, "//tmp//dir/file", true, 2);
+        errors += this->check (classifier, "/tmpfiles/file", false, 0);
+        errors += this->check (classifier, "/home/user/tmp/file", false, 0);
+        errors += this->check (classifier, "tmp/file", false, 0);
+
+        // longest prefix wins
+        errors += this->check (classifier, "/mnt/lustre/project/file", true, 3);
+        errors += this->check (classifier, "/mnt/lustre/scratch/file", true, 4);
+        errors += this->check (classifier, "/mnt/gpfs/file", true, 5);
+        errors += this->check (classifier, "/mnt/beegfs/file", false, 0);
+
+        // "." and ".." components
+        errors += this->check (classifier, "/mnt/lustre/scratch/../file", true, 3);
+        errors += this->check (classifier, "/mnt/lustre/./scratch/file", true, 4);
+        errors += this->check (classifier, "/mnt/lustre/a/b/../../scratch/file", true, 4);
+        errors += this->check (classifier, "/mnt/lustre/../gpfs/file", true, 5);
+        errors += this->check (classifier, "/tmp/../home/file", false, 0);
+
+        // re-registering a prefix replaces its mount point
+        errors += classifier.register_mount_point ("/tmp/", static_cast<MountPoint> (7)) ? 0 : 1;
+        errors += this->check (classifier, "/tmp/file", true, 7);
+        errors += (classifier.get_mount_points ().size () == 4) ? 0 : 1;
+
+        // nested mount points
+        errors += classifier.has_nested_mount_points (static_cast<MountPoint> (3)) ? 0 : 1;
+        errors += classifier.has_nested_mount_points (static_cast<MountPoint> (4)) ? 1 : 0;
+        errors += classifier.has_nested_mount_points (static_cast<MountPoint> (7)) ? 1 : 0;
+        errors += classifier.has_nested_mount_points (static_cast<MountPoint> (9)) ? 0 : 1;
+
+        std::fprintf (this->m_fd, "test_classify: errors: %d\n", errors);
+
+        return errors;
+    }
+
+    /**
+     * test_relative_paths: validate the classification of relative paths, from the working
+     * directory and from directory file descriptors, with a mount point (/tmp/padll-nested)
+     * nested below the remote mount point (/tmp).
+     * @return Returns the number of failed checks.
+     */
+    int test_relative_paths ()
+    {
+        int errors = 0;
+        MountPointTable table {};
+        std::string nested_path { "/tmp/padll-nested" };
+
+        auto [registered, nested] = table.register_mount_point (nested_path, { 1000 });
+        errors += registered ? 0 : 1;
+        ::mkdir (nested_path.c_str (), 0777);
+
+        auto check_relative = [this, &table] (const std::string& path,
+                                  const int& dirfd,
+                                  const MountPoint& expected) {
+            auto mount_point = table.extract_mount_point (path, dirfd);
+            if (mount_point != expected) {
+                std::fprintf (this->m_fd,
+                    "Error: %s (dirfd %d) classified as %d; expected %d\n",
+                    path.c_str (),
+                    dirfd,
+                    static_cast<int> (mount_point),
+                    static_cast<int> (expected));
+                return 1;
+            }
+            return 0;
+        };
+
+        // relative to the working directory
+        errors += (::chdir ("/tmp") == 0) ? 0 : 1;
+        table.update_working_directory ();
+        errors += check_relative ("file", AT_FDCWD, MountPoint::kRemote);
+        errors += check_relative ("./dir/file", AT_FDCWD, MountPoint::kRemote);
+        errors += check_relative ("padll-nested/file", AT_FDCWD, nested);
+        errors += check_relative ("../home/file", AT_FDCWD, MountPoint::kNone);
+
+        errors += (::chdir (nested_path.c_str ()) == 0) ? 0 : 1;
+        table.update_working_directory ();
+        errors += check_relative ("dir/file", AT_FDCWD, nested);
+        errors += check_relative ("../file", AT_FDCWD, MountPoint::kRemote);
+
+        errors += (::chdir ("/") == 0) ? 0 : 1;
+        table.update_working_directory ();
+        errors += check_relative ("tmp/file", AT_FDCWD, MountPoint::kRemote);
+        errors += check_relative ("home/file", AT_FDCWD, MountPoint::kNone);
+
+        // relative to a directory file descriptor
+        int dirfd = ::open (nested_path.c_str (), O_RDONLY | O_DIRECTORY);
+        auto created = table.create_mount_point_entry (dirfd,
+            nested_path,
+            nested,
+            static_cast<uint32_t> (-1));
+        errors += created ? 0 : 1;
+        errors += check_relative ("dir/file", dirfd, nested);
+        errors += check_relative ("../file", dirfd, MountPoint::kRemote);
+        errors += check_relative ("/home/file", dirfd, MountPoint::kNone);
+        errors += (table.resolve_path (dirfd, "file") == nested_path + "/file") ? 0 : 1;
+
+        table.remove_mount_point_entry (dirfd);
+        ::close (dirfd);
+        ::rmdir (nested_path.c_str ());
+
+        std::fprintf (this->m_fd, "test_relative_paths: errors: %d\n", errors);
+
+        return errors;
+    }
+
+    /**
+     * test_performance: measure the cost of classifying paths against a given number of mount
+     * points.
+     * @param num_mount_points Number of registered mount points.
+     * @param iterations Number of classifications.
+     * @return Returns the number of failed checks.
+     */
+    int test_performance (const int& num_mount_points, const int& iterations)
+    {
+        int errors = 0;
+        MountPointClassifier classifier {};
+
+        for (int i = 0; i < num_mount_points; i++) {
+            classifier.register_mount_point ("/mnt/fs-" + std::to_string (i) + "/data",
+                static_cast<MountPoint> (i + 3));
+        }
+
+        std::vector<std::string> paths {};
+        for (int i = 0; i < num_mount_points; i++) {
+            paths.push_back ("/mnt/fs-" + std::to_string (i) + "/data/dir/sub-dir/file-"
+                + std::to_string (i));
+        }
+
+        auto start = std::chrono::high_resolution_clock::now ();
+        for (int i = 0; i < iterations; i++) {
+            auto index = static_cast<std::size_t> (i % num_mount_points);
+            auto [found, mount_point] = classifier.classify (paths[index]);
+            errors += (found && static_cast<int> (mount_point) == static_cast<int> (index) + 3) ? 0
+                                                                                                : 1;
+        }
+        auto end = std::chrono::high_resolution_clock::now ();
+
+        std::fprintf (this->m_fd,
+            "test_performance: %d mount points, %d classifications in %ld us; errors: %d\n",
+            num_mount_points,
+            iterations,
+            static_cast<long> (
+                std::chrono::duration_cast<std::chrono::microseconds> (end - start).count ()),
+            errors);
+
+        return errors;
+    }
+};
+} // namespace padll::tests
+
+using namespace padll::tests;
+
+int main (int argc, char** argv)
+{
+    int num_mount_points = 64;
+    int iterations = 1000000;
+
+    // parse number of mount points
+    if (argc > 1) {
+        num_mount_points = std::stoi (argv[1]);
+    }
+
+    MountPointClassifierTest test {};
+
+    int errors = test.test_classify ();
+    errors += test.test_relative_paths ();
+    errors += test.test_performance (num_mount_points, iterations);
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -157,7 +157,7 @@ private:
         for (int i = 0; i < static_cast<int> (file_identifiers.size ()); i++) {
             auto index = static_cast<int> (random () % file_identifiers.size ());
 
-            const MountPointEntry* entry;
+            std::shared_ptr<MountPointEntry> entry { nullptr };
             if (use_file_descriptor) {
                 auto fd = std::get<int> (file_identifiers[index]);
                 auto [return_value, entry_ptr] = table_ptr->get_mount_point_entry (fd);
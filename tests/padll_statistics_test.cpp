@@ -3,8 +3,10 @@
  *   Copyright (c) 2021-2023 INESC TEC.
  **/
 
+#include <algorithm>
 #include <padll/statistics/statistics.hpp>
 #include <random>
+#include <thread>
 
 using namespace padll::headers;
 using namespace padll::stats;
@@ -103,6 +105,101 @@ public:
             std::cout << stats->to_string (true) << "\n";
         }
     }
+
+    /**
+     * test_concurrent_update_statistic_entry: concurrently update a Statistics object from several
+     * threads and validate that the aggregated counters match the number of updates.
+     * @param stats
+     * @param num_threads
+     * @param iterations
+     * @return Returns true if the aggregated counters are consistent.
+     */
+    bool test_concurrent_update_statistic_entry (Statistics* stats,
+        const int& num_threads,
+        const int& iterations)
+    {
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+        std::fprintf (this->m_fd, "StatisticsTest (test_concurrent_update_statistic_entry)\n");
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+
+        std::vector<std::thread> workers {};
+        for (int i = 0; i < num_threads; i++) {
+            workers.emplace_back ([stats, iterations] () {
+                for (int j = 0; j < iterations; j++) {
+                    stats->update_statistic_entry (j % stats->get_stats_size (), 1, 2, 1);
+                    stats->update_bypassed_statistic_entry (j % stats->get_stats_size (), 1);
+                }
+            });
+        }
+
+        for (auto& worker : workers) {
+            worker.join ();
+        }
+
+        uint64_t operations = 0;
+        uint64_t bytes = 0;
+        uint64_t errors = 0;
+        uint64_t bypassed = 0;
+        for (int i = 0; i < stats->get_stats_size (); i++) {
+            auto entry = stats->get_statistic_entry (i);
+            operations += entry.get_operation_counter ();
+            bytes += entry.get_byte_counter ();
+            errors += entry.get_error_counter ();
+            bypassed += entry.get_bypass_counter ();
+        }
+
+        auto expected = static_cast<uint64_t> (num_threads) * static_cast<uint64_t> (iterations);
+        bool result = (operations == expected) && (bytes == 2 * expected) && (errors == expected)
+            && (bypassed == expected);
+
+        std::cout << stats->to_string (true) << "\n";
+        std::fprintf (this->m_fd, "Consistent counters: %s\n", result ? "true" : "false");
+
+        return result;
+    }
+
+    /**
+     * test_update_latency_entry: concurrently record latencies of a Statistics object from several
+     * threads and validate that the merged histograms account all records.
+     * @param stats
+     * @param num_threads
+     * @param iterations
+     * @return Returns true if the merged histograms are consistent.
+     */
+    bool test_update_latency_entry (Statistics* stats,
+        const int& num_threads,
+        const int& iterations)
+    {
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+        std::fprintf (this->m_fd, "StatisticsTest (test_update_latency_entry)\n");
+        std::fprintf (this->m_fd, "----------------------------------------------\n");
+
+        std::vector<std::thread> workers {};
+        for (int i = 0; i < num_threads; i++) {
+            workers.emplace_back ([stats, iterations] () {
+                for (int j = 0; j < iterations; j++) {
+                    stats->update_latency_entry (0, 100, 1000 + j, 10000);
+                }
+            });
+        }
+
+        for (auto& worker : workers) {
+            worker.join ();
+        }
+
+        auto report = stats->latency_to_string (true);
+        std::fprintf (this->m_fd, "%s\n", report.c_str ());
+
+        // one line per phase of the single updated operation (plus header)
+        auto lines = std::count (report.begin (), report.end (), '\n');
+        auto expected = std::to_string (static_cast<long> (num_threads) * iterations);
+        bool result = !option_default_latency_collection
+            || (lines == 1 + kLatencyPhases && report.find (expected) != std::string::npos);
+
+        std::fprintf (this->m_fd, "Consistent histograms: %s\n", result ? "true" : "false");
+
+        return result;
+    }
 };
 } // namespace padll::tests
 
@@ -118,4 +215,12 @@ int main ()
     test.test_initialize_statistics (&stats_obj, OperationType::metadata_calls);
     test.test_update_statistic_entry (&stats_obj, 1000, debug);
     test.test_get_statistic_entry (&stats_obj, 1000);
+
+    Statistics concurrent_stats_obj { "stats-concurrent-test", OperationType::data_calls };
+    bool result = test.test_concurrent_update_statistic_entry (&concurrent_stats_obj, 8, 100000);
+
+    Statistics latency_stats_obj { "stats-latency-test", OperationType::metadata_calls };
+    result &= test.test_update_latency_entry (&latency_stats_obj, 4, 10000);
+
+    return result ? 0 : 1;
 }
\ No newline at end of file
@@ -0,0 +1,181 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <padll/stage/workflow_selector.hpp>
+#include <thread>
+#include <vector>
+
+using namespace padll::stage;
+
+namespace padll::tests {
+
+/**
+ * WorkflowSelectorTest class.
+ * Validates the workflow selection strategies of the WorkflowSelector, and measures the cost of a
+ * selection under concurrent threads.
+ */
+class WorkflowSelectorTest {
+
+private:
+    FILE* m_fd { stdout };
+    std::vector<uint32_t> m_workflows { 1000, 2000, 3000, 4000 };
+
+    /**
+     * contains: check if a workflow belongs to m_workflows.
+     */
+    bool contains (const uint32_t& workflow) const
+    {
+        for (auto registered : this->m_workflows) {
+            if (registered == workflow) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    /**
+     * WorkflowSelectorTest default constructor.
+     */
+    WorkflowSelectorTest () = default;
+
+    /**
+     * WorkflowSelectorTest parameterized constructor.
+     */
+    explicit WorkflowSelectorTest (FILE* fd) : m_fd { fd } {};
+
+    /**
+     * test_strategy: validate the workflows selected by a given strategy, with concurrent threads.
+     * @param strategy Workflow selection strategy.
+     * @param num_threads Number of threads selecting workflows.
+     * @param iterations Number of selections per thread.
+     * @return Returns the number of failed checks.
+     */
+    int test_strategy (const WorkflowSelection& strategy,
+        const int& num_threads,
+        const int& iterations)
+    {
+        WorkflowSelector selector { strategy };
+        selector.register_workflows (MountPoint::kRemote, this->m_workflows);
+
+        std::atomic<int> errors { 0 };
+        std::vector<std::thread> threads {};
+        auto num_workflows = static_cast<int> (this->m_workflows.size ());
+
+        // unregistered mount points have no workflows
+        errors += (selector.select (MountPoint::kNone, 0) == static_cast<uint32_t> (-1)) ? 0 : 1;
+        errors += (selector.select (MountPoint::kLocal, 0) == static_cast<uint32_t> (-1)) ? 0 : 1;
+
+        auto start = std::chrono::high_resolution_clock::now ();
+        for (int i = 0; i < num_threads; i++) {
+            threads.emplace_back ([&, i] () {
+                std::map<uint32_t, int> selected {};
+                auto path_hash = WorkflowSelector::hash_path ("/tmp/file-" + std::to_string (i));
+
+                for (int j = 0; j < iterations; j++) {
+                    auto workflow = selector.select (MountPoint::kRemote, path_hash);
+                    if (!this->contains (workflow)) {
+                        errors.fetch_add (1);
+                    }
+                    selected[workflow]++;
+                }
+
+                switch (strategy) {
+                    // a thread (or path) always maps to the same workflow
+                    case WorkflowSelection::kThreadAffinity:
+                    case WorkflowSelection::kPathHash:
+                        errors.fetch_add ((selected.size () == 1) ? 0 : 1);
+                        break;
+
+                    // a thread cycles evenly through all workflows
+                    case WorkflowSelection::kRoundRobin:
+                        for (auto& [workflow, count] : selected) {
+                            errors.fetch_add ((count == iterations / num_workflows) ? 0 : 1);
+                        }
+                        errors.fetch_add ((selected.size () == this->m_workflows.size ()) ? 0 : 1);
+                        break;
+
+                    // a thread eventually selects all workflows
+                    case WorkflowSelection::kRandom:
+                    default:
+                        errors.fetch_add ((selected.size () == this->m_workflows.size ()) ? 0 : 1);
+                        break;
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join ();
+        }
+        auto end = std::chrono::high_resolution_clock::now ();
+
+        std::fprintf (this->m_fd,
+            "%16s: %d threads x %d selections in %ld us; errors: %d\n",
+            workflow_selection_to_string (strategy).data (),
+            num_threads,
+            iterations,
+            static_cast<long> (
+                std::chrono::duration_cast<std::chrono::microseconds> (end - start).count ()),
+            errors.load ());
+
+        return errors.load ();
+    }
+
+    /**
+     * test_register: validate that replacing the workflows of a mount point does not change the
+     * workflows of the others.
+     * @return Returns the number of failed checks.
+     */
+    int test_register ()
+    {
+        int errors = 0;
+        WorkflowSelector selector { WorkflowSelection::kRoundRobin };
+
+        selector.register_workflows (MountPoint::kNone, { 1, 2 });
+        selector.register_workflows (MountPoint::kRemote, { 3, 4, 5 });
+        selector.register_workflows (MountPoint::kNone, { 6 });
+
+        std::vector<uint32_t> none_workflows { 6 };
+        std::vector<uint32_t> remote_workflows { 3, 4, 5 };
+
+        errors += (selector.get_workflows (MountPoint::kNone) == none_workflows) ? 0 : 1;
+        errors += (selector.get_workflows (MountPoint::kRemote) == remote_workflows) ? 0 : 1;
+        errors += (selector.select (MountPoint::kNone, 0) == 6) ? 0 : 1;
+
+        std::fprintf (this->m_fd, "%16s: errors: %d\n", "register", errors);
+
+        return errors;
+    }
+};
+} // namespace padll::tests
+
+using namespace padll::tests;
+
+int main (int argc, char** argv)
+{
+    int num_threads = 4;
+    int iterations = 1000000;
+
+    // parse number of threads
+    if (argc > 1) {
+        num_threads = std::stoi (argv[1]);
+    }
+
+    WorkflowSelectorTest test {};
+
+    int errors = test.test_register ();
+    for (auto strategy : { WorkflowSelection::kRandom,
+             WorkflowSelection::kRoundRobin,
+             WorkflowSelection::kThreadAffinity,
+             WorkflowSelection::kPathHash }) {
+        errors += test.test_strategy (strategy, num_threads, iterations);
+    }
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <aio.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * wait_request: wait for the completion of an AIO request.
+ * @param aiocbp
+ * @return Returns the result of the request (as in aio_return).
+ */
+ssize_t wait_request (struct aiocb* aiocbp)
+{
+    const struct aiocb* const list[] = { aiocbp };
+    while (::aio_error (aiocbp) == EINPROGRESS) {
+        ::aio_suspend (list, 1, nullptr);
+    }
+
+    return ::aio_return (aiocbp);
+}
+
+/**
+ * prepare_request: prepare an AIO control block.
+ * @param fd
+ * @param buffer
+ * @param size
+ * @param offset
+ * @param opcode Operation of the request, when submitted through lio_listio.
+ * @return Returns the control block.
+ */
+struct aiocb prepare_request (const int& fd,
+    char* buffer,
+    const size_t& size,
+    const off_t& offset,
+    const int& opcode)
+{
+    struct aiocb request {};
+    request.aio_fildes = fd;
+    request.aio_buf = buffer;
+    request.aio_nbytes = size;
+    request.aio_offset = offset;
+    request.aio_lio_opcode = opcode;
+    request.aio_sigevent.sigev_notify = SIGEV_NONE;
+
+    return request;
+}
+
+/**
+ * test_aio_calls:
+ *
+ * Validation: the statistic entries 'aio_read', 'aio_write', and 'lio_listio' of the Statistics'
+ * container reserved for data-based calls, and 'aio_fsync' of the container reserved for
+ * metadata-based calls should be updated; lio_listio must be accounted with one operation per
+ * control block, and with their size. Requests must complete as without PADLL.
+ * @param pathname Path of the file.
+ * @param size Size of each request (in bytes).
+ * @param blocks Number of control blocks submitted through lio_listio.
+ * @return Returns the number of failed checks.
+ */
+int test_aio_calls (const std::string& pathname, const size_t& size, const int& blocks)
+{
+    std::cout << "Test aio_read, aio_write, aio_fsync, and lio_listio calls (" << pathname << ")\n";
+    int errors = 0;
+
+    std::vector<char> source (size * blocks);
+    for (size_t i = 0; i < source.size (); i++) {
+        source[i] = static_cast<char> ('a' + (i % 26));
+    }
+    std::vector<char> destination (source.size (), 0);
+
+    int fd = ::open (pathname.c_str (), O_CREAT | O_TRUNC | O_RDWR, 0666);
+    errors += (fd >= 0) ? 0 : 1;
+
+    // aio_write and aio_fsync (the first block)
+    auto request = prepare_request (fd, source.data (), size, 0, LIO_NOP);
+    errors += (::aio_write (&request) == 0) ? 0 : 1;
+    errors += (wait_request (&request) == static_cast<ssize_t> (size)) ? 0 : 1;
+    errors += (::aio_fsync (O_SYNC, &request) == 0) ? 0 : 1;
+    errors += (wait_request (&request) == 0) ? 0 : 1;
+
+    // lio_listio (write the remaining blocks in a single list, and wait for all of them)
+    std::vector<struct aiocb> requests;
+    for (int i = 1; i < blocks; i++) {
+        requests.push_back (
+            prepare_request (fd, source.data () + i * size, size, i * size, LIO_WRITE));
+    }
+    std::vector<struct aiocb*> list;
+    for (auto& entry : requests) {
+        list.push_back (&entry);
+    }
+    list.push_back (nullptr); // NULL entries are ignored
+    errors += (::lio_listio (LIO_WAIT, list.data (), list.size (), nullptr) == 0) ? 0 : 1;
+    for (auto& entry : requests) {
+        errors += (::aio_return (&entry) == static_cast<ssize_t> (size)) ? 0 : 1;
+    }
+
+    // lio_listio (read all blocks back, without waiting) and aio_read (the first block, again)
+    requests.clear ();
+    list.clear ();
+    for (int i = 0; i < blocks; i++) {
+        requests.push_back (
+            prepare_request (fd, destination.data () + i * size, size, i * size, LIO_READ));
+    }
+    for (auto& entry : requests) {
+        list.push_back (&entry);
+    }
+    errors += (::lio_listio (LIO_NOWAIT, list.data (), list.size (), nullptr) == 0) ? 0 : 1;
+    for (auto& entry : requests) {
+        errors += (wait_request (&entry) == static_cast<ssize_t> (size)) ? 0 : 1;
+    }
+    errors += (std::memcmp (source.data (), destination.data (), source.size ()) == 0) ? 0 : 1;
+
+    std::memset (destination.data (), 0, size);
+    request = prepare_request (fd, destination.data (), size, 0, LIO_NOP);
+    errors += (::aio_read (&request) == 0) ? 0 : 1;
+    errors += (wait_request (&request) == static_cast<ssize_t> (size)) ? 0 : 1;
+    errors += (std::memcmp (source.data (), destination.data (), size) == 0) ? 0 : 1;
+    ::close (fd);
+
+    // requests over invalid file descriptors must fail (at submission or on completion)
+    request = prepare_request (-1, destination.data (), size, 0, LIO_NOP);
+    errors += (::aio_read (&request) == -1 || wait_request (&request) == -1) ? 0 : 1;
+
+    if (errors > 0) {
+        std::cerr << "Error in AIO calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    std::string dirpath { "/tmp" };
+    if (argc > 1) {
+        dirpath = argv[1];
+    }
+
+    std::string pathname { dirpath + "/padll-aio-file" };
+
+    int errors = test_aio_calls (pathname, 128 * 1024, 8);
+    ::unlink (pathname.c_str ());
+
+    std::cout << "AIO calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -4,7 +4,9 @@
  **/
 
 #include <dirent.h>
+#include <fcntl.h>
 #include <iostream>
+#include <string>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -157,6 +159,80 @@ int test_fdopendir_closedir_call (const char* pathname)
     return result;
 }
 
+/**
+ * test_directory_scan_calls:
+ *
+ * Validation: the statistic entries 'readdir', 'readdir64', and 'getdents64' of the Statistics'
+ * container reserved for directory-based calls should be updated, with one entry per call; only one
+ * request per refill of the directory stream's buffer should be enforced.
+ * @param pathname
+ * @param files Number of files to be created in the directory.
+ * @return Returns the number of failed checks.
+ */
+int test_directory_scan_calls (const char* pathname, const int& files)
+{
+    std::cout << "Test readdir, readdir64, and getdents64 calls (" << pathname << ", " << files
+              << " files)\n";
+    int errors = 0;
+
+    if (::mkdir (pathname, 0777) != 0) {
+        std::cerr << "Error while creating directory (" << errno << ")\n";
+        return 1;
+    }
+
+    for (int i = 0; i < files; i++) {
+        std::string file { std::string (pathname) + "/file-" + std::to_string (i) };
+        int fd = ::open (file.c_str (), O_CREAT | O_WRONLY, 0666);
+        errors += (fd >= 0) ? 0 : 1;
+        ::close (fd);
+    }
+
+    // readdir (entries include '.' and '..')
+    DIR* folder = ::opendir (pathname);
+    int entries = 0;
+    errno = 0;
+    while (::readdir (folder) != nullptr) {
+        entries++;
+    }
+    errors += (entries == files + 2 && errno == 0) ? 0 : 1;
+    errors += (::closedir (folder) == 0) ? 0 : 1;
+
+    // readdir64
+    folder = ::opendir (pathname);
+    entries = 0;
+    while (::readdir64 (folder) != nullptr) {
+        entries++;
+    }
+    errors += (entries == files + 2) ? 0 : 1;
+    errors += (::closedir (folder) == 0) ? 0 : 1;
+
+    // getdents64 (each call fills the buffer with a batch of entries)
+    int fd = ::open (pathname, O_RDONLY | O_DIRECTORY);
+    char buffer[4096];
+    ssize_t bytes;
+    entries = 0;
+    while ((bytes = ::getdents64 (fd, buffer, sizeof (buffer))) > 0) {
+        for (ssize_t offset = 0; offset < bytes;) {
+            auto* entry = reinterpret_cast<struct dirent64*> (buffer + offset);
+            offset += entry->d_reclen;
+            entries++;
+        }
+    }
+    errors += (bytes == 0 && entries == files + 2) ? 0 : 1;
+    ::close (fd);
+
+    for (int i = 0; i < files; i++) {
+        ::unlink ((std::string (pathname) + "/file-" + std::to_string (i)).c_str ());
+    }
+    errors += (::rmdir (pathname) == 0) ? 0 : 1;
+
+    if (errors > 0) {
+        std::cerr << "Error in directory scan calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
 /**
  * test_rmdir_call:
  * @param pathname
@@ -195,6 +271,11 @@ int main (int argc, char** argv)
         test_mkdirat_call (dir, path.data (), 0777);
         test_fdopendir_closedir_call (path.data ());
         test_rmdir_call (path.data ());
+
+        std::cout << "------\n";
+        if (test_directory_scan_calls ("/tmp/padll-scan-dir", 5000) != 0) {
+            return 1;
+        }
     }
 
     return 0;
@@ -0,0 +1,80 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+/**
+ * test_durability_calls:
+ *
+ * Validation: the statistic entries 'fsync', 'fdatasync', 'sync_file_range', 'syncfs', and 'sync'
+ * of the Statistics' container reserved for metadata-based calls should be updated.
+ * @param pathname
+ * @param iterations Number of write-and-flush iterations.
+ * @return Returns the number of failed checks.
+ */
+int test_durability_calls (const char* pathname, const int& iterations)
+{
+    std::cout << "Test fsync, fdatasync, sync_file_range, syncfs, and sync calls (" << pathname
+              << ")\n";
+    int errors = 0;
+
+    int fd = ::open (pathname, O_CREAT | O_TRUNC | O_WRONLY, 0666);
+    if (fd < 0) {
+        std::cerr << "Error while opening file (" << errno << ")\n";
+        return 1;
+    }
+
+    std::string block (4096, 'x');
+    auto size = static_cast<ssize_t> (block.size ());
+    for (int i = 0; i < iterations; i++) {
+        errors += (::write (fd, block.data (), block.size ()) == size) ? 0 : 1;
+        errors += (::fsync (fd) == 0) ? 0 : 1;
+
+        errors += (::write (fd, block.data (), block.size ()) == size) ? 0 : 1;
+        errors += (::fdatasync (fd) == 0) ? 0 : 1;
+
+        errors += (::write (fd, block.data (), block.size ()) == size) ? 0 : 1;
+        errors += (::sync_file_range (fd,
+                       0,
+                       0,
+                       SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE
+                           | SYNC_FILE_RANGE_WAIT_AFTER)
+                      == 0)
+            ? 0
+            : 1;
+    }
+
+    errors += (::syncfs (fd) == 0) ? 0 : 1;
+    ::sync ();
+
+    // flushes over invalid file descriptors must fail
+    errors += (::fsync (-1) == -1 && errno == EBADF) ? 0 : 1;
+
+    ::close (fd);
+
+    if (errors > 0) {
+        std::cerr << "Error in durability calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    std::string path { "/tmp/padll-durability-test" };
+    if (argc > 1) {
+        path = argv[1];
+    }
+
+    int errors = test_durability_calls (path.c_str (), 100);
+    ::unlink (path.c_str ());
+
+    std::cout << "Durability calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
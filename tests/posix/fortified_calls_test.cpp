@@ -0,0 +1,167 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "posix_test_utils.hpp"
+
+// the test is only meaningful if calls are compiled to glibc's fortified entry points
+#if !defined(__USE_FORTIFY_LEVEL) || __USE_FORTIFY_LEVEL < 1
+#error "fortified_calls_test must be compiled with _FORTIFY_SOURCE (and optimizations enabled)"
+#endif
+
+/**
+ * opaque: hide a value from the compiler, so that fortified calls cannot be resolved at compile
+ * time (and are emitted as calls to __open_2, __read_chk, ...).
+ * @param value
+ * @return Returns the value.
+ */
+template <typename T>
+T opaque (const T& value)
+{
+    volatile T copy = value;
+    return copy;
+}
+
+/**
+ * run_in_child: run a function in a child process, which exits with the function's result (so
+ * that PADLL writes the statistics reports of the child).
+ * @param function
+ * @return Returns the status of the child (as in waitpid), and the child's pid.
+ */
+std::pair<int, pid_t> run_in_child (const std::function<int ()>& function)
+{
+    std::fflush (stdout);
+    pid_t pid = ::fork ();
+    if (pid == 0) {
+        std::exit (function ());
+    }
+
+    int status = 0;
+    ::waitpid (pid, &status, 0);
+
+    return { status, pid };
+}
+
+/**
+ * fortified_workload: issue fortified open, openat, read, pread, fread, and fgets calls over a
+ * file, and validate their results.
+ * @param pathname Path of the file.
+ * @param iterations Number of times each call is issued.
+ * @return Returns the number of failed checks.
+ */
+int fortified_workload (const std::string& pathname, const int& iterations)
+{
+    int errors = 0;
+    char buffer[4096];
+    char line[64];
+
+    for (int i = 0; i < iterations; i++) {
+        // __open_2, __read_chk, and __pread_chk
+        int fd = ::open (pathname.c_str (), opaque (O_RDONLY));
+        errors += (fd >= 0) ? 0 : 1;
+        errors += (::read (fd, buffer, opaque (sizeof (buffer))) == 4096) ? 0 : 1;
+        errors += (::pread (fd, buffer, opaque (sizeof (buffer)), 0) == 4096) ? 0 : 1;
+        ::close (fd);
+
+        // __openat_2
+        fd = ::openat (AT_FDCWD, pathname.c_str (), opaque (O_RDONLY));
+        errors += (fd >= 0) ? 0 : 1;
+        ::close (fd);
+
+        // __fread_chk and __fgets_chk
+        FILE* stream = ::fopen (pathname.c_str (), "r");
+        errors += (stream != nullptr) ? 0 : 1;
+        errors += (::fread (buffer, 1, opaque (sizeof (buffer)), stream) == 4096) ? 0 : 1;
+        errors += (::fgets (line, opaque (static_cast<int> (sizeof (line))), stream) != nullptr)
+            ? 0
+            : 1;
+        ::fclose (stream);
+    }
+
+    return errors;
+}
+
+/**
+ * test_fortified_calls:
+ *
+ * Validation: fortified calls of a binary built with _FORTIFY_SOURCE (__open_2, __openat_2,
+ * __read_chk, __pread_chk, __fread_chk, and __fgets_chk) should be accounted in the statistic
+ * entries of the calls they check ('open', 'openat', 'read', 'pread', 'fread', and 'fgets'), and
+ * calls that fail their check must still abort the process.
+ * @param pathname Path of the file.
+ * @param iterations Number of times each call is issued.
+ * @return Returns the number of failed checks.
+ */
+int test_fortified_calls (const std::string& pathname, const int& iterations)
+{
+    std::cout << "Test fortified calls (" << pathname << ")\n";
+    int errors = 0;
+
+    std::string content (8192, 'a');
+    content[4096 + 32] = '\n';
+    std::ofstream file (pathname, std::ios::trunc);
+    file << content;
+    file.close ();
+
+    // run the workload in a child, and validate the statistics reports it generates at exit
+    auto [status, pid] = run_in_child (
+        [&] () { return fortified_workload (pathname, iterations); });
+    errors += (WIFEXITED (status) && WEXITSTATUS (status) == 0) ? 0 : 1;
+
+    for (const auto* call : { "open", "openat", "read", "pread", "fread", "fgets" }) {
+        auto operations = count_calls (pid, call);
+        if (operations < static_cast<uint64_t> (iterations)) {
+            std::cerr << "Fortified call not accounted: " << call << " (" << operations << ")\n";
+            errors++;
+        }
+    }
+    remove_reports (pid);
+
+    // overflowing calls must abort the process, as without PADLL
+    auto read_status = run_in_child ([&] () {
+        char buffer[16];
+        int fd = ::open (pathname.c_str (), O_RDONLY);
+        return static_cast<int> (::read (fd, buffer, opaque (sizeof (buffer) + 1)));
+    }).first;
+    errors += (WIFSIGNALED (read_status) && WTERMSIG (read_status) == SIGABRT) ? 0 : 1;
+
+    auto open_status = run_in_child (
+        [&] () { return ::open (pathname.c_str (), opaque (O_CREAT | O_WRONLY)); }).first;
+    errors += (WIFSIGNALED (open_status) && WTERMSIG (open_status) == SIGABRT) ? 0 : 1;
+
+    if (errors > 0) {
+        std::cerr << "Error in fortified calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    std::string dirpath { "/tmp" };
+    if (argc > 1) {
+        dirpath = argv[1];
+    }
+
+    std::string pathname { dirpath + "/padll-fortified-file" };
+
+    int errors = test_fortified_calls (pathname, 16);
+    ::unlink (pathname.c_str ());
+
+    std::cout << "Fortified calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,258 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <linux/io_uring.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Ring struct: mappings of an io_uring instance (SQ ring, CQ ring, and SQE array).
+ */
+struct Ring {
+    int m_fd { -1 };
+    struct io_uring_params m_params {};
+    char* m_sq_ring { nullptr };
+    size_t m_sq_ring_size { 0 };
+    char* m_cq_ring { nullptr };
+    size_t m_cq_ring_size { 0 };
+    struct io_uring_sqe* m_sqes { nullptr };
+    size_t m_sqes_size { 0 };
+};
+
+/**
+ * setup_ring: create an io_uring instance (through libc's syscall) and map its rings.
+ * @param ring
+ * @param entries Number of entries of the SQ ring.
+ * @return Returns true if the instance was created and mapped; false otherwise.
+ */
+bool setup_ring (Ring& ring, const unsigned& entries)
+{
+    ring.m_fd = static_cast<int> (::syscall (SYS_io_uring_setup, entries, &ring.m_params));
+    if (ring.m_fd < 0) {
+        return false;
+    }
+
+    auto& params = ring.m_params;
+    ring.m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof (unsigned);
+    ring.m_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof (struct io_uring_cqe);
+    ring.m_sqes_size = params.sq_entries * sizeof (struct io_uring_sqe);
+
+    auto map = [&] (const size_t& size, const off_t& offset) {
+        void* address = ::mmap (nullptr,
+            size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            ring.m_fd,
+            offset);
+        return (address == MAP_FAILED) ? nullptr : static_cast<char*> (address);
+    };
+
+    ring.m_sq_ring = map (ring.m_sq_ring_size, IORING_OFF_SQ_RING);
+    ring.m_cq_ring = map (ring.m_cq_ring_size, IORING_OFF_CQ_RING);
+    ring.m_sqes = reinterpret_cast<struct io_uring_sqe*> (map (ring.m_sqes_size, IORING_OFF_SQES));
+
+    return ring.m_sq_ring != nullptr && ring.m_cq_ring != nullptr && ring.m_sqes != nullptr;
+}
+
+/**
+ * teardown_ring: unmap the rings of an io_uring instance and close it.
+ * @param ring
+ */
+void teardown_ring (Ring& ring)
+{
+    if (ring.m_sq_ring != nullptr) {
+        ::munmap (ring.m_sq_ring, ring.m_sq_ring_size);
+    }
+    if (ring.m_cq_ring != nullptr) {
+        ::munmap (ring.m_cq_ring, ring.m_cq_ring_size);
+    }
+    if (ring.m_sqes != nullptr) {
+        ::munmap (ring.m_sqes, ring.m_sqes_size);
+    }
+    if (ring.m_fd >= 0) {
+        ::close (ring.m_fd);
+    }
+}
+
+/**
+ * submit_and_wait: queue a batch of SQEs, submit them with a single io_uring_enter call (through
+ * libc's syscall), and reap their completions.
+ * @param ring
+ * @param batch SQEs to be submitted.
+ * @param results Results of the completions, ordered by the user_data of each SQE.
+ * @return Returns the number of submitted SQEs, or -1 on error.
+ */
+int submit_and_wait (Ring& ring,
+    const std::vector<struct io_uring_sqe>& batch,
+    std::vector<int>& results)
+{
+    auto& params = ring.m_params;
+    auto* sq_tail = reinterpret_cast<unsigned*> (ring.m_sq_ring + params.sq_off.tail);
+    auto sq_mask = *reinterpret_cast<unsigned*> (ring.m_sq_ring + params.sq_off.ring_mask);
+    auto* sq_array = reinterpret_cast<unsigned*> (ring.m_sq_ring + params.sq_off.array);
+
+    // queue the SQEs and publish the new tail
+    auto tail = __atomic_load_n (sq_tail, __ATOMIC_RELAXED);
+    for (const auto& sqe : batch) {
+        auto index = tail & sq_mask;
+        ring.m_sqes[index] = sqe;
+        sq_array[index] = index;
+        tail++;
+    }
+    __atomic_store_n (sq_tail, tail, __ATOMIC_RELEASE);
+
+    auto count = static_cast<unsigned> (batch.size ());
+    auto submitted = static_cast<int> (::syscall (SYS_io_uring_enter,
+        ring.m_fd,
+        count,
+        count,
+        IORING_ENTER_GETEVENTS,
+        nullptr,
+        0));
+    if (submitted < 0) {
+        return -1;
+    }
+
+    // reap the completions
+    auto* cq_head = reinterpret_cast<unsigned*> (ring.m_cq_ring + params.cq_off.head);
+    auto* cq_tail = reinterpret_cast<unsigned*> (ring.m_cq_ring + params.cq_off.tail);
+    auto cq_mask = *reinterpret_cast<unsigned*> (ring.m_cq_ring + params.cq_off.ring_mask);
+    auto* cqes = reinterpret_cast<struct io_uring_cqe*> (ring.m_cq_ring + params.cq_off.cqes);
+
+    results.assign (batch.size (), 0);
+    auto head = __atomic_load_n (cq_head, __ATOMIC_RELAXED);
+    while (head != __atomic_load_n (cq_tail, __ATOMIC_ACQUIRE)) {
+        const auto& cqe = cqes[head & cq_mask];
+        if (cqe.user_data < results.size ()) {
+            results[cqe.user_data] = cqe.res;
+        }
+        head++;
+    }
+    __atomic_store_n (cq_head, head, __ATOMIC_RELEASE);
+
+    return submitted;
+}
+
+/**
+ * prepare_sqe: prepare a submission queue entry.
+ * @param opcode
+ * @param fd
+ * @param address
+ * @param length
+ * @param user_data
+ * @return Returns the SQE.
+ */
+struct io_uring_sqe prepare_sqe (const int& opcode,
+    const int& fd,
+    const void* address,
+    const unsigned& length,
+    const uint64_t& user_data)
+{
+    struct io_uring_sqe sqe {};
+    sqe.opcode = static_cast<uint8_t> (opcode);
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<uint64_t> (address);
+    sqe.len = length;
+    sqe.user_data = user_data;
+
+    return sqe;
+}
+
+/**
+ * test_io_uring_calls:
+ *
+ * Validation: the statistic entries 'io_uring_setup' of the Statistics' container reserved for
+ * metadata-based calls, and 'io_uring_enter' of the container reserved for data-based calls should
+ * be updated; io_uring_enter must be accounted with one operation per submitted SQE, and with the
+ * bytes of its read and write SQEs. Submissions must complete as without PADLL.
+ * @param pathname Path of the file.
+ * @param size Size of each read and write (in bytes).
+ * @return Returns the number of failed checks, or -1 if io_uring is not supported.
+ */
+int test_io_uring_calls (const std::string& pathname, const size_t& size)
+{
+    std::cout << "Test io_uring_setup and io_uring_enter calls (" << pathname << ")\n";
+
+    Ring ring {};
+    if (!setup_ring (ring, 8)) {
+        teardown_ring (ring);
+        return -1;
+    }
+
+    int errors = 0;
+    std::vector<char> source (size);
+    for (size_t i = 0; i < size; i++) {
+        source[i] = static_cast<char> ('a' + (i % 26));
+    }
+    std::vector<char> destination (size, 0);
+    std::vector<int> results;
+
+    // write the file and flush it (a batch of two SQEs, linked to be performed in order)
+    int fd = ::open (pathname.c_str (), O_CREAT | O_TRUNC | O_RDWR, 0666);
+    errors += (fd >= 0) ? 0 : 1;
+    auto write_sqe = prepare_sqe (IORING_OP_WRITE, fd, source.data (), size, 0);
+    write_sqe.flags = IOSQE_IO_LINK;
+    auto fsync_sqe = prepare_sqe (IORING_OP_FSYNC, fd, nullptr, 0, 1);
+    errors += (submit_and_wait (ring, { write_sqe, fsync_sqe }, results) == 2) ? 0 : 1;
+    errors += (results[0] == static_cast<int> (size) && results[1] == 0) ? 0 : 1;
+
+    // read the file back
+    auto read_sqe = prepare_sqe (IORING_OP_READ, fd, destination.data (), size, 0);
+    errors += (submit_and_wait (ring, { read_sqe }, results) == 1) ? 0 : 1;
+    errors += (results[0] == static_cast<int> (size)) ? 0 : 1;
+    errors += (std::memcmp (source.data (), destination.data (), size) == 0) ? 0 : 1;
+    ::close (fd);
+
+    // open the file through the ring
+    auto openat_sqe = prepare_sqe (IORING_OP_OPENAT, AT_FDCWD, pathname.c_str (), 0, 0);
+    openat_sqe.open_flags = O_RDONLY;
+    errors += (submit_and_wait (ring, { openat_sqe }, results) == 1) ? 0 : 1;
+    errors += (results[0] >= 0) ? 0 : 1;
+    if (results[0] >= 0) {
+        ::close (results[0]);
+    }
+
+    // submissions over invalid file descriptors must complete with an error
+    auto invalid_sqe = prepare_sqe (IORING_OP_READ, -1, destination.data (), size, 0);
+    errors += (submit_and_wait (ring, { invalid_sqe }, results) == 1) ? 0 : 1;
+    errors += (results[0] == -EBADF) ? 0 : 1;
+
+    teardown_ring (ring);
+
+    if (errors > 0) {
+        std::cerr << "Error in io_uring calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    std::string dirpath { "/tmp" };
+    if (argc > 1) {
+        dirpath = argv[1];
+    }
+
+    std::string pathname { dirpath + "/padll-io-uring-file" };
+
+    int errors = test_io_uring_calls (pathname, 1024 * 1024);
+    ::unlink (pathname.c_str ());
+
+    // io_uring may be unavailable (e.g., old kernels, or disabled by io_uring_disabled)
+    if (errors < 0) {
+        std::cout << "io_uring calls test: skipped (io_uring not supported)\n";
+        return 0;
+    }
+
+    std::cout << "io_uring calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,228 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#ifdef PADLL_HAVE_LIBURING
+#include <liburing.h>
+#endif
+
+#include "posix_test_utils.hpp"
+
+// exit code of the child when the workload could not run (seccomp filter or io_uring unavailable)
+constexpr int kSkipped { 77 };
+
+// calls intercepted by the child process, validated by the test
+constexpr const char* intercepted_calls {
+    "open, open_variadic, close, io_uring_setup, io_uring_enter" };
+
+#ifdef PADLL_HAVE_LIBURING
+/**
+ * is_filtered: check if a seccomp filter is installed in the calling thread.
+ * @return Returns true if the thread is in seccomp filter mode.
+ */
+bool is_filtered ()
+{
+    std::ifstream status ("/proc/self/status");
+    std::string line;
+    while (std::getline (status, line)) {
+        if (line.rfind ("Seccomp:", 0) == 0) {
+            return line.find ('2') != std::string::npos;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * submit_and_reap: submit the queued SQEs of a ring through liburing, wait for their completions,
+ * and validate their results.
+ * @param ring
+ * @param count Number of queued SQEs.
+ * @param expected Expected result of each completion.
+ * @return Returns the number of failed checks.
+ */
+int submit_and_reap (struct io_uring& ring, const unsigned& count, const int& expected)
+{
+    int errors = (io_uring_submit_and_wait (&ring, count) == static_cast<int> (count)) ? 0 : 1;
+
+    for (unsigned i = 0; i < count; i++) {
+        struct io_uring_cqe* cqe = nullptr;
+        if (io_uring_wait_cqe (&ring, &cqe) != 0) {
+            return errors + 1;
+        }
+        // fsync completions return 0
+        errors += (cqe->res == expected || (cqe->user_data == 1 && cqe->res == 0)) ? 0 : 1;
+        io_uring_cqe_seen (&ring, cqe);
+    }
+
+    return errors;
+}
+#endif
+
+/**
+ * liburing_workload: write, fsync, and read a file through a liburing instance, and validate the
+ * results. Runs in a process where seccomp interception is enabled (liburing issues its own system
+ * call instructions, which are not interposed by PADLL).
+ * @param pathname Path of the file.
+ * @param iterations Number of write, fsync, and read submissions.
+ * @param size Size of each write and read (in bytes).
+ * @return Returns the number of failed checks, or kSkipped if the workload could not run.
+ */
+int liburing_workload (const std::string& pathname, const int& iterations, const size_t& size)
+{
+#ifdef PADLL_HAVE_LIBURING
+    struct io_uring ring {};
+    if (!is_filtered () || io_uring_queue_init (8, &ring, 0) != 0) {
+        return kSkipped;
+    }
+
+    int errors = 0;
+    std::vector<char> source (size, 'u');
+    std::vector<char> destination (size, 0);
+
+    int fd = ::open (pathname.c_str (), O_CREAT | O_TRUNC | O_RDWR, 0644);
+    errors += (fd >= 0) ? 0 : 1;
+
+    for (int i = 0; i < iterations; i++) {
+        // write the file and flush it (linked, to be performed in order)
+        auto* sqe = io_uring_get_sqe (&ring);
+        io_uring_prep_write (sqe, fd, source.data (), static_cast<unsigned> (size), 0);
+        sqe->flags |= IOSQE_IO_LINK;
+        io_uring_sqe_set_data64 (sqe, 0);
+        sqe = io_uring_get_sqe (&ring);
+        io_uring_prep_fsync (sqe, fd, 0);
+        io_uring_sqe_set_data64 (sqe, 1);
+        errors += submit_and_reap (ring, 2, static_cast<int> (size));
+
+        // read the file back
+        sqe = io_uring_get_sqe (&ring);
+        io_uring_prep_read (sqe, fd, destination.data (), static_cast<unsigned> (size), 0);
+        io_uring_sqe_set_data64 (sqe, 2);
+        errors += submit_and_reap (ring, 1, static_cast<int> (size));
+        errors += (std::memcmp (source.data (), destination.data (), size) == 0) ? 0 : 1;
+    }
+
+    ::close (fd);
+    io_uring_queue_exit (&ring);
+
+    return errors;
+#else
+    (void)pathname;
+    (void)iterations;
+    (void)size;
+    return kSkipped;
+#endif
+}
+
+/**
+ * test_liburing_calls:
+ *
+ * Validation: the statistic entries 'io_uring_setup' of the Statistics' container reserved for
+ * metadata-based calls, and 'io_uring_enter' of the container reserved for data-based calls should
+ * be updated for the submissions of a liburing instance (one operation per submitted SQE, with the
+ * bytes of its read and write SQEs), completing as without PADLL. The workload runs in a child
+ * process, re-executed with seccomp interception enabled.
+ * @param program Path of the test's executable.
+ * @param pathname Path of the file.
+ * @param iterations Number of write, fsync, and read submissions.
+ * @param size Size of each write and read (in bytes).
+ * @return Returns the number of failed checks, or -1 if the workload could not run.
+ */
+int test_liburing_calls (const std::string& program,
+    const std::string& pathname,
+    const int& iterations,
+    const size_t& size)
+{
+    std::cout << "Test liburing submissions (" << pathname << ")\n";
+    int errors = 0;
+
+    std::string configuration { pathname + ".conf" };
+    if (!write_configuration (configuration, intercepted_calls)) {
+        std::cerr << "Error while writing configuration (" << configuration << ")\n";
+        return 1;
+    }
+
+    std::cout.flush ();
+    pid_t pid = ::fork ();
+    if (pid == 0) {
+        ::setenv ("padll_config", configuration.c_str (), 1);
+        ::setenv ("padll_seccomp_interception", "true", 1);
+        ::execl (program.c_str (), program.c_str (), "--workload", pathname.c_str (), nullptr);
+        std::exit (1);
+    }
+
+    int status = 0;
+    ::waitpid (pid, &status, 0);
+    ::unlink (configuration.c_str ());
+    if (WIFEXITED (status) && WEXITSTATUS (status) == kSkipped) {
+        remove_reports (pid);
+        return -1;
+    }
+    errors += (WIFEXITED (status) && WEXITSTATUS (status) == 0) ? 0 : 1;
+
+    auto setups = count_calls (pid, "io_uring_setup");
+    auto submissions = count_calls (pid, "io_uring_enter");
+    auto bytes = count_bytes (pid, "io_uring_enter");
+    if (setups < 1 || submissions < static_cast<uint64_t> (3 * iterations)
+        || bytes < 2 * iterations * size) {
+        std::cerr << "liburing submissions not accounted: " << setups << " setups, " << submissions
+                  << " SQEs, " << bytes << " bytes\n";
+        errors++;
+    }
+
+    remove_reports (pid);
+
+    if (errors > 0) {
+        std::cerr << "Error in liburing submissions (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    constexpr int iterations = 8;
+    constexpr size_t size = 64 * 1024;
+
+    // child process, with seccomp interception enabled
+    if (argc > 2 && std::string { argv[1] } == "--workload") {
+        return liburing_workload (argv[2], iterations, size);
+    }
+
+#ifndef PADLL_HAVE_LIBURING
+    std::cout << "liburing calls test: skipped (liburing not available)\n";
+    return 0;
+#endif
+
+    std::string dirpath { "/tmp" };
+    if (argc > 1) {
+        dirpath = argv[1];
+    }
+
+    std::string pathname { dirpath + "/padll-liburing-file" };
+
+    int errors = test_liburing_calls ("/proc/self/exe", pathname, iterations, size);
+    ::unlink (pathname.c_str ());
+
+    // seccomp interception or io_uring may be unsupported (e.g., kernel, or sandboxing)
+    if (errors < 0) {
+        std::cout << "liburing calls test: skipped (seccomp interception or io_uring not "
+                     "supported)\n";
+        return 0;
+    }
+
+    std::cout << "liburing calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
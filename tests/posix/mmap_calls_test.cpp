@@ -0,0 +1,185 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "posix_test_utils.hpp"
+
+// exit code of the child when the file's pages could not be evicted (e.g., tmpfs)
+constexpr int kSkipped { 77 };
+
+// calls intercepted by the child process, validated by the test (mmap and munmap included)
+constexpr const char* intercepted_calls { "open, open_variadic, write, fsync, posix_fadvise, mmap, "
+    "munmap, close" };
+
+// size of the mapped file, and number of bytes read through the mapping
+constexpr size_t kFileSize { 32 * 1024 * 1024 };
+constexpr size_t kReadSize { 4 * 1024 * 1024 };
+
+/**
+ * resident_bytes: get the number of bytes of a mapping that are resident in memory.
+ * @param address Start address of the mapping.
+ * @param length Length of the mapping.
+ * @return Returns the number of resident bytes.
+ */
+size_t resident_bytes (void* address, const size_t& length)
+{
+    auto page_size = static_cast<size_t> (::sysconf (_SC_PAGESIZE));
+    std::vector<unsigned char> residency ((length + page_size - 1) / page_size);
+    if (::mincore (address, length, residency.data ()) != 0) {
+        return 0;
+    }
+
+    size_t bytes = 0;
+    for (const auto& page : residency) {
+        bytes += ((page & 1) != 0) ? page_size : 0;
+    }
+
+    return bytes;
+}
+
+/**
+ * mmap_workload: create a file, evict its pages, map it, and read kReadSize bytes through the
+ * mapping (twice, so that already resident pages are read again). Runs in a process where mmap
+ * sampling is enabled.
+ * @param pathname Path of the file.
+ * @return Returns the number of failed checks, or kSkipped if the file's pages cannot be evicted.
+ */
+int mmap_workload (const std::string& pathname)
+{
+    int errors = 0;
+
+    // create the file, and evict its pages from the page cache
+    int fd = ::open (pathname.c_str (), O_CREAT | O_TRUNC | O_RDWR, 0644);
+    std::vector<char> content (kFileSize, 'm');
+    errors += (::write (fd, content.data (), content.size ())
+                  == static_cast<ssize_t> (content.size ()))
+        ? 0
+        : 1;
+    errors += (::fsync (fd) == 0) ? 0 : 1;
+    ::posix_fadvise (fd, 0, 0, POSIX_FADV_DONTNEED);
+
+    void* address = ::mmap (nullptr, kFileSize, PROT_READ, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        ::close (fd);
+        return errors + 1;
+    }
+
+    // pages that cannot be evicted are never faulted in
+    if (resident_bytes (address, kFileSize) > kFileSize / 2) {
+        ::munmap (address, kFileSize);
+        ::close (fd);
+        return kSkipped;
+    }
+
+    // read through the mapping, with samples in-between
+    const auto* data = static_cast<const char*> (address);
+    auto page_size = static_cast<size_t> (::sysconf (_SC_PAGESIZE));
+    uint64_t checksum = 0;
+    for (int round = 0; round < 2; round++) {
+        for (size_t offset = 0; offset < kReadSize; offset += page_size) {
+            checksum += static_cast<uint64_t> (data[offset]);
+        }
+        std::this_thread::sleep_for (std::chrono::milliseconds (50));
+    }
+    errors += (checksum == 2 * (kReadSize / page_size) * 'm') ? 0 : 1;
+
+    errors += (::munmap (address, kFileSize) == 0) ? 0 : 1;
+    errors += (::close (fd) == 0) ? 0 : 1;
+
+    return errors;
+}
+
+/**
+ * test_mmap_calls:
+ *
+ * Validation: the bytes read through a file-backed mapping should be charged (and accounted in the
+ * 'mmap' statistic entry) as the pages are faulted in, instead of the mapping's length. The bytes
+ * must cover the pages that were read (once, since the second read hits resident pages), and be
+ * far from the file's size (readahead may fault in a few more pages). The workload runs in a child
+ * process, re-executed with mmap sampling enabled.
+ * @param program Path of the test's executable.
+ * @param pathname Path of the file.
+ * @return Returns the number of failed checks, or -1 if the file's pages cannot be evicted.
+ */
+int test_mmap_calls (const std::string& program, const std::string& pathname)
+{
+    std::cout << "Test mmap sampled calls (" << pathname << ")\n";
+    int errors = 0;
+
+    std::string configuration { pathname + ".conf" };
+    if (!write_configuration (configuration, intercepted_calls)) {
+        std::cerr << "Error while writing configuration (" << configuration << ")\n";
+        return 1;
+    }
+
+    std::cout.flush ();
+    pid_t pid = ::fork ();
+    if (pid == 0) {
+        ::setenv ("padll_config", configuration.c_str (), 1);
+        ::setenv ("padll_mmap_sampling_interval", "10", 1);
+        ::execl (program.c_str (), program.c_str (), "--workload", pathname.c_str (), nullptr);
+        std::exit (1);
+    }
+
+    int status = 0;
+    ::waitpid (pid, &status, 0);
+    ::unlink (configuration.c_str ());
+    if (WIFEXITED (status) && WEXITSTATUS (status) == kSkipped) {
+        return -1;
+    }
+    errors += (WIFEXITED (status) && WEXITSTATUS (status) == 0) ? 0 : 1;
+
+    auto bytes = count_bytes (pid, "mmap");
+    if (bytes < kReadSize || bytes > kFileSize / 2) {
+        std::cerr << "Mapped bytes not accounted: " << bytes << " (read " << kReadSize << ")\n";
+        errors++;
+    }
+
+    remove_reports (pid);
+
+    if (errors > 0) {
+        std::cerr << "Error in mmap sampled calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    // child process, with mmap sampling enabled
+    if (argc > 2 && std::string { argv[1] } == "--workload") {
+        return mmap_workload (argv[2]);
+    }
+
+    std::string dirpath { "/tmp" };
+    if (argc > 1) {
+        dirpath = argv[1];
+    }
+
+    std::string pathname { dirpath + "/padll-mmap-file" };
+
+    int errors = test_mmap_calls ("/proc/self/exe", pathname);
+    ::unlink (pathname.c_str ());
+
+    // the file's pages may not be evictable (e.g., tmpfs)
+    if (errors < 0) {
+        std::cout << "Mmap calls test: skipped (pages cannot be evicted)\n";
+        return 0;
+    }
+
+    std::cout << "Mmap calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#ifndef PADLL_POSIX_TEST_UTILS_HPP
+#define PADLL_POSIX_TEST_UTILS_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/types.h>
+#include <unistd.h>
+
+/**
+ * report_prefixes: paths of the LdPreloadedPosix and PosixPassthrough statistics reports (without
+ * the process identifier), written by PADLL at process exit.
+ */
+const char* const report_prefixes[] { "/tmp/padll-ldpreloaded-stats-",
+    "/tmp/padll-passthrough-stats-" };
+
+/**
+ * ReportRow struct: row of the statistics table of a report (syscall calls errors bypassed bytes).
+ */
+struct ReportRow {
+    std::string m_name {};
+    uint64_t m_calls { 0 };
+    uint64_t m_errors { 0 };
+    uint64_t m_bypassed { 0 };
+    uint64_t m_bytes { 0 };
+};
+
+/**
+ * sum_report_rows: sum a field over the rows of a given call in the statistics reports of a
+ * process (both LdPreloadedPosix and PosixPassthrough reports).
+ * @param pid Process identifier of the reports.
+ * @param call Name of the call.
+ * @param field Function that selects the field of a row.
+ * @return Returns the sum of the field.
+ */
+template <typename Field>
+uint64_t sum_report_rows (const pid_t& pid, const std::string& call, const Field& field)
+{
+    uint64_t sum = 0;
+
+    for (const auto* prefix : report_prefixes) {
+        std::ifstream report (prefix + std::to_string (pid) + ".stat");
+        std::string line;
+
+        while (std::getline (report, line)) {
+            std::istringstream stream (line);
+            ReportRow row {};
+            if (stream >> row.m_name >> row.m_calls >> row.m_errors >> row.m_bypassed
+                && row.m_name == call) {
+                stream >> row.m_bytes;
+                sum += field (row);
+            }
+        }
+    }
+
+    return sum;
+}
+
+/**
+ * count_calls: count the operations of a given call in the statistics reports of a process (calls
+ * and bypassed calls).
+ * @param pid Process identifier of the reports.
+ * @param call Name of the call.
+ * @return Returns the number of operations.
+ */
+inline uint64_t count_calls (const pid_t& pid, const std::string& call)
+{
+    return sum_report_rows (pid, call, [] (const ReportRow& row) {
+        return row.m_calls + row.m_bypassed;
+    });
+}
+
+/**
+ * count_bytes: get the bytes of a given call in the statistics reports of a process.
+ * @param pid Process identifier of the reports.
+ * @param call Name of the call.
+ * @return Returns the number of bytes.
+ */
+inline uint64_t count_bytes (const pid_t& pid, const std::string& call)
+{
+    return sum_report_rows (pid, call, [] (const ReportRow& row) { return row.m_bytes; });
+}
+
+/**
+ * remove_reports: remove the statistics reports of a process.
+ * @param pid Process identifier of the reports.
+ */
+inline void remove_reports (const pid_t& pid)
+{
+    for (const auto* prefix : report_prefixes) {
+        ::unlink ((prefix + std::to_string (pid) + ".stat").c_str ());
+    }
+}
+
+/**
+ * write_configuration: write the PADLL configuration of a child process, which intercepts the
+ * calls validated by a test (regardless of the default intercept mask) and collects statistics.
+ * @param path Path of the configuration file.
+ * @param intercept Comma-separated list of the calls to be intercepted.
+ * @return Returns true if the file was written.
+ */
+inline bool write_configuration (const std::string& path, const std::string& intercept)
+{
+    std::ofstream configuration (path);
+    configuration << "intercept = " << intercept << "\n";
+    configuration << "statistic_collection = true\n";
+
+    return configuration.good ();
+}
+
+#endif // PADLL_POSIX_TEST_UTILS_HPP
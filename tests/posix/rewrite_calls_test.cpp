@@ -0,0 +1,196 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "posix_test_utils.hpp"
+
+// exit code of the child when the system call instructions could not be rewritten
+constexpr int kSkipped { 77 };
+
+// calls intercepted by the child process, validated by the test
+constexpr const char* intercepted_calls {
+    "open, open_variadic, openat, openat_variadic, read, write, pread64, fsync, close" };
+
+/**
+ * is_loaded: check if libpadll.so was loaded (by libpadll_loader.so) in the calling process.
+ * @return Returns true if libpadll.so is mapped.
+ */
+bool is_loaded ()
+{
+    std::ifstream maps ("/proc/self/maps");
+    std::string line;
+    while (std::getline (maps, line)) {
+        if (line.find ("libpadll.so") != std::string::npos) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * libc_workload: issue open, write, fsync, pread, and close calls over a file, and read and write
+ * calls over a pipe, through libc (which is not interposed), and validate their results and errno.
+ * Runs in a process where PADLL was loaded through libpadll_loader.so.
+ * @param pathname Path of the file.
+ * @param iterations Number of times each call is issued.
+ * @return Returns the number of failed checks, or kSkipped if the calls cannot be rewritten.
+ */
+int libc_workload (const std::string& pathname, const int& iterations)
+{
+#if !defined(__x86_64__)
+    return kSkipped;
+#endif
+
+    if (!is_loaded ()) {
+        return kSkipped;
+    }
+
+    int errors = 0;
+    std::vector<char> source (4096, 'r');
+    std::vector<char> destination (source.size (), 0);
+
+    for (int i = 0; i < iterations; i++) {
+        int fd = ::open (pathname.c_str (), O_CREAT | O_TRUNC | O_RDWR, 0644);
+        errors += (fd >= 0) ? 0 : 1;
+
+        errors += (::write (fd, source.data (), source.size ())
+                      == static_cast<ssize_t> (source.size ()))
+            ? 0
+            : 1;
+        errors += (::fsync (fd) == 0) ? 0 : 1;
+
+        std::memset (destination.data (), 0, destination.size ());
+        errors += (::pread (fd, destination.data (), destination.size (), 0)
+                      == static_cast<ssize_t> (destination.size ()))
+            ? 0
+            : 1;
+        errors += (source == destination) ? 0 : 1;
+        errors += (::close (fd) == 0) ? 0 : 1;
+    }
+
+    // errors are reported through errno, as without PADLL
+    errno = 0;
+    std::string missing { pathname + "-missing" };
+    errors += (::open (missing.c_str (), O_RDONLY) == -1 && errno == ENOENT) ? 0 : 1;
+    errno = 0;
+    errors += (::close (1 << 20) == -1 && errno == EBADF) ? 0 : 1;
+
+    // calls over untracked file descriptors (e.g., pipes) are performed as is
+    int pipe_fds[2];
+    errors += (::pipe (pipe_fds) == 0) ? 0 : 1;
+    errors += (::write (pipe_fds[1], source.data (), 64) == 64) ? 0 : 1;
+    errors += (::read (pipe_fds[0], destination.data (), 64) == 64) ? 0 : 1;
+    ::close (pipe_fds[0]);
+    ::close (pipe_fds[1]);
+
+    return errors;
+}
+
+/**
+ * test_rewrite_calls:
+ *
+ * Validation: libc calls of a program that does not interpose libc should reach PADLL through the
+ * rewritten system call instructions, and be accounted in the statistic entries of their system
+ * calls ('openat_variadic', 'write', 'pread64', 'fsync', and 'close'), completing as without
+ * PADLL. The workload runs in a child process, re-executed with libpadll_loader.so preloaded.
+ * @param program Path of the test's executable.
+ * @param loader Path of libpadll_loader.so.
+ * @param pathname Path of the file.
+ * @param iterations Number of times each call is issued.
+ * @return Returns the number of failed checks, or -1 if binary rewriting is not supported.
+ */
+int test_rewrite_calls (const std::string& program,
+    const std::string& loader,
+    const std::string& pathname,
+    const int& iterations)
+{
+    std::cout << "Test rewritten calls (" << pathname << ")\n";
+    int errors = 0;
+
+    std::string configuration { pathname + ".conf" };
+    if (!write_configuration (configuration, intercepted_calls)) {
+        std::cerr << "Error while writing configuration (" << configuration << ")\n";
+        return 1;
+    }
+
+    std::cout.flush ();
+    pid_t pid = ::fork ();
+    if (pid == 0) {
+        ::setenv ("padll_config", configuration.c_str (), 1);
+        ::setenv ("LD_PRELOAD", loader.c_str (), 1);
+        ::execl (program.c_str (), program.c_str (), "--workload", pathname.c_str (), nullptr);
+        std::exit (1);
+    }
+
+    int status = 0;
+    ::waitpid (pid, &status, 0);
+    ::unlink (configuration.c_str ());
+    if (WIFEXITED (status) && WEXITSTATUS (status) == kSkipped) {
+        return -1;
+    }
+    errors += (WIFEXITED (status) && WEXITSTATUS (status) == 0) ? 0 : 1;
+
+    for (const auto* call : { "openat_variadic", "write", "pread64", "fsync", "close" }) {
+        auto operations = count_calls (pid, call);
+        if (operations < static_cast<uint64_t> (iterations)) {
+            std::cerr << "Rewritten call not accounted: " << call << " (" << operations << ")\n";
+            errors++;
+        }
+    }
+
+    remove_reports (pid);
+
+    if (errors > 0) {
+        std::cerr << "Error in rewritten calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    constexpr int iterations = 16;
+
+    // child process, with libpadll_loader.so preloaded
+    if (argc > 2 && std::string { argv[1] } == "--workload") {
+        return libc_workload (argv[2], iterations);
+    }
+
+    std::string dirpath { "/tmp" };
+    if (argc > 1) {
+        dirpath = argv[1];
+    }
+
+    std::string loader { "libpadll_loader.so" };
+    if (argc > 2) {
+        loader = argv[2];
+    }
+
+    std::string pathname { dirpath + "/padll-rewrite-file" };
+
+    int errors = test_rewrite_calls ("/proc/self/exe", loader, pathname, iterations);
+    ::unlink (pathname.c_str ());
+
+    // binary rewriting may be unsupported (e.g., architecture, or PADLL could not be loaded)
+    if (errors < 0) {
+        std::cout << "Rewrite calls test: skipped (binary rewriting not supported)\n";
+        return 0;
+    }
+
+    std::cout << "Rewrite calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,269 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "posix_test_utils.hpp"
+
+// exit code of the child when the seccomp filter could not be installed
+constexpr int kSkipped { 77 };
+
+// calls intercepted by the child process, validated by the test
+constexpr const char* intercepted_calls {
+    "open, open_variadic, openat, openat_variadic, read, write, pread64, fsync, close" };
+
+/**
+ * raw_syscall: issue a system call without going through libc (as statically linked programs and
+ * the Go runtime do), so it is only visible to PADLL through the seccomp filter.
+ * @param number
+ * @param arg0
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @return Returns the result of the call (negative error numbers on error).
+ */
+long raw_syscall (long number, long arg0 = 0, long arg1 = 0, long arg2 = 0, long arg3 = 0)
+{
+#if defined(__x86_64__)
+    long result;
+    register long r10 asm ("r10") = arg3;
+    asm volatile ("syscall"
+                  : "=a"(result)
+                  : "a"(number), "D"(arg0), "S"(arg1), "d"(arg2), "r"(r10)
+                  : "rcx", "r11", "memory");
+    return result;
+#elif defined(__aarch64__)
+    register long x8 asm ("x8") = number;
+    register long x0 asm ("x0") = arg0;
+    register long x1 asm ("x1") = arg1;
+    register long x2 asm ("x2") = arg2;
+    register long x3 asm ("x3") = arg3;
+    asm volatile ("svc 0" : "+r"(x0) : "r"(x8), "r"(x1), "r"(x2), "r"(x3) : "memory");
+    return x0;
+#else
+    return ::syscall (number, arg0, arg1, arg2, arg3);
+#endif
+}
+
+/**
+ * through_libc: whether the workload issues its system calls through libc's syscall (which PADLL
+ * interposes) instead of issuing them directly.
+ */
+bool through_libc = false;
+
+/**
+ * issue_syscall: issue a system call of the workload, either directly (raw_syscall) or through
+ * libc's syscall (see through_libc).
+ * @param number
+ * @param arg0
+ * @param arg1
+ * @param arg2
+ * @param arg3
+ * @return Returns the result of the call (negative error numbers on error).
+ */
+long issue_syscall (long number, long arg0 = 0, long arg1 = 0, long arg2 = 0, long arg3 = 0)
+{
+    if (!through_libc) {
+        return raw_syscall (number, arg0, arg1, arg2, arg3);
+    }
+
+    auto result = ::syscall (number, arg0, arg1, arg2, arg3);
+    return (result == -1) ? -errno : result;
+}
+
+/**
+ * is_filtered: check if a seccomp filter is installed in the calling thread.
+ * @return Returns true if the thread is in seccomp filter mode.
+ */
+bool is_filtered ()
+{
+    std::ifstream status ("/proc/self/status");
+    std::string line;
+    while (std::getline (status, line)) {
+        if (line.rfind ("Seccomp:", 0) == 0) {
+            return line.find ('2') != std::string::npos;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * raw_workload: issue raw openat, write, pread64, fsync, and close calls over a file, and raw
+ * read and write calls over a pipe (which are performed by the calling thread), and validate
+ * their results. Runs in a process where seccomp interception is enabled. Calls are issued
+ * directly, or through libc's syscall (see through_libc).
+ * @param pathname Path of the file.
+ * @param iterations Number of times each call is issued.
+ * @return Returns the number of failed checks, or kSkipped if the filter is not installed.
+ */
+int raw_workload (const std::string& pathname, const int& iterations)
+{
+    if (!is_filtered ()) {
+        return kSkipped;
+    }
+
+    int errors = 0;
+    std::vector<char> source (4096, 'p');
+    std::vector<char> destination (source.size (), 0);
+
+    for (int i = 0; i < iterations; i++) {
+        long fd = issue_syscall (SYS_openat,
+            AT_FDCWD,
+            reinterpret_cast<long> (pathname.c_str ()),
+            O_CREAT | O_TRUNC | O_RDWR,
+            0644);
+        errors += (fd >= 0) ? 0 : 1;
+
+        errors += (issue_syscall (SYS_write,
+                       fd,
+                       reinterpret_cast<long> (source.data ()),
+                       static_cast<long> (source.size ()))
+                      == static_cast<long> (source.size ()))
+            ? 0
+            : 1;
+        errors += (issue_syscall (SYS_fsync, fd) == 0) ? 0 : 1;
+
+        std::memset (destination.data (), 0, destination.size ());
+        errors += (issue_syscall (SYS_pread64,
+                       fd,
+                       reinterpret_cast<long> (destination.data ()),
+                       static_cast<long> (destination.size ()),
+                       0)
+                      == static_cast<long> (destination.size ()))
+            ? 0
+            : 1;
+        errors += (source == destination) ? 0 : 1;
+        errors += (issue_syscall (SYS_close, fd) == 0) ? 0 : 1;
+    }
+
+    // errors are returned as negative error numbers
+    errors += (issue_syscall (SYS_close, 1 << 20) == -EBADF) ? 0 : 1;
+
+    // calls over untracked file descriptors (e.g., pipes) are performed by the calling thread
+    int pipe_fds[2];
+    errors += (::pipe (pipe_fds) == 0) ? 0 : 1;
+    auto written
+        = issue_syscall (SYS_write, pipe_fds[1], reinterpret_cast<long> (source.data ()), 64);
+    errors += (written == 64) ? 0 : 1;
+    auto read
+        = issue_syscall (SYS_read, pipe_fds[0], reinterpret_cast<long> (destination.data ()), 64);
+    errors += (read == 64) ? 0 : 1;
+    ::close (pipe_fds[0]);
+    ::close (pipe_fds[1]);
+
+    return errors;
+}
+
+/**
+ * test_seccomp_calls:
+ *
+ * Validation: system calls issued without going through libc should be trapped by the seccomp
+ * filter and accounted in the statistic entries of the same calls issued through libc
+ * ('openat_variadic', 'write', 'pread64', 'fsync', and 'close'), completing as without PADLL.
+ * The workload runs in a child process, re-executed with seccomp interception enabled. Calls
+ * issued through libc's syscall (e.g., syscall (SYS_openat, ...)) must be accounted as well, since
+ * libc's own system call instructions are not trapped.
+ * @param program Path of the test's executable.
+ * @param mode Workload of the child ("--workload" for raw calls, "--libc-workload" for calls
+ * through libc's syscall).
+ * @param pathname Path of the file.
+ * @param iterations Number of times each call is issued.
+ * @return Returns the number of failed checks, or -1 if seccomp interception is not supported.
+ */
+int test_seccomp_calls (const std::string& program,
+    const std::string& mode,
+    const std::string& pathname,
+    const int& iterations)
+{
+    std::cout << "Test seccomp-trapped calls (" << pathname << ", " << mode << ")\n";
+    int errors = 0;
+
+    std::string configuration { pathname + ".conf" };
+    if (!write_configuration (configuration, intercepted_calls)) {
+        std::cerr << "Error while writing configuration (" << configuration << ")\n";
+        return 1;
+    }
+
+    std::cout.flush ();
+    pid_t pid = ::fork ();
+    if (pid == 0) {
+        ::setenv ("padll_config", configuration.c_str (), 1);
+        ::setenv ("padll_seccomp_interception", "true", 1);
+        ::execl (program.c_str (), program.c_str (), mode.c_str (), pathname.c_str (), nullptr);
+        std::exit (1);
+    }
+
+    int status = 0;
+    ::waitpid (pid, &status, 0);
+    ::unlink (configuration.c_str ());
+    if (WIFEXITED (status) && WEXITSTATUS (status) == kSkipped) {
+        return -1;
+    }
+    errors += (WIFEXITED (status) && WEXITSTATUS (status) == 0) ? 0 : 1;
+
+    for (const auto* call : { "openat_variadic", "write", "pread64", "fsync", "close" }) {
+        auto operations = count_calls (pid, call);
+        if (operations < static_cast<uint64_t> (iterations)) {
+            std::cerr << "Trapped call not accounted: " << call << " (" << operations << ")\n";
+            errors++;
+        }
+    }
+
+    remove_reports (pid);
+
+    if (errors > 0) {
+        std::cerr << "Error in seccomp-trapped calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    constexpr int iterations = 16;
+
+    // child process, with seccomp interception enabled
+    if (argc > 2 && std::string { argv[1] } == "--workload") {
+        return raw_workload (argv[2], iterations);
+    }
+    if (argc > 2 && std::string { argv[1] } == "--libc-workload") {
+        through_libc = true;
+        return raw_workload (argv[2], iterations);
+    }
+
+    std::string dirpath { "/tmp" };
+    if (argc > 1) {
+        dirpath = argv[1];
+    }
+
+    std::string pathname { dirpath + "/padll-seccomp-file" };
+
+    int errors = test_seccomp_calls ("/proc/self/exe", "--workload", pathname, iterations);
+    if (errors >= 0) {
+        errors += test_seccomp_calls ("/proc/self/exe", "--libc-workload", pathname, iterations);
+    }
+    ::unlink (pathname.c_str ());
+
+    // seccomp interception may be unsupported (e.g., architecture, kernel, or sandboxing)
+    if (errors < 0) {
+        std::cout << "Seccomp calls test: skipped (seccomp interception not supported)\n";
+        return 0;
+    }
+
+    std::cout << "Seccomp calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
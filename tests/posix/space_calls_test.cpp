@@ -0,0 +1,83 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * file_size: get the size of a file through its file descriptor.
+ * @param fd
+ * @return Returns the size of the file, or -1 if fstat failed.
+ */
+off_t file_size (const int& fd)
+{
+    struct stat statbuf {};
+    return (::fstat (fd, &statbuf) == 0) ? statbuf.st_size : -1;
+}
+
+/**
+ * test_space_calls:
+ *
+ * Validation: the statistic entries 'truncate', 'ftruncate', 'fallocate', 'posix_fallocate', and
+ * 'posix_fadvise' of the Statistics' container reserved for metadata-based calls should be
+ * updated; the bytes of 'posix_fadvise' should account the length of POSIX_FADV_WILLNEED hints.
+ * @param pathname
+ * @param size Size (in bytes) of the preallocations.
+ * @return Returns the number of failed checks.
+ */
+int test_space_calls (const char* pathname, const off_t& size)
+{
+    std::cout << "Test truncate, ftruncate, fallocate, posix_fallocate, and posix_fadvise calls ("
+              << pathname << ")\n";
+    int errors = 0;
+
+    int fd = ::open (pathname, O_CREAT | O_TRUNC | O_RDWR, 0666);
+    if (fd < 0) {
+        std::cerr << "Error while opening file (" << errno << ")\n";
+        return 1;
+    }
+
+    errors += (::ftruncate (fd, size) == 0 && file_size (fd) == size) ? 0 : 1;
+    errors += (::truncate (pathname, size / 2) == 0 && file_size (fd) == size / 2) ? 0 : 1;
+
+    // fallocate may not be supported by the underlying file system (e.g., tmpfs on older kernels)
+    int result = ::fallocate (fd, 0, 0, size);
+    errors += (result == 0 ? file_size (fd) == size : errno == EOPNOTSUPP) ? 0 : 1;
+
+    errors += (::posix_fallocate (fd, 0, 2 * size) == 0 && file_size (fd) == 2 * size) ? 0 : 1;
+    errors += (::posix_fadvise (fd, 0, size, POSIX_FADV_WILLNEED) == 0) ? 0 : 1;
+    errors += (::posix_fadvise (fd, 0, 0, POSIX_FADV_SEQUENTIAL) == 0) ? 0 : 1;
+
+    // posix_fallocate and posix_fadvise return the error number (instead of setting errno)
+    errors += (::posix_fallocate (-1, 0, size) == EBADF) ? 0 : 1;
+    errors += (::posix_fadvise (-1, 0, size, POSIX_FADV_WILLNEED) == EBADF) ? 0 : 1;
+    errors += (::ftruncate (-1, size) == -1 && errno == EBADF) ? 0 : 1;
+
+    ::close (fd);
+
+    if (errors > 0) {
+        std::cerr << "Error in space management calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    std::string path { "/tmp/padll-space-test" };
+    if (argc > 1) {
+        path = argv[1];
+    }
+
+    int errors = test_space_calls (path.c_str (), 4 * 1024 * 1024);
+    ::unlink (path.c_str ());
+
+    std::cout << "Space calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
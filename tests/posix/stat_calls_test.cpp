@@ -0,0 +1,236 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <chrono>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// versioned stat entry points of glibc, no longer declared since glibc 2.33 (defined by PADLL)
+#ifndef _STAT_VER
+#define _STAT_VER 1
+extern "C" {
+int __xstat (int version, const char* path, struct stat* statbuf);
+int __lxstat (int version, const char* path, struct stat* statbuf);
+int __fxstat (int version, int fd, struct stat* statbuf);
+int __fxstatat (int version, int dirfd, const char* path, struct stat* statbuf, int flags);
+int __xstat64 (int version, const char* path, struct stat64* statbuf);
+int __lxstat64 (int version, const char* path, struct stat64* statbuf);
+int __fxstat64 (int version, int fd, struct stat64* statbuf);
+int __fxstatat64 (int version, int dirfd, const char* path, struct stat64* statbuf, int flags);
+}
+#endif
+
+/**
+ * test_stat_calls:
+ *
+ * Validation: the statistic entries 'stat', 'lstat', 'fstat', 'fstatat', 'statx', 'stat64',
+ * 'lstat64', 'fstat64', and 'fstatat64' of the Statistics' container reserved for metadata-based
+ * calls should be updated; all calls must report the same file size.
+ * @param dirpath Directory where the file is created.
+ * @param filename Name of the file (relative to dirpath).
+ * @return Returns the number of failed checks.
+ */
+int test_stat_calls (const std::string& dirpath, const std::string& filename)
+{
+    std::string pathname { dirpath + "/" + filename };
+    std::cout << "Test stat family calls (" << pathname << ")\n";
+    int errors = 0;
+
+    int fd = ::open (pathname.c_str (), O_CREAT | O_TRUNC | O_RDWR, 0666);
+    int dirfd = ::open (dirpath.c_str (), O_RDONLY | O_DIRECTORY);
+    if (fd < 0 || dirfd < 0) {
+        std::cerr << "Error while opening file or directory (" << errno << ")\n";
+        return 1;
+    }
+
+    std::string content { "padll stat family test" };
+    auto size = static_cast<off_t> (content.size ());
+    errors += (::write (fd, content.data (), content.size ()) == size) ? 0 : 1;
+
+    struct stat statbuf {};
+    errors += (::stat (pathname.c_str (), &statbuf) == 0 && statbuf.st_size == size) ? 0 : 1;
+    errors += (::lstat (pathname.c_str (), &statbuf) == 0 && statbuf.st_size == size) ? 0 : 1;
+    errors += (::fstat (fd, &statbuf) == 0 && statbuf.st_size == size) ? 0 : 1;
+    errors += (::fstatat (dirfd, filename.c_str (), &statbuf, 0) == 0 && statbuf.st_size == size)
+        ? 0
+        : 1;
+    errors += (::fstatat (fd, "", &statbuf, AT_EMPTY_PATH) == 0 && statbuf.st_size == size) ? 0
+                                                                                             : 1;
+
+    struct stat64 statbuf64 {};
+    errors += (::stat64 (pathname.c_str (), &statbuf64) == 0 && statbuf64.st_size == size) ? 0 : 1;
+    errors += (::lstat64 (pathname.c_str (), &statbuf64) == 0 && statbuf64.st_size == size) ? 0
+                                                                                            : 1;
+    errors += (::fstat64 (fd, &statbuf64) == 0 && statbuf64.st_size == size) ? 0 : 1;
+    errors += (::fstatat64 (dirfd, filename.c_str (), &statbuf64, 0) == 0
+                  && statbuf64.st_size == size)
+        ? 0
+        : 1;
+
+    struct statx statxbuf {};
+    errors += (::statx (dirfd, filename.c_str (), 0, STATX_SIZE, &statxbuf) == 0
+                  && statxbuf.stx_size == static_cast<uint64_t> (size))
+        ? 0
+        : 1;
+
+    // inexistent files must fail with ENOENT
+    errors += (::stat ((pathname + "-none").c_str (), &statbuf) == -1 && errno == ENOENT) ? 0 : 1;
+
+    ::close (dirfd);
+    ::close (fd);
+
+    if (errors > 0) {
+        std::cerr << "Error in stat family calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+/**
+ * test_versioned_stat_calls:
+ *
+ * Validation: the versioned entry points called by binaries built against glibc < 2.33
+ * ('__xstat', '__lxstat', '__fxstat', '__fxstatat', and their 64-bit variants) should update the
+ * statistic entries of their base calls ('stat', 'lstat', 'fstat', 'fstatat', 'stat64', ...) of
+ * the Statistics' container reserved for metadata-based calls; all calls must report the same file
+ * size.
+ * @param dirpath Directory where the file is created.
+ * @param filename Name of the file (relative to dirpath).
+ * @return Returns the number of failed checks.
+ */
+int test_versioned_stat_calls (const std::string& dirpath, const std::string& filename)
+{
+    std::string pathname { dirpath + "/" + filename };
+    std::cout << "Test versioned stat calls (" << pathname << ")\n";
+    int errors = 0;
+
+    int fd = ::open (pathname.c_str (), O_CREAT | O_TRUNC | O_RDWR, 0666);
+    int dirfd = ::open (dirpath.c_str (), O_RDONLY | O_DIRECTORY);
+    if (fd < 0 || dirfd < 0) {
+        std::cerr << "Error while opening file or directory (" << errno << ")\n";
+        return 1;
+    }
+
+    std::string content { "padll versioned stat test" };
+    auto size = static_cast<off_t> (content.size ());
+    errors += (::write (fd, content.data (), content.size ()) == size) ? 0 : 1;
+
+    struct stat statbuf {};
+    errors += (__xstat (_STAT_VER, pathname.c_str (), &statbuf) == 0 && statbuf.st_size == size)
+        ? 0
+        : 1;
+    errors += (__lxstat (_STAT_VER, pathname.c_str (), &statbuf) == 0 && statbuf.st_size == size)
+        ? 0
+        : 1;
+    errors += (__fxstat (_STAT_VER, fd, &statbuf) == 0 && statbuf.st_size == size) ? 0 : 1;
+    errors += (__fxstatat (_STAT_VER, dirfd, filename.c_str (), &statbuf, 0) == 0
+                  && statbuf.st_size == size)
+        ? 0
+        : 1;
+
+    struct stat64 statbuf64 {};
+    errors += (__xstat64 (_STAT_VER, pathname.c_str (), &statbuf64) == 0
+                  && statbuf64.st_size == size)
+        ? 0
+        : 1;
+    errors += (__lxstat64 (_STAT_VER, pathname.c_str (), &statbuf64) == 0
+                  && statbuf64.st_size == size)
+        ? 0
+        : 1;
+    errors += (__fxstat64 (_STAT_VER, fd, &statbuf64) == 0 && statbuf64.st_size == size) ? 0 : 1;
+    errors += (__fxstatat64 (_STAT_VER, dirfd, filename.c_str (), &statbuf64, 0) == 0
+                  && statbuf64.st_size == size)
+        ? 0
+        : 1;
+
+    // inexistent files must fail with ENOENT
+    auto missing = pathname + "-none";
+    errors += (__xstat (_STAT_VER, missing.c_str (), &statbuf) == -1 && errno == ENOENT) ? 0 : 1;
+
+    ::close (dirfd);
+    ::close (fd);
+
+    if (errors > 0) {
+        std::cerr << "Error in versioned stat calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+/**
+ * test_access_calls:
+ *
+ * Validation: the statistic entries 'access' and 'faccessat' of the Statistics' container
+ * reserved for metadata-based calls should be updated.
+ * @param dirpath Directory where the file is created.
+ * @param filename Name of the file (relative to dirpath).
+ * @return Returns the number of failed checks.
+ */
+int test_access_calls (const std::string& dirpath, const std::string& filename)
+{
+    std::string pathname { dirpath + "/" + filename };
+    std::cout << "Test access and faccessat calls (" << pathname << ")\n";
+    int errors = 0;
+
+    int dirfd = ::open (dirpath.c_str (), O_RDONLY | O_DIRECTORY);
+    errors += (::access (pathname.c_str (), R_OK | W_OK) == 0) ? 0 : 1;
+    errors += (::access ((pathname + "-none").c_str (), F_OK) == -1) ? 0 : 1;
+    errors += (::faccessat (dirfd, filename.c_str (), F_OK, 0) == 0) ? 0 : 1;
+    ::close (dirfd);
+
+    if (errors > 0) {
+        std::cerr << "Error in access calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+/**
+ * test_stat_performance: measure the cost of a stat call (stat storms, such as the ones generated
+ * by module imports or build tools, are far more frequent than open calls).
+ * @param pathname
+ * @param iterations Number of stat calls.
+ * @return Returns the number of failed calls.
+ */
+int test_stat_performance (const std::string& pathname, const int& iterations)
+{
+    int errors = 0;
+    struct stat statbuf {};
+
+    auto start = std::chrono::high_resolution_clock::now ();
+    for (int i = 0; i < iterations; i++) {
+        errors += (::stat (pathname.c_str (), &statbuf) == 0) ? 0 : 1;
+    }
+    auto end = std::chrono::high_resolution_clock::now ();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds> (end - start).count ();
+    std::cout << "Test stat performance: " << iterations << " calls, "
+              << (static_cast<double> (elapsed) / iterations) << " ns/call\n";
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    std::string dirpath { "/tmp" };
+    std::string filename { "padll-stat-test" };
+
+    if (argc > 1) {
+        dirpath = argv[1];
+    }
+
+    int errors = test_stat_calls (dirpath, filename);
+    errors += test_versioned_stat_calls (dirpath, filename);
+    errors += test_access_calls (dirpath, filename);
+    errors += test_stat_performance (dirpath + "/" + filename, 100000);
+    ::unlink ((dirpath + "/" + filename).c_str ());
+
+    std::cout << "Stat calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+/**
+ * test_stream_write_calls:
+ *
+ * Validation: the statistic entries 'fwrite', 'fputs', 'fprintf', and 'fflush' of the Statistics'
+ * container reserved for data-based calls should be updated. Buffered calls are only charged when
+ * the stream's buffer is flushed (on fflush and fclose, or when it fills up).
+ * @param pathname
+ * @param lines Number of lines to be written with each call.
+ * @return Returns the number of failed checks.
+ */
+int test_stream_write_calls (const char* pathname, const int& lines)
+{
+    std::cout << "Test fwrite, fputs, fprintf, and fflush calls (" << pathname << ")\n";
+    int errors = 0;
+
+    FILE* stream = std::fopen (pathname, "w");
+    if (stream == nullptr) {
+        std::cerr << "Error while opening file (" << errno << ")\n";
+        return 1;
+    }
+
+    std::string line { "fwrite line\n" };
+    for (int i = 0; i < lines; i++) {
+        errors += (std::fwrite (line.data (), 1, line.size (), stream) == line.size ()) ? 0 : 1;
+        errors += (std::fputs ("fputs line\n", stream) >= 0) ? 0 : 1;
+        errors += (std::fprintf (stream, "fprintf line %d\n", i) > 0) ? 0 : 1;
+    }
+
+    errors += (std::fflush (stream) == 0) ? 0 : 1;
+    errors += (std::fputs ("last line (flushed by fclose)\n", stream) >= 0) ? 0 : 1;
+    errors += (std::fclose (stream) == 0) ? 0 : 1;
+
+    if (errors > 0) {
+        std::cerr << "Error in stream write calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+/**
+ * test_stream_read_calls:
+ *
+ * Validation: the statistic entries 'fread' and 'fgets' of the Statistics' container reserved for
+ * data-based calls should be updated. Buffered calls are only charged when the stream's buffer is
+ * refilled from the file.
+ * @param pathname
+ * @param lines Number of lines written by test_stream_write_calls.
+ * @return Returns the number of failed checks.
+ */
+int test_stream_read_calls (const char* pathname, const int& lines)
+{
+    std::cout << "Test fread and fgets calls (" << pathname << ")\n";
+    int errors = 0;
+    char buffer[128];
+
+    FILE* stream = std::fopen (pathname, "r");
+    if (stream == nullptr) {
+        std::cerr << "Error while opening file (" << errno << ")\n";
+        return 1;
+    }
+
+    for (int i = 0; i < lines; i++) {
+        std::string expected { "fwrite line\n" };
+        errors += (std::fread (buffer, 1, expected.size (), stream) == expected.size ()
+                      && std::memcmp (buffer, expected.data (), expected.size ()) == 0)
+            ? 0
+            : 1;
+
+        errors += (std::fgets (buffer, sizeof (buffer), stream) != nullptr
+                      && std::strcmp (buffer, "fputs line\n") == 0)
+            ? 0
+            : 1;
+
+        expected = "fprintf line " + std::to_string (i) + "\n";
+        errors += (std::fgets (buffer, sizeof (buffer), stream) != nullptr && expected == buffer)
+            ? 0
+            : 1;
+    }
+
+    errors += (std::fgets (buffer, sizeof (buffer), stream) != nullptr
+                  && std::strcmp (buffer, "last line (flushed by fclose)\n") == 0)
+        ? 0
+        : 1;
+    errors += (std::fgets (buffer, sizeof (buffer), stream) == nullptr) ? 0 : 1;
+    std::fclose (stream);
+
+    if (errors > 0) {
+        std::cerr << "Error in stream read calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    std::string path { "/tmp/padll-stream-test" };
+    int lines = 10000;
+
+    if (argc > 1) {
+        path = argv[1];
+    }
+
+    int errors = test_stream_write_calls (path.c_str (), lines);
+    errors += test_stream_read_calls (path.c_str (), lines);
+    ::unlink (path.c_str ());
+
+    std::cout << "Stream calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
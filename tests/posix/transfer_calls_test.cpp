@@ -0,0 +1,146 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <sys/sendfile.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * create_file: create a file filled with a known pattern.
+ * @param pathname
+ * @param size Size of the file (in bytes).
+ * @return Returns the number of failed checks.
+ */
+int create_file (const std::string& pathname, const size_t& size)
+{
+    std::vector<char> content (size);
+    for (size_t i = 0; i < size; i++) {
+        content[i] = static_cast<char> ('a' + (i % 26));
+    }
+
+    int fd = ::open (pathname.c_str (), O_CREAT | O_TRUNC | O_WRONLY, 0666);
+    if (fd < 0) {
+        return 1;
+    }
+
+    auto result = ::write (fd, content.data (), content.size ());
+    ::close (fd);
+
+    return (result == static_cast<ssize_t> (size)) ? 0 : 1;
+}
+
+/**
+ * compare_files: compare the content of two files.
+ * @param source
+ * @param destination
+ * @return Returns 0 if both files have the same content, and 1 otherwise.
+ */
+int compare_files (const std::string& source, const std::string& destination)
+{
+    auto read_file = [] (const std::string& pathname) {
+        std::vector<char> content;
+        int fd = ::open (pathname.c_str (), O_RDONLY);
+        char buffer[65536];
+        ssize_t bytes;
+        while (fd >= 0 && (bytes = ::read (fd, buffer, sizeof (buffer))) > 0) {
+            content.insert (content.end (), buffer, buffer + bytes);
+        }
+        ::close (fd);
+        return content;
+    };
+
+    return (read_file (source) == read_file (destination)) ? 0 : 1;
+}
+
+/**
+ * test_transfer_calls:
+ *
+ * Validation: the statistic entries 'copy_file_range', 'sendfile', and 'splice' of the
+ * Statistics' container reserved for data-based calls should be updated, with the bytes
+ * transferred by each call; transfers larger than the enforcement chunk must be fully performed.
+ * @param source Path of the source file.
+ * @param destination Path of the destination file.
+ * @param size Size of the source file (in bytes).
+ * @return Returns the number of failed checks.
+ */
+int test_transfer_calls (const std::string& source,
+    const std::string& destination,
+    const size_t& size)
+{
+    std::cout << "Test copy_file_range, sendfile, and splice calls (" << source << ", "
+              << destination << ")\n";
+    int errors = create_file (source, size);
+    auto expected = static_cast<ssize_t> (size);
+
+    // copy_file_range (with explicit offsets)
+    int fd_in = ::open (source.c_str (), O_RDONLY);
+    int fd_out = ::open (destination.c_str (), O_CREAT | O_TRUNC | O_WRONLY, 0666);
+    off64_t off_in = 0;
+    off64_t off_out = 0;
+    errors += (::copy_file_range (fd_in, &off_in, fd_out, &off_out, size, 0) == expected) ? 0 : 1;
+    errors += (off_in == expected && off_out == expected) ? 0 : 1;
+    ::close (fd_out);
+    errors += compare_files (source, destination);
+
+    // sendfile (from the file offset of the source)
+    fd_out = ::open (destination.c_str (), O_CREAT | O_TRUNC | O_WRONLY, 0666);
+    ::lseek (fd_in, 0, SEEK_SET);
+    errors += (::sendfile (fd_out, fd_in, nullptr, size) == expected) ? 0 : 1;
+    ::close (fd_out);
+    errors += compare_files (source, destination);
+
+    // splice (from the source to a pipe, and from the pipe to the destination)
+    int pipe_fds[2];
+    errors += (::pipe (pipe_fds) == 0) ? 0 : 1;
+    fd_out = ::open (destination.c_str (), O_CREAT | O_TRUNC | O_WRONLY, 0666);
+    ::lseek (fd_in, 0, SEEK_SET);
+    ssize_t spliced = 0;
+    while (spliced < expected) {
+        auto bytes = ::splice (fd_in, nullptr, pipe_fds[1], nullptr, size - spliced, 0);
+        if (bytes <= 0) {
+            errors++;
+            break;
+        }
+        errors += (::splice (pipe_fds[0], nullptr, fd_out, nullptr, bytes, 0) == bytes) ? 0 : 1;
+        spliced += bytes;
+    }
+    ::close (pipe_fds[0]);
+    ::close (pipe_fds[1]);
+    ::close (fd_out);
+    errors += compare_files (source, destination);
+
+    // transfers over invalid file descriptors must fail
+    errors += (::sendfile (-1, fd_in, nullptr, size) == -1 && errno == EBADF) ? 0 : 1;
+    ::close (fd_in);
+
+    if (errors > 0) {
+        std::cerr << "Error in transfer calls (" << errors << ")\n";
+    }
+
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    std::string dirpath { "/tmp" };
+    if (argc > 1) {
+        dirpath = argv[1];
+    }
+
+    std::string source { dirpath + "/padll-transfer-source" };
+    std::string destination { dirpath + "/padll-transfer-destination" };
+
+    // larger than option_transfer_chunk_size, so that transfers are split in multiple chunks
+    int errors = test_transfer_calls (source, destination, 10 * 1024 * 1024 + 123);
+    ::unlink (source.c_str ());
+    ::unlink (destination.c_str ());
+
+    std::cout << "Transfer calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
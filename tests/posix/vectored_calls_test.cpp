@@ -0,0 +1,133 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <array>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/**
+ * build_iovec: split a buffer in three segments of different sizes.
+ * @param buffer Buffer to be split.
+ * @param size Size of the buffer.
+ * @return Returns the iovec array that covers the whole buffer.
+ */
+std::array<struct iovec, 3> build_iovec (char* buffer, size_t size)
+{
+    size_t first = size / 4;
+    size_t second = size / 2;
+
+    return { { { buffer, first },
+        { buffer + first, second },
+        { buffer + first + second, size - first - second } } };
+}
+
+/**
+ * test_writev_readv_call:
+ *
+ * Validation: the statistic entries 'writev' and 'readv' of the Statistics' container reserved
+ * for data-based calls should be updated, with the summed length of all segments.
+ * @param pathname
+ * @return Returns the number of failed checks.
+ */
+int test_writev_readv_call (const char* pathname)
+{
+    std::cout << "Test writev and readv calls (" << pathname << ")\n";
+    int errors = 0;
+    std::string message { "padll vectored I/O test: writev, readv, pwritev, preadv" };
+    std::string output (message.size (), '\0');
+
+    int fd = ::open (pathname, O_CREAT | O_TRUNC | O_RDWR, 0666);
+    if (fd < 0) {
+        std::cerr << "Error while opening file (" << errno << ")\n";
+        return 1;
+    }
+
+    auto segments = build_iovec (message.data (), message.size ());
+    ssize_t written = ::writev (fd, segments.data (), static_cast<int> (segments.size ()));
+    if (written != static_cast<ssize_t> (message.size ())) {
+        std::cerr << "Error in writev (" << written << ", " << errno << ")\n";
+        errors++;
+    }
+
+    ::lseek (fd, 0, SEEK_SET);
+    auto read_segments = build_iovec (output.data (), output.size ());
+    ssize_t read = ::readv (fd, read_segments.data (), static_cast<int> (read_segments.size ()));
+    if (read != static_cast<ssize_t> (message.size ()) || output != message) {
+        std::cerr << "Error in readv (" << read << ", " << errno << ")\n";
+        errors++;
+    }
+
+    ::close (fd);
+    return errors;
+}
+
+/**
+ * test_pwritev_preadv_call:
+ *
+ * Validation: the statistic entries 'pwritev', 'preadv', 'pwritev2', and 'preadv2' of the
+ * Statistics' container reserved for data-based calls should be updated.
+ * @param pathname
+ * @return Returns the number of failed checks.
+ */
+int test_pwritev_preadv_call (const char* pathname)
+{
+    std::cout << "Test pwritev, preadv, pwritev2, and preadv2 calls (" << pathname << ")\n";
+    int errors = 0;
+    std::string message { "positional vectored I/O" };
+    std::string output (message.size (), '\0');
+    off_t offset { 4096 };
+
+    int fd = ::open (pathname, O_CREAT | O_TRUNC | O_RDWR, 0666);
+    if (fd < 0) {
+        std::cerr << "Error while opening file (" << errno << ")\n";
+        return 1;
+    }
+
+    auto segments = build_iovec (message.data (), message.size ());
+    auto read_segments = build_iovec (output.data (), output.size ());
+    auto count = static_cast<int> (segments.size ());
+    auto expected = static_cast<ssize_t> (message.size ());
+
+    // pwritev and preadv
+    errors += (::pwritev (fd, segments.data (), count, offset) == expected) ? 0 : 1;
+    errors += (::preadv (fd, read_segments.data (), count, offset) == expected) ? 0 : 1;
+    errors += (output == message) ? 0 : 1;
+
+    // pwritev2 and preadv2 (without flags, at a different offset)
+    output.assign (message.size (), '\0');
+    errors += (::pwritev2 (fd, segments.data (), count, offset * 2, 0) == expected) ? 0 : 1;
+    errors += (::preadv2 (fd, read_segments.data (), count, offset * 2, 0) == expected) ? 0 : 1;
+    errors += (output == message) ? 0 : 1;
+
+    // positional calls do not move the file offset
+    errors += (::lseek (fd, 0, SEEK_CUR) == 0) ? 0 : 1;
+
+    if (errors > 0) {
+        std::cerr << "Error in positional vectored calls (" << errors << ")\n";
+    }
+
+    ::close (fd);
+    return errors;
+}
+
+int main (int argc, char** argv)
+{
+    std::string path { "/tmp/padll-vectored-test" };
+    if (argc > 1) {
+        path = argv[1];
+    }
+
+    int errors = test_writev_readv_call (path.c_str ());
+    errors += test_pwritev_preadv_call (path.c_str ());
+    ::unlink (path.c_str ());
+
+    std::cout << "Vectored calls test: errors: " << errors << "\n";
+
+    return (errors == 0) ? 0 : 1;
+}
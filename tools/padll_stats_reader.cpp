@@ -0,0 +1,192 @@
+/**
+ *   Written by Ricardo Macedo.
+ *   Copyright (c) 2021-2023 INESC TEC.
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <padll/options/options.hpp>
+#include <padll/statistics/statistics_export_layout.hpp>
+#include <string>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace padll::options;
+using namespace padll::stats;
+
+// Struct that stores a consistent copy of a snapshot of the ring.
+struct SnapshotCopy {
+    uint64_t m_snapshot_id;
+    uint64_t m_interval_ns;
+    std::vector<uint64_t> m_counters; // (operations, bytes, errors, bypassed) totals and deltas
+};
+
+/**
+ * map_region: map (read-only) the statistics region of a given process.
+ * @param path Path of the region.
+ * @return Returns a pointer to the region, or nullptr on error.
+ */
+const ExportRegion* map_region (const std::string& path)
+{
+    int fd = ::open (path.c_str (), O_RDONLY);
+    if (fd == -1) {
+        std::fprintf (stderr, "Error while opening %s: %s\n", path.c_str (), std::strerror (errno));
+        return nullptr;
+    }
+
+    void* address = ::mmap (nullptr, sizeof (ExportRegion), PROT_READ, MAP_SHARED, fd, 0);
+    ::close (fd);
+
+    if (address == MAP_FAILED) {
+        std::fprintf (stderr, "Error while mapping %s: %s\n", path.c_str (), std::strerror (errno));
+        return nullptr;
+    }
+
+    auto* region = static_cast<const ExportRegion*> (address);
+    if (region->m_magic != kExportMagic || region->m_version != kExportVersion
+        || region->m_region_size != sizeof (ExportRegion)) {
+        std::fprintf (stderr,
+            "Incompatible statistics region (version %u; expected %u).\n",
+            region->m_version,
+            kExportVersion);
+        ::munmap (address, sizeof (ExportRegion));
+        return nullptr;
+    }
+
+    return region;
+}
+
+/**
+ * read_latest_snapshot: copy the latest published snapshot, retrying while it is being written.
+ * @param region Mapped statistics region.
+ * @param snapshot Object to store the copy.
+ * @return Returns true if a snapshot was copied; false if none was published yet.
+ */
+bool read_latest_snapshot (const ExportRegion* region, SnapshotCopy* snapshot)
+{
+    auto num_entries = std::min<std::size_t> (region->m_num_entries, kExportMaxEntries);
+    snapshot->m_counters.resize (num_entries * 8);
+
+    while (true) {
+        auto published = region->m_published.load (std::memory_order_acquire);
+        if (published == 0) {
+            return false;
+        }
+
+        const auto& slot = region->m_ring[(published - 1) % kExportRingSize];
+        auto sequence = slot.m_sequence.load (std::memory_order_acquire);
+        if ((sequence & 1) != 0) {
+            continue;
+        }
+
+        snapshot->m_snapshot_id = slot.m_snapshot_id.load (std::memory_order_relaxed);
+        snapshot->m_interval_ns = slot.m_interval_ns.load (std::memory_order_relaxed);
+        for (std::size_t i = 0; i < num_entries; i++) {
+            auto* counters = &snapshot->m_counters[i * 8];
+            counters[0] = slot.m_totals[i].m_operations.load (std::memory_order_relaxed);
+            counters[1] = slot.m_totals[i].m_bytes.load (std::memory_order_relaxed);
+            counters[2] = slot.m_totals[i].m_errors.load (std::memory_order_relaxed);
+            counters[3] = slot.m_totals[i].m_bypassed.load (std::memory_order_relaxed);
+            counters[4] = slot.m_deltas[i].m_operations.load (std::memory_order_relaxed);
+            counters[5] = slot.m_deltas[i].m_bytes.load (std::memory_order_relaxed);
+            counters[6] = slot.m_deltas[i].m_errors.load (std::memory_order_relaxed);
+            counters[7] = slot.m_deltas[i].m_bypassed.load (std::memory_order_relaxed);
+        }
+
+        // validate that the slot was not overwritten during the copy
+        std::atomic_thread_fence (std::memory_order_acquire);
+        if (slot.m_sequence.load (std::memory_order_relaxed) == sequence) {
+            return true;
+        }
+    }
+}
+
+/**
+ * print_snapshot: print the per-call totals and rates of a snapshot (only non-zero entries).
+ * @param region Mapped statistics region.
+ * @param snapshot Snapshot to be printed.
+ */
+void print_snapshot (const ExportRegion* region, const SnapshotCopy& snapshot)
+{
+    double seconds = static_cast<double> (snapshot.m_interval_ns) / 1e9;
+
+    std::fprintf (stdout,
+        "\n[pid %u] snapshot %" PRIu64 " (interval %.3f s)\n",
+        region->m_pid,
+        snapshot.m_snapshot_id,
+        seconds);
+    std::fprintf (stdout,
+        "%10s %15s %12s %15s %10s %12s %12s\n",
+        "stats",
+        "syscall",
+        "calls",
+        "bytes",
+        "errors",
+        "ops/s",
+        "MiB/s");
+
+    for (std::size_t i = 0; i < snapshot.m_counters.size () / 8; i++) {
+        const auto* counters = &snapshot.m_counters[i * 8];
+        if ((counters[0] + counters[2] + counters[3]) == 0) {
+            continue;
+        }
+
+        std::fprintf (stdout,
+            "%10s %15s %12" PRIu64 " %15" PRIu64 " %10" PRIu64 " %12.1f %12.2f\n",
+            region->m_names[i].m_stats_identifier,
+            region->m_names[i].m_entry_name,
+            counters[0],
+            counters[1],
+            counters[2],
+            (seconds > 0) ? static_cast<double> (counters[4]) / seconds : 0.0,
+            (seconds > 0) ? static_cast<double> (counters[5]) / seconds / (1024 * 1024) : 0.0);
+    }
+}
+
+int main (int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf (stderr,
+            "usage: %s <pid | region-path> [refresh-ms] [iterations] [path-prefix]\n",
+            argv[0]);
+        return 1;
+    }
+
+    // the region is given by its path, or by the pid of the process and the (configured)
+    // statistics_export_path prefix, which defaults to option_statistics_export_path
+    std::string target { argv[1] };
+    std::string prefix { (argc > 4) ? argv[4] : option_statistics_export_path };
+    auto path = (target.find ('/') != std::string::npos)
+        ? target
+        : export_region_path (prefix, std::stol (target));
+    long refresh_ms = (argc > 2) ? std::stol (argv[2]) : 1000;
+    long iterations = (argc > 3) ? std::stol (argv[3]) : 1;
+
+    const auto* region = map_region (path);
+    if (region == nullptr) {
+        return 1;
+    }
+
+    SnapshotCopy snapshot {};
+    uint64_t last_snapshot_id = UINT64_MAX;
+    for (long i = 0; i < iterations; i++) {
+        if (i > 0) {
+            std::this_thread::sleep_for (std::chrono::milliseconds (refresh_ms));
+        }
+
+        if (read_latest_snapshot (region, &snapshot)
+            && snapshot.m_snapshot_id != last_snapshot_id) {
+            print_snapshot (region, snapshot);
+            last_snapshot_id = snapshot.m_snapshot_id;
+        }
+    }
+
+    ::munmap (const_cast<ExportRegion*> (region), sizeof (ExportRegion));
+    return 0;
+}